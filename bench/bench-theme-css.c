@@ -0,0 +1,802 @@
+/*
+ * bench-theme-css: Benchmark of looking up styles of stylable objects
+ * 
+ * Copyright 2012-2021 Stephan Haller <nomad@froevel.de>
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ * 
+ * 
+ */
+
+/* This program measures styling in three parts:
+ *
+ * 1. It generates a style sheet and a tree of stylable objects and looks up
+ *    the style of each object in this tree repeatedly by calling
+ *    xfdashboard_theme_css_get_properties().
+ * 2. It parses the style sheets of each theme bundled with xfdashboard by
+ *    calling xfdashboard_theme_css_add_file().
+ * 3. It loads each bundled theme with xfdashboard_theme_load() by setting it
+ *    at a core object which is not initialized otherwise and invalidates the
+ *    style of each object in the tree repeatedly by calling
+ *    xfdashboard_stylable_invalidate() which applies the styles of this theme.
+ *    This needs the theme files built next to the style sheets, i.e. it is
+ *    skipped for themes not built in source tree.
+ *
+ * The stylable objects are plain GObjects implementing the XfdashboardStylable
+ * interface, so no stage is needed. But the CSS function @try_icons used by
+ * the bundled themes looks up icons at the icon theme of GTK+, so GTK+ and
+ * Clutter are initialized and a display is required. If no display is
+ * available the program exits with status 77 to indicate it was skipped.
+ *
+ * The timings are collected by the statistics functions of libxfdashboard
+ * and written to stdout when finished unless the environment variable
+ * XFDASHBOARD_STATISTICS requests another destination.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <glib.h>
+#include <glib/gstdio.h>
+#include <glib-object.h>
+#include <gio/gio.h>
+#include <gtk/gtk.h>
+#include <clutter/clutter.h>
+#include <libxfdashboard/stylable.h>
+#include <libxfdashboard/theme-css.h>
+#include <libxfdashboard/theme.h>
+#include <libxfdashboard/settings.h>
+#include <libxfdashboard/core.h>
+#include <libxfdashboard/statistics.h>
+
+
+/* IMPLEMENTATION: Stylable object used in benchmark */
+#define BENCH_TYPE_STYLABLE				(bench_stylable_get_type())
+#define BENCH_STYLABLE(obj)				(G_TYPE_CHECK_INSTANCE_CAST((obj), BENCH_TYPE_STYLABLE, BenchStylable))
+
+typedef struct _BenchStylable			BenchStylable;
+typedef struct _BenchStylableClass		BenchStylableClass;
+
+struct _BenchStylable
+{
+	/*< private >*/
+	/* Parent instance */
+	GObject					parent_instance;
+
+	/* Instance related */
+	BenchStylable			*parent;
+	gchar					*name;
+	gchar					*classes;
+	gchar					*pseudoClasses;
+	gchar					**values;
+};
+
+struct _BenchStylableClass
+{
+	/*< private >*/
+	/* Parent class */
+	GObjectClass			parent_class;
+};
+
+/* Properties */
+enum
+{
+	PROP_0,
+
+	/* From interface: XfdashboardStylable */
+	PROP_STYLE_CLASSES,
+	PROP_STYLE_PSEUDO_CLASSES,
+
+	PROP_LAST
+};
+
+/* Stylable properties set by invalidating style. The first ones are used by
+ * the bundled themes, the other ones by the generated style sheet.
+ */
+static const gchar		*_bench_stylable_properties[]=
+							{
+								"background-fill-color",
+								"background-type",
+								"outline-color",
+								"outline-width",
+								"property-0",
+								"property-1",
+								"property-2",
+								"property-3",
+							};
+
+GType bench_stylable_get_type(void) G_GNUC_CONST;
+static void _bench_stylable_stylable_iface_init(XfdashboardStylableInterface *iface);
+
+G_DEFINE_TYPE_WITH_CODE(BenchStylable,
+						bench_stylable,
+						G_TYPE_OBJECT,
+						G_IMPLEMENT_INTERFACE(XFDASHBOARD_TYPE_STYLABLE, _bench_stylable_stylable_iface_init))
+
+/* Get stylable properties of this stylable object */
+static void _bench_stylable_stylable_get_stylable_properties(XfdashboardStylable *inStylable,
+																GHashTable *ioStylableProperties)
+{
+	guint				i;
+
+	for(i=0; i<G_N_ELEMENTS(_bench_stylable_properties); i++)
+	{
+		xfdashboard_stylable_add_stylable_property(inStylable, ioStylableProperties, _bench_stylable_properties[i]);
+	}
+}
+
+/* Get name of this stylable object */
+static const gchar* _bench_stylable_stylable_get_name(XfdashboardStylable *inStylable)
+{
+	return(BENCH_STYLABLE(inStylable)->name);
+}
+
+/* Get parent stylable object of this stylable object */
+static XfdashboardStylable* _bench_stylable_stylable_get_parent(XfdashboardStylable *inStylable)
+{
+	BenchStylable		*self;
+
+	self=BENCH_STYLABLE(inStylable);
+	if(!self->parent) return(NULL);
+
+	return(XFDASHBOARD_STYLABLE(self->parent));
+}
+
+/* Get/set style classes of this stylable object */
+static const gchar* _bench_stylable_stylable_get_classes(XfdashboardStylable *inStylable)
+{
+	return(BENCH_STYLABLE(inStylable)->classes);
+}
+
+static void _bench_stylable_stylable_set_classes(XfdashboardStylable *inStylable, const gchar *inStyleClasses)
+{
+	BenchStylable		*self;
+
+	self=BENCH_STYLABLE(inStylable);
+	if(g_strcmp0(self->classes, inStyleClasses)!=0)
+	{
+		g_free(self->classes);
+		self->classes=g_strdup(inStyleClasses);
+	}
+}
+
+/* Get/set style pseudo-classes of this stylable object */
+static const gchar* _bench_stylable_stylable_get_pseudo_classes(XfdashboardStylable *inStylable)
+{
+	return(BENCH_STYLABLE(inStylable)->pseudoClasses);
+}
+
+static void _bench_stylable_stylable_set_pseudo_classes(XfdashboardStylable *inStylable, const gchar *inStylePseudoClasses)
+{
+	BenchStylable		*self;
+
+	self=BENCH_STYLABLE(inStylable);
+	if(g_strcmp0(self->pseudoClasses, inStylePseudoClasses)!=0)
+	{
+		g_free(self->pseudoClasses);
+		self->pseudoClasses=g_strdup(inStylePseudoClasses);
+	}
+}
+
+/* Interface initialization
+ * Set up default functions
+ */
+static void _bench_stylable_stylable_iface_init(XfdashboardStylableInterface *iface)
+{
+	iface->get_stylable_properties=_bench_stylable_stylable_get_stylable_properties;
+	iface->get_name=_bench_stylable_stylable_get_name;
+	iface->get_parent=_bench_stylable_stylable_get_parent;
+	iface->get_classes=_bench_stylable_stylable_get_classes;
+	iface->set_classes=_bench_stylable_stylable_set_classes;
+	iface->get_pseudo_classes=_bench_stylable_stylable_get_pseudo_classes;
+	iface->set_pseudo_classes=_bench_stylable_stylable_set_pseudo_classes;
+}
+
+/* Dispose this object */
+static void _bench_stylable_dispose(GObject *inObject)
+{
+	BenchStylable		*self=BENCH_STYLABLE(inObject);
+
+	/* Release allocated resources */
+	if(self->parent)
+	{
+		g_object_unref(self->parent);
+		self->parent=NULL;
+	}
+
+	/* Call parent's class dispose method */
+	G_OBJECT_CLASS(bench_stylable_parent_class)->dispose(inObject);
+}
+
+/* Finalize this object */
+static void _bench_stylable_finalize(GObject *inObject)
+{
+	BenchStylable		*self=BENCH_STYLABLE(inObject);
+
+	/* Release allocated resources */
+	g_free(self->name);
+	g_free(self->classes);
+	g_free(self->pseudoClasses);
+	g_strfreev(self->values);
+
+	/* Call parent's class finalize method */
+	G_OBJECT_CLASS(bench_stylable_parent_class)->finalize(inObject);
+}
+
+/* Set/get properties */
+static void _bench_stylable_set_property(GObject *inObject,
+											guint inPropID,
+											const GValue *inValue,
+											GParamSpec *inSpec)
+{
+	XfdashboardStylable	*self=XFDASHBOARD_STYLABLE(inObject);
+	BenchStylable		*stylable=BENCH_STYLABLE(inObject);
+
+	switch(inPropID)
+	{
+		case PROP_STYLE_CLASSES:
+			_bench_stylable_stylable_set_classes(self, g_value_get_string(inValue));
+			break;
+
+		case PROP_STYLE_PSEUDO_CLASSES:
+			_bench_stylable_stylable_set_pseudo_classes(self, g_value_get_string(inValue));
+			break;
+
+		default:
+			if(inPropID>=PROP_LAST &&
+				inPropID<PROP_LAST+G_N_ELEMENTS(_bench_stylable_properties))
+			{
+				g_free(stylable->values[inPropID-PROP_LAST]);
+				stylable->values[inPropID-PROP_LAST]=g_value_dup_string(inValue);
+				break;
+			}
+
+			G_OBJECT_WARN_INVALID_PROPERTY_ID(inObject, inPropID, inSpec);
+			break;
+	}
+}
+
+static void _bench_stylable_get_property(GObject *inObject,
+											guint inPropID,
+											GValue *outValue,
+											GParamSpec *inSpec)
+{
+	BenchStylable		*self=BENCH_STYLABLE(inObject);
+
+	switch(inPropID)
+	{
+		case PROP_STYLE_CLASSES:
+			g_value_set_string(outValue, self->classes);
+			break;
+
+		case PROP_STYLE_PSEUDO_CLASSES:
+			g_value_set_string(outValue, self->pseudoClasses);
+			break;
+
+		default:
+			if(inPropID>=PROP_LAST &&
+				inPropID<PROP_LAST+G_N_ELEMENTS(_bench_stylable_properties))
+			{
+				g_value_set_string(outValue, self->values[inPropID-PROP_LAST]);
+				break;
+			}
+
+			G_OBJECT_WARN_INVALID_PROPERTY_ID(inObject, inPropID, inSpec);
+			break;
+	}
+}
+
+/* Class initialization
+ * Override functions in parent classes and define properties
+ */
+static void bench_stylable_class_init(BenchStylableClass *klass)
+{
+	GObjectClass		*gobjectClass=G_OBJECT_CLASS(klass);
+	guint				i;
+
+	/* Override functions */
+	gobjectClass->dispose=_bench_stylable_dispose;
+	gobjectClass->finalize=_bench_stylable_finalize;
+	gobjectClass->set_property=_bench_stylable_set_property;
+	gobjectClass->get_property=_bench_stylable_get_property;
+
+	/* Define properties */
+	g_object_class_override_property(gobjectClass, PROP_STYLE_CLASSES, "style-classes");
+	g_object_class_override_property(gobjectClass, PROP_STYLE_PSEUDO_CLASSES, "style-pseudo-classes");
+
+	for(i=0; i<G_N_ELEMENTS(_bench_stylable_properties); i++)
+	{
+		g_object_class_install_property(gobjectClass,
+										PROP_LAST+i,
+										g_param_spec_string(_bench_stylable_properties[i],
+															_bench_stylable_properties[i],
+															"Stylable property set by invalidating style",
+															NULL,
+															G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS));
+	}
+}
+
+/* Object initialization
+ * Set up default values
+ */
+static void bench_stylable_init(BenchStylable *self)
+{
+	self->parent=NULL;
+	self->name=NULL;
+	self->classes=NULL;
+	self->pseudoClasses=NULL;
+	self->values=g_new0(gchar*, G_N_ELEMENTS(_bench_stylable_properties)+1);
+}
+
+/* Create new stylable object */
+static BenchStylable* _bench_stylable_new(BenchStylable *inParent,
+											gint inLevel,
+											gint inIndex)
+{
+	BenchStylable		*stylable;
+
+	stylable=BENCH_STYLABLE(g_object_new(BENCH_TYPE_STYLABLE, NULL));
+	if(inParent) stylable->parent=BENCH_STYLABLE(g_object_ref(inParent));
+	stylable->name=g_strdup_printf("node-%d-%d", inLevel, inIndex);
+	stylable->classes=g_strdup_printf("level-%d.kind-%d", inLevel, inIndex % 4);
+	if((inIndex % 5)==0) stylable->pseudoClasses=g_strdup("hover");
+		else if((inIndex % 7)==0) stylable->pseudoClasses=g_strdup("selected");
+
+	return(stylable);
+}
+
+
+/* IMPLEMENTATION: Benchmark */
+#ifdef BENCH_THEMES_DIR
+static gchar	*_bench_themes=(gchar*)BENCH_THEMES_DIR;
+#else
+static gchar	*_bench_themes=NULL;
+#endif
+static gint		_bench_depth=4;
+static gint		_bench_children=6;
+static gint		_bench_rules=600;
+static gint		_bench_iterations=10;
+
+static GOptionEntry _bench_options[]=
+{
+	{ "themes", 't', 0, G_OPTION_ARG_FILENAME, &_bench_themes, "Path to bundled themes", "PATH" },
+	{ "depth", 'd', 0, G_OPTION_ARG_INT, &_bench_depth, "Number of levels in tree of stylable objects", "N" },
+	{ "children", 'c', 0, G_OPTION_ARG_INT, &_bench_children, "Number of children of each stylable object", "N" },
+	{ "rules", 'r', 0, G_OPTION_ARG_INT, &_bench_rules, "Number of rules in generated style sheet", "N" },
+	{ "iterations", 'i', 0, G_OPTION_ARG_INT, &_bench_iterations, "Number of times the style of whole tree is looked up or invalidated", "N" },
+	{ NULL }
+};
+
+/* Generate style sheet with a mix of selectors used by themes, i.e. type,
+ * class, ID and pseudo-class selectors combined with ancestor and parent
+ * selectors.
+ */
+static gchar* _bench_create_style_sheet(gint inRules, gint inDepth, gint inChildren)
+{
+	GString				*styleSheet;
+	gint				i;
+	gint				level;
+	gint				kind;
+
+	styleSheet=g_string_new(NULL);
+	for(i=0; i<inRules; i++)
+	{
+		level=i % inDepth;
+		kind=i % 4;
+
+		switch(i % 6)
+		{
+			case 0:
+				g_string_append_printf(styleSheet, "BenchStylable.kind-%d", kind);
+				break;
+
+			case 1:
+				g_string_append_printf(styleSheet, ".level-%d .kind-%d", level, kind);
+				break;
+
+			case 2:
+				g_string_append_printf(styleSheet, "#node-%d-%d", level, i % MAX(inChildren, 1));
+				break;
+
+			case 3:
+				g_string_append_printf(styleSheet, ".level-%d > .kind-%d:hover", level, kind);
+				break;
+
+			case 4:
+				g_string_append_printf(styleSheet, "* .kind-%d:selected", kind);
+				break;
+
+			default:
+				g_string_append_printf(styleSheet, "BenchStylable .level-%d.kind-%d", level, kind);
+				break;
+		}
+
+		g_string_append_printf(styleSheet, "\n{\n\tproperty-%d: value-%d;\n}\n\n", i % 16, i);
+	}
+
+	return(g_string_free(styleSheet, FALSE));
+}
+
+/* Create tree of stylable objects and add all objects to list */
+static void _bench_create_tree(BenchStylable *inParent,
+								gint inLevel,
+								gint inDepth,
+								gint inChildren,
+								GPtrArray *ioStylables)
+{
+	BenchStylable		*stylable;
+	gint				i;
+
+	if(inLevel>inDepth) return;
+
+	for(i=0; i<inChildren; i++)
+	{
+		stylable=_bench_stylable_new(inParent, inLevel, i);
+		g_ptr_array_add(ioStylables, stylable);
+
+		_bench_create_tree(stylable, inLevel+1, inDepth, inChildren, ioStylables);
+	}
+}
+
+/* Parse style sheets of bundled theme at path as listed in its theme file */
+static void _bench_parse_theme_style_sheets(const gchar *inThemePath)
+{
+	gchar					*themeFile;
+	GKeyFile				*keyFile;
+	gchar					**styleSheets;
+	gchar					*styleSheetFile;
+	XfdashboardThemeCSS		*themeCSS;
+	gint64					statisticsBegin;
+	gint					i;
+	GError					*error=NULL;
+
+	/* Get list of style sheets from source of theme file */
+	themeFile=g_build_filename(inThemePath, "xfdashboard.theme.in.in", NULL);
+	keyFile=g_key_file_new();
+	if(!g_key_file_load_from_file(keyFile, themeFile, G_KEY_FILE_NONE, &error) ||
+		!(styleSheets=g_key_file_get_string_list(keyFile, "Xfdashboard Theme", "Style", NULL, &error)))
+	{
+		g_printerr("Could not get style sheets from %s: %s\n",
+					themeFile,
+					error ? error->message : "Unknown error");
+		if(error) g_error_free(error);
+		g_key_file_free(keyFile);
+		g_free(themeFile);
+		return;
+	}
+	g_key_file_free(keyFile);
+	g_free(themeFile);
+
+	/* Parse style sheets in the order listed */
+	themeCSS=xfdashboard_theme_css_new(inThemePath);
+
+	statisticsBegin=xfdashboard_statistics_begin();
+	for(i=0; styleSheets[i]; i++)
+	{
+		styleSheetFile=g_build_filename(inThemePath, styleSheets[i], NULL);
+		if(!xfdashboard_theme_css_add_file(themeCSS, styleSheetFile, i, &error))
+		{
+			g_printerr("Could not load style sheet %s: %s\n",
+						styleSheetFile,
+						error ? error->message : "Unknown error");
+			g_clear_error(&error);
+		}
+		g_free(styleSheetFile);
+	}
+	xfdashboard_statistics_end("bench.theme-css.parse", statisticsBegin);
+
+	/* Release allocated resources */
+	g_object_unref(themeCSS);
+	g_strfreev(styleSheets);
+}
+
+/* Load bundled theme at path by setting it at core and invalidate style of
+ * each object in tree with styles of this theme. The theme is made available
+ * to core by a symbolic link in the search path of themes.
+ */
+static void _bench_load_theme(XfdashboardCore *inCore,
+								const gchar *inSearchPath,
+								const gchar *inThemePath,
+								const gchar *inThemeName,
+								GPtrArray *inStylables)
+{
+	XfdashboardTheme		*theme;
+	gchar					*themeFile;
+	gchar					*linkPath;
+	gchar					*linkFile;
+	GFile					*link;
+	gint64					statisticsBegin;
+	gint					i;
+	guint					j;
+	GError					*error=NULL;
+
+	/* Theme can only be loaded if theme file was built in theme path */
+	themeFile=g_build_filename(inThemePath, "xfdashboard.theme", NULL);
+	if(!g_file_test(themeFile, G_FILE_TEST_IS_REGULAR))
+	{
+		g_print("# Skipping loading theme %s as %s was not built\n", inThemeName, themeFile);
+		g_free(themeFile);
+		return;
+	}
+	g_free(themeFile);
+
+	/* Link theme into search path as THEME/xfdashboard-1.0 */
+	linkPath=g_build_filename(inSearchPath, inThemeName, NULL);
+	linkFile=g_build_filename(linkPath, "xfdashboard-1.0", NULL);
+	link=g_file_new_for_path(linkFile);
+	if(g_mkdir_with_parents(linkPath, 0700)<0 ||
+		!g_file_make_symbolic_link(link, inThemePath, NULL, &error))
+	{
+		g_printerr("Could not link theme %s to %s: %s\n",
+					inThemeName,
+					linkFile,
+					error ? error->message : "Unknown error");
+		if(error) g_error_free(error);
+		g_object_unref(link);
+		g_rmdir(linkPath);
+		g_free(linkFile);
+		g_free(linkPath);
+		return;
+	}
+
+	/* Load theme. Loading the theme is also measured by the library itself. */
+	statisticsBegin=xfdashboard_statistics_begin();
+	g_object_set(inCore, "theme-name", inThemeName, NULL);
+	xfdashboard_statistics_end("bench.theme.load", statisticsBegin);
+
+	/* Invalidate style of each object in tree with styles of theme */
+	theme=xfdashboard_core_get_theme(inCore);
+	if(theme && g_strcmp0(xfdashboard_theme_get_theme_name(theme), inThemeName)==0)
+	{
+		for(i=0; i<_bench_iterations; i++)
+		{
+			statisticsBegin=xfdashboard_statistics_begin();
+
+			for(j=0; j<inStylables->len; j++)
+			{
+				xfdashboard_stylable_invalidate(XFDASHBOARD_STYLABLE(g_ptr_array_index(inStylables, j)));
+			}
+
+			xfdashboard_statistics_end("bench.tree-invalidate", statisticsBegin);
+		}
+	}
+		else
+		{
+			g_printerr("Could not load theme %s\n", inThemeName);
+		}
+
+	/* Remove link of theme */
+	g_file_delete(link, NULL, NULL);
+	g_rmdir(linkPath);
+
+	/* Release allocated resources */
+	g_object_unref(link);
+	g_free(linkFile);
+	g_free(linkPath);
+}
+
+/* Main entry point */
+int main(int argc, char **argv)
+{
+	GOptionContext			*context;
+	XfdashboardThemeCSS		*themeCSS;
+	XfdashboardSettings		*settings;
+	XfdashboardCore			*core;
+	GPtrArray				*stylables;
+	gchar					*styleSheet;
+	gchar					*styleSheetFile;
+	gchar					*searchPath;
+	const gchar				*searchPaths[2];
+	GHashTable				*properties;
+	gint					fd;
+	gint					i;
+	guint					j;
+	gint64					statisticsBegin;
+	GError					*error=NULL;
+
+	/* Parse command-line options */
+	context=g_option_context_new(NULL);
+	g_option_context_set_summary(context, "Benchmark of looking up styles of stylable objects");
+	g_option_context_add_main_entries(context, _bench_options, NULL);
+	if(!g_option_context_parse(context, &argc, &argv, &error))
+	{
+		g_printerr("%s\n", error ? error->message : "Unknown error");
+		if(error) g_error_free(error);
+		g_option_context_free(context);
+		return(1);
+	}
+	g_option_context_free(context);
+
+	if(_bench_depth<1 || _bench_children<1 || _bench_rules<1 || _bench_iterations<1)
+	{
+		g_printerr("All options must be positive numbers\n");
+		return(1);
+	}
+
+	/* Collect statistics and write them to stdout if not requested otherwise.
+	 * This must be done before any function of libxfdashboard is called.
+	 */
+	g_setenv("XFDASHBOARD_STATISTICS", "stdout", FALSE);
+
+	/* Initialize GTK+ and Clutter as the CSS function @try_icons needs the
+	 * icon theme of GTK+. Exit with status 77 to indicate that benchmark was
+	 * skipped if no display is available.
+	 */
+	if(!gtk_init_check(&argc, &argv) ||
+		clutter_init(&argc, &argv)!=CLUTTER_INIT_SUCCESS)
+	{
+		g_printerr("Skipping benchmark as GTK+ and Clutter could not be initialized\n");
+		return(77);
+	}
+
+	/* Create core object with settings to look up themes at a temporary
+	 * search path. The core is not initialized as only its theme and settings
+	 * are needed. It must be created before any function of libxfdashboard
+	 * creates the default core object.
+	 */
+	searchPath=g_dir_make_tmp("xfdashboard-bench-XXXXXX", &error);
+	if(!searchPath)
+	{
+		g_printerr("Could not create search path for themes: %s\n", error ? error->message : "Unknown error");
+		if(error) g_error_free(error);
+		return(1);
+	}
+
+	searchPaths[0]=searchPath;
+	searchPaths[1]=NULL;
+	settings=XFDASHBOARD_SETTINGS(g_object_new(XFDASHBOARD_TYPE_SETTINGS,
+												"theme-search-paths", searchPaths,
+												NULL));
+	core=XFDASHBOARD_CORE(g_object_new(XFDASHBOARD_TYPE_CORE,
+										"settings", settings,
+										NULL));
+
+	/* Generate style sheet and load it */
+	fd=g_file_open_tmp("xfdashboard-bench-XXXXXX.css", &styleSheetFile, &error);
+	if(fd<0)
+	{
+		g_printerr("Could not create style sheet: %s\n", error ? error->message : "Unknown error");
+		if(error) g_error_free(error);
+		g_object_unref(core);
+		g_object_unref(settings);
+		g_rmdir(searchPath);
+		g_free(searchPath);
+		return(1);
+	}
+	g_close(fd, NULL);
+
+	styleSheet=_bench_create_style_sheet(_bench_rules, _bench_depth, _bench_children);
+	if(!g_file_set_contents(styleSheetFile, styleSheet, -1, &error))
+	{
+		g_printerr("Could not write style sheet %s: %s\n",
+					styleSheetFile,
+					error ? error->message : "Unknown error");
+		if(error) g_error_free(error);
+		g_unlink(styleSheetFile);
+		g_free(styleSheetFile);
+		g_free(styleSheet);
+		g_object_unref(core);
+		g_object_unref(settings);
+		g_rmdir(searchPath);
+		g_free(searchPath);
+		return(1);
+	}
+	g_free(styleSheet);
+
+	themeCSS=xfdashboard_theme_css_new(g_get_tmp_dir());
+	if(!xfdashboard_theme_css_add_file(themeCSS, styleSheetFile, 0, &error))
+	{
+		g_printerr("Could not load style sheet %s: %s\n",
+					styleSheetFile,
+					error ? error->message : "Unknown error");
+		if(error) g_error_free(error);
+		g_object_unref(themeCSS);
+		g_unlink(styleSheetFile);
+		g_free(styleSheetFile);
+		g_object_unref(core);
+		g_object_unref(settings);
+		g_rmdir(searchPath);
+		g_free(searchPath);
+		return(1);
+	}
+	g_unlink(styleSheetFile);
+	g_free(styleSheetFile);
+
+	/* Create tree of stylable objects */
+	stylables=g_ptr_array_new_with_free_func(g_object_unref);
+	_bench_create_tree(NULL, 0, _bench_depth-1, _bench_children, stylables);
+
+	g_print("# %d rules, %u stylable objects, %d iterations\n",
+				_bench_rules,
+				stylables->len,
+				_bench_iterations);
+
+	/* Look up style of each object in tree */
+	for(i=0; i<_bench_iterations; i++)
+	{
+		statisticsBegin=xfdashboard_statistics_begin();
+
+		for(j=0; j<stylables->len; j++)
+		{
+			properties=xfdashboard_theme_css_get_properties(themeCSS, XFDASHBOARD_STYLABLE(g_ptr_array_index(stylables, j)));
+			xfdashboard_statistics_add("bench.properties", g_hash_table_size(properties));
+			g_hash_table_unref(properties);
+		}
+
+		xfdashboard_statistics_end("bench.tree", statisticsBegin);
+	}
+
+	/* Parse style sheets of each bundled theme, load it and invalidate style
+	 * of each object in tree with it.
+	 */
+	if(_bench_themes)
+	{
+		GDir				*themes;
+		const gchar			*themeName;
+		gchar				*themePath;
+		gchar				*themeFile;
+
+		themes=g_dir_open(_bench_themes, 0, &error);
+		if(!themes)
+		{
+			g_printerr("Could not open themes at %s: %s\n",
+						_bench_themes,
+						error ? error->message : "Unknown error");
+			g_clear_error(&error);
+		}
+
+		while(themes && (themeName=g_dir_read_name(themes)))
+		{
+			themePath=g_build_filename(_bench_themes, themeName, NULL);
+			themeFile=g_build_filename(themePath, "xfdashboard.theme.in.in", NULL);
+
+			if(g_file_test(themeFile, G_FILE_TEST_IS_REGULAR))
+			{
+				g_print("# Theme %s\n", themeName);
+
+				for(i=0; i<_bench_iterations; i++)
+				{
+					_bench_parse_theme_style_sheets(themePath);
+				}
+
+				_bench_load_theme(core, searchPath, themePath, themeName, stylables);
+			}
+
+			g_free(themeFile);
+			g_free(themePath);
+		}
+
+		if(themes) g_dir_close(themes);
+	}
+		else
+		{
+			g_print("# Skipping bundled themes as no path to them was given\n");
+		}
+
+	/* Write statistics */
+	xfdashboard_statistics_dump();
+
+	/* Release allocated resources */
+	g_ptr_array_unref(stylables);
+	g_object_unref(themeCSS);
+	g_object_unref(core);
+	g_object_unref(settings);
+	g_rmdir(searchPath);
+	g_free(searchPath);
+
+	return(0);
+}
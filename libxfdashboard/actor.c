@@ -34,6 +34,7 @@
 #include <libxfdashboard/focusable.h>
 #include <libxfdashboard/animation.h>
 #include <libxfdashboard/utils.h>
+#include <libxfdashboard/profiler.h>
 #include <libxfdashboard/compat.h>
 #include <libxfdashboard/debug.h>
 #include <math.h>
@@ -150,7 +151,7 @@ static void _xfdashboard_actor_animation_entry_free_dispose_callback(gpointer in
 }
 
 /* Invalidate all stylable children recursively beginning at given actor */
-static void _xfdashboard_actor_invalidate_recursive(ClutterActor *inActor)
+static void _xfdashboard_actor_invalidate_recursive_internal(ClutterActor *inActor)
 {
 	ClutterActor			*child;
 	ClutterActorIter		actorIter;
@@ -173,10 +174,19 @@ static void _xfdashboard_actor_invalidate_recursive(ClutterActor *inActor)
 		 * iterated over its children then. In both cases the child will
 		 * be invalidated.
 		 */
-		_xfdashboard_actor_invalidate_recursive(child);
+		_xfdashboard_actor_invalidate_recursive_internal(child);
 	}
 }
 
+static void _xfdashboard_actor_invalidate_recursive(ClutterActor *inActor)
+{
+	gint64					profilerBegin;
+
+	profilerBegin=xfdashboard_profiler_begin("style");
+	_xfdashboard_actor_invalidate_recursive_internal(inActor);
+	xfdashboard_profiler_end("style", "style.invalidate-recursive", profilerBegin);
+}
+
 /* Get parameter specification of stylable properties and add them to hashtable.
  * If requested do it recursively over all parent classes.
  */
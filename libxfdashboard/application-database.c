@@ -27,10 +27,18 @@
 #endif
 
 #include <glib/gi18n-lib.h>
+#include <glib/gstdio.h>
+#include <errno.h>
 
 #include <libxfdashboard/core.h>
 #include <libxfdashboard/application-database.h>
 #include <libxfdashboard/desktop-app-info.h>
+#include <libxfdashboard/directory-watcher.h>
+#include <libxfdashboard/settings.h>
+#include <libxfdashboard/statistics.h>
+#include <libxfdashboard/profiler.h>
+#include <libxfdashboard/marshal.h>
+#include <libxfdashboard/utils.h>
 #include <libxfdashboard/compat.h>
 #include <libxfdashboard/debug.h>
 
@@ -48,7 +56,20 @@ struct _XfdashboardApplicationDatabasePrivate
 	guint				appsMenuReloadRequiredID;
 
 	GHashTable			*applications;
-	GList				*appDirMonitors;
+	XfdashboardDirectoryWatcher	*appDirWatcher;
+	guint				appDirWatcherChangedID;
+
+	GHashTable			*indexedApplications;
+	GHashTable			*startupWMClassIndex;
+	GHashTable			*executableIndex;
+	GHashTable			*executableBasenameIndex;
+	GHashTable			*caseFoldedDesktopIDIndex;
+	GHashTable			*desktopIDSuffixIndex;
+
+	GHashTable			*pendingChanges;
+	guint				pendingChangesTimeoutID;
+	gint64				pendingChangesSince;
+	gboolean			pendingMenuReload;
 };
 
 G_DEFINE_TYPE_WITH_PRIVATE(XfdashboardApplicationDatabase,
@@ -75,6 +96,8 @@ enum
 	SIGNAL_APPLICATION_ADDED,
 	SIGNAL_APPLICATION_REMOVED,
 
+	SIGNAL_APPLICATIONS_CHANGED,
+
 	SIGNAL_LAST
 };
 
@@ -83,16 +106,103 @@ static guint XfdashboardApplicationDatabaseSignals[SIGNAL_LAST]={ 0, };
 
 /* IMPLEMENTATION: Private variables and methods */
 
-typedef struct _XfdashboardApplicationDatabaseFileMonitorData	XfdashboardApplicationDatabaseFileMonitorData;
-struct _XfdashboardApplicationDatabaseFileMonitorData
+/* The cache of application database stores the result of scanning all search
+ * paths for desktop files. It contains:
+ * - the version of cache format,
+ * - the key the cache was created for,
+ * - the list of scanned directories (path, modification time or -1 if missing),
+ * - the list of desktop files which won for their desktop ID in the order
+ *   they were found (desktop ID, path, modification time, size and the data
+ *   parsed from desktop file or nothing if it is invalid).
+ * As long as no directory was modified, no desktop file was added, removed
+ * or renamed, so scanning the search paths can be skipped and only desktop
+ * files whose modification time or size changed need to be parsed again.
+ * All other desktop app infos are created from the data parsed before.
+ * Modification times are stored in nanoseconds.
+ */
+#define XFDASHBOARD_APPLICATION_DATABASE_CACHE_VERSION		2
+#define XFDASHBOARD_APPLICATION_DATABASE_CACHE_ENTRY_TYPE	"(ssxxm" XFDASHBOARD_DESKTOP_APP_INFO_DATA_TYPE ")"
+#define XFDASHBOARD_APPLICATION_DATABASE_CACHE_TYPE			"(usa(sx)a" XFDASHBOARD_APPLICATION_DATABASE_CACHE_ENTRY_TYPE ")"
+#define XFDASHBOARD_APPLICATION_DATABASE_CACHE_FILENAME		"applications.cache"
+
+/* Minimum number of desktop files to parse at a thread pool */
+#define XFDASHBOARD_APPLICATION_DATABASE_PARSE_THREAD_MIN_FILES	32
+
+typedef struct _XfdashboardApplicationDatabaseCacheEntry	XfdashboardApplicationDatabaseCacheEntry;
+struct _XfdashboardApplicationDatabaseCacheEntry
+{
+	gchar				*desktopID;
+	gchar				*path;
+	gint64				mtime;
+	gint64				size;
+	GVariant			*data;
+};
+
+typedef struct _XfdashboardApplicationDatabaseCacheDirectory	XfdashboardApplicationDatabaseCacheDirectory;
+struct _XfdashboardApplicationDatabaseCacheDirectory
+{
+	gchar				*path;
+	gint64				mtime;
+};
+
+/* A desktop file found while scanning search paths which wins for its desktop ID */
+typedef struct _XfdashboardApplicationDatabaseScanEntry	XfdashboardApplicationDatabaseScanEntry;
+struct _XfdashboardApplicationDatabaseScanEntry
+{
+	gchar				*desktopID;
+	GFile				*file;
+	gchar				*path;
+	gint64				mtime;
+	gint64				size;
+	gboolean			isCached;
+	GVariant			*data;
+};
+
+typedef struct _XfdashboardApplicationDatabaseCache		XfdashboardApplicationDatabaseCache;
+struct _XfdashboardApplicationDatabaseCache
+{
+	GPtrArray			*directories;
+	GPtrArray			*entries;
+	GHashTable			*entriesByPath;
+	gboolean			isModified;
+};
+
+/* The keys an application was added to indexes with */
+typedef struct _XfdashboardApplicationDatabaseIndexKeys	XfdashboardApplicationDatabaseIndexKeys;
+struct _XfdashboardApplicationDatabaseIndexKeys
 {
-	GFile				*path;
-	GFileMonitor		*monitor;
-	guint				changedID;
+	GAppInfo			*appInfo;
+	gulong				changedID;
+
+	gchar				*startupWMClass;
+	gchar				*executable;
+	gchar				*executableBasename;
+	gchar				*caseFoldedDesktopID;
+	GPtrArray			*desktopIDSuffixes;
 };
 
+/* Changes at desktop files and application menus are collected for the
+ * delay set in settings after the last change before they are applied at
+ * once. But a continuous stream of changes must not postpone applying them
+ * forever, so they are applied at latest after this factor of the delay.
+ */
+#define XFDASHBOARD_APPLICATION_DATABASE_MAX_RELOAD_DELAY_FACTOR	10
+
+/* The kind of change at a desktop ID while applying collected changes */
+typedef enum
+{
+	XFDASHBOARD_APPLICATION_DATABASE_CHANGE_ADDED=0,
+	XFDASHBOARD_APPLICATION_DATABASE_CHANGE_CHANGED,
+	XFDASHBOARD_APPLICATION_DATABASE_CHANGE_REMOVED
+} XfdashboardApplicationDatabaseChange;
+
 /* Forward declarations */
 static gboolean _xfdashboard_application_database_load_application_menu(XfdashboardApplicationDatabase *self, GError **outError);
+static guint _xfdashboard_application_database_get_reload_delay(XfdashboardApplicationDatabase *self);
+static void _xfdashboard_application_database_schedule_pending_changes(XfdashboardApplicationDatabase *self);
+static void _xfdashboard_application_database_change_set_add(GHashTable *ioChanges,
+																const gchar *inDesktopID,
+																XfdashboardApplicationDatabaseChange inChange);
 
 /* Callback function for hash table iterator to add each value to a list of type GList */
 static void _xfdashboard_application_database_add_hashtable_item_to_list(gpointer inKey,
@@ -109,210 +219,404 @@ static void _xfdashboard_application_database_add_hashtable_item_to_list(gpointe
 	*applicationsList=g_list_prepend(*applicationsList, g_object_ref(G_OBJECT(inValue)));
 }
 
-/* Application menu needs to be reloaded */
-static void _xfdashboard_application_database_on_application_menu_reload_required(XfdashboardApplicationDatabase *self,
-																					gpointer inUserData)
+/* Free keys of an indexed application */
+static void _xfdashboard_application_database_index_keys_free(XfdashboardApplicationDatabaseIndexKeys *inKeys)
 {
-	GError	*error=NULL;
+	g_return_if_fail(inKeys);
+
+	if(inKeys->changedID) g_signal_handler_disconnect(inKeys->appInfo, inKeys->changedID);
+	if(inKeys->startupWMClass) g_free(inKeys->startupWMClass);
+	if(inKeys->executable) g_free(inKeys->executable);
+	if(inKeys->executableBasename) g_free(inKeys->executableBasename);
+	if(inKeys->caseFoldedDesktopID) g_free(inKeys->caseFoldedDesktopID);
+	if(inKeys->desktopIDSuffixes) g_ptr_array_unref(inKeys->desktopIDSuffixes);
+	g_free(inKeys);
+}
 
-	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self));
-	g_return_if_fail(GARCON_IS_MENU(inUserData));
+/* Add application to or remove application from list of applications for key
+ * in index. The lists are not freed by hash table of index, so the head of a
+ * list can be replaced without freeing it.
+ */
+static void _xfdashboard_application_database_index_insert(GHashTable *inIndex,
+															const gchar *inKey,
+															GAppInfo *inAppInfo)
+{
+	GList									*apps;
 
-	/* Reload application menu. This also emits all necessary signals. */
-	XFDASHBOARD_DEBUG(self, APPLICATIONS,
-						"Menu '%s' changed and requires a reload of application menu",
-						garcon_menu_element_get_name(GARCON_MENU_ELEMENT(inUserData)));
-	if(!_xfdashboard_application_database_load_application_menu(self, &error))
-	{
-		g_critical("Could not reload application menu: %s",
-					error ? error->message : "Unknown error");
+	g_return_if_fail(inIndex);
+	g_return_if_fail(G_IS_APP_INFO(inAppInfo));
 
-		/* Release allocated resources */
-		if(error) g_error_free(error);
-	}
+	if(!inKey || !*inKey) return;
+
+	apps=(GList*)g_hash_table_lookup(inIndex, inKey);
+	if(!apps) g_hash_table_insert(inIndex, g_strdup(inKey), g_list_append(NULL, inAppInfo));
+		else apps=g_list_append(apps, inAppInfo);
 }
 
-/* Create a new data structure for file monitor */
-static XfdashboardApplicationDatabaseFileMonitorData* _xfdashboard_application_database_monitor_data_new(GFile *inPath)
+static void _xfdashboard_application_database_index_remove(GHashTable *inIndex,
+															const gchar *inKey,
+															GAppInfo *inAppInfo)
 {
-	XfdashboardApplicationDatabaseFileMonitorData	*monitorData;
+	GList									*apps;
+	GList									*newApps;
 
-	g_return_val_if_fail(G_IS_FILE(inPath), NULL);
+	g_return_if_fail(inIndex);
+	g_return_if_fail(G_IS_APP_INFO(inAppInfo));
 
-	/* Allocate memory for file monitor data structure */
-	monitorData=g_new0(XfdashboardApplicationDatabaseFileMonitorData, 1);
-	if(!monitorData) return(NULL);
+	if(!inKey || !*inKey) return;
 
-	monitorData->path=g_object_ref(inPath);
+	apps=(GList*)g_hash_table_lookup(inIndex, inKey);
+	if(!apps) return;
 
-	/* Return newly create and initialized file monitor data structure */
-	return(monitorData);
+	newApps=g_list_remove(apps, inAppInfo);
+	if(!newApps) g_hash_table_remove(inIndex, inKey);
+		else if(newApps!=apps) g_hash_table_insert(inIndex, g_strdup(inKey), newApps);
 }
 
-/* Free a file monitor data structure */
-static void _xfdashboard_application_database_monitor_data_free(XfdashboardApplicationDatabaseFileMonitorData *inData)
+/* Free lists of applications in index and index itself */
+static void _xfdashboard_application_database_index_free(GHashTable *inIndex)
 {
-	g_return_if_fail(inData);
+	GHashTableIter							iter;
+	GList									*apps;
 
-	/* Release each data in file monitor structure */
-	if(inData->path) g_object_unref(inData->path);
-	if(inData->monitor)
-	{
-		if(inData->changedID)
-		{
-			g_signal_handler_disconnect(inData->monitor, inData->changedID);
-		}
+	g_return_if_fail(inIndex);
 
-		g_object_unref(inData->monitor);
+	g_hash_table_iter_init(&iter, inIndex);
+	while(g_hash_table_iter_next(&iter, NULL, (gpointer*)&apps))
+	{
+		g_list_free(apps);
 	}
 
-	/* Release allocated memory */
-	g_free(inData);
+	g_hash_table_destroy(inIndex);
 }
 
-/* Find file monitor data structure */
-static XfdashboardApplicationDatabaseFileMonitorData* _xfdashboard_application_database_monitor_data_find_by_monitor(XfdashboardApplicationDatabase *self,
-																														GFileMonitor *inMonitor)
+/* Forward declaration as indexed applications are indexed again if they changed */
+static void _xfdashboard_application_database_on_indexed_application_changed(XfdashboardDesktopAppInfo *inAppInfo,
+																				gpointer inUserData);
+
+/* Add application to all indexes */
+static void _xfdashboard_application_database_index_add_application(XfdashboardApplicationDatabase *self,
+																	GAppInfo *inAppInfo)
 {
-	XfdashboardApplicationDatabasePrivate			*priv;
-	GList											*iter;
-	XfdashboardApplicationDatabaseFileMonitorData	*iterData;
+	XfdashboardApplicationDatabasePrivate	*priv;
+	XfdashboardApplicationDatabaseIndexKeys	*keys;
+	const gchar								*desktopID;
+	const gchar								*executable;
+	const gchar								*iter;
+	guint									i;
 
-	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self), NULL);
-	g_return_val_if_fail(G_IS_FILE_MONITOR(inMonitor), NULL);
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self));
+	g_return_if_fail(G_IS_APP_INFO(inAppInfo));
 
 	priv=self->priv;
 
-	/* Iterate through list of registered file monitor data structure and
-	 * lookup the one matching requested file monitor.
+	/* Do nothing if indexes were not built yet or application is indexed already */
+	if(!priv->indexedApplications) return;
+	if(g_hash_table_contains(priv->indexedApplications, inAppInfo)) return;
+
+	/* Determine keys of application for all indexes. Desktop app infos serve
+	 * the StartupWMClass key, the executable and the desktop ID from the data
+	 * they were created from, so do not use any other information here as it
+	 * would load the desktop file.
 	 */
-	for(iter=priv->appDirMonitors; iter; iter=g_list_next(iter))
+	keys=g_new0(XfdashboardApplicationDatabaseIndexKeys, 1);
+	keys->appInfo=inAppInfo;
+	keys->desktopIDSuffixes=g_ptr_array_new_with_free_func(g_free);
+
+	if(XFDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo) &&
+		xfdashboard_desktop_app_info_has_key(XFDASHBOARD_DESKTOP_APP_INFO(inAppInfo), G_KEY_FILE_DESKTOP_KEY_STARTUP_WM_CLASS))
+	{
+		keys->startupWMClass=xfdashboard_desktop_app_info_get_string(XFDASHBOARD_DESKTOP_APP_INFO(inAppInfo), G_KEY_FILE_DESKTOP_KEY_STARTUP_WM_CLASS);
+	}
+
+	executable=g_app_info_get_executable(inAppInfo);
+	if(executable)
 	{
-		iterData=(XfdashboardApplicationDatabaseFileMonitorData*)iter->data;
-		if(iterData &&
-			iterData->monitor &&
-			iterData->monitor==inMonitor)
+		if(g_path_is_absolute(executable)) keys->executable=g_strdup(executable);
+		keys->executableBasename=g_path_get_basename(executable);
+	}
+
+	desktopID=g_app_info_get_id(inAppInfo);
+	if(desktopID)
+	{
+		keys->caseFoldedDesktopID=g_utf8_casefold(desktopID, -1);
+
+		/* Desktop IDs of desktop files in sub-directories are prefixed with
+		 * the sub-directories' names followed by a dash, so remember every
+		 * part of desktop ID following a dash.
+		 */
+		for(iter=strchr(desktopID, '-'); iter; iter=strchr(iter+1, '-'))
 		{
-			return(iterData);
+			g_ptr_array_add(keys->desktopIDSuffixes, g_strdup(iter+1));
 		}
 	}
 
-	/* If we get here we could not find a file monitor data structure
-	 * matching the requested file monitor so return NULL.
-	 */
-	return(NULL);
+	/* Add application to indexes */
+	_xfdashboard_application_database_index_insert(priv->startupWMClassIndex, keys->startupWMClass, inAppInfo);
+	_xfdashboard_application_database_index_insert(priv->executableIndex, keys->executable, inAppInfo);
+	_xfdashboard_application_database_index_insert(priv->executableBasenameIndex, keys->executableBasename, inAppInfo);
+	_xfdashboard_application_database_index_insert(priv->caseFoldedDesktopIDIndex, keys->caseFoldedDesktopID, inAppInfo);
+	for(i=0; i<keys->desktopIDSuffixes->len; i++)
+	{
+		_xfdashboard_application_database_index_insert(priv->desktopIDSuffixIndex, g_ptr_array_index(keys->desktopIDSuffixes, i), inAppInfo);
+	}
+
+	/* Get notified when application changes to index it again */
+	if(XFDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo))
+	{
+		keys->changedID=g_signal_connect(inAppInfo,
+											"changed",
+											G_CALLBACK(_xfdashboard_application_database_on_indexed_application_changed),
+											self);
+	}
+
+	g_hash_table_insert(priv->indexedApplications, inAppInfo, keys);
 }
 
-static XfdashboardApplicationDatabaseFileMonitorData* _xfdashboard_application_database_monitor_data_find_by_file(XfdashboardApplicationDatabase *self,
-																													GFile *inPath)
+/* Remove application from all indexes */
+static void _xfdashboard_application_database_index_remove_application(XfdashboardApplicationDatabase *self,
+																		GAppInfo *inAppInfo)
 {
-	XfdashboardApplicationDatabasePrivate			*priv;
-	GList											*iter;
-	XfdashboardApplicationDatabaseFileMonitorData	*iterData;
+	XfdashboardApplicationDatabasePrivate	*priv;
+	XfdashboardApplicationDatabaseIndexKeys	*keys;
+	guint									i;
 
-	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self), NULL);
-	g_return_val_if_fail(G_IS_FILE(inPath), NULL);
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self));
+	g_return_if_fail(G_IS_APP_INFO(inAppInfo));
 
 	priv=self->priv;
 
-	/* Iterate through list of registered file monitor data structure and
-	 * lookup the one matching requested path.
-	 */
-	for(iter=priv->appDirMonitors; iter; iter=g_list_next(iter))
+	/* Do nothing if indexes were not built yet or application is not indexed */
+	if(!priv->indexedApplications) return;
+
+	keys=(XfdashboardApplicationDatabaseIndexKeys*)g_hash_table_lookup(priv->indexedApplications, inAppInfo);
+	if(!keys) return;
+
+	/* Remove application from indexes by the keys it was added with */
+	_xfdashboard_application_database_index_remove(priv->startupWMClassIndex, keys->startupWMClass, inAppInfo);
+	_xfdashboard_application_database_index_remove(priv->executableIndex, keys->executable, inAppInfo);
+	_xfdashboard_application_database_index_remove(priv->executableBasenameIndex, keys->executableBasename, inAppInfo);
+	_xfdashboard_application_database_index_remove(priv->caseFoldedDesktopIDIndex, keys->caseFoldedDesktopID, inAppInfo);
+	for(i=0; i<keys->desktopIDSuffixes->len; i++)
 	{
-		iterData=(XfdashboardApplicationDatabaseFileMonitorData*)iter->data;
-		if(iterData &&
-			iterData->path &&
-			g_file_equal(iterData->path, inPath))
-		{
-			return(iterData);
-		}
+		_xfdashboard_application_database_index_remove(priv->desktopIDSuffixIndex, g_ptr_array_index(keys->desktopIDSuffixes, i), inAppInfo);
 	}
 
-	/* If we get here we could not find a file monitor data structure
-	 * matching the requested path so return NULL.
-	 */
-	return(NULL);
+	/* Removing keys from hash table frees them */
+	g_hash_table_remove(priv->indexedApplications, inAppInfo);
 }
 
-/* A directory containing desktop files has changed */
-static void _xfdashboard_application_database_on_file_monitor_changed(XfdashboardApplicationDatabase *self,
-																		GFile *inFile,
-																		GFile *inOtherFile,
-																		GFileMonitorEvent inEventType,
-																		gpointer inUserData)
+/* An indexed application changed, e.g. its desktop file was modified, so index it again */
+static void _xfdashboard_application_database_on_indexed_application_changed(XfdashboardDesktopAppInfo *inAppInfo,
+																				gpointer inUserData)
 {
-	XfdashboardApplicationDatabasePrivate				*priv;
-	GFileMonitor										*monitor;
-	XfdashboardApplicationDatabaseFileMonitorData		*monitorData;
-	gchar												*filePath;
+	XfdashboardApplicationDatabase			*self;
+
+	g_return_if_fail(XFDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo));
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(inUserData));
+
+	self=XFDASHBOARD_APPLICATION_DATABASE(inUserData);
+
+	_xfdashboard_application_database_index_remove_application(self, G_APP_INFO(inAppInfo));
+	_xfdashboard_application_database_index_add_application(self, G_APP_INFO(inAppInfo));
+}
+
+/* Build indexes of all applications if not done yet. Building indexes is
+ * deferred until the first lookup. The keys of applications created while
+ * loading the database are taken from the data parsed at the thread pool or
+ * taken from cache, so no desktop file is loaded to build the indexes.
+ */
+static void _xfdashboard_application_database_ensure_indexes(XfdashboardApplicationDatabase *self)
+{
+	XfdashboardApplicationDatabasePrivate	*priv;
+	GHashTableIter							iter;
+	GAppInfo								*appInfo;
+	gint64									profilerBegin;
 
 	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self));
-	g_return_if_fail(G_IS_FILE_MONITOR(inUserData));
 
 	priv=self->priv;
-	monitor=G_FILE_MONITOR(inUserData);
 
-	/* Find file monitor data structure of file monitor emitting this signal */
-	monitorData=_xfdashboard_application_database_monitor_data_find_by_monitor(self, monitor);
-	if(!monitorData)
+	/* Do nothing if indexes exist already or there are no applications */
+	if(priv->indexedApplications || !priv->applications) return;
+
+	profilerBegin=xfdashboard_profiler_begin("applications");
+
+	/* Create indexes */
+	priv->indexedApplications=g_hash_table_new_full(g_direct_hash,
+													g_direct_equal,
+													NULL,
+													(GDestroyNotify)_xfdashboard_application_database_index_keys_free);
+	priv->startupWMClassIndex=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+	priv->executableIndex=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+	priv->executableBasenameIndex=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+	priv->caseFoldedDesktopIDIndex=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+	priv->desktopIDSuffixIndex=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+
+	/* Add all applications to indexes */
+	g_hash_table_iter_init(&iter, priv->applications);
+	while(g_hash_table_iter_next(&iter, NULL, (gpointer*)&appInfo))
 	{
-		g_warning("Received event from unknown file monitor");
-		return;
+		_xfdashboard_application_database_index_add_application(self, appInfo);
 	}
 
-	/* Get file path */
-	filePath=g_file_get_path(inFile);
+	xfdashboard_profiler_end("applications", "application-database.build-indexes", profilerBegin);
 
-	/* Check if a new directory was created */
-	if(inEventType==G_FILE_MONITOR_EVENT_CREATED &&
-		g_file_query_file_type(inFile, G_FILE_QUERY_INFO_NONE, NULL)==G_FILE_TYPE_DIRECTORY)
+	XFDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Built indexes for %u applications",
+						g_hash_table_size(priv->indexedApplications));
+}
+
+/* Destroy indexes of all applications */
+static void _xfdashboard_application_database_clear_indexes(XfdashboardApplicationDatabase *self)
+{
+	XfdashboardApplicationDatabasePrivate	*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self));
+
+	priv=self->priv;
+
+	if(priv->indexedApplications)
 	{
-		XfdashboardApplicationDatabaseFileMonitorData	*fileMonitorData;
-		GError											*error;
+		g_hash_table_destroy(priv->indexedApplications);
+		priv->indexedApplications=NULL;
+	}
 
-		error=NULL;
+	if(priv->startupWMClassIndex)
+	{
+		_xfdashboard_application_database_index_free(priv->startupWMClassIndex);
+		priv->startupWMClassIndex=NULL;
+	}
 
-		XFDASHBOARD_DEBUG(self, APPLICATIONS,
-							"Directory '%s' in application search paths was created",
-							filePath);
+	if(priv->executableIndex)
+	{
+		_xfdashboard_application_database_index_free(priv->executableIndex);
+		priv->executableIndex=NULL;
+	}
 
-		/* A new directory was created so create a file monitor for it,
-		 * connect signals and add to list of registered file monitors.
-		 */
-		fileMonitorData=_xfdashboard_application_database_monitor_data_new(inFile);
-		if(!fileMonitorData)
-		{
-			g_warning("Unable to create file monitor for newly created directory '%s'", filePath);
+	if(priv->executableBasenameIndex)
+	{
+		_xfdashboard_application_database_index_free(priv->executableBasenameIndex);
+		priv->executableBasenameIndex=NULL;
+	}
 
-			/* Release allocated resources */
-			if(filePath) g_free(filePath);
+	if(priv->caseFoldedDesktopIDIndex)
+	{
+		_xfdashboard_application_database_index_free(priv->caseFoldedDesktopIDIndex);
+		priv->caseFoldedDesktopIDIndex=NULL;
+	}
 
-			return;
-		}
+	if(priv->desktopIDSuffixIndex)
+	{
+		_xfdashboard_application_database_index_free(priv->desktopIDSuffixIndex);
+		priv->desktopIDSuffixIndex=NULL;
+	}
+}
 
-		fileMonitorData->monitor=g_file_monitor(inFile, G_FILE_MONITOR_NONE, NULL, &error);
-		if(!fileMonitorData->monitor)
-		{
-			g_warning("Unable to create file monitor for '%s': %s",
-						filePath,
-						error ? error->message : "Unknown error");
+/* Add application to or remove application from hash table of all
+ * applications and keep indexes up-to-date
+ */
+static void _xfdashboard_application_database_insert_application(XfdashboardApplicationDatabase *self,
+																	const gchar *inDesktopID,
+																	XfdashboardDesktopAppInfo *inAppInfo)
+{
+	XfdashboardApplicationDatabasePrivate	*priv;
 
-			/* Release allocated resources */
-			if(fileMonitorData) _xfdashboard_application_database_monitor_data_free(fileMonitorData);
-			if(filePath) g_free(filePath);
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self));
+	g_return_if_fail(inDesktopID && *inDesktopID);
+	g_return_if_fail(XFDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo));
 
-			return;
-		}
+	priv=self->priv;
 
-		fileMonitorData->changedID=g_signal_connect_swapped(fileMonitorData->monitor,
-															"changed",
-															G_CALLBACK(_xfdashboard_application_database_on_file_monitor_changed),
-															self);
+	/* Hash table takes the reference of application */
+	g_hash_table_insert(priv->applications, g_strdup(inDesktopID), inAppInfo);
+	_xfdashboard_application_database_index_add_application(self, G_APP_INFO(inAppInfo));
+}
+
+static void _xfdashboard_application_database_remove_application(XfdashboardApplicationDatabase *self,
+																	const gchar *inDesktopID)
+{
+	XfdashboardApplicationDatabasePrivate	*priv;
+	GAppInfo								*appInfo;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self));
+	g_return_if_fail(inDesktopID && *inDesktopID);
+
+	priv=self->priv;
+
+	appInfo=(GAppInfo*)g_hash_table_lookup(priv->applications, inDesktopID);
+	if(appInfo) _xfdashboard_application_database_index_remove_application(self, appInfo);
+
+	g_hash_table_remove(priv->applications, inDesktopID);
+}
+
+/* Reload application menu. This also emits all necessary signals. */
+static void _xfdashboard_application_database_reload_application_menu(XfdashboardApplicationDatabase *self)
+{
+	GError	*error=NULL;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self));
+
+	if(!_xfdashboard_application_database_load_application_menu(self, &error))
+	{
+		g_critical("Could not reload application menu: %s",
+					error ? error->message : "Unknown error");
+
+		/* Release allocated resources */
+		if(error) g_error_free(error);
+	}
+}
+
+/* Application menu needs to be reloaded */
+static void _xfdashboard_application_database_on_application_menu_reload_required(XfdashboardApplicationDatabase *self,
+																					gpointer inUserData)
+{
+	XfdashboardApplicationDatabasePrivate	*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self));
+	g_return_if_fail(GARCON_IS_MENU(inUserData));
+
+	priv=self->priv;
+
+	XFDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Menu '%s' changed and requires a reload of application menu",
+						garcon_menu_element_get_name(GARCON_MENU_ELEMENT(inUserData)));
 
-		priv->appDirMonitors=g_list_prepend(priv->appDirMonitors, fileMonitorData);
+	/* Reload application menu immediately if changes should not be collected ... */
+	if(_xfdashboard_application_database_get_reload_delay(self)==0)
+	{
+		_xfdashboard_application_database_reload_application_menu(self);
+		return;
 	}
 
+	/* ... otherwise remember to reload application menu when collected
+	 * changes are applied, so that the menu is reloaded only once.
+	 */
+	priv->pendingMenuReload=TRUE;
+	_xfdashboard_application_database_schedule_pending_changes(self);
+}
+
+/* Apply a change at a desktop file to hash table of applications, emit the
+ * signals for each application added or removed and record the change
+ * of its desktop ID at change set.
+ */
+static void _xfdashboard_application_database_apply_file_change(XfdashboardApplicationDatabase *self,
+																	GFile *inFile,
+																	GFileMonitorEvent inEventType,
+																	GHashTable *ioChanges)
+{
+	XfdashboardApplicationDatabasePrivate				*priv;
+	gchar												*filePath;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self));
+	g_return_if_fail(G_IS_FILE(inFile));
+	g_return_if_fail(ioChanges);
+
+	priv=self->priv;
+
+	/* Get file path */
+	filePath=g_file_get_path(inFile);
+
 	/* Check if a new desktop file was created */
 	if(inEventType==G_FILE_MONITOR_EVENT_CREATED &&
 		g_file_query_file_type(inFile, G_FILE_QUERY_INFO_NONE, NULL)==G_FILE_TYPE_REGULAR)
@@ -362,6 +666,7 @@ static void _xfdashboard_application_database_on_file_monitor_changed(Xfdashboar
 						 * No need to change anything at hash table.
 						 */
 						g_object_set(currentDesktopAppInfo, "file", newDesktopFile, NULL);
+						_xfdashboard_application_database_change_set_add(ioChanges, desktopID, XFDASHBOARD_APPLICATION_DATABASE_CHANGE_CHANGED);
 
 						XFDASHBOARD_DEBUG(self, APPLICATIONS,
 											"Replacing known desktop ID '%s' at desktop file '%s' with new desktop file '%s'",
@@ -400,10 +705,11 @@ static void _xfdashboard_application_database_on_file_monitor_changed(Xfdashboar
 							/* Add desktop app info to hash table because creation
 							 * was successful.
 							 */
-							g_hash_table_insert(priv->applications, g_strdup(desktopID), newDesktopAppInfo);
+							_xfdashboard_application_database_insert_application(self, desktopID, newDesktopAppInfo);
 
 							/* Emit signal that an application has been removed from hash table */
 							g_signal_emit(self, XfdashboardApplicationDatabaseSignals[SIGNAL_APPLICATION_ADDED], 0, newDesktopAppInfo);
+							_xfdashboard_application_database_change_set_add(ioChanges, desktopID, XFDASHBOARD_APPLICATION_DATABASE_CHANGE_ADDED);
 
 							XFDASHBOARD_DEBUG(self, APPLICATIONS,
 												"Adding new desktop ID '%s' for new desktop file at '%s'",
@@ -422,6 +728,9 @@ static void _xfdashboard_application_database_on_file_monitor_changed(Xfdashboar
 							}
 					}
 			}
+
+			/* Release allocated resources */
+			if(desktopID) g_free(desktopID);
 		}
 	}
 
@@ -488,7 +797,7 @@ static void _xfdashboard_application_database_on_file_monitor_changed(Xfdashboar
 							/* Remove desktop app info from hash table because either
 							 * reload failed or it is invalid now.
 							 */
-							g_hash_table_remove(priv->applications, desktopID);
+							_xfdashboard_application_database_remove_application(self, desktopID);
 
 							XFDASHBOARD_DEBUG(self, APPLICATIONS,
 												"Removed desktop ID '%s' with origin desktop file '%s' with modified desktop file '%s' because reload failed or it is invalid",
@@ -498,6 +807,7 @@ static void _xfdashboard_application_database_on_file_monitor_changed(Xfdashboar
 
 							/* Emit signal that an application has been removed */
 							g_signal_emit(self, XfdashboardApplicationDatabaseSignals[SIGNAL_APPLICATION_REMOVED], 0, appInfo);
+							_xfdashboard_application_database_change_set_add(ioChanges, desktopID, XFDASHBOARD_APPLICATION_DATABASE_CHANGE_REMOVED);
 
 							/* Release extra reference we took on desktop app info and
 							 * let object maybe destroyed now because it was the last one.
@@ -506,6 +816,8 @@ static void _xfdashboard_application_database_on_file_monitor_changed(Xfdashboar
 						}
 							else
 							{
+								_xfdashboard_application_database_change_set_add(ioChanges, desktopID, XFDASHBOARD_APPLICATION_DATABASE_CHANGE_CHANGED);
+
 								XFDASHBOARD_DEBUG(self, APPLICATIONS,
 													"Reloaded desktop ID '%s' with origin desktop file '%s' with modified desktop file '%s'",
 													desktopID,
@@ -532,10 +844,11 @@ static void _xfdashboard_application_database_on_file_monitor_changed(Xfdashboar
 																					NULL));
 						if(xfdashboard_desktop_app_info_is_valid(newDesktopAppInfo))
 						{
-							g_hash_table_insert(priv->applications, g_strdup(desktopID), newDesktopAppInfo);
+							_xfdashboard_application_database_insert_application(self, desktopID, newDesktopAppInfo);
 
 							/* Emit signal that an application has been removed from hash table */
 							g_signal_emit(self, XfdashboardApplicationDatabaseSignals[SIGNAL_APPLICATION_ADDED], 0, newDesktopAppInfo);
+							_xfdashboard_application_database_change_set_add(ioChanges, desktopID, XFDASHBOARD_APPLICATION_DATABASE_CHANGE_ADDED);
 
 							XFDASHBOARD_DEBUG(self, APPLICATIONS,
 												"Adding new desktop ID '%s' for modified desktop file at '%s'",
@@ -558,33 +871,11 @@ static void _xfdashboard_application_database_on_file_monitor_changed(Xfdashboar
 		}
 	}
 
-	/* Check if a file or directory was removed.
-	 * The problem here is that we cannot determine if the removed file
-	 * is really a file or a directory because we cannot query the file type
-	 * because it is removed at filesystem. So assume it was both:
-	 * a file and a directory.
-	 */
+	/* Check if a desktop file was removed */
 	if(inEventType==G_FILE_MONITOR_EVENT_DELETED)
 	{
-		XfdashboardApplicationDatabaseFileMonitorData	*fileMonitorData;
-
-		/* Assume it was a directory so remove file monitor and free
-		 * it's file monitor data structure.
-		 */
-		fileMonitorData=_xfdashboard_application_database_monitor_data_find_by_file(self, inFile);
-		if(fileMonitorData)
-		{
-			XFDASHBOARD_DEBUG(self, APPLICATIONS,
-								"Removing file monitor for deleted directory '%s'",
-								filePath);
-
-			priv->appDirMonitors=g_list_remove_all(priv->appDirMonitors, fileMonitorData);
-			_xfdashboard_application_database_monitor_data_free(fileMonitorData);
-			fileMonitorData=NULL;
-		}
-
-		/* Assume it was a file so check if it was a desktop file, then check
-		 * if any other desktop file in the other paths in list of search paths
+		/* Check if it was a desktop file, then check if any other
+		 * desktop file in the other paths in list of search paths
 		 * matches the removed desktop ID. If so replace desktop app info and
 		 * emit signal. Otherwise remove desktop app info from hash table and
 		 * emit signal. Check can only be performed if a hash table exists.
@@ -635,6 +926,7 @@ static void _xfdashboard_application_database_on_file_monitor_changed(Xfdashboar
 						newDesktopFile=g_file_new_for_path(newDesktopFilename);
 						g_object_set(currentDesktopAppInfo, "file", newDesktopFile, NULL);
 						g_object_unref(newDesktopFile);
+						_xfdashboard_application_database_change_set_add(ioChanges, desktopID, XFDASHBOARD_APPLICATION_DATABASE_CHANGE_CHANGED);
 
 						/* Release allocated resources */
 						g_free(newDesktopFilename);
@@ -652,56 +944,1154 @@ static void _xfdashboard_application_database_on_file_monitor_changed(Xfdashboar
 							/* There is no other desktop file for this desktop ID.
 							 * Remove desktop app info and desktop ID from hash table.
 							 */
-							g_hash_table_remove(priv->applications, desktopID);
+							_xfdashboard_application_database_remove_application(self, desktopID);
 
 							XFDASHBOARD_DEBUG(self, APPLICATIONS,
 												"Removing desktop ID '%s'",
 												desktopID);
 
-							/* Emit signal that an application has been removed */
-							g_signal_emit(self, XfdashboardApplicationDatabaseSignals[SIGNAL_APPLICATION_REMOVED], 0, currentDesktopAppInfo);
+							/* Emit signal that an application has been removed */
+							g_signal_emit(self, XfdashboardApplicationDatabaseSignals[SIGNAL_APPLICATION_REMOVED], 0, currentDesktopAppInfo);
+							_xfdashboard_application_database_change_set_add(ioChanges, desktopID, XFDASHBOARD_APPLICATION_DATABASE_CHANGE_REMOVED);
+
+							/* Set a NULL file at desktop app info which causes
+							 * the 'changed' signal to be emitted.
+							 */
+							g_object_set(currentDesktopAppInfo, "file", NULL, NULL);
+
+							/* Release the extra reference we took */
+							g_object_unref(currentDesktopAppInfo);
+						}
+				}
+
+				/* Release allocated resources */
+				g_free(desktopID);
+			}
+		}
+	}
+
+	/* Release allocated resources */
+	if(filePath) g_free(filePath);
+}
+
+/* Create a new change set which maps desktop IDs to the kind of change */
+static GHashTable* _xfdashboard_application_database_change_set_new(void)
+{
+	return(g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL));
+}
+
+/* Record change at desktop ID in change set and merge it with a change
+ * recorded before, e.g. a desktop ID added and removed again is no change
+ * at all and a desktop ID removed and added again is a changed one.
+ */
+static void _xfdashboard_application_database_change_set_add(GHashTable *ioChanges,
+																const gchar *inDesktopID,
+																XfdashboardApplicationDatabaseChange inChange)
+{
+	gpointer								value;
+	XfdashboardApplicationDatabaseChange	change;
+
+	g_return_if_fail(ioChanges);
+	g_return_if_fail(inDesktopID && *inDesktopID);
+
+	/* If desktop ID was not changed before, just record change */
+	if(!g_hash_table_lookup_extended(ioChanges, inDesktopID, NULL, &value))
+	{
+		g_hash_table_insert(ioChanges, g_strdup(inDesktopID), GINT_TO_POINTER(inChange));
+		return;
+	}
+
+	/* Merge change with the one recorded before */
+	change=(XfdashboardApplicationDatabaseChange)GPOINTER_TO_INT(value);
+	if(change==XFDASHBOARD_APPLICATION_DATABASE_CHANGE_ADDED)
+	{
+		if(inChange==XFDASHBOARD_APPLICATION_DATABASE_CHANGE_REMOVED)
+		{
+			g_hash_table_remove(ioChanges, inDesktopID);
+		}
+	}
+		else if(change==XFDASHBOARD_APPLICATION_DATABASE_CHANGE_REMOVED)
+		{
+			if(inChange==XFDASHBOARD_APPLICATION_DATABASE_CHANGE_ADDED)
+			{
+				g_hash_table_insert(ioChanges, g_strdup(inDesktopID), GINT_TO_POINTER(XFDASHBOARD_APPLICATION_DATABASE_CHANGE_CHANGED));
+			}
+		}
+		else
+		{
+			g_hash_table_insert(ioChanges, g_strdup(inDesktopID), GINT_TO_POINTER(inChange));
+		}
+}
+
+/* Emit one signal for all changes recorded at change set */
+static void _xfdashboard_application_database_change_set_emit(XfdashboardApplicationDatabase *self,
+																GHashTable *inChanges)
+{
+	GPtrArray								*added;
+	GPtrArray								*changed;
+	GPtrArray								*removed;
+	GHashTableIter							iter;
+	const gchar								*desktopID;
+	gpointer								value;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self));
+	g_return_if_fail(inChanges);
+
+	/* Do nothing if nothing changed */
+	if(g_hash_table_size(inChanges)==0) return;
+
+	/* Split changes into lists of added, changed and removed desktop IDs */
+	added=g_ptr_array_new();
+	changed=g_ptr_array_new();
+	removed=g_ptr_array_new();
+
+	g_hash_table_iter_init(&iter, inChanges);
+	while(g_hash_table_iter_next(&iter, (gpointer*)&desktopID, &value))
+	{
+		switch((XfdashboardApplicationDatabaseChange)GPOINTER_TO_INT(value))
+		{
+			case XFDASHBOARD_APPLICATION_DATABASE_CHANGE_ADDED:
+				g_ptr_array_add(added, g_strdup(desktopID));
+				break;
+
+			case XFDASHBOARD_APPLICATION_DATABASE_CHANGE_CHANGED:
+				g_ptr_array_add(changed, g_strdup(desktopID));
+				break;
+
+			case XFDASHBOARD_APPLICATION_DATABASE_CHANGE_REMOVED:
+				g_ptr_array_add(removed, g_strdup(desktopID));
+				break;
+		}
+	}
+
+	g_ptr_array_add(added, NULL);
+	g_ptr_array_add(changed, NULL);
+	g_ptr_array_add(removed, NULL);
+
+	XFDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Applications changed: %u added, %u changed, %u removed",
+						added->len-1,
+						changed->len-1,
+						removed->len-1);
+
+	/* Emit signal */
+	g_signal_emit(self,
+					XfdashboardApplicationDatabaseSignals[SIGNAL_APPLICATIONS_CHANGED],
+					0,
+					added->pdata,
+					changed->pdata,
+					removed->pdata);
+
+	/* Release allocated resources */
+	g_strfreev((gchar**)g_ptr_array_free(added, FALSE));
+	g_strfreev((gchar**)g_ptr_array_free(changed, FALSE));
+	g_strfreev((gchar**)g_ptr_array_free(removed, FALSE));
+}
+
+/* Get delay in milliseconds to collect changes before applying them */
+static guint _xfdashboard_application_database_get_reload_delay(XfdashboardApplicationDatabase *self)
+{
+	XfdashboardSettings		*settings;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self), 0);
+
+	/* Without settings apply each change immediately */
+	settings=xfdashboard_core_get_settings(NULL);
+	if(!settings) return(0);
+
+	return(xfdashboard_settings_get_application_database_reload_delay(settings));
+}
+
+/* Apply all collected changes at once */
+static void _xfdashboard_application_database_apply_pending_changes(XfdashboardApplicationDatabase *self)
+{
+	XfdashboardApplicationDatabasePrivate	*priv;
+	GHashTable								*pendingChanges;
+	gboolean								pendingMenuReload;
+	GHashTable								*changes;
+	GHashTableIter							iter;
+	GFile									*file;
+	gpointer								value;
+	gint64									profilerBegin;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self));
+
+	priv=self->priv;
+
+	/* Take collected changes as applying them could collect new ones */
+	if(priv->pendingChangesTimeoutID)
+	{
+		g_source_remove(priv->pendingChangesTimeoutID);
+		priv->pendingChangesTimeoutID=0;
+	}
+
+	pendingChanges=priv->pendingChanges;
+	priv->pendingChanges=NULL;
+
+	pendingMenuReload=priv->pendingMenuReload;
+	priv->pendingMenuReload=FALSE;
+
+	profilerBegin=xfdashboard_profiler_begin("applications");
+
+	/* Apply changes at desktop files */
+	changes=_xfdashboard_application_database_change_set_new();
+	if(pendingChanges)
+	{
+		XFDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Applying %u collected changes at desktop files",
+							g_hash_table_size(pendingChanges));
+
+		g_hash_table_iter_init(&iter, pendingChanges);
+		while(g_hash_table_iter_next(&iter, (gpointer*)&file, &value))
+		{
+			_xfdashboard_application_database_apply_file_change(self,
+																file,
+																(GFileMonitorEvent)GPOINTER_TO_INT(value),
+																changes);
+		}
+
+		xfdashboard_statistics_add("application-database.changes-applied", g_hash_table_size(pendingChanges));
+		g_hash_table_destroy(pendingChanges);
+	}
+
+	/* Reload application menu after applications were updated because
+	 * the menu refers to them.
+	 */
+	if(pendingMenuReload) _xfdashboard_application_database_reload_application_menu(self);
+
+	/* Emit one signal for all changes at applications */
+	_xfdashboard_application_database_change_set_emit(self, changes);
+
+	xfdashboard_profiler_end("applications", "application-database.apply-changes", profilerBegin);
+
+	/* Release allocated resources */
+	g_hash_table_destroy(changes);
+}
+
+/* Delay for collecting changes has expired */
+static gboolean _xfdashboard_application_database_on_pending_changes_timeout(gpointer inUserData)
+{
+	XfdashboardApplicationDatabase			*self;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(inUserData), G_SOURCE_REMOVE);
+
+	self=XFDASHBOARD_APPLICATION_DATABASE(inUserData);
+
+	/* Timeout source will be removed so reset its ID before applying changes */
+	self->priv->pendingChangesTimeoutID=0;
+	_xfdashboard_application_database_apply_pending_changes(self);
+
+	return(G_SOURCE_REMOVE);
+}
+
+/* (Re-)Start delay for collecting changes */
+static void _xfdashboard_application_database_schedule_pending_changes(XfdashboardApplicationDatabase *self)
+{
+	XfdashboardApplicationDatabasePrivate	*priv;
+	guint									delay;
+	gint64									now;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self));
+
+	priv=self->priv;
+	delay=_xfdashboard_application_database_get_reload_delay(self);
+	now=g_get_monotonic_time();
+
+	/* If changes are already collected restart delay to wait for further
+	 * changes but only if the changes are not collected for too long already.
+	 * Otherwise let the running delay expire.
+	 */
+	if(priv->pendingChangesTimeoutID)
+	{
+		if((now-priv->pendingChangesSince)/1000>=(gint64)delay*XFDASHBOARD_APPLICATION_DATABASE_MAX_RELOAD_DELAY_FACTOR) return;
+
+		g_source_remove(priv->pendingChangesTimeoutID);
+		priv->pendingChangesTimeoutID=0;
+	}
+		else priv->pendingChangesSince=now;
+
+	priv->pendingChangesTimeoutID=g_timeout_add(MAX(delay, 1),
+												_xfdashboard_application_database_on_pending_changes_timeout,
+												self);
+}
+
+/* Queue change at desktop file to apply it together with further changes */
+static void _xfdashboard_application_database_queue_file_change(XfdashboardApplicationDatabase *self,
+																GFile *inFile,
+																GFileMonitorEvent inEventType)
+{
+	XfdashboardApplicationDatabasePrivate	*priv;
+	GFileMonitorEvent						eventType;
+	gpointer								value;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self));
+	g_return_if_fail(G_IS_FILE(inFile));
+
+	priv=self->priv;
+
+	/* Apply change immediately if changes should not be collected */
+	if(_xfdashboard_application_database_get_reload_delay(self)==0)
+	{
+		GHashTable							*changes;
+
+		changes=_xfdashboard_application_database_change_set_new();
+		_xfdashboard_application_database_apply_file_change(self, inFile, inEventType, changes);
+		_xfdashboard_application_database_change_set_emit(self, changes);
+		g_hash_table_destroy(changes);
+
+		return;
+	}
+
+	/* Create queue if it does not exist */
+	if(!priv->pendingChanges)
+	{
+		priv->pendingChanges=g_hash_table_new_full(g_file_hash,
+													(GEqualFunc)g_file_equal,
+													g_object_unref,
+													NULL);
+	}
+
+	/* Merge change with the one queued for this file before. Only the last
+	 * change is of interest except for a desktop file removed and created
+	 * again, e.g. when it is replaced by a package manager, which must be
+	 * applied as modified to reload it. A desktop file created and modified
+	 * afterwards stays a created one.
+	 */
+	eventType=inEventType;
+	if(g_hash_table_lookup_extended(priv->pendingChanges, inFile, NULL, &value))
+	{
+		GFileMonitorEvent					queuedEventType;
+
+		queuedEventType=(GFileMonitorEvent)GPOINTER_TO_INT(value);
+		if(queuedEventType==G_FILE_MONITOR_EVENT_DELETED &&
+			inEventType==G_FILE_MONITOR_EVENT_CREATED)
+		{
+			eventType=G_FILE_MONITOR_EVENT_CHANGED;
+		}
+			else if(queuedEventType==G_FILE_MONITOR_EVENT_CREATED &&
+						inEventType==G_FILE_MONITOR_EVENT_CHANGED)
+			{
+				eventType=G_FILE_MONITOR_EVENT_CREATED;
+			}
+
+		xfdashboard_statistics_add("application-database.changes-merged", 1);
+	}
+
+	g_hash_table_insert(priv->pendingChanges, g_object_ref(inFile), GINT_TO_POINTER(eventType));
+	xfdashboard_statistics_add("application-database.changes-queued", 1);
+
+	/* (Re-)Start delay */
+	_xfdashboard_application_database_schedule_pending_changes(self);
+}
+
+/* Changes in a watched directory were missed, so queue all desktop files in
+ * it as modified and all desktop files of known applications which were
+ * located in it but do not exist anymore as removed. Subdirectories created
+ * meanwhile are watched and rescanned as well.
+ */
+static void _xfdashboard_application_database_rescan_directory(XfdashboardApplicationDatabase *self,
+																XfdashboardDirectoryWatcher *inWatcher,
+																GFile *inDirectory)
+{
+	XfdashboardApplicationDatabasePrivate				*priv;
+	GFileEnumerator										*enumerator;
+	GFileInfo											*info;
+	GHashTableIter										iter;
+	XfdashboardDesktopAppInfo							*appInfo;
+	GSList												*entry;
+	gchar												*path;
+	GError												*error;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self));
+	g_return_if_fail(XFDASHBOARD_IS_DIRECTORY_WATCHER(inWatcher));
+	g_return_if_fail(G_IS_FILE(inDirectory));
+
+	priv=self->priv;
+	path=g_file_get_path(inDirectory);
+	error=NULL;
+
+	XFDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Rescanning directory '%s' in application search paths",
+						path);
+
+	/* Queue all desktop files in directory as modified, so new ones get added
+	 * and known ones get reloaded.
+	 */
+	enumerator=g_file_enumerate_children(inDirectory,
+											G_FILE_ATTRIBUTE_STANDARD_NAME "," G_FILE_ATTRIBUTE_STANDARD_TYPE,
+											G_FILE_QUERY_INFO_NONE,
+											NULL,
+											&error);
+	if(enumerator)
+	{
+		while((info=g_file_enumerator_next_file(enumerator, NULL, NULL)))
+		{
+			GFile										*child;
+
+			child=g_file_get_child(inDirectory, g_file_info_get_name(info));
+
+			if(g_file_info_get_file_type(info)==G_FILE_TYPE_DIRECTORY)
+			{
+				if(!xfdashboard_directory_watcher_has_directory(inWatcher, child) &&
+					xfdashboard_directory_watcher_add(inWatcher, child, NULL))
+				{
+					_xfdashboard_application_database_rescan_directory(self, inWatcher, child);
+				}
+			}
+				else if(g_file_info_get_file_type(info)==G_FILE_TYPE_REGULAR &&
+							g_str_has_suffix(g_file_info_get_name(info), ".desktop"))
+				{
+					_xfdashboard_application_database_queue_file_change(self, child, G_FILE_MONITOR_EVENT_CHANGED);
+				}
+
+			g_object_unref(child);
+			g_object_unref(info);
+		}
+
+		g_object_unref(enumerator);
+	}
+		else
+		{
+			XFDASHBOARD_DEBUG(self, APPLICATIONS,
+								"Could not rescan directory '%s': %s",
+								path,
+								error ? error->message : "Unknown error");
+			g_clear_error(&error);
+		}
+
+	/* Queue desktop files of known applications in this directory which
+	 * do not exist anymore as removed. They are collected first as queuing
+	 * a change might apply it immediately and modify the hash-table.
+	 */
+	if(priv->applications)
+	{
+		GSList											*removedFiles;
+
+		removedFiles=NULL;
+
+		g_hash_table_iter_init(&iter, priv->applications);
+		while(g_hash_table_iter_next(&iter, NULL, (gpointer*)&appInfo))
+		{
+			GFile										*file;
+			GFile										*parent;
+
+			file=xfdashboard_desktop_app_info_get_file(appInfo);
+			if(!file) continue;
+
+			parent=g_file_get_parent(file);
+			if(parent &&
+				g_file_equal(parent, inDirectory) &&
+				!g_file_query_exists(file, NULL))
+			{
+				removedFiles=g_slist_prepend(removedFiles, g_object_ref(file));
+			}
+			if(parent) g_object_unref(parent);
+		}
+
+		for(entry=removedFiles; entry; entry=g_slist_next(entry))
+		{
+			_xfdashboard_application_database_queue_file_change(self, G_FILE(entry->data), G_FILE_MONITOR_EVENT_DELETED);
+		}
+		g_slist_free_full(removedFiles, g_object_unref);
+	}
+
+	/* Release allocated resources */
+	if(path) g_free(path);
+}
+
+/* Directories containing desktop files have changed */
+static void _xfdashboard_application_database_on_directory_watcher_changed(XfdashboardApplicationDatabase *self,
+																			const GPtrArray *inEvents,
+																			gpointer inUserData)
+{
+	XfdashboardApplicationDatabasePrivate				*priv;
+	XfdashboardDirectoryWatcher							*watcher;
+	guint												i;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self));
+	g_return_if_fail(inEvents);
+	g_return_if_fail(XFDASHBOARD_IS_DIRECTORY_WATCHER(inUserData));
+
+	priv=self->priv;
+	watcher=XFDASHBOARD_DIRECTORY_WATCHER(inUserData);
+
+	/* Check that event was received from current directory watcher */
+	if(watcher!=priv->appDirWatcher)
+	{
+		g_warning("Received event from unknown directory watcher");
+		return;
+	}
+
+	for(i=0; i<inEvents->len; i++)
+	{
+		const XfdashboardDirectoryWatcherEvent			*event;
+		gchar											*filePath;
+
+		event=(const XfdashboardDirectoryWatcherEvent*)g_ptr_array_index(inEvents, i);
+		filePath=g_file_get_path(event->file);
+
+		/* Directories are watched and unwatched immediately to miss
+		 * no event.
+		 */
+		if(event->isDirectory)
+		{
+			if(event->eventType==G_FILE_MONITOR_EVENT_CREATED)
+			{
+				GError									*error;
+
+				XFDASHBOARD_DEBUG(self, APPLICATIONS,
+									"Directory '%s' in application search paths was created",
+									filePath);
+
+				error=NULL;
+				if(!xfdashboard_directory_watcher_add(watcher, event->file, &error))
+				{
+					g_warning("Unable to watch newly created directory '%s': %s",
+								filePath,
+								error ? error->message : "Unknown error");
+					g_clear_error(&error);
+				}
+			}
+
+			if(event->eventType==G_FILE_MONITOR_EVENT_DELETED &&
+				xfdashboard_directory_watcher_remove(watcher, event->file))
+			{
+				XFDASHBOARD_DEBUG(self, APPLICATIONS,
+									"Stopped watching deleted directory '%s'",
+									filePath);
+			}
+
+			/* Changes in directory were missed, so rescan it */
+			if(event->eventType==G_FILE_MONITOR_EVENT_CHANGED)
+			{
+				_xfdashboard_application_database_rescan_directory(self, watcher, event->file);
+			}
+		}
+			/* Changes at desktop files are queued and applied at once */
+			else if(filePath && g_str_has_suffix(filePath, ".desktop"))
+			{
+				_xfdashboard_application_database_queue_file_change(self, event->file, event->eventType);
+			}
+
+		/* Release allocated resources */
+		if(filePath) g_free(filePath);
+	}
+}
+
+/* Free a directory or desktop file entry of cache */
+static void _xfdashboard_application_database_cache_directory_free(XfdashboardApplicationDatabaseCacheDirectory *inDirectory)
+{
+	g_return_if_fail(inDirectory);
+
+	if(inDirectory->path) g_free(inDirectory->path);
+	g_free(inDirectory);
+}
+
+static void _xfdashboard_application_database_cache_entry_free(XfdashboardApplicationDatabaseCacheEntry *inEntry)
+{
+	g_return_if_fail(inEntry);
+
+	if(inEntry->desktopID) g_free(inEntry->desktopID);
+	if(inEntry->path) g_free(inEntry->path);
+	if(inEntry->data) g_variant_unref(inEntry->data);
+	g_free(inEntry);
+}
+
+/* Create and free cache */
+static XfdashboardApplicationDatabaseCache* _xfdashboard_application_database_cache_new(void)
+{
+	XfdashboardApplicationDatabaseCache		*cache;
+
+	cache=g_new0(XfdashboardApplicationDatabaseCache, 1);
+	cache->directories=g_ptr_array_new_with_free_func((GDestroyNotify)_xfdashboard_application_database_cache_directory_free);
+	cache->entries=g_ptr_array_new_with_free_func((GDestroyNotify)_xfdashboard_application_database_cache_entry_free);
+	cache->entriesByPath=g_hash_table_new(g_str_hash, g_str_equal);
+	cache->isModified=FALSE;
+
+	return(cache);
+}
+
+static void _xfdashboard_application_database_cache_free(XfdashboardApplicationDatabaseCache *inCache)
+{
+	g_return_if_fail(inCache);
+
+	g_hash_table_destroy(inCache->entriesByPath);
+	g_ptr_array_unref(inCache->entries);
+	g_ptr_array_unref(inCache->directories);
+	g_free(inCache);
+}
+
+/* Add a scanned directory or a desktop file to cache */
+static void _xfdashboard_application_database_cache_add_directory(XfdashboardApplicationDatabaseCache *inCache,
+																	const gchar *inPath,
+																	gint64 inModificationTime)
+{
+	XfdashboardApplicationDatabaseCacheDirectory	*directory;
+
+	g_return_if_fail(inCache);
+	g_return_if_fail(inPath && *inPath);
+
+	directory=g_new0(XfdashboardApplicationDatabaseCacheDirectory, 1);
+	directory->path=g_strdup(inPath);
+	directory->mtime=inModificationTime;
+	g_ptr_array_add(inCache->directories, directory);
+}
+
+static void _xfdashboard_application_database_cache_add_entry(XfdashboardApplicationDatabaseCache *inCache,
+																const gchar *inDesktopID,
+																const gchar *inPath,
+																gint64 inModificationTime,
+																gint64 inSize,
+																GVariant *inData)
+{
+	XfdashboardApplicationDatabaseCacheEntry		*entry;
+
+	g_return_if_fail(inCache);
+	g_return_if_fail(inDesktopID && *inDesktopID);
+	g_return_if_fail(inPath && *inPath);
+
+	entry=g_new0(XfdashboardApplicationDatabaseCacheEntry, 1);
+	entry->desktopID=g_strdup(inDesktopID);
+	entry->path=g_strdup(inPath);
+	entry->mtime=inModificationTime;
+	entry->size=inSize;
+	entry->data=(inData ? g_variant_ref(inData) : NULL);
+	g_ptr_array_add(inCache->entries, entry);
+	g_hash_table_insert(inCache->entriesByPath, entry->path, entry);
+}
+
+/* Get modification time of a directory or -1 if it does not exist */
+static gint64 _xfdashboard_application_database_cache_get_directory_mtime(const gchar *inPath)
+{
+	GStatBuf										fileInfo;
+
+	g_return_val_if_fail(inPath && *inPath, -1);
+
+	if(g_stat(inPath, &fileInfo)!=0 || !S_ISDIR(fileInfo.st_mode)) return(-1);
+	return(xfdashboard_get_modification_time(&fileInfo));
+}
+
+/* Get path to cache file and the key the cache is valid for. Returns FALSE
+ * if caching is not supported.
+ */
+static gboolean _xfdashboard_application_database_cache_get_file_and_key(XfdashboardApplicationDatabase *self,
+																			gchar **outCacheFile,
+																			gchar **outCacheKey)
+{
+	XfdashboardApplicationDatabasePrivate			*priv;
+	XfdashboardSettings								*settings;
+	const gchar										*cachePath;
+	GString											*key;
+	GList											*iter;
+	const gchar * const								*languages;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self), FALSE);
+	g_return_val_if_fail(outCacheFile && outCacheKey, FALSE);
+
+	priv=self->priv;
+	*outCacheFile=NULL;
+	*outCacheKey=NULL;
+
+	/* Check if caching is supported */
+	settings=xfdashboard_core_get_settings(NULL);
+	if(!settings) return(FALSE);
+
+	cachePath=xfdashboard_settings_get_cache_path(settings);
+	if(!cachePath) return(FALSE);
+
+	/* Build key of cache from all conditions the scan depends on, i.e. the
+	 * version of this library, the search paths in their order and the
+	 * locale and desktop environment the desktop files were parsed for.
+	 */
+	key=g_string_new(PACKAGE_VERSION);
+	for(iter=priv->searchPaths; iter; iter=g_list_next(iter))
+	{
+		g_string_append_printf(key, "\n%s", (const gchar*)iter->data);
+	}
+
+	for(languages=g_get_language_names(); *languages; languages++)
+	{
+		g_string_append_printf(key, "\n%s", *languages);
+	}
+
+	g_string_append_printf(key, "\n%s", garcon_get_environment() ? garcon_get_environment() : "");
+
+	*outCacheFile=g_build_filename(cachePath, XFDASHBOARD_APPLICATION_DATABASE_CACHE_FILENAME, NULL);
+	*outCacheKey=g_string_free(key, FALSE);
+
+	return(TRUE);
+}
+
+/* Load cache from file. Returns NULL if cache file does not exist or
+ * was created for another version or key.
+ */
+static XfdashboardApplicationDatabaseCache* _xfdashboard_application_database_cache_load(XfdashboardApplicationDatabase *self,
+																							const gchar *inCacheFile,
+																							const gchar *inKey)
+{
+	XfdashboardApplicationDatabaseCache				*cache;
+	GMappedFile										*mappedFile;
+	GBytes											*bytes;
+	GVariant										*data;
+	GVariant										*directories;
+	GVariant										*entries;
+	GVariantIter									iter;
+	guint32											version;
+	const gchar										*key;
+	const gchar										*desktopID;
+	const gchar										*path;
+	gint64											mtime;
+	gint64											size;
+	GVariant										*maybeData;
+	GVariant										*entryData;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self), NULL);
+	g_return_val_if_fail(inCacheFile && *inCacheFile, NULL);
+	g_return_val_if_fail(inKey, NULL);
+
+	/* Map cache file into memory and create a variant from it */
+	mappedFile=g_mapped_file_new(inCacheFile, FALSE, NULL);
+	if(!mappedFile)
+	{
+		XFDASHBOARD_DEBUG(self, APPLICATIONS,
+							"No application cache found at '%s'",
+							inCacheFile);
+		return(NULL);
+	}
+
+	bytes=g_mapped_file_get_bytes(mappedFile);
+	data=g_variant_ref_sink(g_variant_new_from_bytes(G_VARIANT_TYPE(XFDASHBOARD_APPLICATION_DATABASE_CACHE_TYPE), bytes, FALSE));
+	g_bytes_unref(bytes);
+	g_mapped_file_unref(mappedFile);
+
+	g_variant_get(data,
+					"(u&s@a(sx)@a" XFDASHBOARD_APPLICATION_DATABASE_CACHE_ENTRY_TYPE ")",
+					&version,
+					&key,
+					&directories,
+					&entries);
+
+	/* Check that cache file was created by this version and for requested key */
+	cache=NULL;
+	if(version==XFDASHBOARD_APPLICATION_DATABASE_CACHE_VERSION &&
+		g_strcmp0(key, inKey)==0)
+	{
+		cache=_xfdashboard_application_database_cache_new();
+
+		g_variant_iter_init(&iter, directories);
+		while(g_variant_iter_next(&iter, "(&sx)", &path, &mtime))
+		{
+			_xfdashboard_application_database_cache_add_directory(cache, path, mtime);
+		}
+
+		g_variant_iter_init(&iter, entries);
+		while(g_variant_iter_next(&iter, "(&s&sxx@m" XFDASHBOARD_DESKTOP_APP_INFO_DATA_TYPE ")", &desktopID, &path, &mtime, &size, &maybeData))
+		{
+			entryData=g_variant_get_maybe(maybeData);
+			_xfdashboard_application_database_cache_add_entry(cache, desktopID, path, mtime, size, entryData);
+			if(entryData) g_variant_unref(entryData);
+			g_variant_unref(maybeData);
+		}
+
+		XFDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Loaded %u directories and %u desktop files from application cache '%s'",
+							cache->directories->len,
+							cache->entries->len,
+							inCacheFile);
+	}
+		else
+		{
+			XFDASHBOARD_DEBUG(self, APPLICATIONS,
+								"Application cache '%s' was created for another version or key",
+								inCacheFile);
+		}
+
+	/* Release allocated resources */
+	g_variant_unref(directories);
+	g_variant_unref(entries);
+	g_variant_unref(data);
+
+	return(cache);
+}
+
+/* Save cache to file */
+static gboolean _xfdashboard_application_database_cache_save(XfdashboardApplicationDatabase *self,
+																XfdashboardApplicationDatabaseCache *inCache,
+																const gchar *inCacheFile,
+																const gchar *inKey,
+																GError **outError)
+{
+	GVariantBuilder									directoriesBuilder;
+	GVariantBuilder									entriesBuilder;
+	GVariant										*data;
+	gchar											*fileFolder;
+	GError											*error;
+	gboolean										success;
+	guint											i;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self), FALSE);
+	g_return_val_if_fail(inCache, FALSE);
+	g_return_val_if_fail(inCacheFile && *inCacheFile, FALSE);
+	g_return_val_if_fail(inKey, FALSE);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
+
+	error=NULL;
+
+	/* Build cache */
+	g_variant_builder_init(&directoriesBuilder, G_VARIANT_TYPE("a(sx)"));
+	for(i=0; i<inCache->directories->len; i++)
+	{
+		XfdashboardApplicationDatabaseCacheDirectory	*directory;
+
+		directory=(XfdashboardApplicationDatabaseCacheDirectory*)g_ptr_array_index(inCache->directories, i);
+		g_variant_builder_add(&directoriesBuilder, "(sx)", directory->path, directory->mtime);
+	}
+
+	g_variant_builder_init(&entriesBuilder, G_VARIANT_TYPE("a" XFDASHBOARD_APPLICATION_DATABASE_CACHE_ENTRY_TYPE));
+	for(i=0; i<inCache->entries->len; i++)
+	{
+		XfdashboardApplicationDatabaseCacheEntry		*entry;
+
+		entry=(XfdashboardApplicationDatabaseCacheEntry*)g_ptr_array_index(inCache->entries, i);
+		g_variant_builder_add(&entriesBuilder,
+								"(ssxx@m" XFDASHBOARD_DESKTOP_APP_INFO_DATA_TYPE ")",
+								entry->desktopID,
+								entry->path,
+								entry->mtime,
+								entry->size,
+								g_variant_new_maybe(G_VARIANT_TYPE(XFDASHBOARD_DESKTOP_APP_INFO_DATA_TYPE), entry->data));
+	}
+
+	data=g_variant_ref_sink(g_variant_new(XFDASHBOARD_APPLICATION_DATABASE_CACHE_TYPE,
+											XFDASHBOARD_APPLICATION_DATABASE_CACHE_VERSION,
+											inKey,
+											&directoriesBuilder,
+											&entriesBuilder));
+
+	/* Create parent folders for cache file if not available */
+	fileFolder=g_path_get_dirname(inCacheFile);
+	if(g_mkdir_with_parents(fileFolder, 0700)<0)
+	{
+		int											errno_save;
+
+		/* Get error code */
+		errno_save=errno;
+
+		/* Set error */
+		g_set_error(outError,
+						G_IO_ERROR,
+						g_io_error_from_errno(errno_save),
+						"Could not create folder for application cache at %s: %s",
+						fileFolder,
+						g_strerror(errno_save));
+
+		/* Release allocated resources */
+		if(fileFolder) g_free(fileFolder);
+		g_variant_unref(data);
+
+		return(FALSE);
+	}
+
+	/* Store cache in file */
+	success=g_file_set_contents(inCacheFile,
+								g_variant_get_data(data),
+								g_variant_get_size(data),
+								&error);
+	if(!success) g_propagate_error(outError, error);
+		else
+		{
+			XFDASHBOARD_DEBUG(self, APPLICATIONS,
+								"Saved %u directories and %u desktop files to application cache '%s'",
+								inCache->directories->len,
+								inCache->entries->len,
+								inCacheFile);
+		}
+
+	/* Release allocated resources */
+	if(fileFolder) g_free(fileFolder);
+	g_variant_unref(data);
+
+	return(success);
+}
+
+/* Create and free a desktop file found while scanning search paths */
+static XfdashboardApplicationDatabaseScanEntry* _xfdashboard_application_database_scan_entry_new(const gchar *inDesktopID,
+																									GFile *inFile,
+																									const gchar *inPath,
+																									gint64 inModificationTime,
+																									gint64 inSize,
+																									XfdashboardApplicationDatabaseCache *inCache)
+{
+	XfdashboardApplicationDatabaseScanEntry			*scanEntry;
+	XfdashboardApplicationDatabaseCacheEntry		*cacheEntry;
+
+	g_return_val_if_fail(inDesktopID && *inDesktopID, NULL);
+	g_return_val_if_fail(G_IS_FILE(inFile), NULL);
+	g_return_val_if_fail(inPath && *inPath, NULL);
+
+	scanEntry=g_new0(XfdashboardApplicationDatabaseScanEntry, 1);
+	scanEntry->desktopID=g_strdup(inDesktopID);
+	scanEntry->file=G_FILE(g_object_ref(inFile));
+	scanEntry->path=g_strdup(inPath);
+	scanEntry->mtime=inModificationTime;
+	scanEntry->size=inSize;
+
+	/* Check if desktop file did not change since cache was created. If so,
+	 * it does not need to be parsed and its data can be taken from cache.
+	 */
+	cacheEntry=NULL;
+	if(inCache) cacheEntry=(XfdashboardApplicationDatabaseCacheEntry*)g_hash_table_lookup(inCache->entriesByPath, inPath);
+
+	if(cacheEntry &&
+		cacheEntry->mtime==inModificationTime &&
+		cacheEntry->size==inSize &&
+		g_strcmp0(cacheEntry->desktopID, inDesktopID)==0)
+	{
+		scanEntry->isCached=TRUE;
+		if(cacheEntry->data) scanEntry->data=g_variant_ref(cacheEntry->data);
+	}
+
+	return(scanEntry);
+}
+
+static void _xfdashboard_application_database_scan_entry_free(XfdashboardApplicationDatabaseScanEntry *inScanEntry)
+{
+	g_return_if_fail(inScanEntry);
+
+	if(inScanEntry->desktopID) g_free(inScanEntry->desktopID);
+	if(inScanEntry->file) g_object_unref(inScanEntry->file);
+	if(inScanEntry->path) g_free(inScanEntry->path);
+	if(inScanEntry->data) g_variant_unref(inScanEntry->data);
+	g_free(inScanEntry);
+}
+
+/* Parse desktop file of a found desktop file. This function is called
+ * at a worker thread of thread pool, so only touch the entry given.
+ */
+static void _xfdashboard_application_database_scan_entry_parse(gpointer inData, gpointer inUserData)
+{
+	XfdashboardApplicationDatabaseScanEntry			*scanEntry;
+	GarconMenuItem									*item;
+
+	g_return_if_fail(inData);
+
+	scanEntry=(XfdashboardApplicationDatabaseScanEntry*)inData;
+
+	/* Parse desktop file and collect data needed to create desktop app info.
+	 * An invalid desktop file has no data.
+	 */
+	item=garcon_menu_item_new(scanEntry->file);
+	if(item)
+	{
+		scanEntry->data=xfdashboard_desktop_app_info_data_new(item);
+		g_object_unref(item);
+	}
+}
+
+/* Parse all found desktop files which changed since cache was created.
+ * Parsing is done at a thread pool if there are enough files to parse.
+ */
+static void _xfdashboard_application_database_scan_entries_parse(XfdashboardApplicationDatabase *self,
+																	GPtrArray *inScanEntries)
+{
+	XfdashboardApplicationDatabaseScanEntry			*scanEntry;
+	GThreadPool										*pool;
+	guint											parseCount;
+	guint											i;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self));
+	g_return_if_fail(inScanEntries);
+
+	/* Count desktop files to parse */
+	parseCount=0;
+	for(i=0; i<inScanEntries->len; i++)
+	{
+		scanEntry=(XfdashboardApplicationDatabaseScanEntry*)g_ptr_array_index(inScanEntries, i);
+		if(!scanEntry->isCached) parseCount++;
+	}
+
+	if(!parseCount) return;
+
+	XFDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Parsing %u of %u desktop files",
+						parseCount,
+						inScanEntries->len);
+
+	/* Start parsing desktop files at thread pool. If no thread pool could be
+	 * created or only a few files need to be parsed, parse them at main thread.
+	 */
+	pool=NULL;
+	if(parseCount>=XFDASHBOARD_APPLICATION_DATABASE_PARSE_THREAD_MIN_FILES)
+	{
+		pool=g_thread_pool_new(_xfdashboard_application_database_scan_entry_parse,
+								NULL,
+								MAX(1, (gint)g_get_num_processors()),
+								FALSE,
+								NULL);
+	}
+
+	for(i=0; i<inScanEntries->len; i++)
+	{
+		scanEntry=(XfdashboardApplicationDatabaseScanEntry*)g_ptr_array_index(inScanEntries, i);
+		if(scanEntry->isCached) continue;
+
+		if(pool) g_thread_pool_push(pool, scanEntry, NULL);
+			else _xfdashboard_application_database_scan_entry_parse(scanEntry, NULL);
+	}
+
+	/* Wait for all desktop files to be parsed */
+	if(pool) g_thread_pool_free(pool, FALSE, TRUE);
+}
+
+/* Add directory to directory watcher but do not fail if directory cannot
+ * be watched on FreeBSD (workaround for Glib bug)
+ */
+static gboolean _xfdashboard_application_database_add_watched_directory(XfdashboardApplicationDatabase *self,
+																		XfdashboardDirectoryWatcher *inWatcher,
+																		GFile *inPath,
+																		GError **outError)
+{
+	gchar											*path;
+	GError											*error;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self), FALSE);
+	g_return_val_if_fail(XFDASHBOARD_IS_DIRECTORY_WATCHER(inWatcher), FALSE);
+	g_return_val_if_fail(G_IS_FILE(inPath), FALSE);
+
+	error=NULL;
+	path=g_file_get_path(inPath);
+
+	if(!xfdashboard_directory_watcher_add(inWatcher, inPath, &error))
+	{
+#if defined(__unix__)
+		/* Workaround for FreeBSD with Glib bug (file/directory monitors cannot be created) */
+		g_warning("[workaround for FreeBSD] Cannot initialize file monitor for path '%s' but will not fail: %s",
+					path,
+					error ? error->message : "Unknown error");
+
+		/* Clear error as this error will not fail at FreeBSD */
+		g_clear_error(&error);
+#else
+		XFDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Failed to initialize file monitor for path '%s'",
+							path);
+
+		/* Propagate error */
+		g_propagate_error(outError, error);
+
+		/* Release allocated resources */
+		if(path) g_free(path);
+
+		return(FALSE);
+#endif
+	}
+
+	/* Release allocated resources */
+	if(path) g_free(path);
+
+	return(TRUE);
+}
+
+/* Collect installed and user-overidden application desktop files from cache
+ * without scanning search paths. Returns FALSE if cache is outdated, i.e.
+ * any scanned directory or desktop file was added or removed since cache
+ * was created, and the search paths need to be scanned.
+ */
+static gboolean _xfdashboard_application_database_scan_cache(XfdashboardApplicationDatabase *self,
+																XfdashboardApplicationDatabaseCache *inCache,
+																GPtrArray *ioScanEntries,
+																XfdashboardApplicationDatabaseCache *ioNewCache)
+{
+	XfdashboardApplicationDatabaseCacheDirectory	*directory;
+	XfdashboardApplicationDatabaseCacheEntry		*entry;
+	GStatBuf										fileInfo;
+	guint											i;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self), FALSE);
+	g_return_val_if_fail(inCache, FALSE);
+	g_return_val_if_fail(ioScanEntries, FALSE);
+	g_return_val_if_fail(ioNewCache, FALSE);
 
-							/* Set a NULL file at desktop app info which causes
-							 * the 'changed' signal to be emitted.
-							 */
-							g_object_set(currentDesktopAppInfo, "file", NULL, NULL);
+	/* Check that no scanned directory was modified since cache was created */
+	for(i=0; i<inCache->directories->len; i++)
+	{
+		directory=(XfdashboardApplicationDatabaseCacheDirectory*)g_ptr_array_index(inCache->directories, i);
+		if(_xfdashboard_application_database_cache_get_directory_mtime(directory->path)!=directory->mtime)
+		{
+			XFDASHBOARD_DEBUG(self, APPLICATIONS,
+								"Application cache is outdated because directory '%s' has changed",
+								directory->path);
+			return(FALSE);
+		}
+	}
 
-							/* Release the extra reference we took */
-							g_object_unref(currentDesktopAppInfo);
-						}
-				}
+	/* Collect all desktop files in cache in the order they were found */
+	for(i=0; i<inCache->entries->len; i++)
+	{
+		GFile										*file;
 
-				/* Release allocated resources */
-				g_free(desktopID);
-			}
+		entry=(XfdashboardApplicationDatabaseCacheEntry*)g_ptr_array_index(inCache->entries, i);
+
+		/* A desktop file vanished, so cache is outdated */
+		if(g_stat(entry->path, &fileInfo)!=0)
+		{
+			XFDASHBOARD_DEBUG(self, APPLICATIONS,
+								"Application cache is outdated because desktop file '%s' was removed",
+								entry->path);
+			return(FALSE);
 		}
+
+		file=g_file_new_for_path(entry->path);
+		g_ptr_array_add(ioScanEntries,
+						_xfdashboard_application_database_scan_entry_new(entry->desktopID,
+																			file,
+																			entry->path,
+																			xfdashboard_get_modification_time(&fileInfo),
+																			(gint64)fileInfo.st_size,
+																			inCache));
+		g_object_unref(file);
 	}
 
-	/* Release allocated resources */
-	if(filePath) g_free(filePath);
+	/* Take over all directories scanned */
+	for(i=0; i<inCache->directories->len; i++)
+	{
+		directory=(XfdashboardApplicationDatabaseCacheDirectory*)g_ptr_array_index(inCache->directories, i);
+		_xfdashboard_application_database_cache_add_directory(ioNewCache, directory->path, directory->mtime);
+	}
+
+	XFDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Collected %u desktop files from application cache",
+						inCache->entries->len);
+
+	/* Desktop files were collected successfully from cache */
+	return(TRUE);
 }
 
-/* Load installed and user-overidden application desktop files */
-static gboolean _xfdashboard_application_database_load_applications_recursive(XfdashboardApplicationDatabase *self,
-																				GFile *inTopLevelPath,
-																				GFile *inCurrentPath,
-																				GHashTable **ioDesktopAppInfos,
-																				GList **ioFileMonitors,
-																				GError **outError)
+/* Collect installed and user-overidden application desktop files by
+ * scanning search path recursively
+ */
+static gboolean _xfdashboard_application_database_scan_recursive(XfdashboardApplicationDatabase *self,
+																	GFile *inTopLevelPath,
+																	GFile *inCurrentPath,
+																	GHashTable *ioFoundDesktopIDs,
+																	GPtrArray *ioScanEntries,
+																	XfdashboardApplicationDatabaseCache *inCache,
+																	XfdashboardApplicationDatabaseCache *ioNewCache,
+																	GError **outError)
 {
 	XfdashboardApplicationDatabasePrivate			*priv G_GNUC_UNUSED;
 	gchar											*topLevelPath;
 	gchar											*path;
 	GFileEnumerator									*enumerator;
 	GFileInfo										*info;
-	XfdashboardApplicationDatabaseFileMonitorData	*monitorData;
 	GError											*error;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self), FALSE);
 	g_return_val_if_fail(G_IS_FILE(inTopLevelPath), FALSE);
 	g_return_val_if_fail(G_IS_FILE(inCurrentPath), FALSE);
-	g_return_val_if_fail(ioDesktopAppInfos && *ioDesktopAppInfos, FALSE);
-	g_return_val_if_fail(ioFileMonitors, FALSE);
+	g_return_val_if_fail(ioFoundDesktopIDs, FALSE);
+	g_return_val_if_fail(ioScanEntries, FALSE);
+	g_return_val_if_fail(ioNewCache, FALSE);
 
 	priv=self->priv;
 	error=NULL;
@@ -715,6 +2105,13 @@ static gboolean _xfdashboard_application_database_load_applications_recursive(Xf
 						path,
 						topLevelPath);
 
+	/* Remember directory and its modification time before scanning it in
+	 * new cache, so any modification while scanning will outdate the cache.
+	 */
+	_xfdashboard_application_database_cache_add_directory(ioNewCache,
+															path,
+															_xfdashboard_application_database_cache_get_directory_mtime(path));
+
 	/* Create enumerator for current path to iterate through path and
 	 * searching for desktop files.
 	 */
@@ -781,12 +2178,14 @@ static gboolean _xfdashboard_application_database_load_applications_recursive(Xf
 				return(FALSE);
 			}
 
-			childSuccess=_xfdashboard_application_database_load_applications_recursive(self,
-																						inTopLevelPath,
-																						childPath,
-																						ioDesktopAppInfos,
-																						ioFileMonitors,
-																						&error);
+			childSuccess=_xfdashboard_application_database_scan_recursive(self,
+																			inTopLevelPath,
+																			childPath,
+																			ioFoundDesktopIDs,
+																			ioScanEntries,
+																			inCache,
+																			ioNewCache,
+																			&error);
 			if(!childSuccess)
 			{
 				XFDASHBOARD_DEBUG(self, APPLICATIONS,
@@ -853,55 +2252,52 @@ static gboolean _xfdashboard_application_database_load_applications_recursive(Xf
 								g_file_info_get_name(info));
 				}
 
-			/* If no desktop app info with determined desktop ID exists
-			 * then create it now.
+			/* If desktop ID was not found before, remember desktop file to
+			 * parse it later. The first desktop file found for a desktop ID -
+			 * valid or invalid - has the highest priority. So even an invalid
+			 * desktop file prevents that a desktop file for the same desktop ID
+			 * at a path of lower priority will be used. Later the caller has to
+			 * ensure that all invalid desktop IDs in the database will be removed.
 			 */
 			if(desktopID &&
-				!g_hash_table_lookup_extended(*ioDesktopAppInfos,
-												desktopID,
-												NULL,
-												NULL))
+				!g_hash_table_contains(ioFoundDesktopIDs, desktopID))
 			{
-				XfdashboardDesktopAppInfo			*appInfo;
-
-				appInfo=XFDASHBOARD_DESKTOP_APP_INFO(g_object_new(XFDASHBOARD_TYPE_DESKTOP_APP_INFO,
-																	"desktop-id", desktopID,
-																	"file", childFile,
-																	NULL));
-				if(xfdashboard_desktop_app_info_is_valid(appInfo))
+				XfdashboardApplicationDatabaseScanEntry	*scanEntry;
+				gchar								*childPath;
+				GStatBuf							childInfo;
+				gint64								childModificationTime;
+				gint64								childSize;
+
+				/* Get modification time in nanoseconds and size of desktop file
+				 * to check if it changed since cache was created. If it cannot
+				 * be determined, it will be parsed again.
+				 */
+				childPath=g_file_get_path(childFile);
+				childModificationTime=-1;
+				childSize=-1;
+				if(g_stat(childPath, &childInfo)==0)
 				{
-					g_hash_table_insert(*ioDesktopAppInfos, g_strdup(desktopID), g_object_ref(appInfo));
-
-					XFDASHBOARD_DEBUG(self, APPLICATIONS,
-										"Found desktop file '%s%s%s' with desktop ID '%s' at search path '%s'",
-										path,
-										G_DIR_SEPARATOR_S,
-										childName,
-										desktopID,
-										topLevelPath);
+					childModificationTime=xfdashboard_get_modification_time(&childInfo);
+					childSize=(gint64)childInfo.st_size;
 				}
-					else
-					{
-						/* Although desktop file for desktop ID is invalid, add
-						 * it to the database to prevent that a valid desktop file
-						 * for the same desktop ID will be found at path of lower
-						 * prioritory which will then be store in the database as
-						 * no entry exists. The first entry found - valid or invalid -
-						 * has the highest priority. Later the caller has to ensure
-						 * that all invalid desktop IDs in the database will be removed.
-						 */
-						g_hash_table_insert(*ioDesktopAppInfos, g_strdup(desktopID), g_object_ref(appInfo));
 
-						XFDASHBOARD_DEBUG(self, APPLICATIONS,
-											"Adding and mark invalid desktop file '%s%s%s' with desktop ID '%s' at search path '%s'",
-											path,
-											G_DIR_SEPARATOR_S,
-											childName,
-											desktopID,
-											topLevelPath);
-					}
+				scanEntry=_xfdashboard_application_database_scan_entry_new(desktopID,
+																			childFile,
+																			childPath,
+																			childModificationTime,
+																			childSize,
+																			inCache);
+				g_ptr_array_add(ioScanEntries, scanEntry);
+				g_hash_table_add(ioFoundDesktopIDs, scanEntry->desktopID);
+				g_free(childPath);
 
-				g_object_unref(appInfo);
+				XFDASHBOARD_DEBUG(self, APPLICATIONS,
+									"Found desktop file '%s%s%s' with desktop ID '%s' at search path '%s'",
+									path,
+									G_DIR_SEPARATOR_S,
+									childName,
+									desktopID,
+									topLevelPath);
 			}
 
 			/* Release allocated resources */
@@ -925,80 +2321,6 @@ static gboolean _xfdashboard_application_database_load_applications_recursive(Xf
 		return(FALSE);
 	}
 
-	/* Iterating through given path was successful so create file monitor
-	 * for this path.
-	 */
-	monitorData=_xfdashboard_application_database_monitor_data_new(inCurrentPath);
-	if(!monitorData)
-	{
-		XFDASHBOARD_DEBUG(self, APPLICATIONS,
-							"Failed to create data object for file monitor for path '%s'",
-							path);
-
-		/* Set error */
-		g_set_error(outError,
-						G_IO_ERROR,
-						G_IO_ERROR_FAILED,
-						"Unable to create file monitor for '%s'",
-						path);
-
-		/* Release allocated resources */
-		if(path) g_free(path);
-		if(topLevelPath) g_free(topLevelPath);
-		if(enumerator) g_object_unref(enumerator);
-
-		return(FALSE);
-	}
-
-	monitorData->monitor=g_file_monitor(inCurrentPath, G_FILE_MONITOR_NONE, NULL, &error);
-	if(!monitorData->monitor && error)
-	{
-#if defined(__unix__)
-		/* Workaround for FreeBSD with Glib bug (file/directory monitors cannot be created) */
-		g_warning("[workaround for FreeBSD] Cannot initialize file monitor for path '%s' but will not fail: %s",
-					path,
-					error ? error->message : "Unknown error");
-
-		/* Clear error as this error will not fail at FreeBSD */
-		g_clear_error(&error);
-#else
-		XFDASHBOARD_DEBUG(self, APPLICATIONS,
-							"Failed to initialize file monitor for path '%s'",
-							path);
-
-		/* Propagate error */
-		g_propagate_error(outError, error);
-
-		/* Release allocated resources */
-		if(monitorData) _xfdashboard_application_database_monitor_data_free(monitorData);
-
-		if(path) g_free(path);
-		if(topLevelPath) g_free(topLevelPath);
-		if(enumerator) g_object_unref(enumerator);
-
-		return(FALSE);
-#endif
-	}
-
-	/* If file monitor could be created, add it to list of file monitors ... */
-	if(monitorData && monitorData->monitor)
-	{
-		*ioFileMonitors=g_list_prepend(*ioFileMonitors, monitorData);
-
-		XFDASHBOARD_DEBUG(self, APPLICATIONS,
-							"Added file monitor for path '%s'",
-							path);
-	}
-		/* ... otherwise free file monitor data */
-		else
-		{
-			if(monitorData) _xfdashboard_application_database_monitor_data_free(monitorData);
-
-			XFDASHBOARD_DEBUG(self, APPLICATIONS,
-								"Destroying file monitor for path '%s'",
-								path);
-		}
-
 	XFDASHBOARD_DEBUG(self, APPLICATIONS,
 						"Finished scanning directory '%s' for search path '%s'",
 						path,
@@ -1017,89 +2339,225 @@ static gboolean _xfdashboard_application_database_load_applications(XfdashboardA
 {
 	XfdashboardApplicationDatabasePrivate			*priv;
 	GHashTable										*apps;
-	GList											*fileMonitors;
+	XfdashboardDirectoryWatcher						*watcher;
 	GError											*error;
 	GList											*iter;
-	XfdashboardApplicationDatabaseFileMonitorData	*monitorData;
+	gchar											*cacheFile;
+	gchar											*cacheKey;
+	XfdashboardApplicationDatabaseCache				*cache;
+	XfdashboardApplicationDatabaseCache				*newCache;
+	GPtrArray										*scanEntries;
+	GHashTable										*foundDesktopIDs;
+	guint											i;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self), FALSE);
 	g_return_val_if_fail(outError && *outError==NULL, FALSE);
 
 	priv=self->priv;
 	error=NULL;
+	cache=NULL;
+
+	/* Load cache of previous scan of search paths */
+	if(_xfdashboard_application_database_cache_get_file_and_key(self, &cacheFile, &cacheKey))
+	{
+		cache=_xfdashboard_application_database_cache_load(self, cacheFile, cacheKey);
+	}
+
+	/* Collect desktop files in three steps. First enumerate files at each path
+	 * in list of search paths and remember only the first occurence of each
+	 * desktop ID. If no directory was modified since cache was created, take
+	 * the desktop files from cache instead of scanning search paths.
+	 */
+	scanEntries=g_ptr_array_new_with_free_func((GDestroyNotify)_xfdashboard_application_database_scan_entry_free);
+	newCache=_xfdashboard_application_database_cache_new();
+
+	if(!cache ||
+		!_xfdashboard_application_database_scan_cache(self, cache, scanEntries, newCache))
+	{
+		/* Discard everything collected from cache so far */
+		g_ptr_array_set_size(scanEntries, 0);
+
+		_xfdashboard_application_database_cache_free(newCache);
+		newCache=_xfdashboard_application_database_cache_new();
+		newCache->isModified=TRUE;
+
+		/* Scan all search paths */
+		foundDesktopIDs=g_hash_table_new(g_str_hash, g_str_equal);
+		for(iter=priv->searchPaths; iter; iter=g_list_next(iter))
+		{
+			const gchar								*path;
+			GFile									*directory;
+
+			/* Iterate through files in current search path recursively and
+			 * for each desktop file remember it but only if it is the first
+			 * occurence of that desktop ID.
+			 */
+			path=(const gchar*)iter->data;
+			directory=g_file_new_for_path(path);
+
+			/* Only scan current search path if path exists and is a directory.
+			 * Otherwise the called function will fail and then this function
+			 * will fail also. But not all search path must exist so check.
+			 * Remember missing search paths in cache to notice when they
+			 * get created.
+			 */
+			if(g_file_query_file_type(directory, G_FILE_QUERY_INFO_NONE, NULL)!=G_FILE_TYPE_DIRECTORY)
+			{
+				_xfdashboard_application_database_cache_add_directory(newCache, path, -1);
+			}
+				else if(!_xfdashboard_application_database_scan_recursive(self, directory, directory, foundDesktopIDs, scanEntries, cache, newCache, &error))
+				{
+					/* Propagate error */
+					g_propagate_error(outError, error);
+
+					/* Release allocated resources */
+					if(foundDesktopIDs) g_hash_table_destroy(foundDesktopIDs);
+					if(scanEntries) g_ptr_array_unref(scanEntries);
+					if(directory) g_object_unref(directory);
+					if(newCache) _xfdashboard_application_database_cache_free(newCache);
+					if(cache) _xfdashboard_application_database_cache_free(cache);
+					if(cacheFile) g_free(cacheFile);
+					if(cacheKey) g_free(cacheKey);
+
+					return(FALSE);
+				}
+
+			if(directory) g_object_unref(directory);
+		}
+		g_hash_table_destroy(foundDesktopIDs);
+	}
+
+	/* Second, parse all collected desktop files which changed since cache
+	 * was created at thread pool.
+	 */
+	_xfdashboard_application_database_scan_entries_parse(self, scanEntries);
 
-	/* Iterate through enumerated files at each path in list of search paths
-	 * and add only the first occurence of each desktop ID. Also set up
-	 * file monitors to get notified if a desktop file changes, was removed
-	 * or a new one added.
+	/* Third, create desktop app info objects for all collected desktop files
+	 * and file monitors for all scanned directories at main thread in one
+	 * batch. File monitors are needed to get notified if a desktop file
+	 * changes, was removed or a new one added.
 	 */
-	fileMonitors=NULL;
 	apps=g_hash_table_new_full(g_str_hash,
 								g_str_equal,
 								g_free,
 								g_object_unref);
 
-	for(iter=priv->searchPaths; iter; iter=g_list_next(iter))
+	for(i=0; i<scanEntries->len; i++)
 	{
-		const gchar							*path;
-		GFile								*directory;
+		XfdashboardApplicationDatabaseScanEntry		*scanEntry;
+		XfdashboardDesktopAppInfo					*appInfo;
 
-		/* Iterate through files in current search path recursively and
-		 * for each desktop file create a desktop app info object but only
-		 * if it is the first occurence of that desktop ID.
-		 */
-		path=(const gchar*)iter->data;
-		directory=g_file_new_for_path(path);
+		scanEntry=(XfdashboardApplicationDatabaseScanEntry*)g_ptr_array_index(scanEntries, i);
 
-		/* Only scan current search path if path exists and is a directory.
-		 * Otherwise the called function will fail and then this function
-		 * will fail also. But not all search path must exist so check.
+		/* Create desktop app info from data parsed at thread pool or taken
+		 * from cache. The desktop file itself is loaded first when any
+		 * information not contained in data is requested. Invalid desktop
+		 * files have no data, so create an invalid desktop app info.
 		 */
-		if(g_file_query_file_type(directory, G_FILE_QUERY_INFO_NONE, NULL)==G_FILE_TYPE_DIRECTORY &&
-			!_xfdashboard_application_database_load_applications_recursive(self, directory, directory, &apps, &fileMonitors, &error))
+		if(scanEntry->data)
 		{
-			/* Propagate error */
-			g_propagate_error(outError, error);
+			appInfo=XFDASHBOARD_DESKTOP_APP_INFO(xfdashboard_desktop_app_info_new_from_data(scanEntry->desktopID,
+																							scanEntry->file,
+																							scanEntry->data));
+		}
+			else
+			{
+				appInfo=XFDASHBOARD_DESKTOP_APP_INFO(xfdashboard_desktop_app_info_new_deferred(scanEntry->desktopID,
+																								scanEntry->file,
+																								FALSE));
+			}
 
-			/* Release allocated resources */
-			if(fileMonitors) g_list_free_full(fileMonitors, g_object_unref);
-			if(apps) g_hash_table_unref(apps);
-			if(directory) g_object_unref(directory);
+		if(scanEntry->isCached) xfdashboard_statistics_add("application-database.cache-hit", 1);
+			else
+			{
+				newCache->isModified=TRUE;
+				xfdashboard_statistics_add("application-database.cache-miss", 1);
+			}
 
-			return(FALSE);
+		/* Remember desktop file in new cache - valid or invalid */
+		_xfdashboard_application_database_cache_add_entry(newCache,
+															scanEntry->desktopID,
+															scanEntry->path,
+															scanEntry->mtime,
+															scanEntry->size,
+															scanEntry->data);
+
+		/* Add only valid desktop IDs to database */
+		if(xfdashboard_desktop_app_info_is_valid(appInfo))
+		{
+			g_hash_table_insert(apps, g_strdup(scanEntry->desktopID), g_object_ref(appInfo));
 		}
+			else
+			{
+				XFDASHBOARD_DEBUG(self, APPLICATIONS,
+									"Skipping invalid desktop ID '%s' at desktop file '%s'",
+									scanEntry->desktopID,
+									scanEntry->path);
+			}
 
-		if(directory) g_object_unref(directory);
+		g_object_unref(appInfo);
 	}
 
-	/* Remove invalid desktop IDs from database */
-	if(apps)
+	watcher=xfdashboard_directory_watcher_new();
+	for(i=0; i<newCache->directories->len; i++)
 	{
-		GHashTableIter								appsIter;
-		const gchar									*desktopID;
-		XfdashboardDesktopAppInfo					*appInfo;
+		XfdashboardApplicationDatabaseCacheDirectory	*directory;
+		GFile										*path;
+		gboolean									success;
+
+		/* Skip search paths which do not exist */
+		directory=(XfdashboardApplicationDatabaseCacheDirectory*)g_ptr_array_index(newCache->directories, i);
+		if(directory->mtime<0) continue;
 
-		g_hash_table_iter_init(&appsIter, apps);
-		while(g_hash_table_iter_next(&appsIter, (gpointer*)&desktopID, (gpointer*)&appInfo))
+		path=g_file_new_for_path(directory->path);
+		success=_xfdashboard_application_database_add_watched_directory(self, watcher, path, &error);
+		g_object_unref(path);
+
+		if(!success)
 		{
-			/* If value for key is invalid then remove this entry now */
-			if(!xfdashboard_desktop_app_info_is_valid(appInfo))
-			{
-				XFDASHBOARD_DEBUG(self, APPLICATIONS,
-									"Removing invalid desktop ID '%s' from application database",
-									desktopID);
+			/* Propagate error */
+			g_propagate_error(outError, error);
 
-				/* Remove entry from hash table via the iterator */
-				g_hash_table_iter_remove(&appsIter);
-			}
+			/* Release allocated resources */
+			if(watcher) g_object_unref(watcher);
+			if(apps) g_hash_table_unref(apps);
+			if(scanEntries) g_ptr_array_unref(scanEntries);
+			if(newCache) _xfdashboard_application_database_cache_free(newCache);
+			if(cache) _xfdashboard_application_database_cache_free(cache);
+			if(cacheFile) g_free(cacheFile);
+			if(cacheKey) g_free(cacheKey);
+
+			return(FALSE);
 		}
 	}
 
+	/* Store result of scan in cache if anything has changed */
+	if(cacheFile &&
+		newCache->isModified &&
+		!_xfdashboard_application_database_cache_save(self, newCache, cacheFile, cacheKey, &error))
+	{
+		g_warning("Could not save application cache to %s: %s",
+					cacheFile,
+					error ? error->message : "Unknown error");
+		g_clear_error(&error);
+	}
+
+	/* Release allocated resources */
+	if(scanEntries) g_ptr_array_unref(scanEntries);
+	if(newCache) _xfdashboard_application_database_cache_free(newCache);
+	if(cache) _xfdashboard_application_database_cache_free(cache);
+	if(cacheFile) g_free(cacheFile);
+	if(cacheKey) g_free(cacheKey);
+
 	XFDASHBOARD_DEBUG(self, APPLICATIONS,
 						"Loaded %u applications desktop files",
 						g_hash_table_size(apps));
 
-	/* Release old list of installed applications and set new one */
+	/* Release old list of installed applications and set new one. Indexes
+	 * are built again on next lookup.
+	 */
+	_xfdashboard_application_database_clear_indexes(self);
+
 	if(priv->applications)
 	{
 		g_hash_table_unref(priv->applications);
@@ -1108,32 +2566,31 @@ static gboolean _xfdashboard_application_database_load_applications(XfdashboardA
 
 	priv->applications=apps;
 
-	/* Release old list of installed applications and set new one.
-	 * Now ee can also connect signals to all file monitors created.
+	/* Release old directory watcher and set new one. Now we can also
+	 * connect signal to directory watcher created.
 	 */
-	if(priv->appDirMonitors)
+	if(priv->appDirWatcher)
 	{
-		for(iter=priv->appDirMonitors; iter; iter=g_list_next(iter))
+		if(priv->appDirWatcherChangedID)
 		{
-			_xfdashboard_application_database_monitor_data_free((XfdashboardApplicationDatabaseFileMonitorData*)iter->data);
+			g_signal_handler_disconnect(priv->appDirWatcher, priv->appDirWatcherChangedID);
+			priv->appDirWatcherChangedID=0;
 		}
-		g_list_free(priv->appDirMonitors);
-		priv->appDirMonitors=NULL;
-	}
 
-	priv->appDirMonitors=fileMonitors;
-	for(iter=priv->appDirMonitors; iter; iter=g_list_next(iter))
-	{
-		monitorData=(XfdashboardApplicationDatabaseFileMonitorData*)iter->data;
-		if(monitorData->monitor)
-		{
-			monitorData->changedID=g_signal_connect_swapped(monitorData->monitor,
-														"changed",
-														G_CALLBACK(_xfdashboard_application_database_on_file_monitor_changed),
-														self);
-		}
+		g_object_unref(priv->appDirWatcher);
+		priv->appDirWatcher=NULL;
 	}
 
+	XFDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Watching %u directories for changes at desktop files",
+						xfdashboard_directory_watcher_get_count(watcher));
+
+	priv->appDirWatcher=watcher;
+	priv->appDirWatcherChangedID=g_signal_connect_swapped(priv->appDirWatcher,
+															"changed",
+															G_CALLBACK(_xfdashboard_application_database_on_directory_watcher_changed),
+															self);
+
 	/* Desktop files were loaded successfully */
 	return(TRUE);
 }
@@ -1203,16 +2660,30 @@ static void _xfdashboard_application_database_clean(XfdashboardApplicationDataba
 	priv=self->priv;
 
 	/* Release allocated resources */
-	if(priv->appDirMonitors)
+	if(priv->pendingChangesTimeoutID)
 	{
-		GList								*iter;
+		g_source_remove(priv->pendingChangesTimeoutID);
+		priv->pendingChangesTimeoutID=0;
+	}
+
+	if(priv->pendingChanges)
+	{
+		g_hash_table_destroy(priv->pendingChanges);
+		priv->pendingChanges=NULL;
+	}
 
-		for(iter=priv->appDirMonitors; iter; iter=g_list_next(iter))
+	priv->pendingMenuReload=FALSE;
+
+	if(priv->appDirWatcher)
+	{
+		if(priv->appDirWatcherChangedID)
 		{
-			_xfdashboard_application_database_monitor_data_free((XfdashboardApplicationDatabaseFileMonitorData*)iter->data);
+			g_signal_handler_disconnect(priv->appDirWatcher, priv->appDirWatcherChangedID);
+			priv->appDirWatcherChangedID=0;
 		}
-		g_list_free(priv->appDirMonitors);
-		priv->appDirMonitors=NULL;
+
+		g_object_unref(priv->appDirWatcher);
+		priv->appDirWatcher=NULL;
 	}
 
 	if(priv->appsMenu)
@@ -1227,6 +2698,8 @@ static void _xfdashboard_application_database_clean(XfdashboardApplicationDataba
 		priv->appsMenu=NULL;
 	}
 
+	_xfdashboard_application_database_clear_indexes(self);
+
 	if(priv->applications)
 	{
 		g_hash_table_unref(priv->applications);
@@ -1356,6 +2829,20 @@ static void xfdashboard_application_database_class_init(XfdashboardApplicationDa
 						G_TYPE_NONE,
 						1,
 						G_TYPE_APP_INFO);
+
+	XfdashboardApplicationDatabaseSignals[SIGNAL_APPLICATIONS_CHANGED]=
+		g_signal_new("applications-changed",
+						G_TYPE_FROM_CLASS(klass),
+						G_SIGNAL_RUN_LAST | G_SIGNAL_NO_HOOKS,
+						G_STRUCT_OFFSET(XfdashboardApplicationDatabaseClass, applications_changed),
+						NULL,
+						NULL,
+						_xfdashboard_marshal_VOID__BOXED_BOXED_BOXED,
+						G_TYPE_NONE,
+						3,
+						G_TYPE_STRV,
+						G_TYPE_STRV,
+						G_TYPE_STRV);
 }
 
 /* Object initialization
@@ -1375,7 +2862,18 @@ static void xfdashboard_application_database_init(XfdashboardApplicationDatabase
 	priv->appsMenu=NULL;
 	priv->appsMenuReloadRequiredID=0;
 	priv->applications=NULL;
-	priv->appDirMonitors=NULL;
+	priv->appDirWatcher=NULL;
+	priv->appDirWatcherChangedID=0;
+	priv->indexedApplications=NULL;
+	priv->startupWMClassIndex=NULL;
+	priv->executableIndex=NULL;
+	priv->executableBasenameIndex=NULL;
+	priv->caseFoldedDesktopIDIndex=NULL;
+	priv->desktopIDSuffixIndex=NULL;
+	priv->pendingChanges=NULL;
+	priv->pendingChangesTimeoutID=0;
+	priv->pendingChangesSince=0;
+	priv->pendingMenuReload=FALSE;
 
 	/* Set up search paths but eliminate duplicates */
 	path=g_build_filename(g_get_user_data_dir(), "applications", NULL);
@@ -1550,6 +3048,144 @@ GAppInfo* xfdashboard_application_database_lookup_desktop_id(XfdashboardApplicat
 	return(NULL);
 }
 
+/* Get GAppInfo for start-up WM class from index.
+ * If a GAppInfo object was found the return object has to be freed
+ * with g_object_unref(). Otherwise NULL will be returned.
+ */
+GAppInfo* xfdashboard_application_database_lookup_startup_wm_class(XfdashboardApplicationDatabase *self,
+																	const gchar *inStartupWMClass)
+{
+	XfdashboardApplicationDatabasePrivate	*priv;
+	GList									*apps;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self), NULL);
+	g_return_val_if_fail(inStartupWMClass && *inStartupWMClass, NULL);
+
+	priv=self->priv;
+
+	/* Lookup start-up WM class in index */
+	_xfdashboard_application_database_ensure_indexes(self);
+	if(!priv->startupWMClassIndex) return(NULL);
+
+	apps=(GList*)g_hash_table_lookup(priv->startupWMClassIndex, inStartupWMClass);
+	if(apps) return(G_APP_INFO(g_object_ref(apps->data)));
+
+	/* Start-up WM class not found, so return NULL */
+	return(NULL);
+}
+
+/* Get GAppInfo for executable from index. If either the executable requested
+ * or the executable of an application is a relative path, only their basenames
+ * are compared. Otherwise the absolute paths must match.
+ * If a GAppInfo object was found the return object has to be freed
+ * with g_object_unref(). Otherwise NULL will be returned.
+ */
+GAppInfo* xfdashboard_application_database_lookup_executable(XfdashboardApplicationDatabase *self,
+																const gchar *inExecutable)
+{
+	XfdashboardApplicationDatabasePrivate	*priv;
+	GList									*apps;
+	gchar									*basename;
+	GAppInfo								*appInfo;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self), NULL);
+	g_return_val_if_fail(inExecutable && *inExecutable, NULL);
+
+	priv=self->priv;
+	appInfo=NULL;
+
+	/* Lookup executable in indexes */
+	_xfdashboard_application_database_ensure_indexes(self);
+	if(!priv->executableIndex || !priv->executableBasenameIndex) return(NULL);
+
+	/* If executable is an absolute path, lookup applications with the same
+	 * absolute path first.
+	 */
+	if(g_path_is_absolute(inExecutable))
+	{
+		apps=(GList*)g_hash_table_lookup(priv->executableIndex, inExecutable);
+		if(apps) return(G_APP_INFO(g_object_ref(apps->data)));
+	}
+
+	/* Lookup applications with the same basename of executable but if
+	 * executable requested is an absolute path, only applications having
+	 * a relative path as executable can match.
+	 */
+	basename=g_path_get_basename(inExecutable);
+	apps=(GList*)g_hash_table_lookup(priv->executableBasenameIndex, basename);
+	for(; apps && !appInfo; apps=g_list_next(apps))
+	{
+		const gchar							*executable;
+
+		executable=g_app_info_get_executable(G_APP_INFO(apps->data));
+		if(!g_path_is_absolute(inExecutable) ||
+			!executable ||
+			!g_path_is_absolute(executable))
+		{
+			appInfo=G_APP_INFO(g_object_ref(apps->data));
+		}
+	}
+	g_free(basename);
+
+	/* Return found application or NULL */
+	return(appInfo);
+}
+
+/* Get GAppInfo for desktop ID from index by comparing desktop IDs case-insensitive.
+ * If a GAppInfo object was found the return object has to be freed
+ * with g_object_unref(). Otherwise NULL will be returned.
+ */
+GAppInfo* xfdashboard_application_database_lookup_desktop_id_nocase(XfdashboardApplicationDatabase *self,
+																	const gchar *inDesktopID)
+{
+	XfdashboardApplicationDatabasePrivate	*priv;
+	GList									*apps;
+	gchar									*caseFoldedDesktopID;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self), NULL);
+	g_return_val_if_fail(inDesktopID && *inDesktopID, NULL);
+
+	priv=self->priv;
+
+	/* Lookup case-folded desktop ID in index */
+	_xfdashboard_application_database_ensure_indexes(self);
+	if(!priv->caseFoldedDesktopIDIndex) return(NULL);
+
+	caseFoldedDesktopID=g_utf8_casefold(inDesktopID, -1);
+	apps=(GList*)g_hash_table_lookup(priv->caseFoldedDesktopIDIndex, caseFoldedDesktopID);
+	g_free(caseFoldedDesktopID);
+
+	if(apps) return(G_APP_INFO(g_object_ref(apps->data)));
+
+	/* Desktop ID not found, so return NULL */
+	return(NULL);
+}
+
+/* Get list of GAppInfo whose desktop ID ends with a dash followed by the
+ * requested suffix, e.g. for desktop files located in sub-directories like
+ * "vendor-name.desktop" for suffix "name.desktop".
+ * The returned list and each object in list have to be freed with
+ * g_list_free_full(list, g_object_unref).
+ */
+GList* xfdashboard_application_database_lookup_desktop_id_suffix(XfdashboardApplicationDatabase *self,
+																	const gchar *inSuffix)
+{
+	XfdashboardApplicationDatabasePrivate	*priv;
+	GList									*apps;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self), NULL);
+	g_return_val_if_fail(inSuffix && *inSuffix, NULL);
+
+	priv=self->priv;
+
+	/* Lookup suffix in index */
+	_xfdashboard_application_database_ensure_indexes(self);
+	if(!priv->desktopIDSuffixIndex) return(NULL);
+
+	apps=(GList*)g_hash_table_lookup(priv->desktopIDSuffixIndex, inSuffix);
+	return(g_list_copy_deep(apps, (GCopyFunc)g_object_ref, NULL));
+}
+
 /* Get path to desktop file for requested desktop ID.
  * Returns NULL if desktop file is invalid or was not found at any search path.
  */
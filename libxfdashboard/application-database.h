@@ -66,6 +66,11 @@ struct _XfdashboardApplicationDatabaseClass
 
 	void (*application_added)(XfdashboardApplicationDatabase *self, GAppInfo *inAppInfo);
 	void (*application_removed)(XfdashboardApplicationDatabase *self, GAppInfo *inAppInfo);
+
+	void (*applications_changed)(XfdashboardApplicationDatabase *self,
+									const gchar **inAddedDesktopIDs,
+									const gchar **inChangedDesktopIDs,
+									const gchar **inRemovedDesktopIDs);
 };
 
 /* Public API */
@@ -81,6 +86,14 @@ GList* xfdashboard_application_database_get_all_applications(XfdashboardApplicat
 
 GAppInfo* xfdashboard_application_database_lookup_desktop_id(XfdashboardApplicationDatabase *self,
 																const gchar *inDesktopID);
+GAppInfo* xfdashboard_application_database_lookup_desktop_id_nocase(XfdashboardApplicationDatabase *self,
+																	const gchar *inDesktopID);
+GList* xfdashboard_application_database_lookup_desktop_id_suffix(XfdashboardApplicationDatabase *self,
+																	const gchar *inSuffix);
+GAppInfo* xfdashboard_application_database_lookup_startup_wm_class(XfdashboardApplicationDatabase *self,
+																	const gchar *inStartupWMClass);
+GAppInfo* xfdashboard_application_database_lookup_executable(XfdashboardApplicationDatabase *self,
+																const gchar *inExecutable);
 
 gchar* xfdashboard_application_database_get_file_from_desktop_id(const gchar *inDesktopID);
 gchar* xfdashboard_application_database_get_desktop_id_from_path(const gchar *inFilename);
@@ -34,6 +34,7 @@
 #include <libxfdashboard/application-database.h>
 #include <libxfdashboard/window-tracker.h>
 #include <libxfdashboard/marshal.h>
+#include <libxfdashboard/statistics.h>
 #include <libxfdashboard/compat.h>
 #include <libxfdashboard/debug.h>
 
@@ -46,6 +47,12 @@ struct _XfdashboardApplicationTrackerPrivate
 
 	XfdashboardApplicationDatabase	*appDatabase;
 	XfdashboardWindowTracker		*windowTracker;
+
+	GHashTable						*launchedDesktopFiles;
+
+	XfdashboardCore					*core;
+	GHashTable						*pendingLaunches;
+	guint							pendingLaunchesExpireID;
 };
 
 G_DEFINE_TYPE_WITH_PRIVATE(XfdashboardApplicationTracker,
@@ -426,102 +433,121 @@ static GHashTable* _xfdashboard_application_tracker_get_environment_from_pid(Xfd
 }
 #endif
 
-/* Get desktop ID from process' environment which owns window.
- * Callee is responsible to free result with g_object_unref().
+/* Get desktop file launched by process from process' environment. The result
+ * is remembered for PID as the environment of a process does not change.
+ * Returns NULL if process was not launched from a desktop file.
  */
-static GAppInfo* _xfdashboard_application_tracker_get_desktop_id_from_environment(XfdashboardApplicationTracker *self,
-																					XfdashboardWindowTrackerWindow *inWindow)
+static const gchar* _xfdashboard_application_tracker_get_launched_desktop_file(XfdashboardApplicationTracker *self,
+																				gint inPID,
+																				XfdashboardWindowTrackerWindow *inWindow)
 {
 	XfdashboardApplicationTrackerPrivate	*priv;
-	GAppInfo								*foundAppInfo;
-	gint									windowPID;
 	GHashTable								*environments;
 	gchar									*value;
 	gint									checkPID;
+	gchar									*desktopFile;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_TRACKER(self), NULL);
+	g_return_val_if_fail(inPID>0, NULL);
 	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_WINDOW(inWindow), NULL);
 
 	priv=self->priv;
-	foundAppInfo=NULL;
 
-	/* Get process ID running this window */
-	windowPID=xfdashboard_window_tracker_window_get_pid(inWindow);
-	if(windowPID<=0)
+	/* Check if environment of process was looked up already. An empty string
+	 * means that process was not launched from a desktop file.
+	 */
+	if(g_hash_table_lookup_extended(priv->launchedDesktopFiles, GINT_TO_POINTER(inPID), NULL, (gpointer*)&desktopFile))
 	{
-		XFDASHBOARD_DEBUG(self, APPLICATIONS,
-							"Could not get PID for window '%s' of a running application to parse environment variables",
-							xfdashboard_window_tracker_window_get_name(inWindow));
-
-		/* Return NULL result */
-		return(NULL);
+		xfdashboard_statistics_add("application-tracker.environment-cache-hit", 1);
+		return(*desktopFile ? desktopFile : NULL);
 	}
 
-	/* Get hash-table with environment variables found for window's PID */
-	environments=_xfdashboard_application_tracker_get_environment_from_pid(self, windowPID);
-	if(!environments)
-	{
-		XFDASHBOARD_DEBUG(self, APPLICATIONS,
-							"Could not get environments for PID %d of windows '%s'",
-							windowPID,
-							xfdashboard_window_tracker_window_get_name(inWindow));
-
-		/* Return NULL result */
-		return(NULL);
-	}
+	xfdashboard_statistics_add("application-tracker.environment-cache-miss", 1);
 
-	/* Check that environment variable GIO_LAUNCHED_DESKTOP_FILE_PID exists.
+	/* Get hash-table with environment variables found for window's PID and
+	 * check that environment variable GIO_LAUNCHED_DESKTOP_FILE_PID exists.
 	 * Also check that the PID in value matches the requested window's PID
 	 * as the process may inherit the environments of its parent process
 	 * but then this one is not the initial process for this application.
+	 * At last check that environment variable GIO_LAUNCHED_DESKTOP_FILE exists.
 	 */
-	if(!g_hash_table_lookup_extended(environments, "GIO_LAUNCHED_DESKTOP_FILE_PID", NULL, (gpointer)&value))
+	desktopFile=NULL;
+	environments=_xfdashboard_application_tracker_get_environment_from_pid(self, inPID);
+	if(!environments)
 	{
 		XFDASHBOARD_DEBUG(self, APPLICATIONS,
-							"Missing 'GIO_LAUNCHED_DESKTOP_FILE_PID' in environment variables for PID %d of windows '%s'",
-							windowPID,
+							"Could not get environments for PID %d of windows '%s'",
+							inPID,
 							xfdashboard_window_tracker_window_get_name(inWindow));
+	}
+		else if(!g_hash_table_lookup_extended(environments, "GIO_LAUNCHED_DESKTOP_FILE_PID", NULL, (gpointer)&value))
+		{
+			XFDASHBOARD_DEBUG(self, APPLICATIONS,
+								"Missing 'GIO_LAUNCHED_DESKTOP_FILE_PID' in environment variables for PID %d of windows '%s'",
+								inPID,
+								xfdashboard_window_tracker_window_get_name(inWindow));
+		}
+		else if((checkPID=atoi(value))!=inPID)
+		{
+			XFDASHBOARD_DEBUG(self, APPLICATIONS,
+								"PID %d of environment variables does not match requested window PID %d for '%s'",
+								checkPID,
+								inPID,
+								xfdashboard_window_tracker_window_get_name(inWindow));
+		}
+		else if(!g_hash_table_lookup_extended(environments, "GIO_LAUNCHED_DESKTOP_FILE", NULL, (gpointer)&value))
+		{
+			XFDASHBOARD_DEBUG(self, APPLICATIONS,
+								"Missing 'GIO_LAUNCHED_DESKTOP_FILE' in environment variables for PID %d of windows '%s'",
+								inPID,
+								xfdashboard_window_tracker_window_get_name(inWindow));
+		}
+		else desktopFile=value;
 
-		/* Release allocated resources */
-		if(environments) g_hash_table_destroy(environments);
+	/* Remember desktop file launched by process */
+	desktopFile=g_strdup(desktopFile ? desktopFile : "");
+	g_hash_table_insert(priv->launchedDesktopFiles, GINT_TO_POINTER(inPID), desktopFile);
 
-		/* Return NULL result */
-		return(NULL);
-	}
+	/* Release allocated resources */
+	if(environments) g_hash_table_destroy(environments);
 
-	checkPID=atoi(value);
-	if(checkPID!=windowPID)
-	{
-		XFDASHBOARD_DEBUG(self, APPLICATIONS,
-							"PID %d of environment variables does not match requested window PID %d for '%s'",
-							checkPID,
-							windowPID,
-							xfdashboard_window_tracker_window_get_name(inWindow));
+	return(*desktopFile ? desktopFile : NULL);
+}
 
-		/* Release allocated resources */
-		if(environments) g_hash_table_destroy(environments);
+/* Get desktop ID from process' environment which owns window.
+ * Callee is responsible to free result with g_object_unref().
+ */
+static GAppInfo* _xfdashboard_application_tracker_get_desktop_id_from_environment(XfdashboardApplicationTracker *self,
+																					XfdashboardWindowTrackerWindow *inWindow)
+{
+	XfdashboardApplicationTrackerPrivate	*priv;
+	GAppInfo								*foundAppInfo;
+	gint									windowPID;
+	const gchar								*value;
 
-		/* Return NULL result */
-		return(NULL);
-	}
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_TRACKER(self), NULL);
+	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_WINDOW(inWindow), NULL);
 
-	/* Check that environment variable GIO_LAUNCHED_DESKTOP_FILE exists and
-	 * lookup application from full path as set in environment's value.
-	 */
-	if(!g_hash_table_lookup_extended(environments, "GIO_LAUNCHED_DESKTOP_FILE", NULL, (gpointer)&value))
+	priv=self->priv;
+	foundAppInfo=NULL;
+
+	/* Get process ID running this window */
+	windowPID=xfdashboard_window_tracker_window_get_pid(inWindow);
+	if(windowPID<=0)
 	{
 		XFDASHBOARD_DEBUG(self, APPLICATIONS,
-							"Missing 'GIO_LAUNCHED_DESKTOP_FILE' in environment variables for PID %d of windows '%s'",
-							windowPID,
+							"Could not get PID for window '%s' of a running application to parse environment variables",
 							xfdashboard_window_tracker_window_get_name(inWindow));
 
-		/* Release allocated resources */
-		if(environments) g_hash_table_destroy(environments);
-
 		/* Return NULL result */
 		return(NULL);
 	}
 
+	/* Get desktop file launched by process from its environment */
+	value=_xfdashboard_application_tracker_get_launched_desktop_file(self, windowPID, inWindow);
+	if(!value) return(NULL);
+
+	/* Lookup application from full path as set in environment's value */
 	foundAppInfo=xfdashboard_application_database_lookup_desktop_id(priv->appDatabase, value);
 	if(!foundAppInfo)
 	{
@@ -534,9 +560,6 @@ static GAppInfo* _xfdashboard_application_tracker_get_desktop_id_from_environmen
 		}
 	}
 
-	/* Release allocated resources */
-	if(environments) g_hash_table_destroy(environments);
-
 	/* Return found application info which may be NULL if not found in
 	 * application database.
 	 */
@@ -548,6 +571,156 @@ static GAppInfo* _xfdashboard_application_tracker_get_desktop_id_from_environmen
 	return(foundAppInfo);
 }
 
+/* Forget desktop file launched by process of window if no other known window
+ * belongs to the same process as PIDs may be reused by new processes.
+ */
+static void _xfdashboard_application_tracker_forget_launched_desktop_file(XfdashboardApplicationTracker *self,
+																			XfdashboardWindowTrackerWindow *inWindow)
+{
+	XfdashboardApplicationTrackerPrivate	*priv;
+	gint									windowPID;
+	GList									*iterApps;
+	GList									*iterWindows;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_TRACKER(self));
+	g_return_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_WINDOW(inWindow));
+
+	priv=self->priv;
+
+	windowPID=xfdashboard_window_tracker_window_get_pid(inWindow);
+	if(windowPID<=0) return;
+
+	/* Check if any other window belongs to the same process */
+	for(iterApps=priv->runningApps; iterApps; iterApps=g_list_next(iterApps))
+	{
+		XfdashboardApplicationTrackerItem	*item;
+
+		item=(XfdashboardApplicationTrackerItem*)iterApps->data;
+		for(iterWindows=item->windows; iterWindows; iterWindows=g_list_next(iterWindows))
+		{
+			if(iterWindows->data!=inWindow &&
+				xfdashboard_window_tracker_window_get_pid(XFDASHBOARD_WINDOW_TRACKER_WINDOW(iterWindows->data))==windowPID)
+			{
+				return;
+			}
+		}
+	}
+
+	/* Forget desktop file launched by process */
+	g_hash_table_remove(priv->launchedDesktopFiles, GINT_TO_POINTER(windowPID));
+}
+
+/* Launched applications which did not open a window within this time, e.g.
+ * command-line tools or applications reusing an existing instance, are
+ * forgotten.
+ */
+#define XFDASHBOARD_APPLICATION_TRACKER_PENDING_LAUNCH_TIMEOUT		60	/* in seconds */
+
+/* Forget launched applications which did not open a window in time */
+static gboolean _xfdashboard_application_tracker_on_expire_pending_launches(gpointer inUserData)
+{
+	XfdashboardApplicationTracker			*self;
+	XfdashboardApplicationTrackerPrivate	*priv;
+	GHashTableIter							iter;
+	gint64									*launchTime;
+	gint64									now;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_TRACKER(inUserData), G_SOURCE_REMOVE);
+
+	self=XFDASHBOARD_APPLICATION_TRACKER(inUserData);
+	priv=self->priv;
+	now=g_get_monotonic_time();
+
+	g_hash_table_iter_init(&iter, priv->pendingLaunches);
+	while(g_hash_table_iter_next(&iter, NULL, (gpointer*)&launchTime))
+	{
+		if(now-*launchTime>=XFDASHBOARD_APPLICATION_TRACKER_PENDING_LAUNCH_TIMEOUT*G_USEC_PER_SEC)
+		{
+			g_hash_table_iter_remove(&iter);
+			xfdashboard_statistics_add("application-tracker.launch-expired", 1);
+		}
+	}
+
+	/* Keep checking as long as launched applications are waiting for their window */
+	if(g_hash_table_size(priv->pendingLaunches)>0) return(G_SOURCE_CONTINUE);
+
+	priv->pendingLaunchesExpireID=0;
+	return(G_SOURCE_REMOVE);
+}
+
+/* An application was launched, so remember time of launch to measure the
+ * time until its first window opens.
+ */
+static void _xfdashboard_application_tracker_on_application_launched(XfdashboardApplicationTracker *self,
+																		GAppInfo *inAppInfo,
+																		gpointer inUserData)
+{
+	XfdashboardApplicationTrackerPrivate	*priv;
+	const gchar								*appID;
+	gint64									*launchTime;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_TRACKER(self));
+	g_return_if_fail(G_IS_APP_INFO(inAppInfo));
+
+	priv=self->priv;
+
+	/* Only remember launch if statistics are collected */
+	if(G_LIKELY(!xfdashboard_statistics_is_enabled())) return;
+
+	appID=g_app_info_get_id(inAppInfo);
+	if(!appID) return;
+
+	launchTime=g_new(gint64, 1);
+	*launchTime=xfdashboard_statistics_begin();
+	g_hash_table_insert(priv->pendingLaunches, g_strdup(appID), launchTime);
+
+	/* Forget launch if application does not open a window in time */
+	if(!priv->pendingLaunchesExpireID)
+	{
+		priv->pendingLaunchesExpireID=g_timeout_add_seconds(XFDASHBOARD_APPLICATION_TRACKER_PENDING_LAUNCH_TIMEOUT,
+															_xfdashboard_application_tracker_on_expire_pending_launches,
+															self);
+	}
+}
+
+/* A window of an application was resolved, so record the time elapsed since
+ * the application was launched if it is its first window after launch.
+ */
+static void _xfdashboard_application_tracker_record_launch_latency(XfdashboardApplicationTracker *self,
+																	GAppInfo *inAppInfo)
+{
+	XfdashboardApplicationTrackerPrivate	*priv;
+	const gchar								*appID;
+	gint64									*launchTime;
+	gchar									*statisticsName;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_TRACKER(self));
+	g_return_if_fail(G_IS_APP_INFO(inAppInfo));
+
+	priv=self->priv;
+
+	/* Check if application was launched and is waiting for its first window */
+	if(G_LIKELY(g_hash_table_size(priv->pendingLaunches)==0)) return;
+
+	appID=g_app_info_get_id(inAppInfo);
+	if(!appID) return;
+
+	launchTime=(gint64*)g_hash_table_lookup(priv->pendingLaunches, appID);
+	if(!launchTime) return;
+
+	/* Record latency for application and forget launch */
+	statisticsName=g_strdup_printf("application-tracker.launch-latency.%s", appID);
+	xfdashboard_statistics_end(statisticsName, *launchTime);
+	g_free(statisticsName);
+
+	XFDASHBOARD_DEBUG(self, APPLICATIONS,
+						"First window of launched application '%s' opened after %" G_GINT64_FORMAT " microseconds",
+						appID,
+						g_get_monotonic_time()-*launchTime);
+
+	g_hash_table_remove(priv->pendingLaunches, appID);
+}
+
 /* A window was created */
 static void _xfdashboard_application_tracker_on_window_opened(XfdashboardApplicationTracker *self,
 																XfdashboardWindowTrackerWindow *inWindow,
@@ -609,6 +782,9 @@ static void _xfdashboard_application_tracker_on_window_opened(XfdashboardApplica
 						xfdashboard_window_tracker_window_get_name(inWindow),
 						g_app_info_get_id(appInfo));
 
+	/* Record time to first window if application was launched */
+	_xfdashboard_application_tracker_record_launch_latency(self, appInfo);
+
 	/* Create application tracker item if no one exists for application and window ... */
 	item= _xfdashboard_application_tracker_find_item_by_app_info(self, appInfo);
 	if(!item)
@@ -667,6 +843,9 @@ static void _xfdashboard_application_tracker_on_window_closed(XfdashboardApplica
 						xfdashboard_window_tracker_window_get_name(inWindow),
 						item->desktopID);
 
+	/* Forget environment of process if this was its last window */
+	_xfdashboard_application_tracker_forget_launched_desktop_file(self, inWindow);
+
 	/* Remove window from found application tracker item */
 	_xfdashboard_application_tracker_item_remove_window(item, inWindow);
 
@@ -782,6 +961,30 @@ static void _xfdashboard_application_tracker_dispose(GObject *inObject)
 		priv->appDatabase=NULL;
 	}
 
+	if(priv->launchedDesktopFiles)
+	{
+		g_hash_table_destroy(priv->launchedDesktopFiles);
+		priv->launchedDesktopFiles=NULL;
+	}
+
+	if(priv->core)
+	{
+		g_signal_handlers_disconnect_by_data(priv->core, self);
+		priv->core=NULL;
+	}
+
+	if(priv->pendingLaunchesExpireID)
+	{
+		g_source_remove(priv->pendingLaunchesExpireID);
+		priv->pendingLaunchesExpireID=0;
+	}
+
+	if(priv->pendingLaunches)
+	{
+		g_hash_table_destroy(priv->pendingLaunches);
+		priv->pendingLaunches=NULL;
+	}
+
 	/* Call parent's class dispose method */
 	G_OBJECT_CLASS(xfdashboard_application_tracker_parent_class)->dispose(inObject);
 }
@@ -825,6 +1028,10 @@ static void xfdashboard_application_tracker_init(XfdashboardApplicationTracker *
 	priv->runningApps=NULL;
 	priv->appDatabase=xfdashboard_core_get_application_database(NULL);
 	priv->windowTracker=xfdashboard_core_get_window_tracker(NULL);
+	priv->launchedDesktopFiles=g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+	priv->core=xfdashboard_core_get_default();
+	priv->pendingLaunches=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+	priv->pendingLaunchesExpireID=0;
 
 	/* Load application database if not done already */
 	if(!xfdashboard_application_database_is_loaded(priv->appDatabase))
@@ -845,6 +1052,14 @@ static void xfdashboard_application_tracker_init(XfdashboardApplicationTracker *
 								"active-window-changed",
 								G_CALLBACK(_xfdashboard_application_tracker_on_active_window_changed),
 								self);
+
+	if(priv->core)
+	{
+		g_signal_connect_swapped(priv->core,
+									"application-launched",
+									G_CALLBACK(_xfdashboard_application_tracker_on_application_launched),
+									self);
+	}
 }
 
 /* IMPLEMENTATION: Public API */
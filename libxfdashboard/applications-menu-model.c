@@ -34,6 +34,8 @@
 #include <libxfdashboard/application-database.h>
 #include <libxfdashboard/compat.h>
 #include <libxfdashboard/debug.h>
+#include <libxfdashboard/statistics.h>
+#include <libxfdashboard/profiler.h>
 
 
 /* Define these classes in GObject system */
@@ -41,15 +43,34 @@ struct _XfdashboardApplicationsMenuModelPrivate
 {
 	/* Instance related */
 	GarconMenu						*rootMenu;
+	GHashTable						*menuKeys;
+	GHashTable						*menusByDirectory;
+	GHashTable						*menusByName;
 
 	XfdashboardApplicationDatabase	*appDB;
 	guint							reloadRequiredSignalID;
+
+	gboolean						isLazy;
+	gboolean						isLoadRequested;
+	guint							loadIdleID;
 };
 
 G_DEFINE_TYPE_WITH_PRIVATE(XfdashboardApplicationsMenuModel,
 							xfdashboard_applications_menu_model,
 							XFDASHBOARD_TYPE_MODEL)
 
+/* Properties */
+enum
+{
+	PROP_0,
+
+	PROP_LAZY,
+
+	PROP_LAST
+};
+
+static GParamSpec* XfdashboardApplicationsMenuModelProperties[PROP_LAST]={ 0, };
+
 /* Signals */
 enum
 {
@@ -65,20 +86,31 @@ typedef struct _XfdashboardApplicationsMenuModelFillData		XfdashboardApplication
 struct _XfdashboardApplicationsMenuModelFillData
 {
 	gint				sequenceID;
-	GSList				*populatedMenus;
+	GPtrArray			*items;
+	GHashTable			*usedKeys;
 };
 
 typedef struct _XfdashboardApplicationsMenuModelItem			XfdashboardApplicationsMenuModelItem;
 struct _XfdashboardApplicationsMenuModelItem
 {
 	guint				sequenceID;
+	gchar				*key;
 	GarconMenuElement	*menuElement;
 	GarconMenu			*parentMenu;
+	gchar				*parentKey;
 	GarconMenu			*section;
+	gchar				*sectionKey;
 	gchar				*title;
 	gchar				*description;
 };
 
+/* Each menu added to model is identified by a key which is built from its
+ * directory or - if it has none - from its name, comment and icon. This key
+ * is stable over reloads of the menu, so rows of model can be matched with
+ * the menu elements of a reloaded menu. The root menu uses an empty key.
+ */
+#define XFDASHBOARD_APPLICATIONS_MENU_MODEL_ROOT_KEY	""
+
 /* Forward declarations */
 static void _xfdashboard_applications_menu_model_fill_model(XfdashboardApplicationsMenuModel *self);
 
@@ -88,9 +120,12 @@ static void _xfdashboard_applications_menu_model_item_free(XfdashboardApplicatio
 	if(inItem)
 	{
 		/* Release allocated resources in item */
+		if(inItem->key) g_free(inItem->key);
 		if(inItem->menuElement) g_object_unref(inItem->menuElement);
 		if(inItem->parentMenu) g_object_unref(inItem->parentMenu);
+		if(inItem->parentKey) g_free(inItem->parentKey);
 		if(inItem->section) g_object_unref(inItem->section);
+		if(inItem->sectionKey) g_free(inItem->sectionKey);
 		if(inItem->title) g_free(inItem->title);
 		if(inItem->description) g_free(inItem->description);
 
@@ -111,60 +146,139 @@ static XfdashboardApplicationsMenuModelItem* _xfdashboard_applications_menu_mode
 	return(item);
 }
 
+/* Check if both items of application menu model are equal in all values
+ * shown to user and in their location in menu
+ */
+static gboolean _xfdashboard_applications_menu_model_item_equal(XfdashboardApplicationsMenuModelItem *inLeft,
+																XfdashboardApplicationsMenuModelItem *inRight)
+{
+	const gchar									*leftIconName;
+	const gchar									*rightIconName;
+
+	g_return_val_if_fail(inLeft, FALSE);
+	g_return_val_if_fail(inRight, FALSE);
+
+	/* Check key, title, description and location in menu */
+	if(g_strcmp0(inLeft->key, inRight->key)!=0) return(FALSE);
+	if(g_strcmp0(inLeft->title, inRight->title)!=0) return(FALSE);
+	if(g_strcmp0(inLeft->description, inRight->description)!=0) return(FALSE);
+	if(g_strcmp0(inLeft->parentKey, inRight->parentKey)!=0) return(FALSE);
+	if(g_strcmp0(inLeft->sectionKey, inRight->sectionKey)!=0) return(FALSE);
+
+	/* Check icon */
+	leftIconName=NULL;
+	if(inLeft->menuElement) leftIconName=garcon_menu_element_get_icon_name(inLeft->menuElement);
+
+	rightIconName=NULL;
+	if(inRight->menuElement) rightIconName=garcon_menu_element_get_icon_name(inRight->menuElement);
+
+	if(g_strcmp0(leftIconName, rightIconName)!=0) return(FALSE);
+
+	/* If we get here both items are equal */
+	return(TRUE);
+}
+
+/* Take over menu elements of other item. The menu elements of the item taking
+ * them over are moved to the other one, so they are released when the other
+ * item is freed.
+ */
+static void _xfdashboard_applications_menu_model_item_take(XfdashboardApplicationsMenuModelItem *self,
+															XfdashboardApplicationsMenuModelItem *inOther)
+{
+	GarconMenuElement							*menuElement;
+	GarconMenu									*parentMenu;
+	GarconMenu									*section;
+
+	g_return_if_fail(self);
+	g_return_if_fail(inOther);
+
+	self->sequenceID=inOther->sequenceID;
+
+	menuElement=self->menuElement;
+	self->menuElement=inOther->menuElement;
+	inOther->menuElement=menuElement;
+
+	parentMenu=self->parentMenu;
+	self->parentMenu=inOther->parentMenu;
+	inOther->parentMenu=parentMenu;
+
+	section=self->section;
+	self->section=inOther->section;
+	inOther->section=section;
+}
+
 /* A menu was changed and needs to be reloaded */
 static void _xfdashboard_applications_menu_model_on_reload_required(XfdashboardApplicationsMenuModel *self,
 																	gpointer inUserData)
 {
 	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(inUserData));
 
+	/* Nothing to reload if model was not requested to load yet. It will be
+	 * filled with the current menu when it gets loaded the first time.
+	 */
+	if(!self->priv->isLoadRequested) return;
+
 	/* Reload menu by filling it again. This also emits all necessary signals. */
 	XFDASHBOARD_DEBUG(self, APPLICATIONS, "Applications menu has changed and needs to be reloaded.");
 	_xfdashboard_applications_menu_model_fill_model(self);
 }
 
-/* Clear all data in model and also release all allocated resources needed for this model */
-static void _xfdashboard_applications_menu_model_clear(XfdashboardApplicationsMenuModel *self)
+/* Get keys to lookup similar menus by their directory or by their name,
+ * description and icon
+ */
+static gchar* _xfdashboard_applications_menu_model_get_directory_key(GarconMenu *inMenu)
 {
-	XfdashboardApplicationsMenuModelPrivate		*priv;
+	GarconMenuDirectory							*directory;
+	GFile										*file;
 
-	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_MENU_MODEL(self));
+	g_return_val_if_fail(GARCON_IS_MENU(inMenu), NULL);
 
-	priv=self->priv;
+	/* Get file of directory of menu */
+	directory=garcon_menu_get_directory(inMenu);
+	if(!directory) return(NULL);
 
-	/* Unset filter (forces all rows being accessible and not being skipped/filtered) */
-	xfdashboard_model_set_filter(XFDASHBOARD_MODEL(self), NULL, NULL, NULL);
+	file=garcon_menu_directory_get_file(directory);
+	if(!file) return(NULL);
 
-	/* Clean up and remove all rows */
-	xfdashboard_model_remove_all(XFDASHBOARD_MODEL(self));
+	/* Return key */
+	return(g_file_get_uri(file));
+}
 
-	/* Destroy root menu */
-	if(priv->rootMenu)
-	{
-		g_object_unref(priv->rootMenu);
-		priv->rootMenu=NULL;
-	}
+static gchar* _xfdashboard_applications_menu_model_get_name_key(GarconMenu *inMenu)
+{
+	const gchar									*name;
+	const gchar									*comment;
+	const gchar									*iconName;
+
+	g_return_val_if_fail(GARCON_IS_MENU(inMenu), NULL);
+
+	name=garcon_menu_element_get_name(GARCON_MENU_ELEMENT(inMenu));
+	comment=garcon_menu_element_get_comment(GARCON_MENU_ELEMENT(inMenu));
+	iconName=garcon_menu_element_get_icon_name(GARCON_MENU_ELEMENT(inMenu));
+
+	/* Return key */
+	return(g_strdup_printf("%s\x1f%s\x1f%s",
+							name ? name : "",
+							comment ? comment : "",
+							iconName ? iconName : ""));
 }
 
 /* Helper function to filter model data */
 static gboolean _xfdashboard_applications_menu_model_filter_by_menu(XfdashboardModelIter *inIter,
 																	gpointer inUserData)
 {
-	XfdashboardApplicationsMenuModel			*model;
-	XfdashboardApplicationsMenuModelPrivate		*modelPriv;
 	gboolean									doShow;
-	GarconMenu									*requestedParentMenu;
+	const gchar									*requestedParentMenuKey;
 	XfdashboardApplicationsMenuModelItem		*item;
 	GarconMenuItemPool							*itemPool;
 	const gchar									*desktopID;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_MODEL_ITER(inIter), FALSE);
-	g_return_val_if_fail(GARCON_IS_MENU(inUserData), FALSE);
+	g_return_val_if_fail(inUserData, FALSE);
 	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_MENU_MODEL(xfdashboard_model_iter_get_model(inIter)), FALSE);
 
 	doShow=FALSE;
-	requestedParentMenu=GARCON_MENU(inUserData);
-	model=XFDASHBOARD_APPLICATIONS_MENU_MODEL(xfdashboard_model_iter_get_model(inIter));
-	modelPriv=model->priv;
+	requestedParentMenuKey=(const gchar*)inUserData;
 
 	/* Get menu element at iterator */
 	item=(XfdashboardApplicationsMenuModelItem*)xfdashboard_model_iter_get(inIter);
@@ -179,11 +293,7 @@ static gboolean _xfdashboard_applications_menu_model_filter_by_menu(XfdashboardM
 	/* If menu element is a menu check if it's parent menu is the requested one */
 	if(GARCON_IS_MENU(item->menuElement))
 	{
-		if(requestedParentMenu==item->parentMenu ||
-			(!requestedParentMenu && item->parentMenu==modelPriv->rootMenu))
-		{
-			doShow=TRUE;
-		}
+		if(g_strcmp0(item->parentKey, requestedParentMenuKey)==0) doShow=TRUE;
 	}
 		/* Otherwise it is a menu item and check if item is in requested menu */
 		else
@@ -202,46 +312,27 @@ static gboolean _xfdashboard_applications_menu_model_filter_by_menu(XfdashboardM
 	return(doShow);
 }
 
-static gboolean _xfdashboard_applications_menu_model_filter_by_section(XfdashboardModelIter *inIter,
-																		gpointer inUserData)
+/* Helper function to index model data by section */
+static const gchar* _xfdashboard_applications_menu_model_index_by_section(XfdashboardModelIter *inIter,
+																			gpointer inUserData)
 {
-	XfdashboardApplicationsMenuModel			*model;
-	XfdashboardApplicationsMenuModelPrivate		*modelPriv;
-	gboolean									doShow;
-	GarconMenu									*requestedSection;
 	XfdashboardApplicationsMenuModelItem		*item;
 
-	g_return_val_if_fail(XFDASHBOARD_IS_MODEL_ITER(inIter), FALSE);
-	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_MENU_MODEL(xfdashboard_model_iter_get_model(inIter)), FALSE);
-	g_return_val_if_fail(GARCON_IS_MENU(inUserData), FALSE);
-
-	doShow=FALSE;
-	requestedSection=GARCON_MENU(inUserData);
-	model=XFDASHBOARD_APPLICATIONS_MENU_MODEL(xfdashboard_model_iter_get_model(inIter));
-	modelPriv=model->priv;
-
-	/* Check if root section is requested */
-	if(!requestedSection) requestedSection=modelPriv->rootMenu;
+	g_return_val_if_fail(XFDASHBOARD_IS_MODEL_ITER(inIter), NULL);
 
 	/* Get menu element at iterator */
 	item=(XfdashboardApplicationsMenuModelItem*)xfdashboard_model_iter_get(inIter);
 
-	/* If menu element is a menu check if root menu is parent menu and root menu is requested */
-	if((item->section && item->section==requestedSection) ||
-		(!item->section && requestedSection==modelPriv->rootMenu))
-	{
-		doShow=TRUE;
-	}
+	/* Menu elements without section belong to root section */
+	if(!item->sectionKey) return(XFDASHBOARD_APPLICATIONS_MENU_MODEL_ROOT_KEY);
 
-	/* If we get here return TRUE to show model data item or FALSE to hide */
-	return(doShow);
+	return(item->sectionKey);
 }
 
 static gboolean _xfdashboard_applications_menu_model_filter_empty(XfdashboardModelIter *inIter,
 																	gpointer inUserData)
 {
 	g_return_val_if_fail(XFDASHBOARD_IS_MODEL_ITER(inIter), FALSE);
-	g_return_val_if_fail(GARCON_IS_MENU(inUserData), FALSE);
 
 	/* This functions always returns FALSE because each entry is considered empty and hidden */
 	return(FALSE);
@@ -249,102 +340,41 @@ static gboolean _xfdashboard_applications_menu_model_filter_empty(XfdashboardMod
 
 /* Fill model */
 static GarconMenu* _xfdashboard_applications_menu_model_find_similar_menu(XfdashboardApplicationsMenuModel *self,
-																			GarconMenu *inMenu,
-																			XfdashboardApplicationsMenuModelFillData *inFillData)
+																			GarconMenu *inMenu)
 {
-	GarconMenu					*parentMenu;
-	GSList						*iter;
-	GarconMenu					*foundMenu;
+	XfdashboardApplicationsMenuModelPrivate		*priv;
+	GarconMenu									*foundMenu;
+	gchar										*key;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_MENU_MODEL(self), NULL);
 	g_return_val_if_fail(GARCON_IS_MENU(inMenu), NULL);
-	g_return_val_if_fail(inFillData, NULL);
+
+	priv=self->priv;
 
 	/* Check if menu is visible. Hidden menus do not need to be checked. */
 	if(!garcon_menu_element_get_visible(GARCON_MENU_ELEMENT(inMenu))) return(NULL);
 
-	/* Get parent menu to look for at each menu we iterate */
-	parentMenu=garcon_menu_get_parent(inMenu);
-	if(!parentMenu) return(NULL);
+	/* Root menu has no similar menu */
+	if(!garcon_menu_get_parent(inMenu)) return(NULL);
 
-	/* Iterate through parent menu up to current menu and lookup similar menu.
-	 * A similar menu is identified by either they share the same directory
-	 * or match in name, description and icon.
+	/* Lookup similar menu among the menus added to model. A similar menu is
+	 * identified by either they share the same directory or match in name,
+	 * description and icon.
 	 */
 	foundMenu=NULL;
-	for(iter=inFillData->populatedMenus; iter && !foundMenu; iter=g_slist_next(iter))
-	{
-		GarconMenu				*iterMenu;
-
-		/* Get menu element from list */
-		iterMenu=GARCON_MENU(iter->data);
-
-		/* We can only process menus which have the same parent menu as the
-		 * requested menu and they need to be visible.
-		 */
-		if(garcon_menu_get_parent(iterMenu) &&
-			garcon_menu_element_get_visible(GARCON_MENU_ELEMENT(iterMenu)))
-		{
-			gboolean			isSimilar;
-			GarconMenuDirectory	*iterMenuDirectory;
-			GarconMenuDirectory	*menuDirectory;
-
-			/* Check if both menus share the same directory. That will be the
-			 * case if iterator point to the menu which was given as function
-			 * parameter. So it's safe just to iterate through.
-			 */
-			iterMenuDirectory=garcon_menu_get_directory(iterMenu);
-			menuDirectory=garcon_menu_get_directory(inMenu);
-
-			isSimilar=FALSE;
-			if(iterMenuDirectory && menuDirectory)
-			{
-				isSimilar=garcon_menu_directory_equal(iterMenuDirectory, menuDirectory);
-			}
-
-			/* If both menus do not share the same directory, check if they
-			 * match in name, description and icon.
-			 */
-			if(!isSimilar)
-			{
-				const gchar		*left;
-				const gchar		*right;
-
-				/* Reset similar flag to TRUE as it will be set to FALSE again
-				 * on first item not matching.
-				 */
-				isSimilar=TRUE;
-
-				/* Check title */
-				if(isSimilar)
-				{
-					left=garcon_menu_element_get_name(GARCON_MENU_ELEMENT(inMenu));
-					right=garcon_menu_element_get_name(GARCON_MENU_ELEMENT(iterMenu));
-					if(g_strcmp0(left, right)!=0) isSimilar=FALSE;
-				}
 
+	key=_xfdashboard_applications_menu_model_get_directory_key(inMenu);
+	if(key)
+	{
+		foundMenu=GARCON_MENU(g_hash_table_lookup(priv->menusByDirectory, key));
+		g_free(key);
+	}
 
-				/* Check description */
-				if(isSimilar)
-				{
-					left=garcon_menu_element_get_comment(GARCON_MENU_ELEMENT(inMenu));
-					right=garcon_menu_element_get_comment(GARCON_MENU_ELEMENT(iterMenu));
-					if(g_strcmp0(left, right)!=0) isSimilar=FALSE;
-				}
-
-
-				/* Check icon */
-				if(isSimilar)
-				{
-					left=garcon_menu_element_get_icon_name(GARCON_MENU_ELEMENT(inMenu));
-					right=garcon_menu_element_get_icon_name(GARCON_MENU_ELEMENT(iterMenu));
-					if(g_strcmp0(left, right)!=0) isSimilar=FALSE;
-				}
-			}
-
-			/* If we get and we found a similar menu set result to return */
-			if(isSimilar) foundMenu=iterMenu;
-		}
+	if(!foundMenu)
+	{
+		key=_xfdashboard_applications_menu_model_get_name_key(inMenu);
+		foundMenu=GARCON_MENU(g_hash_table_lookup(priv->menusByName, key));
+		g_free(key);
 	}
 
 	/* Return found menu */
@@ -352,8 +382,7 @@ static GarconMenu* _xfdashboard_applications_menu_model_find_similar_menu(Xfdash
 }
 
 static GarconMenu* _xfdashboard_applications_menu_model_find_section(XfdashboardApplicationsMenuModel *self,
-																		GarconMenu *inMenu,
-																		XfdashboardApplicationsMenuModelFillData *inFillData)
+																		GarconMenu *inMenu)
 {
 	XfdashboardApplicationsMenuModelPrivate		*priv;
 	GarconMenu									*sectionMenu;
@@ -386,13 +415,147 @@ static GarconMenu* _xfdashboard_applications_menu_model_find_section(Xfdashboard
 	/* Find similar menu to found section menu */
 	if(sectionMenu)
 	{
-		sectionMenu=_xfdashboard_applications_menu_model_find_similar_menu(self, sectionMenu, inFillData);
+		sectionMenu=_xfdashboard_applications_menu_model_find_similar_menu(self, sectionMenu);
 	}
 
 	/* Return found section menu */
 	return(sectionMenu);
 }
 
+/* Get key of a menu added to model or of the root menu. Menus not added to
+ * model themselves are resolved to the similar menu added to model.
+ */
+static const gchar* _xfdashboard_applications_menu_model_get_menu_key(XfdashboardApplicationsMenuModel *self,
+																		GarconMenu *inMenu)
+{
+	XfdashboardApplicationsMenuModelPrivate		*priv;
+	const gchar									*key;
+	GarconMenu									*similarMenu;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_MENU_MODEL(self), NULL);
+	g_return_val_if_fail(GARCON_IS_MENU(inMenu), NULL);
+
+	priv=self->priv;
+
+	/* A menu without parent is the root menu */
+	if(!garcon_menu_get_parent(inMenu)) return(XFDASHBOARD_APPLICATIONS_MENU_MODEL_ROOT_KEY);
+
+	/* Lookup key of menu directly */
+	key=(const gchar*)g_hash_table_lookup(priv->menuKeys, inMenu);
+	if(key) return(key);
+
+	/* Otherwise lookup key of similar menu */
+	similarMenu=_xfdashboard_applications_menu_model_find_similar_menu(self, inMenu);
+	if(similarMenu) return((const gchar*)g_hash_table_lookup(priv->menuKeys, similarMenu));
+
+	/* If we get here the menu is unknown */
+	return(NULL);
+}
+
+/* Add menu to lookup tables for similar menus and return its key */
+static const gchar* _xfdashboard_applications_menu_model_register_menu(XfdashboardApplicationsMenuModel *self,
+																		GarconMenu *inMenu)
+{
+	XfdashboardApplicationsMenuModelPrivate		*priv;
+	gchar										*directoryKey;
+	gchar										*nameKey;
+	gchar										*key;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_MENU_MODEL(self), NULL);
+	g_return_val_if_fail(GARCON_IS_MENU(inMenu), NULL);
+
+	priv=self->priv;
+
+	directoryKey=_xfdashboard_applications_menu_model_get_directory_key(inMenu);
+	nameKey=_xfdashboard_applications_menu_model_get_name_key(inMenu);
+
+	/* Prefer directory as key of menu as it is more stable */
+	if(directoryKey) key=g_strconcat("directory:", directoryKey, NULL);
+		else key=g_strconcat("menu:", nameKey, NULL);
+
+	g_hash_table_insert(priv->menuKeys, inMenu, key);
+
+	/* Store menu at lookup tables. The tables take ownership of the keys. */
+	if(directoryKey) g_hash_table_insert(priv->menusByDirectory, directoryKey, inMenu);
+	g_hash_table_insert(priv->menusByName, nameKey, inMenu);
+
+	/* Return key of menu */
+	return(key);
+}
+
+static void _xfdashboard_applications_menu_model_fill_model_add_item(XfdashboardApplicationsMenuModel *self,
+																		GarconMenuElement *inMenuElement,
+																		GarconMenu *inParentMenu,
+																		GarconMenu *inSection,
+																		XfdashboardApplicationsMenuModelFillData *inFillData)
+{
+	XfdashboardApplicationsMenuModelItem			*item;
+	const gchar										*parentKey;
+	const gchar										*temp;
+	guint											occurrences;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_MENU_MODEL(self));
+	g_return_if_fail(GARCON_IS_MENU_ELEMENT(inMenuElement));
+	g_return_if_fail(GARCON_IS_MENU(inParentMenu));
+	g_return_if_fail(inFillData);
+
+	/* Create item */
+	inFillData->sequenceID++;
+
+	parentKey=_xfdashboard_applications_menu_model_get_menu_key(self, inParentMenu);
+
+	item=_xfdashboard_applications_menu_model_item_new();
+	item->sequenceID=inFillData->sequenceID;
+	item->menuElement=g_object_ref(inMenuElement);
+	item->parentMenu=g_object_ref(inParentMenu);
+	item->parentKey=g_strdup(parentKey);
+	if(inSection)
+	{
+		item->section=g_object_ref(inSection);
+		item->sectionKey=g_strdup(_xfdashboard_applications_menu_model_get_menu_key(self, inSection));
+	}
+
+	/* To increase performance when sorting of filtering this model by title or description
+	 * in a case-insensitive way store title and description in lower case.
+	 */
+	temp=garcon_menu_element_get_name(inMenuElement);
+	if(temp) item->title=g_utf8_strdown(temp, -1);
+
+	temp=garcon_menu_element_get_comment(inMenuElement);
+	if(temp) item->description=g_utf8_strdown(temp, -1);
+
+	/* Build key of item. Menus use the key they were registered with. Menu items
+	 * are identified by their desktop ID in the menu they were added to. The same
+	 * desktop ID may be added more than once to the same menu if it is merged from
+	 * similar menus, so count the occurrences of each key to keep them unique.
+	 */
+	if(GARCON_IS_MENU(inMenuElement))
+	{
+		item->key=g_strdup(_xfdashboard_applications_menu_model_get_menu_key(self, GARCON_MENU(inMenuElement)));
+	}
+		else
+		{
+			temp=NULL;
+			if(GARCON_IS_MENU_ITEM(inMenuElement)) temp=garcon_menu_item_get_desktop_id(GARCON_MENU_ITEM(inMenuElement));
+
+			item->key=g_strdup_printf("item:%s\x1f%s", parentKey ? parentKey : "", temp ? temp : "");
+		}
+
+	occurrences=GPOINTER_TO_UINT(g_hash_table_lookup(inFillData->usedKeys, item->key));
+	if(occurrences>0)
+	{
+		gchar										*uniqueKey;
+
+		uniqueKey=g_strdup_printf("%s\x1f%u", item->key, occurrences);
+		g_free(item->key);
+		item->key=uniqueKey;
+	}
+	g_hash_table_insert(inFillData->usedKeys, g_strdup(item->key), GUINT_TO_POINTER(occurrences+1));
+
+	/* Add item to list of items for model */
+	g_ptr_array_add(inFillData->items, item);
+}
+
 static void _xfdashboard_applications_menu_model_fill_model_collect_menu(XfdashboardApplicationsMenuModel *self,
 																			GarconMenu *inMenu,
 																			GarconMenu *inParentMenu,
@@ -402,7 +565,6 @@ static void _xfdashboard_applications_menu_model_fill_model_collect_menu(Xfdashb
 	GarconMenu										*menu;
 	GarconMenu										*section;
 	GList											*elements, *element;
-	XfdashboardApplicationsMenuModelItem			*item;
 
 	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_MENU_MODEL(self));
 	g_return_if_fail(GARCON_IS_MENU(inMenu));
@@ -418,54 +580,29 @@ static void _xfdashboard_applications_menu_model_fill_model_collect_menu(Xfdashb
 	if(inMenu!=priv->rootMenu)
 	{
 		/* Find section to add menu to */
-		section=_xfdashboard_applications_menu_model_find_section(self, inMenu, inFillData);
+		section=_xfdashboard_applications_menu_model_find_section(self, inMenu);
 
 		/* Add menu to model if no duplicate or similar menu exist */
-		menu=_xfdashboard_applications_menu_model_find_similar_menu(self, inMenu, inFillData);
+		menu=_xfdashboard_applications_menu_model_find_similar_menu(self, inMenu);
 		if(!menu)
 		{
-			gchar									*title;
-			gchar									*description;
-			const gchar								*temp;
-
-			/* To increase performance when sorting of filtering this model by title or description
-			 * in a case-insensitive way store title and description in lower case.
-			 */
-			temp=garcon_menu_element_get_name(GARCON_MENU_ELEMENT(inMenu));
-			if(temp) title=g_utf8_strdown(temp, -1);
-				else title=NULL;
-
-			temp=garcon_menu_element_get_comment(GARCON_MENU_ELEMENT(inMenu));
-			if(temp) description=g_utf8_strdown(temp, -1);
-				else description=NULL;
+			/* Add menu to lookup tables of populated ones */
+			_xfdashboard_applications_menu_model_register_menu(self, inMenu);
 
 			/* Insert row into model because there is no duplicate
 			 * and no similar menu
 			 */
-			inFillData->sequenceID++;
-
-			item=_xfdashboard_applications_menu_model_item_new();
-			item->sequenceID=inFillData->sequenceID;
-			if(inMenu) item->menuElement=GARCON_MENU_ELEMENT(g_object_ref(inMenu));
-			if(inParentMenu) item->parentMenu=g_object_ref(inParentMenu);
-			if(section) item->section=g_object_ref(section);
-			if(title) item->title=g_strdup(title);
-			if(description) item->description=g_strdup(description);
-
-			xfdashboard_model_append(XFDASHBOARD_MODEL(self), item, NULL);
-
-			/* Add menu to list of populated ones */
-			inFillData->populatedMenus=g_slist_prepend(inFillData->populatedMenus, inMenu);
+			_xfdashboard_applications_menu_model_fill_model_add_item(self,
+																		GARCON_MENU_ELEMENT(inMenu),
+																		inParentMenu,
+																		section,
+																		inFillData);
 
 			/* All menu items should be added to this newly created menu */
 			menu=inMenu;
 
 			/* Find section of newly created menu to */
-			section=_xfdashboard_applications_menu_model_find_section(self, menu, inFillData);
-
-			/* Release allocated resources */
-			g_free(title);
-			g_free(description);
+			section=_xfdashboard_applications_menu_model_find_section(self, menu);
 		}
 	}
 
@@ -493,37 +630,7 @@ static void _xfdashboard_applications_menu_model_fill_model_collect_menu(Xfdashb
 		if(GARCON_IS_MENU_ITEM(menuElement) &&
 			menu!=priv->rootMenu)
 		{
-			gchar									*title;
-			gchar									*description;
-			const gchar								*temp;
-
-			/* To increase performance when sorting of filtering this model by title or description
-			 * in a case-insensitive way store title and description in lower case.
-			 */
-			temp=garcon_menu_element_get_name(GARCON_MENU_ELEMENT(menuElement));
-			if(temp) title=g_utf8_strdown(temp, -1);
-				else title=NULL;
-
-			temp=garcon_menu_element_get_comment(GARCON_MENU_ELEMENT(menuElement));
-			if(temp) description=g_utf8_strdown(temp, -1);
-				else description=NULL;
-
-			/* Add menu item to model */
-			inFillData->sequenceID++;
-
-			item=_xfdashboard_applications_menu_model_item_new();
-			item->sequenceID=inFillData->sequenceID;
-			if(menuElement) item->menuElement=g_object_ref(menuElement);
-			if(menu) item->parentMenu=g_object_ref(menu);
-			if(section) item->section=g_object_ref(section);
-			if(title) item->title=g_strdup(title);
-			if(description) item->description=g_strdup(description);
-
-			xfdashboard_model_append(XFDASHBOARD_MODEL(self), item, NULL);
-
-			/* Release allocated resources */
-			g_free(title);
-			g_free(description);
+			_xfdashboard_applications_menu_model_fill_model_add_item(self, menuElement, menu, section, inFillData);
 		}
 	}
 	g_list_free(elements);
@@ -532,18 +639,195 @@ static void _xfdashboard_applications_menu_model_fill_model_collect_menu(Xfdashb
 	g_object_unref(inMenu);
 }
 
+/* Update rows of model to match the collected items by removing, inserting
+ * and changing only those rows which differ. Rows are matched by their keys.
+ * Each item is either taken over by model or freed.
+ */
+static void _xfdashboard_applications_menu_model_fill_model_update_rows(XfdashboardApplicationsMenuModel *self,
+																		GPtrArray *inItems)
+{
+	XfdashboardModel								*model;
+	GHashTable										*newPositions;
+	GHashTable										*oldPositions;
+	XfdashboardApplicationsMenuModelItem			*newItem;
+	XfdashboardApplicationsMenuModelItem			*oldItem;
+	gint											rows;
+	gint											row;
+	guint											i;
+	guint											rowsAdded;
+	guint											rowsRemoved;
+	guint											rowsChanged;
+	guint											rowsUnchanged;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_MENU_MODEL(self));
+	g_return_if_fail(inItems);
+
+	model=XFDASHBOARD_MODEL(self);
+	rowsAdded=0;
+	rowsRemoved=0;
+	rowsChanged=0;
+	rowsUnchanged=0;
+
+	/* If model is empty add all collected items at once */
+	if(xfdashboard_model_get_rows_count(model)==0)
+	{
+		xfdashboard_model_append_many(model, inItems);
+
+		XFDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Filled applications menu model with %u rows",
+							inItems->len);
+
+		xfdashboard_statistics_add("applications-menu-model.rows-added", inItems->len);
+		return;
+	}
+
+	/* Remember position of each collected item by its key */
+	newPositions=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+	for(i=0; i<inItems->len; i++)
+	{
+		newItem=(XfdashboardApplicationsMenuModelItem*)g_ptr_array_index(inItems, i);
+		g_hash_table_insert(newPositions, g_strdup(newItem->key), GUINT_TO_POINTER(i));
+	}
+
+	/* Remove all rows whose key does not exist anymore */
+	rows=xfdashboard_model_get_rows_count(model);
+	for(row=rows-1; row>=0; row--)
+	{
+		oldItem=(XfdashboardApplicationsMenuModelItem*)xfdashboard_model_get(model, row);
+		if(!g_hash_table_contains(newPositions, oldItem->key))
+		{
+			xfdashboard_model_remove(model, row);
+			rowsRemoved++;
+		}
+	}
+
+	/* Remember position of each remaining row by its key */
+	oldPositions=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+	rows=xfdashboard_model_get_rows_count(model);
+	for(row=0; row<rows; row++)
+	{
+		oldItem=(XfdashboardApplicationsMenuModelItem*)xfdashboard_model_get(model, row);
+		g_hash_table_insert(oldPositions, g_strdup(oldItem->key), GINT_TO_POINTER(row));
+	}
+
+	/* Iterate through collected items and bring rows into same order. All rows
+	 * before the current position match the collected items already.
+	 */
+	i=0;
+	while(i<inItems->len)
+	{
+		newItem=(XfdashboardApplicationsMenuModelItem*)g_ptr_array_index(inItems, i);
+
+		oldItem=NULL;
+		rows=xfdashboard_model_get_rows_count(model);
+		if((gint)i<rows) oldItem=(XfdashboardApplicationsMenuModelItem*)xfdashboard_model_get(model, i);
+
+		/* If row at current position has the same key, keep row and only
+		 * replace its data if anything visible has changed.
+		 */
+		if(oldItem && g_strcmp0(oldItem->key, newItem->key)==0)
+		{
+			g_hash_table_remove(oldPositions, oldItem->key);
+
+			if(_xfdashboard_applications_menu_model_item_equal(oldItem, newItem))
+			{
+				/* Row is unchanged but must refer to the reloaded menu elements */
+				_xfdashboard_applications_menu_model_item_take(oldItem, newItem);
+				_xfdashboard_applications_menu_model_item_free(newItem);
+				rowsUnchanged++;
+			}
+				else
+				{
+					xfdashboard_model_set(model, i, newItem);
+					rowsChanged++;
+				}
+
+			i++;
+			continue;
+		}
+
+		/* Row at current position has another key. If the collected item
+		 * exists at a later row, either the row at current position or the
+		 * row of the collected item was moved. Remove the one which moved
+		 * the larger distance as it will be inserted again at its new position.
+		 */
+		if(oldItem && g_hash_table_contains(oldPositions, newItem->key))
+		{
+			guint									oldItemNewPosition;
+			gint									newItemOldPosition;
+
+			oldItemNewPosition=GPOINTER_TO_UINT(g_hash_table_lookup(newPositions, oldItem->key));
+			newItemOldPosition=GPOINTER_TO_INT(g_hash_table_lookup(oldPositions, newItem->key));
+			if(oldItemNewPosition>(guint)newItemOldPosition)
+			{
+				g_hash_table_remove(oldPositions, oldItem->key);
+				xfdashboard_model_remove(model, i);
+				rowsRemoved++;
+				continue;
+			}
+
+			for(row=i+1; row<rows; row++)
+			{
+				oldItem=(XfdashboardApplicationsMenuModelItem*)xfdashboard_model_get(model, row);
+				if(g_strcmp0(oldItem->key, newItem->key)==0)
+				{
+					g_hash_table_remove(oldPositions, oldItem->key);
+					xfdashboard_model_remove(model, row);
+					rowsRemoved++;
+					break;
+				}
+			}
+		}
+
+		/* Insert collected item at current position */
+		rows=xfdashboard_model_get_rows_count(model);
+		if((gint)i<rows) xfdashboard_model_insert(model, i, newItem, NULL);
+			else xfdashboard_model_append(model, newItem, NULL);
+		rowsAdded++;
+		i++;
+	}
+
+	XFDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Updated applications menu model: %u rows added, %u rows removed, %u rows changed, %u rows unchanged",
+						rowsAdded,
+						rowsRemoved,
+						rowsChanged,
+						rowsUnchanged);
+
+	xfdashboard_statistics_add("applications-menu-model.rows-added", rowsAdded);
+	xfdashboard_statistics_add("applications-menu-model.rows-removed", rowsRemoved);
+	xfdashboard_statistics_add("applications-menu-model.rows-changed", rowsChanged);
+	xfdashboard_statistics_add("applications-menu-model.rows-unchanged", rowsUnchanged);
+
+	/* Release allocated resources */
+	g_hash_table_destroy(oldPositions);
+	g_hash_table_destroy(newPositions);
+}
+
 static void _xfdashboard_applications_menu_model_fill_model(XfdashboardApplicationsMenuModel *self)
 {
 	XfdashboardApplicationsMenuModelPrivate		*priv;
 	GarconMenuItemCache							*cache;
 	XfdashboardApplicationsMenuModelFillData	fillData;
+	GarconMenu									*oldRootMenu;
+	gint64										profilerBegin;
 
 	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_MENU_MODEL(self));
 
 	priv=self->priv;
 
-	/* Clear model data */
-	_xfdashboard_applications_menu_model_clear(self);
+	profilerBegin=xfdashboard_profiler_begin("applications");
+
+	/* Keep previous menu alive until signal "loaded" was emitted, so handlers
+	 * can lookup the menus they refer to at the reloaded menu.
+	 */
+	oldRootMenu=priv->rootMenu;
+	priv->rootMenu=NULL;
+
+	/* Clear lookup tables of menus as they refer to previous menu */
+	g_hash_table_remove_all(priv->menuKeys);
+	g_hash_table_remove_all(priv->menusByDirectory);
+	g_hash_table_remove_all(priv->menusByName);
 
 	/* Clear garcon's menu item cache otherwise some items will not be loaded
 	 * if this is a reload of the model or a second(, third, ...) instance of model
@@ -555,28 +839,60 @@ static void _xfdashboard_applications_menu_model_fill_model(XfdashboardApplicati
 	/* Load root menu */
 	priv->rootMenu=xfdashboard_application_database_get_application_menu(priv->appDB);
 
-	/* Iterate through menus recursively to add them to model */
+	/* Iterate through menus recursively to collect the items for model and
+	 * update the rows of model which differ from collected ones
+	 */
 	fillData.sequenceID=0;
-	fillData.populatedMenus=NULL;
+	fillData.items=g_ptr_array_new();
+	fillData.usedKeys=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
 	_xfdashboard_applications_menu_model_fill_model_collect_menu(self, priv->rootMenu, NULL, &fillData);
+	_xfdashboard_applications_menu_model_fill_model_update_rows(self, fillData.items);
+
+	xfdashboard_profiler_end("applications", "applications-menu-model.fill", profilerBegin);
 
 	/* Emit signal */
 	g_signal_emit(self, XfdashboardApplicationsMenuModelSignals[SIGNAL_LOADED], 0);
 
 	/* Release allocated resources at fill data structure */
-	if(fillData.populatedMenus) g_slist_free(fillData.populatedMenus);
+	g_ptr_array_free(fillData.items, TRUE);
+	g_hash_table_destroy(fillData.usedKeys);
+
+	if(oldRootMenu) g_object_unref(oldRootMenu);
 }
 
 /* Idle callback to fill model */
-static gboolean _xfdashboard_applications_menu_model_init_idle(gpointer inUserData)
+static gboolean _xfdashboard_applications_menu_model_load_idle(gpointer inUserData)
 {
-	_xfdashboard_applications_menu_model_fill_model(XFDASHBOARD_APPLICATIONS_MENU_MODEL(inUserData));
+	XfdashboardApplicationsMenuModel			*self;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_MENU_MODEL(inUserData), G_SOURCE_REMOVE);
+
+	self=XFDASHBOARD_APPLICATIONS_MENU_MODEL(inUserData);
+
+	self->priv->loadIdleID=0;
+	_xfdashboard_applications_menu_model_fill_model(self);
+
 	return(G_SOURCE_REMOVE);
 }
 
 
 /* IMPLEMENTATION: GObject */
 
+/* Object was fully constructed */
+static void _xfdashboard_applications_menu_model_constructed(GObject *inObject)
+{
+	XfdashboardApplicationsMenuModel			*self=XFDASHBOARD_APPLICATIONS_MENU_MODEL(inObject);
+
+	/* Call parent's class constructed method */
+	if(G_OBJECT_CLASS(xfdashboard_applications_menu_model_parent_class)->constructed)
+	{
+		G_OBJECT_CLASS(xfdashboard_applications_menu_model_parent_class)->constructed(inObject);
+	}
+
+	/* Fill model now unless it should be loaded on request only */
+	if(!self->priv->isLazy) xfdashboard_applications_menu_model_load(self);
+}
+
 /* Dispose this object */
 static void _xfdashboard_applications_menu_model_dispose(GObject *inObject)
 {
@@ -584,6 +900,30 @@ static void _xfdashboard_applications_menu_model_dispose(GObject *inObject)
 	XfdashboardApplicationsMenuModelPrivate		*priv=self->priv;
 
 	/* Release allocated resources */
+	if(priv->loadIdleID)
+	{
+		g_source_remove(priv->loadIdleID);
+		priv->loadIdleID=0;
+	}
+
+	if(priv->menuKeys)
+	{
+		g_hash_table_destroy(priv->menuKeys);
+		priv->menuKeys=NULL;
+	}
+
+	if(priv->menusByDirectory)
+	{
+		g_hash_table_destroy(priv->menusByDirectory);
+		priv->menusByDirectory=NULL;
+	}
+
+	if(priv->menusByName)
+	{
+		g_hash_table_destroy(priv->menusByName);
+		priv->menusByName=NULL;
+	}
+
 	if(priv->rootMenu)
 	{
 		g_object_unref(priv->rootMenu);
@@ -606,6 +946,45 @@ static void _xfdashboard_applications_menu_model_dispose(GObject *inObject)
 	G_OBJECT_CLASS(xfdashboard_applications_menu_model_parent_class)->dispose(inObject);
 }
 
+/* Set/get properties */
+static void _xfdashboard_applications_menu_model_set_property(GObject *inObject,
+																guint inPropID,
+																const GValue *inValue,
+																GParamSpec *inSpec)
+{
+	XfdashboardApplicationsMenuModel			*self=XFDASHBOARD_APPLICATIONS_MENU_MODEL(inObject);
+
+	switch(inPropID)
+	{
+		case PROP_LAZY:
+			self->priv->isLazy=g_value_get_boolean(inValue);
+			break;
+
+		default:
+			G_OBJECT_WARN_INVALID_PROPERTY_ID(inObject, inPropID, inSpec);
+			break;
+	}
+}
+
+static void _xfdashboard_applications_menu_model_get_property(GObject *inObject,
+																guint inPropID,
+																GValue *outValue,
+																GParamSpec *inSpec)
+{
+	XfdashboardApplicationsMenuModel			*self=XFDASHBOARD_APPLICATIONS_MENU_MODEL(inObject);
+
+	switch(inPropID)
+	{
+		case PROP_LAZY:
+			g_value_set_boolean(outValue, self->priv->isLazy);
+			break;
+
+		default:
+			G_OBJECT_WARN_INVALID_PROPERTY_ID(inObject, inPropID, inSpec);
+			break;
+	}
+}
+
 /* Class initialization
  * Override functions in parent classes and define properties
  * and signals
@@ -614,7 +993,20 @@ static void xfdashboard_applications_menu_model_class_init(XfdashboardApplicatio
 {
 	GObjectClass			*gobjectClass=G_OBJECT_CLASS(klass);
 
+	gobjectClass->constructed=_xfdashboard_applications_menu_model_constructed;
 	gobjectClass->dispose=_xfdashboard_applications_menu_model_dispose;
+	gobjectClass->set_property=_xfdashboard_applications_menu_model_set_property;
+	gobjectClass->get_property=_xfdashboard_applications_menu_model_get_property;
+
+	/* Define properties */
+	XfdashboardApplicationsMenuModelProperties[PROP_LAZY]=
+		g_param_spec_boolean("lazy",
+								"Lazy",
+								"Whether the model is filled not before it is requested to load",
+								FALSE,
+								G_PARAM_READWRITE | G_PARAM_CONSTRUCT_ONLY | G_PARAM_STATIC_STRINGS);
+
+	g_object_class_install_properties(gobjectClass, PROP_LAST, XfdashboardApplicationsMenuModelProperties);
 
 	/* Define signals */
 	XfdashboardApplicationsMenuModelSignals[SIGNAL_LOADED]=
@@ -640,8 +1032,14 @@ static void xfdashboard_applications_menu_model_init(XfdashboardApplicationsMenu
 
 	/* Set up default values */
 	priv->rootMenu=NULL;
+	priv->menuKeys=g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+	priv->menusByDirectory=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+	priv->menusByName=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
 	priv->appDB=NULL;
 	priv->reloadRequiredSignalID=0;
+	priv->isLazy=FALSE;
+	priv->isLoadRequested=FALSE;
+	priv->loadIdleID=0;
 
 	/* Get application database and connect signals */
 	priv->appDB=xfdashboard_core_get_application_database(NULL);
@@ -649,8 +1047,12 @@ static void xfdashboard_applications_menu_model_init(XfdashboardApplicationsMenu
 															"menu-reload-required",
 															G_CALLBACK(_xfdashboard_applications_menu_model_on_reload_required),
 															self);
-	/* Defer filling model */
-	clutter_threads_add_idle(_xfdashboard_applications_menu_model_init_idle, self);
+	/* Index rows by section to filter sections quickly */
+	xfdashboard_model_add_index(XFDASHBOARD_MODEL(self),
+								"section",
+								_xfdashboard_applications_menu_model_index_by_section,
+								NULL,
+								NULL);
 }
 
 
@@ -671,6 +1073,44 @@ XfdashboardModel* xfdashboard_applications_menu_model_new(void)
 	return(XFDASHBOARD_MODEL(model));
 }
 
+/* Create a new instance of application menu model which is not filled
+ * before xfdashboard_applications_menu_model_load() is called
+ */
+XfdashboardModel* xfdashboard_applications_menu_model_new_lazy(void)
+{
+	GObject		*model;
+
+	/* Create instance */
+	model=g_object_new(XFDASHBOARD_TYPE_APPLICATIONS_MENU_MODEL,
+						"free-data-callback", _xfdashboard_applications_menu_model_item_free,
+						"lazy", TRUE,
+						NULL);
+	if(!model) return(NULL);
+
+	/* Return new instance */
+	return(XFDASHBOARD_MODEL(model));
+}
+
+/* Request model to get filled with the application menu. The model is filled
+ * asynchronously only once, so it is safe to call this function multiple times.
+ * Afterwards it reloads itself whenever the application menu changes.
+ */
+void xfdashboard_applications_menu_model_load(XfdashboardApplicationsMenuModel *self)
+{
+	XfdashboardApplicationsMenuModelPrivate		*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_MENU_MODEL(self));
+
+	priv=self->priv;
+
+	/* Do nothing if model was requested to load already */
+	if(priv->isLoadRequested) return;
+
+	/* Defer filling model */
+	priv->isLoadRequested=TRUE;
+	priv->loadIdleID=clutter_threads_add_idle(_xfdashboard_applications_menu_model_load_idle, self);
+}
+
 /* Get values from application menu model at requested iterator and columns */
 void xfdashboard_applications_menu_model_get(XfdashboardApplicationsMenuModel *self,
 												XfdashboardModelIter *inIter,
@@ -773,6 +1213,7 @@ void xfdashboard_applications_menu_model_filter_by_menu(XfdashboardApplicationsM
 														GarconMenu *inMenu)
 {
 	XfdashboardApplicationsMenuModelPrivate		*priv;
+	const gchar									*menuKey;
 
 	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_MENU_MODEL(self));
 	g_return_if_fail(inMenu==NULL || GARCON_IS_MENU(inMenu));
@@ -782,11 +1223,26 @@ void xfdashboard_applications_menu_model_filter_by_menu(XfdashboardApplicationsM
 	/* If menu is NULL filter root menu */
 	if(inMenu==NULL) inMenu=priv->rootMenu;
 
-	/* Filter model data */
-	xfdashboard_model_set_filter(XFDASHBOARD_MODEL(self),
-									_xfdashboard_applications_menu_model_filter_by_menu,
-									g_object_ref(inMenu),
-									g_object_unref);
+	/* Filter model data by key of menu. The key is interned so setting
+	 * the same menu again does not change the filter.
+	 */
+	menuKey=NULL;
+	if(inMenu) menuKey=_xfdashboard_applications_menu_model_get_menu_key(self, inMenu);
+
+	if(menuKey)
+	{
+		xfdashboard_model_set_filter(XFDASHBOARD_MODEL(self),
+										_xfdashboard_applications_menu_model_filter_by_menu,
+										(gpointer)g_intern_string(menuKey),
+										NULL);
+	}
+		else
+		{
+			xfdashboard_model_set_filter(XFDASHBOARD_MODEL(self),
+											_xfdashboard_applications_menu_model_filter_empty,
+											NULL,
+											NULL);
+		}
 }
 
 /* Filter menu items being an indirect child item of requested section */
@@ -794,6 +1250,7 @@ void xfdashboard_applications_menu_model_filter_by_section(XfdashboardApplicatio
 															GarconMenu *inSection)
 {
 	XfdashboardApplicationsMenuModelPrivate		*priv;
+	const gchar									*sectionKey;
 
 	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_MENU_MODEL(self));
 	g_return_if_fail(inSection==NULL || GARCON_IS_MENU(inSection));
@@ -803,16 +1260,16 @@ void xfdashboard_applications_menu_model_filter_by_section(XfdashboardApplicatio
 	/* If requested section is NULL filter root menu */
 	if(!inSection) inSection=priv->rootMenu;
 
-	/* Filter model data */
-	if(inSection)
+	/* Filter model data by key of section at index of sections */
+	sectionKey=NULL;
+	if(inSection) sectionKey=_xfdashboard_applications_menu_model_get_menu_key(self, inSection);
+
+	if(sectionKey)
 	{
 		XFDASHBOARD_DEBUG(self, APPLICATIONS,
 							"Filtering section '%s'",
 							garcon_menu_element_get_name(GARCON_MENU_ELEMENT(inSection)));
-		xfdashboard_model_set_filter(XFDASHBOARD_MODEL(self),
-										_xfdashboard_applications_menu_model_filter_by_section,
-										g_object_ref(inSection),
-										g_object_unref);
+		xfdashboard_model_set_filter_by_index(XFDASHBOARD_MODEL(self), "section", sectionKey);
 	}
 		else
 		{
@@ -823,3 +1280,27 @@ void xfdashboard_applications_menu_model_filter_by_section(XfdashboardApplicatio
 											NULL);
 		}
 }
+
+/* Lookup menu at current menu of model which is the same as or similar to
+ * requested menu. The requested menu may belong to a previous menu of model,
+ * e.g. while handling signal "loaded" after the menu was reloaded.
+ */
+GarconMenu* xfdashboard_applications_menu_model_lookup_menu(XfdashboardApplicationsMenuModel *self,
+															GarconMenu *inMenu)
+{
+	XfdashboardApplicationsMenuModelPrivate		*priv;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_MENU_MODEL(self), NULL);
+	g_return_val_if_fail(GARCON_IS_MENU(inMenu), NULL);
+
+	priv=self->priv;
+
+	/* A menu without parent is the root menu */
+	if(!garcon_menu_get_parent(inMenu)) return(priv->rootMenu);
+
+	/* Check if menu was added to model */
+	if(g_hash_table_contains(priv->menuKeys, inMenu)) return(inMenu);
+
+	/* Otherwise return similar menu added to model if any */
+	return(_xfdashboard_applications_menu_model_find_similar_menu(self, inMenu));
+}
@@ -87,6 +87,9 @@ enum
 GType xfdashboard_applications_menu_model_get_type(void) G_GNUC_CONST;
 
 XfdashboardModel* xfdashboard_applications_menu_model_new(void);
+XfdashboardModel* xfdashboard_applications_menu_model_new_lazy(void);
+
+void xfdashboard_applications_menu_model_load(XfdashboardApplicationsMenuModel *self);
 
 void xfdashboard_applications_menu_model_get(XfdashboardApplicationsMenuModel *self,
 												XfdashboardModelIter *inIter,
@@ -97,6 +100,9 @@ void xfdashboard_applications_menu_model_filter_by_menu(XfdashboardApplicationsM
 void xfdashboard_applications_menu_model_filter_by_section(XfdashboardApplicationsMenuModel *self,
 															GarconMenu *inSection);
 
+GarconMenu* xfdashboard_applications_menu_model_lookup_menu(XfdashboardApplicationsMenuModel *self,
+															GarconMenu *inMenu);
+
 G_END_DECLS
 
 #endif	/* __LIBXFDASHBOARD_APPLICATIONS_MENU_MODEL__ */
@@ -50,6 +50,7 @@
 #include <libxfdashboard/popup-menu-item-separator.h>
 #include <libxfdashboard/application-tracker.h>
 #include <libxfdashboard/compat.h>
+#include <libxfdashboard/statistics.h>
 #include <libxfdashboard/debug.h>
 
 
@@ -64,6 +65,7 @@ struct _XfdashboardApplicationsViewPrivate
 	gchar								*parentMenuIcon;
 	gchar								*formatTitleOnly;
 	gchar								*formatTitleDescription;
+	gboolean							virtualized;
 
 	/* Instance related */
 	ClutterLayoutManager				*layout;
@@ -74,6 +76,13 @@ struct _XfdashboardApplicationsViewPrivate
 
 	gboolean							showAllAppsMenu;
 	GBinding							*settingsShowAllAppsMenuBinding;
+
+	GHashTable							*itemActors;
+	GHashTable							*placeholders;
+	guint								itemsCount;
+	gfloat								placeholderWidth;
+	gfloat								placeholderHeight;
+	guint								materializeRepaintID;
 };
 
 G_DEFINE_TYPE_WITH_CODE(XfdashboardApplicationsView,
@@ -96,6 +105,8 @@ enum
 
 	PROP_SHOW_ALL_APPS,
 
+	PROP_VIRTUALIZED,
+
 	PROP_LAST
 };
 
@@ -104,8 +115,11 @@ static GParamSpec* XfdashboardApplicationsViewProperties[PROP_LAST]={ 0, };
 /* IMPLEMENTATION: Private variables and methods */
 #define ALL_APPLICATIONS_MENU_ICON		"applications-other"
 
+#define VIRTUALIZED_MARGIN_PAGES		1.0f	/* Number of pages above and below visible area to create actors for */
+
 /* Forward declarations */
 static void _xfdashboard_applications_view_on_item_clicked(XfdashboardApplicationsView *self, gpointer inUserData);
+static void _xfdashboard_applications_view_queue_materialize(XfdashboardApplicationsView *self);
 
 /* Set up child actor for current view mode */
 static void _xfdashboard_applications_view_setup_actor_for_view_mode(XfdashboardApplicationsView *self, ClutterActor *inActor)
@@ -431,6 +445,456 @@ static void _xfdashboard_applications_view_on_popup_menu(XfdashboardApplications
 	}
 }
 
+/* Create actor for an application */
+static ClutterActor* _xfdashboard_applications_view_create_actor_for_app_info(XfdashboardApplicationsView *self,
+																				GAppInfo *inAppInfo)
+{
+	ClutterActor						*actor;
+	ClutterAction						*clickAction;
+	ClutterAction						*dragAction;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self), NULL);
+	g_return_val_if_fail(G_IS_APP_INFO(inAppInfo), NULL);
+
+	/* Create actor for app info */
+	actor=xfdashboard_application_button_new_from_app_info(inAppInfo);
+
+	g_signal_connect_swapped(actor, "clicked", G_CALLBACK(_xfdashboard_applications_view_on_item_clicked), self);
+
+	/* Set up and add pop-up menu click action */
+	clickAction=xfdashboard_click_action_new();
+	g_signal_connect_swapped(clickAction, "clicked", G_CALLBACK(_xfdashboard_applications_view_on_popup_menu), self);
+	clutter_actor_add_action(actor, clickAction);
+
+	/* Add drag action to actor */
+	dragAction=xfdashboard_drag_action_new_with_source(CLUTTER_ACTOR(self));
+	clutter_drag_action_set_drag_threshold(CLUTTER_DRAG_ACTION(dragAction), -1, -1);
+	clutter_actor_add_action(actor, dragAction);
+	g_signal_connect(dragAction, "drag-begin", G_CALLBACK(_xfdashboard_applications_view_on_drag_begin), self);
+	g_signal_connect(dragAction, "drag-end", G_CALLBACK(_xfdashboard_applications_view_on_drag_end), self);
+
+	return(actor);
+}
+
+/* Create actor for a menu */
+static ClutterActor* _xfdashboard_applications_view_create_actor_for_menu(XfdashboardApplicationsView *self,
+																			GarconMenuElement *inMenuElement)
+{
+	XfdashboardApplicationsViewPrivate	*priv;
+	ClutterActor						*actor;
+	gchar								*actorText;
+	const gchar							*iconName;
+	const gchar							*title;
+	const gchar							*description;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self), NULL);
+	g_return_val_if_fail(GARCON_IS_MENU_ELEMENT(inMenuElement), NULL);
+
+	priv=self->priv;
+
+	/* Create button for menu */
+	actor=xfdashboard_button_new();
+
+	iconName=garcon_menu_element_get_icon_name(inMenuElement);
+	if(iconName) xfdashboard_label_set_icon_name(XFDASHBOARD_LABEL(actor), iconName);
+
+	title=garcon_menu_element_get_name(inMenuElement);
+	description=garcon_menu_element_get_comment(inMenuElement);
+
+	if(priv->viewMode==XFDASHBOARD_VIEW_MODE_LIST)
+	{
+		actorText=g_markup_printf_escaped(priv->formatTitleDescription,
+											title ? title : "",
+											description ? description : "");
+	}
+		else
+		{
+			actorText=g_markup_printf_escaped(priv->formatTitleOnly,
+												title ? title : "");
+		}
+	xfdashboard_label_set_text(XFDASHBOARD_LABEL(actor), actorText);
+	g_free(actorText);
+
+	g_signal_connect(actor, "clicked", G_CALLBACK(_xfdashboard_applications_view_on_menu_clicked), inMenuElement);
+
+	return(actor);
+}
+
+/* Get actor for an item which is either a menu element or an app info. The
+ * actor is taken from cache of item actors if possible so it can be re-used
+ * when the filter changes. Otherwise a new actor is created and cached.
+ */
+static ClutterActor* _xfdashboard_applications_view_get_item_actor(XfdashboardApplicationsView *self,
+																	GObject *inItem)
+{
+	XfdashboardApplicationsViewPrivate	*priv;
+	ClutterActor						*actor;
+	GAppInfo							*appInfo;
+	gboolean							cacheActor;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self), NULL);
+	g_return_val_if_fail(G_IS_OBJECT(inItem), NULL);
+
+	priv=self->priv;
+	cacheActor=TRUE;
+
+	/* Return cached actor if available and not in use */
+	actor=g_hash_table_lookup(priv->itemActors, inItem);
+	if(actor)
+	{
+		if(!clutter_actor_get_parent(actor))
+		{
+			xfdashboard_statistics_add("applications-view.actor-reused", 1);
+			return(actor);
+		}
+
+		/* The item is shown more than once so create an uncached actor */
+		cacheActor=FALSE;
+	}
+
+	/* Create actor for item */
+	if(GARCON_IS_MENU_ITEM(inItem))
+	{
+		appInfo=xfdashboard_desktop_app_info_new_from_menu_item(GARCON_MENU_ITEM(inItem));
+		actor=_xfdashboard_applications_view_create_actor_for_app_info(self, appInfo);
+		g_object_unref(appInfo);
+	}
+		else if(GARCON_IS_MENU_ELEMENT(inItem))
+		{
+			actor=_xfdashboard_applications_view_create_actor_for_menu(self, GARCON_MENU_ELEMENT(inItem));
+		}
+		else if(G_IS_APP_INFO(inItem))
+		{
+			actor=_xfdashboard_applications_view_create_actor_for_app_info(self, G_APP_INFO(inItem));
+		}
+		else
+		{
+			g_critical("Cannot create actor for item of unsupported type %s", G_OBJECT_TYPE_NAME(inItem));
+			return(NULL);
+		}
+
+	_xfdashboard_applications_view_setup_actor_for_view_mode(self, actor);
+	xfdashboard_statistics_add("applications-view.actor-created", 1);
+
+	/* Store actor in cache */
+	if(cacheActor)
+	{
+		g_hash_table_insert(priv->itemActors, g_object_ref(inItem), g_object_ref_sink(actor));
+	}
+
+	return(actor);
+}
+
+/* Replace placeholder by the real actor of its item. If actor is not a
+ * placeholder it is returned unchanged.
+ */
+static ClutterActor* _xfdashboard_applications_view_materialize_item(XfdashboardApplicationsView *self,
+																		ClutterActor *inActor)
+{
+	XfdashboardApplicationsViewPrivate	*priv;
+	GObject								*item;
+	ClutterActor						*actor;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self), NULL);
+	g_return_val_if_fail(!inActor || CLUTTER_IS_ACTOR(inActor), NULL);
+
+	priv=self->priv;
+
+	/* Check if actor is a placeholder */
+	if(!inActor) return(NULL);
+
+	item=g_hash_table_lookup(priv->placeholders, inActor);
+	if(!item) return(inActor);
+
+	/* Create actor for item and put it at position of placeholder */
+	actor=_xfdashboard_applications_view_get_item_actor(self, item);
+	if(!actor) return(inActor);
+
+	clutter_actor_insert_child_above(CLUTTER_ACTOR(self), actor, inActor);
+	clutter_actor_show(actor);
+
+	/* Destroy placeholder */
+	g_hash_table_remove(priv->placeholders, inActor);
+	xfdashboard_actor_destroy(inActor);
+
+	xfdashboard_statistics_add("applications-view.actor-materialized", 1);
+
+	return(actor);
+}
+
+/* Determine size for placeholders from item actors shown in view and resize
+ * all placeholders.
+ */
+static void _xfdashboard_applications_view_update_placeholder_size(XfdashboardApplicationsView *self)
+{
+	XfdashboardApplicationsViewPrivate	*priv;
+	GHashTableIter						iter;
+	ClutterActor						*actor;
+	gfloat								width, height;
+	gfloat								maxWidth, maxHeight;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self));
+
+	priv=self->priv;
+	maxWidth=maxHeight=0.0f;
+
+	/* Get largest natural size of all mapped item actors in this view */
+	g_hash_table_iter_init(&iter, priv->itemActors);
+	while(g_hash_table_iter_next(&iter, NULL, (gpointer*)&actor))
+	{
+		if(clutter_actor_get_parent(actor)!=CLUTTER_ACTOR(self) ||
+			!clutter_actor_is_mapped(actor))
+		{
+			continue;
+		}
+
+		clutter_actor_get_preferred_size(actor, NULL, NULL, &width, &height);
+		maxWidth=MAX(maxWidth, width);
+		maxHeight=MAX(maxHeight, height);
+	}
+
+	if(maxWidth<=0.0f || maxHeight<=0.0f) return;
+
+	/* Resize all placeholders */
+	priv->placeholderWidth=maxWidth;
+	priv->placeholderHeight=maxHeight;
+
+	g_hash_table_iter_init(&iter, priv->placeholders);
+	while(g_hash_table_iter_next(&iter, (gpointer*)&actor, NULL))
+	{
+		clutter_actor_set_size(actor, priv->placeholderWidth, priv->placeholderHeight);
+	}
+
+	XFDASHBOARD_DEBUG(self, ACTOR,
+						"Using size %.2fx%.2f for %u placeholders at %s",
+						priv->placeholderWidth,
+						priv->placeholderHeight,
+						g_hash_table_size(priv->placeholders),
+						G_OBJECT_TYPE_NAME(self));
+}
+
+/* Replace all placeholders in visible area of view by real actors */
+static gboolean _xfdashboard_applications_view_on_materialize_repaint(gpointer inUserData)
+{
+	XfdashboardApplicationsView			*self;
+	XfdashboardApplicationsViewPrivate	*priv;
+	GHashTableIter						iter;
+	ClutterActor						*actor;
+	ClutterActorBox						box;
+	GSList								*visibleActors;
+	GSList								*actorIter;
+	gfloat								x, y, w, h;
+	gfloat								marginX, marginY;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(inUserData), G_SOURCE_REMOVE);
+
+	self=XFDASHBOARD_APPLICATIONS_VIEW(inUserData);
+	priv=self->priv;
+
+	/* Reset ID of repaint function as it will be removed */
+	priv->materializeRepaintID=0;
+
+	/* Do nothing if there are no placeholders or view is not visible */
+	if(g_hash_table_size(priv->placeholders)==0 ||
+		!clutter_actor_is_mapped(CLUTTER_ACTOR(self)))
+	{
+		return(G_SOURCE_REMOVE);
+	}
+
+	/* If size of placeholders is not known yet, determine it first and check
+	 * visible area after next relayout and repaint of view when placeholders
+	 * have their new size.
+	 */
+	if(priv->placeholderWidth<=0.0f || priv->placeholderHeight<=0.0f)
+	{
+		_xfdashboard_applications_view_update_placeholder_size(self);
+		_xfdashboard_applications_view_queue_materialize(self);
+
+		return(G_SOURCE_REMOVE);
+	}
+
+	/* Get visible area of view extended by margin */
+	if(clutter_actor_has_clip(CLUTTER_ACTOR(self)))
+	{
+		clutter_actor_get_clip(CLUTTER_ACTOR(self), &x, &y, &w, &h);
+	}
+		else
+		{
+			x=y=0.0f;
+			clutter_actor_get_size(CLUTTER_ACTOR(self), &w, &h);
+		}
+
+	marginX=w*VIRTUALIZED_MARGIN_PAGES;
+	marginY=h*VIRTUALIZED_MARGIN_PAGES;
+
+	/* Collect placeholders in visible area first as materializing them
+	 * modifies the hash-table of placeholders.
+	 */
+	visibleActors=NULL;
+
+	g_hash_table_iter_init(&iter, priv->placeholders);
+	while(g_hash_table_iter_next(&iter, (gpointer*)&actor, NULL))
+	{
+		clutter_actor_get_allocation_box(actor, &box);
+		if(box.x2>=(x-marginX) && box.x1<=(x+w+marginX) &&
+			box.y2>=(y-marginY) && box.y1<=(y+h+marginY))
+		{
+			visibleActors=g_slist_prepend(visibleActors, actor);
+		}
+	}
+
+	/* Replace placeholders by real actors */
+	for(actorIter=visibleActors; actorIter; actorIter=g_slist_next(actorIter))
+	{
+		_xfdashboard_applications_view_materialize_item(self, CLUTTER_ACTOR(actorIter->data));
+	}
+
+	XFDASHBOARD_DEBUG(self, ACTOR,
+						"Materialized %u items in area %.2f,%.2f-%.2fx%.2f at %s, %u placeholders left",
+						g_slist_length(visibleActors),
+						x, y, w, h,
+						G_OBJECT_TYPE_NAME(self),
+						g_hash_table_size(priv->placeholders));
+
+	g_slist_free(visibleActors);
+
+	return(G_SOURCE_REMOVE);
+}
+
+/* Schedule replacing placeholders in visible area by real actors */
+static void _xfdashboard_applications_view_queue_materialize(XfdashboardApplicationsView *self)
+{
+	XfdashboardApplicationsViewPrivate	*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self));
+
+	priv=self->priv;
+
+	/* Only add repaint function if there are placeholders and it was
+	 * not added already.
+	 */
+	if(priv->materializeRepaintID==0 &&
+		g_hash_table_size(priv->placeholders)>0)
+	{
+		priv->materializeRepaintID=
+			clutter_threads_add_repaint_func_full(CLUTTER_REPAINT_FLAGS_QUEUE_REDRAW_ON_ADD | CLUTTER_REPAINT_FLAGS_POST_PAINT,
+													_xfdashboard_applications_view_on_materialize_repaint,
+													self,
+													NULL);
+	}
+}
+
+/* Visible area, allocation or visibility of view changed */
+static void _xfdashboard_applications_view_on_visible_area_changed(XfdashboardApplicationsView *self,
+																	GParamSpec *inSpec,
+																	gpointer inUserData)
+{
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self));
+
+	/* The view might be hidden for the whole session, so fill the model
+	 * not before the view gets mapped the first time.
+	 */
+	if(clutter_actor_is_mapped(CLUTTER_ACTOR(self)))
+	{
+		xfdashboard_applications_menu_model_load(self->priv->apps);
+	}
+
+	_xfdashboard_applications_view_queue_materialize(self);
+}
+
+/* Add an item which is either a menu element or an app info to view. If the
+ * view is virtualized and no cached actor exists for item, a placeholder of
+ * the size of an item actor is added instead which will be replaced by the
+ * real actor when it gets into visible area of view.
+ */
+static ClutterActor* _xfdashboard_applications_view_add_item(XfdashboardApplicationsView *self,
+																GObject *inItem)
+{
+	XfdashboardApplicationsViewPrivate	*priv;
+	ClutterActor						*actor;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self), NULL);
+	g_return_val_if_fail(G_IS_OBJECT(inItem), NULL);
+
+	priv=self->priv;
+	actor=NULL;
+
+	/* Add placeholder if view is virtualized and actor for item is not cached.
+	 * If size of placeholders is not known yet, create the first item's actor
+	 * to be able to determine it.
+	 */
+	if(priv->virtualized &&
+		!g_hash_table_contains(priv->itemActors, inItem) &&
+		(priv->itemsCount>0 || (priv->placeholderWidth>0.0f && priv->placeholderHeight>0.0f)))
+	{
+		actor=clutter_actor_new();
+		clutter_actor_set_size(actor, priv->placeholderWidth, priv->placeholderHeight);
+		_xfdashboard_applications_view_setup_actor_for_view_mode(self, actor);
+		g_hash_table_insert(priv->placeholders, actor, g_object_ref(inItem));
+	}
+		else
+		{
+			actor=_xfdashboard_applications_view_get_item_actor(self, inItem);
+			if(!actor) return(NULL);
+		}
+
+	/* Add to view and layout */
+	clutter_actor_add_child(CLUTTER_ACTOR(self), actor);
+	clutter_actor_show(actor);
+	priv->itemsCount++;
+
+	return(actor);
+}
+
+/* Remove all actors from view but keep cached item actors for re-use */
+static void _xfdashboard_applications_view_clear(XfdashboardApplicationsView *self)
+{
+	XfdashboardApplicationsViewPrivate	*priv;
+	GHashTableIter						iter;
+	ClutterActor						*actor;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self));
+
+	priv=self->priv;
+
+	/* Unset selection */
+	xfdashboard_focusable_set_selection(XFDASHBOARD_FOCUSABLE(self), NULL);
+
+	/* Remove cached item actors from view before destroying all children */
+	g_hash_table_iter_init(&iter, priv->itemActors);
+	while(g_hash_table_iter_next(&iter, NULL, (gpointer*)&actor))
+	{
+		if(clutter_actor_get_parent(actor)==CLUTTER_ACTOR(self))
+		{
+			clutter_actor_remove_child(CLUTTER_ACTOR(self), actor);
+		}
+	}
+
+	/* Destroy all other children and placeholders */
+	g_hash_table_remove_all(priv->placeholders);
+	priv->itemsCount=0;
+
+	xfdashboard_actor_destroy_all_children(CLUTTER_ACTOR(self));
+	clutter_layout_manager_layout_changed(priv->layout);
+}
+
+/* Release all cached item actors, e.g. if their appearance will change */
+static void _xfdashboard_applications_view_clear_item_actors(XfdashboardApplicationsView *self)
+{
+	XfdashboardApplicationsViewPrivate	*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self));
+
+	priv=self->priv;
+
+	/* Actors still shown in view will be destroyed when view is cleared next
+	 * time as they are not known to cache anymore.
+	 */
+	g_hash_table_remove_all(priv->itemActors);
+	priv->placeholderWidth=0.0f;
+	priv->placeholderHeight=0.0f;
+}
+
 /* Parent menu of "All applications" was clicked */
 static void _xfdashboard_applications_view_on_all_applications_menu_parent_menu_clicked(XfdashboardApplicationsView *self, gpointer inUserData)
 {
@@ -531,18 +995,14 @@ static void _xfdashboard_applications_view_on_all_applications_menu_clicked(Xfda
 	GList								*iter;
 	XfdashboardDesktopAppInfo			*appInfo;
 	XfdashboardApplicationDatabase		*appDB;
-	ClutterAction						*clickAction;
-	ClutterAction						*dragAction;
 	gchar								*actorText;
 
 	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self));
 
 	priv=self->priv;
 
-	/* Destroy all children */
-	xfdashboard_focusable_set_selection(XFDASHBOARD_FOCUSABLE(self), NULL);
-	xfdashboard_actor_destroy_all_children(CLUTTER_ACTOR(self));
-	clutter_layout_manager_layout_changed(priv->layout);
+	/* Remove all children */
+	_xfdashboard_applications_view_clear(self);
 
 	/* Create parent menu item */
 	actor=xfdashboard_button_new();
@@ -587,27 +1047,9 @@ static void _xfdashboard_applications_view_on_all_applications_menu_clicked(Xfda
 			continue;
 		}
 
-		/* Create actor for app info */
-		actor=xfdashboard_application_button_new_from_app_info(G_APP_INFO(appInfo));
-
-		g_signal_connect_swapped(actor, "clicked", G_CALLBACK(_xfdashboard_applications_view_on_item_clicked), self);
-
-		/* Set up and add pop-up menu click action */
-		clickAction=xfdashboard_click_action_new();
-		g_signal_connect_swapped(clickAction, "clicked", G_CALLBACK(_xfdashboard_applications_view_on_popup_menu), self);
-		clutter_actor_add_action(actor, clickAction);
-
-		/* Add to view and layout */
-		_xfdashboard_applications_view_setup_actor_for_view_mode(self, CLUTTER_ACTOR(actor));
-		clutter_actor_add_child(CLUTTER_ACTOR(self), CLUTTER_ACTOR(actor));
-		clutter_actor_show(actor);
-
-		/* Add drag action to actor */
-		dragAction=xfdashboard_drag_action_new_with_source(CLUTTER_ACTOR(self));
-		clutter_drag_action_set_drag_threshold(CLUTTER_DRAG_ACTION(dragAction), -1, -1);
-		clutter_actor_add_action(actor, dragAction);
-		g_signal_connect(dragAction, "drag-begin", G_CALLBACK(_xfdashboard_applications_view_on_drag_begin), self);
-		g_signal_connect(dragAction, "drag-end", G_CALLBACK(_xfdashboard_applications_view_on_drag_end), self);
+		/* Add actor for app info */
+		actor=_xfdashboard_applications_view_add_item(self, G_OBJECT(appInfo));
+		if(!actor) continue;
 
 		/* If no item was selected (i.e. no "parent menu" item) select this one
 		 * which is usually the first menu item.
@@ -615,10 +1057,14 @@ static void _xfdashboard_applications_view_on_all_applications_menu_clicked(Xfda
 		if(xfdashboard_view_has_focus(XFDASHBOARD_VIEW(self)) &&
 			!xfdashboard_focusable_get_selection(XFDASHBOARD_FOCUSABLE(self)))
 		{
+			actor=_xfdashboard_applications_view_materialize_item(self, actor);
 			xfdashboard_focusable_set_selection(XFDASHBOARD_FOCUSABLE(self), CLUTTER_ACTOR(actor));
 		}
 	}
 
+	/* Create actors for items in visible area */
+	_xfdashboard_applications_view_queue_materialize(self);
+
 	g_list_free_full(allApps, g_object_unref);
 	g_object_unref(appDB);
 }
@@ -631,18 +1077,13 @@ static void _xfdashboard_applications_view_on_filter_changed(XfdashboardApplicat
 	ClutterActor						*actor;
 	GarconMenuElement					*menuElement=NULL;
 	GarconMenu							*parentMenu=NULL;
-	ClutterAction						*clickAction;
-	ClutterAction						*dragAction;
-	GAppInfo							*appInfo;
 
 	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self));
 
 	priv=XFDASHBOARD_APPLICATIONS_VIEW(self)->priv;
 
-	/* Destroy all children */
-	xfdashboard_focusable_set_selection(XFDASHBOARD_FOCUSABLE(self), NULL);
-	xfdashboard_actor_destroy_all_children(CLUTTER_ACTOR(self));
-	clutter_layout_manager_layout_changed(priv->layout);
+	/* Remove all children */
+	_xfdashboard_applications_view_clear(self);
 
 	/* Get parent menu */
 	if(priv->currentRootMenuElement &&
@@ -725,74 +1166,17 @@ static void _xfdashboard_applications_view_on_filter_changed(XfdashboardApplicat
 
 			if(!menuElement) continue;
 
-			/* Create actor for menu element. Support drag'n'drop at actor if
-			 * menu element is a menu item.
-			 */
-			if(GARCON_IS_MENU_ITEM(menuElement))
-			{
-				appInfo=xfdashboard_desktop_app_info_new_from_menu_item(GARCON_MENU_ITEM(menuElement));
-				actor=xfdashboard_application_button_new_from_app_info(appInfo);
-				g_object_unref(appInfo);
-
-				g_signal_connect_swapped(actor, "clicked", G_CALLBACK(_xfdashboard_applications_view_on_item_clicked), self);
-			}
-				else
-				{
-					gchar		*actorText;
-					const gchar	*iconName;
-					const gchar	*title;
-					const gchar	*description;
-
-					actor=xfdashboard_button_new();
-
-					iconName=garcon_menu_element_get_icon_name(menuElement);
-					if(iconName) xfdashboard_label_set_icon_name(XFDASHBOARD_LABEL(actor), iconName);
-
-					title=garcon_menu_element_get_name(menuElement);
-					description=garcon_menu_element_get_comment(menuElement);
-
-					if(priv->viewMode==XFDASHBOARD_VIEW_MODE_LIST)
-					{
-						actorText=g_markup_printf_escaped(priv->formatTitleDescription,
-															title ? title : "",
-															description ? description : "");
-					}
-						else
-						{
-							actorText=g_markup_printf_escaped(priv->formatTitleOnly,
-																title ? title : "");
-						}
-					xfdashboard_label_set_text(XFDASHBOARD_LABEL(actor), actorText);
-					g_free(actorText);
-
-					g_signal_connect(actor, "clicked", G_CALLBACK(_xfdashboard_applications_view_on_menu_clicked), menuElement);
-				}
-
-			/* Add to view and layout */
-			_xfdashboard_applications_view_setup_actor_for_view_mode(self, CLUTTER_ACTOR(actor));
-			clutter_actor_add_child(CLUTTER_ACTOR(self), CLUTTER_ACTOR(actor));
-			clutter_actor_show(actor);
-
-			/* Set up and add pop-up menu click action and drag action */
-			if(GARCON_IS_MENU_ITEM(menuElement))
-			{
-				clickAction=xfdashboard_click_action_new();
-				g_signal_connect_swapped(clickAction, "clicked", G_CALLBACK(_xfdashboard_applications_view_on_popup_menu), self);
-				clutter_actor_add_action(actor, clickAction);
-
-				dragAction=xfdashboard_drag_action_new_with_source(CLUTTER_ACTOR(self));
-				clutter_drag_action_set_drag_threshold(CLUTTER_DRAG_ACTION(dragAction), -1, -1);
-				clutter_actor_add_action(actor, dragAction);
-				g_signal_connect(dragAction, "drag-begin", G_CALLBACK(_xfdashboard_applications_view_on_drag_begin), self);
-				g_signal_connect(dragAction, "drag-end", G_CALLBACK(_xfdashboard_applications_view_on_drag_end), self);
-			}
+			/* Add actor for menu element */
+			actor=_xfdashboard_applications_view_add_item(self, G_OBJECT(menuElement));
 
 			/* If no item was selected (i.e. no "parent menu" item) select this one
 			 * which is usually the first menu item.
 			 */
-			if(xfdashboard_view_has_focus(XFDASHBOARD_VIEW(self)) &&
+			if(actor &&
+				xfdashboard_view_has_focus(XFDASHBOARD_VIEW(self)) &&
 				!xfdashboard_focusable_get_selection(XFDASHBOARD_FOCUSABLE(self)))
 			{
+				actor=_xfdashboard_applications_view_materialize_item(self, actor);
 				xfdashboard_focusable_set_selection(XFDASHBOARD_FOCUSABLE(self), CLUTTER_ACTOR(actor));
 			}
 
@@ -802,6 +1186,9 @@ static void _xfdashboard_applications_view_on_filter_changed(XfdashboardApplicat
 		}
 		g_object_unref(iterator);
 	}
+
+	/* Create actors for items in visible area */
+	_xfdashboard_applications_view_queue_materialize(self);
 }
 
 /* Application model has fully loaded */
@@ -813,11 +1200,29 @@ static void _xfdashboard_applications_view_on_model_loaded(XfdashboardApplicatio
 
 	priv=XFDASHBOARD_APPLICATIONS_VIEW(self)->priv;
 
-	/* Reset to root menu as menu referenced will not be available anymore
-	 * and re-filter to update view
+	/* The menu referenced belongs to the previous menu which will not be
+	 * available anymore after this signal was handled. So lookup the same
+	 * menu at reloaded menu or reset to root menu if it does not exist anymore.
 	 */
-	priv->currentRootMenuElement=NULL;
+	if(priv->currentRootMenuElement &&
+		GARCON_IS_MENU(priv->currentRootMenuElement))
+	{
+		priv->currentRootMenuElement=GARCON_MENU_ELEMENT(xfdashboard_applications_menu_model_lookup_menu(priv->apps, GARCON_MENU(priv->currentRootMenuElement)));
+	}
+		else priv->currentRootMenuElement=NULL;
+
+	/* Re-filter and update view. The filter may not change if the menu still
+	 * exists but rows may have been added, removed or changed, so block
+	 * signal "filter-changed" and update view only once.
+	 */
+	g_signal_handlers_block_by_func(priv->apps, _xfdashboard_applications_view_on_filter_changed, self);
 	xfdashboard_applications_menu_model_filter_by_section(priv->apps, GARCON_MENU(priv->currentRootMenuElement));
+	g_signal_handlers_unblock_by_func(priv->apps, _xfdashboard_applications_view_on_filter_changed, self);
+
+	/* Cached actors refer to menu elements of previous menu, so release them */
+	_xfdashboard_applications_view_clear_item_actors(self);
+
+	_xfdashboard_applications_view_on_filter_changed(self, NULL);
 }
 
 /* The application will be resumed */
@@ -916,6 +1321,17 @@ static gboolean _xfdashboard_applications_view_focusable_set_selection(Xfdashboa
 		return(FALSE);
 	}
 
+	/* Check that selection is not a placeholder */
+	if(inSelection &&
+		g_hash_table_contains(priv->placeholders, inSelection))
+	{
+		g_warning("%s is a placeholder at %s and cannot be selected",
+					G_OBJECT_TYPE_NAME(inSelection),
+					G_OBJECT_TYPE_NAME(self));
+
+		return(FALSE);
+	}
+
 	/* Remove weak reference at current selection */
 	if(priv->selectedItem)
 	{
@@ -1223,6 +1639,7 @@ static ClutterActor* _xfdashboard_applications_view_focusable_find_selection(Xfd
 	if(!inSelection)
 	{
 		newSelection=clutter_actor_get_first_child(CLUTTER_ACTOR(self));
+		newSelection=_xfdashboard_applications_view_materialize_item(self, newSelection);
 
 		valueName=xfdashboard_get_enum_value_name(XFDASHBOARD_TYPE_SELECTION_TARGET, inDirection);
 		XFDASHBOARD_DEBUG(self, ACTOR,
@@ -1294,8 +1711,10 @@ static ClutterActor* _xfdashboard_applications_view_focusable_find_selection(Xfd
 			break;
 	}
 
-	/* If new selection could be found override current selection with it */
-	if(newSelection) selection=newSelection;
+	/* If new selection could be found override current selection with it.
+	 * The new selection may be a placeholder so replace it by its real actor.
+	 */
+	if(newSelection) selection=_xfdashboard_applications_view_materialize_item(self, newSelection);
 
 	/* Return new selection found */
 	XFDASHBOARD_DEBUG(self, ACTOR,
@@ -1335,6 +1754,7 @@ static gboolean _xfdashboard_applications_view_focusable_activate_selection(Xfda
 	}
 
 	/* Activate selection */
+	inSelection=_xfdashboard_applications_view_materialize_item(self, inSelection);
 	g_signal_emit_by_name(inSelection, "clicked");
 
 	return(TRUE);
@@ -1363,12 +1783,30 @@ static void _xfdashboard_applications_view_dispose(GObject *inObject)
 	XfdashboardApplicationsViewPrivate	*priv=self->priv;
 
 	/* Release allocated resources */
+	if(priv->materializeRepaintID)
+	{
+		clutter_threads_remove_repaint_func(priv->materializeRepaintID);
+		priv->materializeRepaintID=0;
+	}
+
 	if(priv->selectedItem)
 	{
 		g_object_remove_weak_pointer(G_OBJECT(priv->selectedItem), &priv->selectedItem);
 		priv->selectedItem=NULL;
 	}
 
+	if(priv->placeholders)
+	{
+		g_hash_table_destroy(priv->placeholders);
+		priv->placeholders=NULL;
+	}
+
+	if(priv->itemActors)
+	{
+		g_hash_table_destroy(priv->itemActors);
+		priv->itemActors=NULL;
+	}
+
 	if(priv->layout)
 	{
 		priv->layout=NULL;
@@ -1444,6 +1882,10 @@ static void _xfdashboard_applications_view_set_property(GObject *inObject,
 			xfdashboard_applications_view_set_show_all_apps(self, g_value_get_boolean(inValue));
 			break;
 
+		case PROP_VIRTUALIZED:
+			xfdashboard_applications_view_set_virtualized(self, g_value_get_boolean(inValue));
+			break;
+
 		default:
 			G_OBJECT_WARN_INVALID_PROPERTY_ID(inObject, inPropID, inSpec);
 			break;
@@ -1487,6 +1929,10 @@ static void _xfdashboard_applications_view_get_property(GObject *inObject,
 			g_value_set_boolean(outValue, priv->showAllAppsMenu);
 			break;
 
+		case PROP_VIRTUALIZED:
+			g_value_set_boolean(outValue, priv->virtualized);
+			break;
+
 		default:
 			G_OBJECT_WARN_INVALID_PROPERTY_ID(inObject, inPropID, inSpec);
 			break;
@@ -1552,6 +1998,13 @@ static void xfdashboard_applications_view_class_init(XfdashboardApplicationsView
 								FALSE,
 								G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
 
+	XfdashboardApplicationsViewProperties[PROP_VIRTUALIZED]=
+		g_param_spec_boolean("virtualized",
+								"Virtualized",
+								"Whether to create actors only for items in or near visible area of view",
+								TRUE,
+								G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+
 	g_object_class_install_properties(gobjectClass, PROP_LAST, XfdashboardApplicationsViewProperties);
 
 	/* Define stylable properties */
@@ -1560,6 +2013,7 @@ static void xfdashboard_applications_view_class_init(XfdashboardApplicationsView
 	xfdashboard_actor_install_stylable_property(actorClass, XfdashboardApplicationsViewProperties[PROP_PARENT_MENU_ICON]);
 	xfdashboard_actor_install_stylable_property(actorClass, XfdashboardApplicationsViewProperties[PROP_FORMAT_TITLE_ONLY]);
 	xfdashboard_actor_install_stylable_property(actorClass, XfdashboardApplicationsViewProperties[PROP_FORMAT_TITLE_DESCRIPTION]);
+	xfdashboard_actor_install_stylable_property(actorClass, XfdashboardApplicationsViewProperties[PROP_VIRTUALIZED]);
 }
 
 /* Object initialization
@@ -1574,7 +2028,7 @@ static void xfdashboard_applications_view_init(XfdashboardApplicationsView *self
 	self->priv=priv=xfdashboard_applications_view_get_instance_private(self);
 
 	/* Set up default values */
-	priv->apps=XFDASHBOARD_APPLICATIONS_MENU_MODEL(xfdashboard_applications_menu_model_new());
+	priv->apps=XFDASHBOARD_APPLICATIONS_MENU_MODEL(xfdashboard_applications_menu_model_new_lazy());
 	priv->currentRootMenuElement=NULL;
 	priv->viewMode=-1;
 	priv->spacing=0.0f;
@@ -1584,6 +2038,13 @@ static void xfdashboard_applications_view_init(XfdashboardApplicationsView *self
 	priv->selectedItem=NULL;
 	priv->showAllAppsMenu=FALSE;
 	priv->settingsShowAllAppsMenuBinding=NULL;
+	priv->virtualized=TRUE;
+	priv->itemActors=g_hash_table_new_full(g_direct_hash, g_direct_equal, g_object_unref, g_object_unref);
+	priv->placeholders=g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_object_unref);
+	priv->itemsCount=0;
+	priv->placeholderWidth=0.0f;
+	priv->placeholderHeight=0.0f;
+	priv->materializeRepaintID=0;
 
 	/* Set up view */
 	xfdashboard_view_set_name(XFDASHBOARD_VIEW(self), _("Applications"));
@@ -1599,6 +2060,10 @@ static void xfdashboard_applications_view_init(XfdashboardApplicationsView *self
 	g_signal_connect_swapped(priv->apps, "filter-changed", G_CALLBACK(_xfdashboard_applications_view_on_filter_changed), self);
 	g_signal_connect_swapped(priv->apps, "loaded", G_CALLBACK(_xfdashboard_applications_view_on_model_loaded), self);
 
+	g_signal_connect(self, "notify::clip-rect", G_CALLBACK(_xfdashboard_applications_view_on_visible_area_changed), NULL);
+	g_signal_connect(self, "notify::allocation", G_CALLBACK(_xfdashboard_applications_view_on_visible_area_changed), NULL);
+	g_signal_connect(self, "notify::mapped", G_CALLBACK(_xfdashboard_applications_view_on_visible_area_changed), NULL);
+
 	/* Connect signal to core */
 	core=xfdashboard_core_get_default();
 	g_signal_connect_swapped(core, "resume", G_CALLBACK(_xfdashboard_applications_view_on_application_resume), self);
@@ -1662,7 +2127,8 @@ void xfdashboard_applications_view_set_view_mode(XfdashboardApplicationsView *se
 				g_assert_not_reached();
 		}
 
-		/* Rebuild view */
+		/* Rebuild view with new actors as they depend on view mode */
+		_xfdashboard_applications_view_clear_item_actors(self);
 		_xfdashboard_applications_view_on_filter_changed(self, NULL);
 
 		/* Notify about property change */
@@ -1776,7 +2242,11 @@ void xfdashboard_applications_view_set_format_title_only(XfdashboardApplications
 		priv->formatTitleOnly=g_strdup(inFormat);
 
 		/* Update view only if view mode is list which uses this format string */
-		if(priv->viewMode==XFDASHBOARD_VIEW_MODE_ICON) _xfdashboard_applications_view_on_filter_changed(self, NULL);
+		if(priv->viewMode==XFDASHBOARD_VIEW_MODE_ICON)
+		{
+			_xfdashboard_applications_view_clear_item_actors(self);
+			_xfdashboard_applications_view_on_filter_changed(self, NULL);
+		}
 
 		/* Notify about property change */
 		g_object_notify_by_pspec(G_OBJECT(self), XfdashboardApplicationsViewProperties[PROP_FORMAT_TITLE_ONLY]);
@@ -1808,7 +2278,11 @@ void xfdashboard_applications_view_set_format_title_description(XfdashboardAppli
 		priv->formatTitleDescription=g_strdup(inFormat);
 
 		/* Update view only if view mode is list which uses this format string */
-		if(priv->viewMode==XFDASHBOARD_VIEW_MODE_LIST) _xfdashboard_applications_view_on_filter_changed(self, NULL);
+		if(priv->viewMode==XFDASHBOARD_VIEW_MODE_LIST)
+		{
+			_xfdashboard_applications_view_clear_item_actors(self);
+			_xfdashboard_applications_view_on_filter_changed(self, NULL);
+		}
 
 		/* Notify about property change */
 		g_object_notify_by_pspec(G_OBJECT(self), XfdashboardApplicationsViewProperties[PROP_FORMAT_TITLE_DESCRIPTION]);
@@ -1848,3 +2322,45 @@ void xfdashboard_applications_view_set_show_all_apps(XfdashboardApplicationsView
 		g_object_notify_by_pspec(G_OBJECT(self), XfdashboardApplicationsViewProperties[PROP_SHOW_ALL_APPS]);
 	}
 }
+
+/* Get/set flag whether to create actors only for items in visible area */
+gboolean xfdashboard_applications_view_get_virtualized(XfdashboardApplicationsView *self)
+{
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self), FALSE);
+
+	return(self->priv->virtualized);
+}
+
+void xfdashboard_applications_view_set_virtualized(XfdashboardApplicationsView *self, gboolean inVirtualized)
+{
+	XfdashboardApplicationsViewPrivate		*priv;
+	GList									*placeholders;
+	GList									*iter;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self));
+
+	priv=self->priv;
+
+	/* Set value if changed */
+	if(priv->virtualized!=inVirtualized)
+	{
+		/* Set value */
+		priv->virtualized=inVirtualized;
+
+		/* If view is not virtualized anymore, replace all placeholders by
+		 * real actors.
+		 */
+		if(!priv->virtualized)
+		{
+			placeholders=g_hash_table_get_keys(priv->placeholders);
+			for(iter=placeholders; iter; iter=g_list_next(iter))
+			{
+				_xfdashboard_applications_view_materialize_item(self, CLUTTER_ACTOR(iter->data));
+			}
+			g_list_free(placeholders);
+		}
+
+		/* Notify about property change */
+		g_object_notify_by_pspec(G_OBJECT(self), XfdashboardApplicationsViewProperties[PROP_VIRTUALIZED]);
+	}
+}
@@ -81,6 +81,9 @@ void xfdashboard_applications_view_set_format_title_description(XfdashboardAppli
 gboolean xfdashboard_applications_view_get_show_all_apps(XfdashboardApplicationsView *self);
 void xfdashboard_applications_view_set_show_all_apps(XfdashboardApplicationsView *self, gboolean inShowAllApps);
 
+gboolean xfdashboard_applications_view_get_virtualized(XfdashboardApplicationsView *self);
+void xfdashboard_applications_view_set_virtualized(XfdashboardApplicationsView *self, gboolean inVirtualized);
+
 G_END_DECLS
 
 #endif	/* __LIBXFDASHBOARD_APPLICATIONS_VIEW__ */
@@ -33,11 +33,16 @@
 #include <math.h>
 
 #include <libxfdashboard/enums.h>
+#include <libxfdashboard/gradient-pipeline.h>
 #include <libxfdashboard/outline-effect.h>
+#include <libxfdashboard/statistics.h>
+#include <libxfdashboard/utils.h>
 #include <libxfdashboard/compat.h>
 
 
 /* Define this class in GObject system */
+typedef struct _XfdashboardBackgroundFillNineSlice		XfdashboardBackgroundFillNineSlice;
+
 struct _XfdashboardBackgroundPrivate
 {
 	/* Properties related */
@@ -55,6 +60,10 @@ struct _XfdashboardBackgroundPrivate
 
 	/* Instance related */
 	ClutterContent				*fillCanvas;
+	XfdashboardBackgroundFillNineSlice	*fillNineSlice;
+	CoglPipeline				*fillPipeline;
+	gfloat						fillPipelineWidth;
+	gfloat						fillPipelineHeight;
 	XfdashboardOutlineEffect	*outline;
 	ClutterImage				*image;
 };
@@ -92,6 +101,21 @@ static GParamSpec* XfdashboardBackgroundProperties[PROP_LAST]={ 0, };
 
 /* IMPLEMENTATION: Private variables and methods */
 
+struct _XfdashboardBackgroundFillNineSlice
+{
+	gchar						*key;
+	CoglTexture					*texture;
+	gint						sliceSize;
+	gint						refCount;
+};
+
+static GHashTable		*_xfdashboard_background_fill_nine_slices=NULL;
+
+static void _xfdashboard_background_draw_fill_canvas_simple(XfdashboardBackground *self,
+															cairo_t *inContext,
+															int inWidth,
+															int inHeight);
+
 /* Create pattern for simple canvas fill function */
 static cairo_pattern_t* _xfdashboard_background_create_fill_pattern(XfdashboardBackground *self,
 																	cairo_t *inContext,
@@ -125,106 +149,18 @@ static cairo_pattern_t* _xfdashboard_background_create_fill_pattern(XfdashboardB
 	/* Create linear gradient pattern if gradient is linear */
 	if(type==XFDASHBOARD_GRADIENT_TYPE_LINEAR_GRADIENT)
 	{
-		gdouble					width, height;
-		gdouble					midX, midY;
 		gdouble					startX, startY;
 		gdouble					endX, endY;
-		gdouble					angle;
-		gdouble					atanRectangle;
-		gdouble					tanAngle;
 		guint					i, stops;
 
-		/* Adjust angle to find region */
-		angle=(2*M_PI)-xfdashboard_gradient_color_get_angle(priv->fillColor);
-		while(angle<-M_PI) angle+=(2*M_PI);
-		while(angle>M_PI) angle-=(2*M_PI);
-
-		/* I do not know why but exactly at radians of 0.0 and M_PI the
-		 * start and end points are mirrored so this is a dirty workaround
-		 * to swap angles. Maybe it is because tan(angle) resolves to -0.0
-		 * instead of 0.0. Looks like a sign error.
-		 */
-		if(angle==0.0) angle=M_PI;
-			else if(angle==M_PI) angle=0.0;
-
-		/* Get size of region */
-		width=inWidth;
-		height=inHeight;
-
-		/* Find region and calculates points */
-		atanRectangle=atan2(height, width);
-		tanAngle=tan(angle);
-
-		midX=(width/2.0);
-		midY=(height/2.0);
-
-		if(angle!=0.0 && (angle>-atanRectangle) && (angle<=atanRectangle))
-		{
-			/* Region 1 */
-			startX=midX+(width/2.0);
-			startY=midY-((width/2.0)*tanAngle);
-
-			endX=midX-(width/2.0);
-			endY=midY+((width/2.0)*tanAngle);
-		}
-			else if((angle>atanRectangle) && (angle<=(M_PI-atanRectangle)))
-			{
-				/* Region 2 */
-				startX=midX+(height/(2.0*tanAngle));
-				startY=midY-(height/2.0);
-
-				endX=midX-(height/(2.0*tanAngle));
-				endY=midY+(height/2.0);
-			}
-			else if(angle==0.0 || (angle>(M_PI-atanRectangle)) || (angle<=-(M_PI-atanRectangle)))
-			{
-				/* Region 3 */
-				startX=midX-(width/2.0);
-				startY=midY+((width/2.0)*tanAngle);
-
-				endX=midX+(width/2.0);
-				endY=midY-((width/2.0)*tanAngle);
-			}
-			else
-			{
-				/* Region 4 */
-				startX=midX-(height/(2.0*tanAngle));
-				startY=midY+(height/2.0);
-
-				endX=midX+(height/(2.0*tanAngle));
-				endY=midY-(height/2.0);
-			}
-
-		/* Reduce full length to requested length if gradient should be repeated */
-		if(xfdashboard_gradient_color_get_repeat(priv->fillColor))
-		{
-			gdouble				vectorX, vectorY;
-			gdouble				distance;
-			gdouble				requestedLength;
-
-			/* Calculate distance between start and end point as this is the current
-			 * length of pattern.
-			 */
-			vectorX=endX-startX;
-			vectorY=endY-startY;
-			distance=sqrt((vectorX*vectorX) + (vectorY*vectorY));
-
-			/* Reduce distance by percentage or absolute length */
-			requestedLength=xfdashboard_gradient_color_get_length(priv->fillColor);
-			if(requestedLength<0.0)
-			{
-				vectorX*=-requestedLength;
-				vectorY*=-requestedLength;
-			}
-				else
-				{
-					vectorX=(vectorX/distance)*requestedLength;
-					vectorY=(vectorY/distance)*requestedLength;
-				}
-
-			endX=startX+vectorX;
-			endY=startY+vectorY;
-		}
+		/* Calculate start and end point of gradient */
+		xfdashboard_gradient_color_get_linear_points(priv->fillColor,
+														inWidth,
+														inHeight,
+														&startX,
+														&startY,
+														&endX,
+														&endY);
 
 		/* Create pattern based on calculated points */
 		pattern=cairo_pattern_create_linear(startX, startY, endX, endY);
@@ -428,6 +364,424 @@ static void _xfdashboard_background_draw_fill_canvas_path_gradient(XfdashboardBa
 	}
 }
 
+/* Get size of corner slices if background is filled with a style which can
+ * be painted from a stretched nine-slice texture. Returns zero if it cannot.
+ */
+static gint _xfdashboard_background_get_fill_slice_size(XfdashboardBackground *self)
+{
+	XfdashboardBackgroundPrivate	*priv;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_BACKGROUND(self), 0);
+
+	priv=self->priv;
+
+	/* Only solid colors do not depend on size of background. Gradients are
+	 * calculated from the size of background so they cannot be stretched.
+	 */
+	if(!(priv->type & XFDASHBOARD_BACKGROUND_TYPE_FILL) ||
+		!priv->fillColor ||
+		xfdashboard_gradient_color_get_gradient_type(priv->fillColor)!=XFDASHBOARD_GRADIENT_TYPE_SOLID)
+	{
+		return(0);
+	}
+
+	/* Corner slices must hold rounded corners completely */
+	if((priv->type & XFDASHBOARD_BACKGROUND_TYPE_ROUNDED_CORNERS) &&
+		(priv->fillCorners & XFDASHBOARD_CORNERS_ALL) &&
+		priv->fillCornersRadius>0.0f)
+	{
+		return(ceil(priv->fillCornersRadius)+1);
+	}
+
+	return(1);
+}
+
+/* Check if background of requested size is painted from nine-slice texture */
+static gboolean _xfdashboard_background_uses_fill_nine_slice(XfdashboardBackground *self,
+																gfloat inWidth,
+																gfloat inHeight)
+{
+	gint							sliceSize;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_BACKGROUND(self), FALSE);
+
+	sliceSize=_xfdashboard_background_get_fill_slice_size(self);
+	if(sliceSize<=0) return(FALSE);
+
+	return(inWidth>=((2*sliceSize)+1) && inHeight>=((2*sliceSize)+1));
+}
+
+/* Check if background is filled by shader */
+static gboolean _xfdashboard_background_uses_fill_shader(XfdashboardBackground *self)
+{
+	XfdashboardBackgroundPrivate	*priv;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_BACKGROUND(self), FALSE);
+
+	priv=self->priv;
+
+	return((priv->type & XFDASHBOARD_BACKGROUND_TYPE_FILL) &&
+			priv->fillColor &&
+			xfdashboard_gradient_pipeline_is_supported(priv->fillColor));
+}
+
+/* Check if background of requested size is drawn by canvas */
+static gboolean _xfdashboard_background_uses_fill_canvas(XfdashboardBackground *self,
+															gfloat inWidth,
+															gfloat inHeight)
+{
+	g_return_val_if_fail(XFDASHBOARD_IS_BACKGROUND(self), FALSE);
+
+	return(!_xfdashboard_background_uses_fill_shader(self) &&
+			!_xfdashboard_background_uses_fill_nine_slice(self, inWidth, inHeight));
+}
+
+/* Create texture with filled background of requested size */
+static CoglTexture* _xfdashboard_background_create_fill_texture(XfdashboardBackground *self,
+																gint inSize)
+{
+	cairo_surface_t					*surface;
+	cairo_t							*context;
+	CoglTexture						*texture;
+#if COGL_VERSION_CHECK(1, 18, 0)
+	CoglContext						*coglContext;
+	CoglError						*error;
+#endif
+
+	g_return_val_if_fail(XFDASHBOARD_IS_BACKGROUND(self), NULL);
+	g_return_val_if_fail(inSize>0, NULL);
+
+	/* Draw background into an image surface */
+	surface=cairo_image_surface_create(CAIRO_FORMAT_ARGB32, inSize, inSize);
+	context=cairo_create(surface);
+	cairo_set_operator(context, CAIRO_OPERATOR_OVER);
+	_xfdashboard_background_draw_fill_canvas_simple(self, context, inSize, inSize);
+	cairo_destroy(context);
+	cairo_surface_flush(surface);
+
+	/* Create texture from drawn surface */
+#if COGL_VERSION_CHECK(1, 18, 0)
+	error=NULL;
+
+	coglContext=clutter_backend_get_cogl_context(clutter_get_default_backend());
+	texture=cogl_texture_2d_new_from_data(coglContext,
+											inSize,
+											inSize,
+											CLUTTER_CAIRO_FORMAT_ARGB32,
+											cairo_image_surface_get_stride(surface),
+											cairo_image_surface_get_data(surface),
+											&error);
+	if(!texture || error)
+	{
+		g_warning("Could not create texture for background: %s",
+					(error && error->message) ? error->message : "Unknown error");
+
+		/* Release allocated resources */
+		if(texture)
+		{
+			cogl_object_unref(texture);
+			texture=NULL;
+		}
+
+		if(error)
+		{
+			cogl_error_free(error);
+			error=NULL;
+		}
+	}
+#else
+	texture=cogl_texture_new_from_data(inSize,
+										inSize,
+										COGL_TEXTURE_NO_SLICING,
+										CLUTTER_CAIRO_FORMAT_ARGB32,
+										COGL_PIXEL_FORMAT_ANY,
+										cairo_image_surface_get_stride(surface),
+										cairo_image_surface_get_data(surface));
+	if(!texture) g_warning("Could not create texture for background");
+#endif
+
+	/* Release allocated resources */
+	cairo_surface_destroy(surface);
+
+	/* Return created texture */
+	return(texture);
+}
+
+/* Get nine-slice texture for fill style of this background from shared cache
+ * or create it if no other background uses this style yet.
+ */
+static XfdashboardBackgroundFillNineSlice* _xfdashboard_background_fill_nine_slice_acquire(XfdashboardBackground *self)
+{
+	XfdashboardBackgroundPrivate		*priv;
+	XfdashboardBackgroundFillNineSlice	*nineSlice;
+	gchar								*colorString;
+	gchar								*key;
+	gint								sliceSize;
+	CoglTexture							*texture;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_BACKGROUND(self), NULL);
+
+	priv=self->priv;
+
+	/* Check if fill style can be stretched at all */
+	sliceSize=_xfdashboard_background_get_fill_slice_size(self);
+	if(sliceSize<=0) return(NULL);
+
+	/* Build key of fill style. Corners and radius only matter if corners
+	 * are rounded which is also the case if slice size is larger than one.
+	 */
+	colorString=xfdashboard_gradient_color_to_string(priv->fillColor);
+	if(sliceSize>1)
+	{
+		key=g_strdup_printf("%s|%.3f|%u",
+							colorString,
+							priv->fillCornersRadius,
+							priv->fillCorners);
+	}
+		else key=g_strdup(colorString);
+	g_free(colorString);
+
+	/* Check if another background has already drawn this fill style */
+	if(_xfdashboard_background_fill_nine_slices)
+	{
+		nineSlice=(XfdashboardBackgroundFillNineSlice*)g_hash_table_lookup(_xfdashboard_background_fill_nine_slices, key);
+		if(nineSlice)
+		{
+			xfdashboard_statistics_add("background.nine-slice-hit", 1);
+
+			nineSlice->refCount++;
+			g_free(key);
+			return(nineSlice);
+		}
+	}
+
+	/* Draw background once into a texture which is just large enough to hold
+	 * all corners and one pixel between them to stretch.
+	 */
+	xfdashboard_statistics_add("background.nine-slice-miss", 1);
+
+	texture=_xfdashboard_background_create_fill_texture(self, (2*sliceSize)+1);
+	if(!texture)
+	{
+		g_free(key);
+		return(NULL);
+	}
+
+	/* Store texture in shared cache */
+	nineSlice=g_new0(XfdashboardBackgroundFillNineSlice, 1);
+	nineSlice->key=key;
+	nineSlice->texture=texture;
+	nineSlice->sliceSize=sliceSize;
+	nineSlice->refCount=1;
+
+	if(!_xfdashboard_background_fill_nine_slices)
+	{
+		_xfdashboard_background_fill_nine_slices=g_hash_table_new(g_str_hash, g_str_equal);
+	}
+	g_hash_table_insert(_xfdashboard_background_fill_nine_slices, nineSlice->key, nineSlice);
+
+	return(nineSlice);
+}
+
+/* Release nine-slice texture and remove it from shared cache if it is not
+ * used anymore.
+ */
+static void _xfdashboard_background_fill_nine_slice_release(XfdashboardBackgroundFillNineSlice *inNineSlice)
+{
+	g_return_if_fail(inNineSlice);
+	g_return_if_fail(inNineSlice->refCount>0);
+
+	/* Decrease usage counter and return if still in use */
+	inNineSlice->refCount--;
+	if(inNineSlice->refCount>0) return;
+
+	/* Remove from shared cache and release allocated resources */
+	if(_xfdashboard_background_fill_nine_slices)
+	{
+		g_hash_table_remove(_xfdashboard_background_fill_nine_slices, inNineSlice->key);
+	}
+
+	cogl_object_unref(inNineSlice->texture);
+	g_free(inNineSlice->key);
+	g_free(inNineSlice);
+}
+
+/* Fill style has changed so release nine-slice texture of old style and
+ * redraw canvas if background is not painted from a nine-slice texture.
+ */
+static void _xfdashboard_background_invalidate_fill(XfdashboardBackground *self)
+{
+	XfdashboardBackgroundPrivate	*priv;
+	ClutterActorBox					box;
+	gfloat							width, height;
+
+	g_return_if_fail(XFDASHBOARD_IS_BACKGROUND(self));
+
+	priv=self->priv;
+
+	/* Release nine-slice texture and shader pipeline of old style */
+	if(priv->fillNineSlice)
+	{
+		_xfdashboard_background_fill_nine_slice_release(priv->fillNineSlice);
+		priv->fillNineSlice=NULL;
+	}
+
+	if(priv->fillPipeline)
+	{
+		cogl_object_unref(priv->fillPipeline);
+		priv->fillPipeline=NULL;
+	}
+
+	/* Canvas is only resized when needed so set its size before redrawing it
+	 * if actor was allocated already. Otherwise just invalidate canvas as it
+	 * will be resized when actor gets allocated.
+	 */
+	if(priv->fillCanvas)
+	{
+		if(clutter_actor_has_allocation(CLUTTER_ACTOR(self)))
+		{
+			clutter_actor_get_allocation_box(CLUTTER_ACTOR(self), &box);
+			clutter_actor_box_get_size(&box, &width, &height);
+
+			if(_xfdashboard_background_uses_fill_canvas(self, width, height) &&
+				!clutter_canvas_set_size(CLUTTER_CANVAS(priv->fillCanvas), width, height))
+			{
+				clutter_content_invalidate(priv->fillCanvas);
+			}
+		}
+			else clutter_content_invalidate(priv->fillCanvas);
+	}
+
+	/* Redraw actor */
+	clutter_actor_queue_redraw(CLUTTER_ACTOR(self));
+}
+
+/* Paint background from nine-slice texture */
+static void _xfdashboard_background_paint_fill_nine_slice(XfdashboardBackground *self,
+															ClutterPaintNode *inRootNode)
+{
+	XfdashboardBackgroundPrivate	*priv;
+	ClutterScalingFilter			minFilter, magFilter;
+	ClutterPaintNode				*node;
+	ClutterActorBox					box;
+	ClutterActorBox					rectangle;
+	ClutterColor					color;
+	guint8							opacity;
+	gfloat							coordinates[XFDASHBOARD_NINE_SLICE_RECTANGLES*8];
+	gfloat							*coordinate;
+	gint							i;
+
+	g_return_if_fail(XFDASHBOARD_IS_BACKGROUND(self));
+	g_return_if_fail(self->priv->fillNineSlice);
+
+	priv=self->priv;
+
+	/* Get needed data for painting */
+	clutter_actor_get_content_box(CLUTTER_ACTOR(self), &box);
+	clutter_actor_get_content_scaling_filters(CLUTTER_ACTOR(self), &minFilter, &magFilter);
+	opacity=clutter_actor_get_paint_opacity(CLUTTER_ACTOR(self));
+
+	color.red=opacity;
+	color.green=opacity;
+	color.blue=opacity;
+	color.alpha=opacity;
+
+	/* Paint slices stretched to content box */
+	xfdashboard_get_nine_slice_rectangles(clutter_actor_box_get_width(&box),
+											clutter_actor_box_get_height(&box),
+											priv->fillNineSlice->sliceSize,
+											coordinates);
+
+	node=clutter_texture_node_new(priv->fillNineSlice->texture, &color, minFilter, magFilter);
+	clutter_paint_node_set_name(node, G_OBJECT_TYPE_NAME(self));
+
+	for(i=0; i<XFDASHBOARD_NINE_SLICE_RECTANGLES; i++)
+	{
+		coordinate=coordinates+(i*8);
+
+		rectangle.x1=box.x1+coordinate[0];
+		rectangle.y1=box.y1+coordinate[1];
+		rectangle.x2=box.x1+coordinate[2];
+		rectangle.y2=box.y1+coordinate[3];
+		clutter_paint_node_add_texture_rectangle(node,
+													&rectangle,
+													coordinate[4],
+													coordinate[5],
+													coordinate[6],
+													coordinate[7]);
+	}
+
+	clutter_paint_node_add_child(inRootNode, node);
+	clutter_paint_node_unref(node);
+}
+
+/* Paint background by shader */
+static void _xfdashboard_background_paint_fill_shader(XfdashboardBackground *self,
+														ClutterPaintNode *inRootNode)
+{
+	XfdashboardBackgroundPrivate	*priv;
+	ClutterPaintNode				*node;
+	ClutterActorBox					box;
+	gfloat							width, height;
+	guint8							opacity;
+
+	g_return_if_fail(XFDASHBOARD_IS_BACKGROUND(self));
+
+	priv=self->priv;
+
+	/* Get size of background to draw */
+	clutter_actor_get_content_box(CLUTTER_ACTOR(self), &box);
+	clutter_actor_box_get_size(&box, &width, &height);
+	if(width<1.0f || height<1.0f) return;
+
+	/* Create pipeline again if size has changed */
+	if(priv->fillPipeline &&
+		(priv->fillPipelineWidth!=width || priv->fillPipelineHeight!=height))
+	{
+		cogl_object_unref(priv->fillPipeline);
+		priv->fillPipeline=NULL;
+	}
+
+	if(!priv->fillPipeline)
+	{
+		if((priv->type & XFDASHBOARD_BACKGROUND_TYPE_ROUNDED_CORNERS) &&
+			(priv->fillCorners & XFDASHBOARD_CORNERS_ALL) &&
+			priv->fillCornersRadius>0.0f)
+		{
+			priv->fillPipeline=xfdashboard_gradient_pipeline_new(priv->fillColor,
+																	width,
+																	height,
+																	priv->fillCorners,
+																	priv->fillCornersRadius,
+																	0.0f);
+		}
+			else
+			{
+				priv->fillPipeline=xfdashboard_gradient_pipeline_new(priv->fillColor,
+																		width,
+																		height,
+																		XFDASHBOARD_CORNERS_NONE,
+																		0.0f,
+																		0.0f);
+			}
+
+		priv->fillPipelineWidth=width;
+		priv->fillPipelineHeight=height;
+
+		if(!priv->fillPipeline) return;
+	}
+
+	/* Paint pipeline with paint opacity of actor */
+	opacity=clutter_actor_get_paint_opacity(CLUTTER_ACTOR(self));
+	cogl_pipeline_set_color4ub(priv->fillPipeline, opacity, opacity, opacity, opacity);
+
+	node=clutter_pipeline_node_new(priv->fillPipeline);
+	clutter_paint_node_set_name(node, G_OBJECT_TYPE_NAME(self));
+	clutter_paint_node_add_texture_rectangle(node, &box, 0.0f, 0.0f, 1.0f, 1.0f);
+	clutter_paint_node_add_child(inRootNode, node);
+	clutter_paint_node_unref(node);
+}
+
 /* Rectangle canvas (filling) should be redrawn */
 static gboolean _xfdashboard_background_on_draw_fill_canvas(XfdashboardBackground *self,
 															cairo_t *inContext,
@@ -475,12 +829,40 @@ static void _xfdashboard_background_paint_node(ClutterActor *self,
 {
 	XfdashboardBackgroundPrivate	*priv=XFDASHBOARD_BACKGROUND(self)->priv;
 	ClutterContentIface				*iface;
+	ClutterActorBox					box;
+	gboolean						useShader;
+	gboolean						useNineSlice;
 
-	/* First draw canvas for background */
+	/* First draw background either by shader, from nine-slice texture shared
+	 * with all other backgrounds of same fill style or from canvas.
+	 */
 	if(priv->type & XFDASHBOARD_BACKGROUND_TYPE_FILL)
 	{
-		iface=CLUTTER_CONTENT_GET_IFACE(priv->fillCanvas);
-		if(iface->paint_content) iface->paint_content(priv->fillCanvas, self, inRootNode);
+		clutter_actor_get_content_box(self, &box);
+		useShader=_xfdashboard_background_uses_fill_shader(XFDASHBOARD_BACKGROUND(self));
+		useNineSlice=(!useShader &&
+						_xfdashboard_background_uses_fill_nine_slice(XFDASHBOARD_BACKGROUND(self),
+																		clutter_actor_box_get_width(&box),
+																		clutter_actor_box_get_height(&box)));
+
+		if(useNineSlice && !priv->fillNineSlice)
+		{
+			priv->fillNineSlice=_xfdashboard_background_fill_nine_slice_acquire(XFDASHBOARD_BACKGROUND(self));
+		}
+
+		if(useShader)
+		{
+			_xfdashboard_background_paint_fill_shader(XFDASHBOARD_BACKGROUND(self), inRootNode);
+		}
+			else if(useNineSlice && priv->fillNineSlice)
+			{
+				_xfdashboard_background_paint_fill_nine_slice(XFDASHBOARD_BACKGROUND(self), inRootNode);
+			}
+			else
+			{
+				iface=CLUTTER_CONTENT_GET_IFACE(priv->fillCanvas);
+				if(iface->paint_content) iface->paint_content(priv->fillCanvas, self, inRootNode);
+			}
 	}
 
 	/* If available draw image for background */
@@ -507,8 +889,13 @@ static void _xfdashboard_background_allocate(ClutterActor *self,
 	/* Chain up to store the allocation of the actor */
 	CLUTTER_ACTOR_CLASS(xfdashboard_background_parent_class)->allocate(self, inBox, inFlags);
 
-	/* Set size of canvas */
-	if(priv->fillCanvas)
+	/* Set size of canvas but only if background is drawn by canvas as
+	 * resizing the canvas redraws it.
+	 */
+	if(priv->fillCanvas &&
+		_xfdashboard_background_uses_fill_canvas(XFDASHBOARD_BACKGROUND(self),
+													clutter_actor_box_get_width(inBox),
+													clutter_actor_box_get_height(inBox)))
 	{
 		clutter_canvas_set_size(CLUTTER_CANVAS(priv->fillCanvas),
 									clutter_actor_box_get_width(inBox),
@@ -524,6 +911,18 @@ static void _xfdashboard_background_dispose(GObject *inObject)
 	/* Release allocated variables */
 	XfdashboardBackgroundPrivate	*priv=XFDASHBOARD_BACKGROUND(inObject)->priv;
 
+	if(priv->fillNineSlice)
+	{
+		_xfdashboard_background_fill_nine_slice_release(priv->fillNineSlice);
+		priv->fillNineSlice=NULL;
+	}
+
+	if(priv->fillPipeline)
+	{
+		cogl_object_unref(priv->fillPipeline);
+		priv->fillPipeline=NULL;
+	}
+
 	if(priv->fillCanvas)
 	{
 		g_object_unref(priv->fillCanvas);
@@ -836,6 +1235,8 @@ static void xfdashboard_background_init(XfdashboardBackground *self)
 	priv->type=XFDASHBOARD_BACKGROUND_TYPE_NONE;
 
 	priv->fillCanvas=clutter_canvas_new();
+	priv->fillNineSlice=NULL;
+	priv->fillPipeline=NULL;
 	priv->fillColor=xfdashboard_gradient_color_new_solid(CLUTTER_COLOR_Black);
 	priv->fillCorners=XFDASHBOARD_CORNERS_ALL;
 	priv->fillCornersRadius=0.0f;
@@ -894,8 +1295,8 @@ void xfdashboard_background_set_background_type(XfdashboardBackground *self, con
 		/* Set value */
 		priv->type=inType;
 
-		/* Force redraw of background canvas */
-		if(priv->fillCanvas) clutter_content_invalidate(priv->fillCanvas);
+		/* Force redraw of background */
+		_xfdashboard_background_invalidate_fill(self);
 
 		/* Enable or disable drawing outline and also check if type does not
 		 * include rounded corners set corner radius at outline to zero. But
@@ -973,8 +1374,8 @@ void xfdashboard_background_set_fill_color(XfdashboardBackground *self, const Xf
 		if(priv->fillColor) xfdashboard_gradient_color_free(priv->fillColor);
 		priv->fillColor=xfdashboard_gradient_color_copy(inColor);
 
-		/* Invalidate canvas to get it redrawn */
-		if(priv->fillCanvas) clutter_content_invalidate(priv->fillCanvas);
+		/* Invalidate background to get it redrawn */
+		_xfdashboard_background_invalidate_fill(self);
 
 		/* Notify about property change */
 		g_object_notify_by_pspec(G_OBJECT(self), XfdashboardBackgroundProperties[PROP_FILL_COLOR]);
@@ -1003,8 +1404,8 @@ void xfdashboard_background_set_fill_corners(XfdashboardBackground *self, const
 		/* Set value */
 		priv->fillCorners=inCorners;
 
-		/* Invalidate canvas to get it redrawn */
-		if(priv->fillCanvas) clutter_content_invalidate(priv->fillCanvas);
+		/* Invalidate background to get it redrawn */
+		_xfdashboard_background_invalidate_fill(self);
 
 		/* Notify about property change */
 		g_object_notify_by_pspec(G_OBJECT(self), XfdashboardBackgroundProperties[PROP_FILL_CORNERS]);
@@ -1034,8 +1435,8 @@ void xfdashboard_background_set_fill_corner_radius(XfdashboardBackground *self,
 		/* Set value */
 		priv->fillCornersRadius=inRadius;
 
-		/* Invalidate canvas to get it redrawn */
-		if(priv->fillCanvas) clutter_content_invalidate(priv->fillCanvas);
+		/* Invalidate background to get it redrawn */
+		_xfdashboard_background_invalidate_fill(self);
 
 		/* Notify about property change */
 		g_object_notify_by_pspec(G_OBJECT(self), XfdashboardBackgroundProperties[PROP_FILL_CORNERS_RADIUS]);
@@ -0,0 +1,299 @@
+/*
+ * cache-effect: Caches the rendering of an actor and its children in
+ *               an offscreen texture
+ * 
+ * Copyright 2012-2021 Stephan Haller <nomad@froevel.de>
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ * 
+ * 
+ */
+
+/**
+ * SECTION:cache-effect
+ * @short_description: An effect caching the rendering of an actor
+ * @include: xfdashboard/cache-effect.h
+ *
+ * #XfdashboardCacheEffect renders the actor it is applied to, including all
+ * its children, into an offscreen texture. As long as neither the actor nor
+ * any of its children queue a redraw or relayout and the actor is not
+ * transformed differently, the texture is reused and painting the actor
+ * only draws one textured rectangle. This is useful for large and mostly
+ * static actors like the grid of #XfdashboardApplicationsView or the
+ * #XfdashboardQuicklaunch which would otherwise be painted completely in
+ * each frame of an animation, e.g. when their opacity is faded.
+ *
+ * The effect is opt-in and is set up by themes. Define it in an effects XML
+ * file and add its ID to the `effects` property of an actor in CSS, e.g.
+ *
+ * |[<!-- language="xml" -->
+ *   <effects>
+ *     <object id="cache" class="XfdashboardCacheEffect">
+ *       <property name="max-size">4096</property>
+ *     </object>
+ *   </effects>
+ * ]|
+ *
+ * |[<!-- language="CSS" -->
+ *   XfdashboardQuicklaunch
+ *   {
+ *     effects: cache;
+ *   }
+ * ]|
+ *
+ * Actors changing their content in each frame, e.g. live windows, should not
+ * use this effect as they would be rendered twice in each frame.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <libxfdashboard/cache-effect.h>
+
+#include <glib/gi18n-lib.h>
+
+#include <libxfdashboard/statistics.h>
+#include <libxfdashboard/compat.h>
+
+
+/* Define this class in GObject system */
+struct _XfdashboardCacheEffectPrivate
+{
+	/* Properties related */
+	guint						maxSize;
+};
+
+G_DEFINE_TYPE_WITH_PRIVATE(XfdashboardCacheEffect,
+							xfdashboard_cache_effect,
+							CLUTTER_TYPE_OFFSCREEN_EFFECT)
+
+/* Properties */
+enum
+{
+	PROP_0,
+
+	PROP_MAX_SIZE,
+
+	PROP_LAST
+};
+
+static GParamSpec* XfdashboardCacheEffectProperties[PROP_LAST]={ 0, };
+
+
+/* IMPLEMENTATION: Private variables and methods */
+
+#define DEFAULT_MAX_SIZE			4096
+
+
+/* IMPLEMENTATION: ClutterEffect */
+
+/* Paint actor either from cached texture or render it into texture first */
+static void _xfdashboard_cache_effect_paint(ClutterEffect *inEffect, ClutterEffectPaintFlags inFlags)
+{
+	XfdashboardCacheEffect				*self;
+	XfdashboardCacheEffectPrivate		*priv;
+	ClutterActor						*target;
+	gfloat								width, height;
+
+	g_return_if_fail(XFDASHBOARD_IS_CACHE_EFFECT(inEffect));
+
+	self=XFDASHBOARD_CACHE_EFFECT(inEffect);
+	priv=self->priv;
+
+	/* Paint actor directly without caching if it is larger than the
+	 * maximum size allowed for the texture.
+	 */
+	target=clutter_actor_meta_get_actor(CLUTTER_ACTOR_META(self));
+	clutter_actor_get_size(target, &width, &height);
+	if(priv->maxSize>0 &&
+		(width>priv->maxSize || height>priv->maxSize))
+	{
+		xfdashboard_statistics_add("cache-effect.too-large", 1);
+
+		clutter_actor_continue_paint(target);
+		return;
+	}
+
+	/* Count if actor is rendered into texture because it changed or
+	 * if the cached texture could be reused.
+	 */
+	if(xfdashboard_statistics_is_enabled())
+	{
+		if((inFlags & CLUTTER_EFFECT_PAINT_ACTOR_DIRTY) ||
+			!clutter_offscreen_effect_get_texture(CLUTTER_OFFSCREEN_EFFECT(self)))
+		{
+			xfdashboard_statistics_add("cache-effect.dirty", 1);
+		}
+			else xfdashboard_statistics_add("cache-effect.clean", 1);
+	}
+
+	/* Chain up to let offscreen effect render actor into texture if needed
+	 * and to draw texture.
+	 */
+	CLUTTER_EFFECT_CLASS(xfdashboard_cache_effect_parent_class)->paint(inEffect, inFlags);
+}
+
+
+/* IMPLEMENTATION: GObject */
+
+/* Set/get properties */
+static void _xfdashboard_cache_effect_set_property(GObject *inObject,
+													guint inPropID,
+													const GValue *inValue,
+													GParamSpec *inSpec)
+{
+	XfdashboardCacheEffect			*self=XFDASHBOARD_CACHE_EFFECT(inObject);
+
+	switch(inPropID)
+	{
+		case PROP_MAX_SIZE:
+			xfdashboard_cache_effect_set_max_size(self, g_value_get_uint(inValue));
+			break;
+
+		default:
+			G_OBJECT_WARN_INVALID_PROPERTY_ID(inObject, inPropID, inSpec);
+			break;
+	}
+}
+
+static void _xfdashboard_cache_effect_get_property(GObject *inObject,
+													guint inPropID,
+													GValue *outValue,
+													GParamSpec *inSpec)
+{
+	XfdashboardCacheEffect			*self=XFDASHBOARD_CACHE_EFFECT(inObject);
+	XfdashboardCacheEffectPrivate	*priv=self->priv;
+
+	switch(inPropID)
+	{
+		case PROP_MAX_SIZE:
+			g_value_set_uint(outValue, priv->maxSize);
+			break;
+
+		default:
+			G_OBJECT_WARN_INVALID_PROPERTY_ID(inObject, inPropID, inSpec);
+			break;
+	}
+}
+
+/* Class initialization
+ * Override functions in parent classes and define properties
+ * and signals
+ */
+static void xfdashboard_cache_effect_class_init(XfdashboardCacheEffectClass *klass)
+{
+	ClutterEffectClass				*effectClass=CLUTTER_EFFECT_CLASS(klass);
+	GObjectClass					*gobjectClass=G_OBJECT_CLASS(klass);
+
+	/* Override functions */
+	gobjectClass->set_property=_xfdashboard_cache_effect_set_property;
+	gobjectClass->get_property=_xfdashboard_cache_effect_get_property;
+
+	effectClass->paint=_xfdashboard_cache_effect_paint;
+
+	/* Define properties */
+	/**
+	 * XfdashboardCacheEffect:max-size:
+	 *
+	 * The maximum width and height in pixels of an actor to cache. Larger
+	 * actors are painted directly as their texture would need too much
+	 * memory or may exceed the texture size supported by the graphics
+	 * hardware. A value of zero does not limit the size.
+	 */
+	XfdashboardCacheEffectProperties[PROP_MAX_SIZE]=
+		g_param_spec_uint("max-size",
+							"Maximum size",
+							"Maximum width and height of actor to cache or zero for unlimited size",
+							0, G_MAXUINT,
+							DEFAULT_MAX_SIZE,
+							G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+
+	g_object_class_install_properties(gobjectClass, PROP_LAST, XfdashboardCacheEffectProperties);
+}
+
+/* Object initialization
+ * Create private structure and set up default values
+ */
+static void xfdashboard_cache_effect_init(XfdashboardCacheEffect *self)
+{
+	XfdashboardCacheEffectPrivate	*priv;
+
+	priv=self->priv=xfdashboard_cache_effect_get_instance_private(self);
+
+	/* Set up default values */
+	priv->maxSize=DEFAULT_MAX_SIZE;
+}
+
+
+/* IMPLEMENTATION: Public API */
+
+/**
+ * xfdashboard_cache_effect_new:
+ *
+ * Creates a new effect caching the rendering of the actor it is applied to.
+ *
+ * Returns: The newly created #XfdashboardCacheEffect
+ */
+ClutterEffect* xfdashboard_cache_effect_new(void)
+{
+	return(g_object_new(XFDASHBOARD_TYPE_CACHE_EFFECT, NULL));
+}
+
+/**
+ * xfdashboard_cache_effect_get_max_size:
+ * @self: A #XfdashboardCacheEffect
+ *
+ * Retrieves the maximum width and height of an actor to cache.
+ *
+ * Returns: The maximum size in pixels or zero if size is unlimited
+ */
+guint xfdashboard_cache_effect_get_max_size(XfdashboardCacheEffect *self)
+{
+	g_return_val_if_fail(XFDASHBOARD_IS_CACHE_EFFECT(self), 0);
+
+	return(self->priv->maxSize);
+}
+
+/**
+ * xfdashboard_cache_effect_set_max_size:
+ * @self: A #XfdashboardCacheEffect
+ * @inMaxSize: The maximum size in pixels or zero for unlimited size
+ *
+ * Sets the maximum width and height of an actor to cache at @inMaxSize.
+ * Larger actors are painted directly.
+ */
+void xfdashboard_cache_effect_set_max_size(XfdashboardCacheEffect *self, const guint inMaxSize)
+{
+	XfdashboardCacheEffectPrivate	*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_CACHE_EFFECT(self));
+
+	priv=self->priv;
+
+	/* Set value if changed */
+	if(priv->maxSize!=inMaxSize)
+	{
+		/* Set value */
+		priv->maxSize=inMaxSize;
+
+		/* Redraw actor as it may be painted differently now */
+		clutter_effect_queue_repaint(CLUTTER_EFFECT(self));
+
+		/* Notify about property change */
+		g_object_notify_by_pspec(G_OBJECT(self), XfdashboardCacheEffectProperties[PROP_MAX_SIZE]);
+	}
+}
@@ -0,0 +1,74 @@
+/*
+ * cache-effect: Caches the rendering of an actor and its children in
+ *               an offscreen texture
+ * 
+ * Copyright 2012-2021 Stephan Haller <nomad@froevel.de>
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ * 
+ * 
+ */
+
+#ifndef __LIBXFDASHBOARD_CACHE_EFFECT__
+#define __LIBXFDASHBOARD_CACHE_EFFECT__
+
+#if !defined(__LIBXFDASHBOARD_H_INSIDE__) && !defined(LIBXFDASHBOARD_COMPILATION)
+#error "Only <libxfdashboard/libxfdashboard.h> can be included directly."
+#endif
+
+#include <clutter/clutter.h>
+
+G_BEGIN_DECLS
+
+#define XFDASHBOARD_TYPE_CACHE_EFFECT				(xfdashboard_cache_effect_get_type())
+#define XFDASHBOARD_CACHE_EFFECT(obj)				(G_TYPE_CHECK_INSTANCE_CAST((obj), XFDASHBOARD_TYPE_CACHE_EFFECT, XfdashboardCacheEffect))
+#define XFDASHBOARD_IS_CACHE_EFFECT(obj)			(G_TYPE_CHECK_INSTANCE_TYPE((obj), XFDASHBOARD_TYPE_CACHE_EFFECT))
+#define XFDASHBOARD_CACHE_EFFECT_CLASS(klass)		(G_TYPE_CHECK_CLASS_CAST((klass), XFDASHBOARD_TYPE_CACHE_EFFECT, XfdashboardCacheEffectClass))
+#define XFDASHBOARD_IS_CACHE_EFFECT_CLASS(klass)	(G_TYPE_CHECK_CLASS_TYPE((klass), XFDASHBOARD_TYPE_CACHE_EFFECT))
+#define XFDASHBOARD_CACHE_EFFECT_GET_CLASS(obj)		(G_TYPE_INSTANCE_GET_CLASS((obj), XFDASHBOARD_TYPE_CACHE_EFFECT, XfdashboardCacheEffectClass))
+
+typedef struct _XfdashboardCacheEffect				XfdashboardCacheEffect;
+typedef struct _XfdashboardCacheEffectClass			XfdashboardCacheEffectClass;
+typedef struct _XfdashboardCacheEffectPrivate		XfdashboardCacheEffectPrivate;
+
+struct _XfdashboardCacheEffect
+{
+	/*< private >*/
+	/* Parent instance */
+	ClutterOffscreenEffect				parent_instance;
+
+	/* Private structure */
+	XfdashboardCacheEffectPrivate		*priv;
+};
+
+struct _XfdashboardCacheEffectClass
+{
+	/*< private >*/
+	/* Parent class */
+	ClutterOffscreenEffectClass			parent_class;
+};
+
+/* Public API */
+GType xfdashboard_cache_effect_get_type(void) G_GNUC_CONST;
+
+ClutterEffect* xfdashboard_cache_effect_new(void);
+
+guint xfdashboard_cache_effect_get_max_size(XfdashboardCacheEffect *self);
+void xfdashboard_cache_effect_set_max_size(XfdashboardCacheEffect *self, const guint inMaxSize);
+
+G_END_DECLS
+
+#endif	/* __LIBXFDASHBOARD_CACHE_EFFECT__ */
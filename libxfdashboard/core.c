@@ -53,6 +53,8 @@
 #include <libxfdashboard/utils.h>
 #include <libxfdashboard/theme.h>
 #include <libxfdashboard/marshal.h>
+#include <libxfdashboard/statistics.h>
+#include <libxfdashboard/profiler.h>
 #include <libxfdashboard/compat.h>
 #include <libxfdashboard/debug.h>
 
@@ -462,6 +464,10 @@ static void _xfdashboard_core_dispose(GObject *inObject)
 	/* Signal "shutdown-final" of application */
 	g_signal_emit(self, XfdashboardCoreSignals[SIGNAL_SHUTDOWN], 0);
 
+	/* Write statistics collected and profiler trace (if enabled) */
+	xfdashboard_statistics_dump();
+	xfdashboard_profiler_dump();
+
 	/* Release allocated resources */
 	if(priv->windowTrackerBackend)
 	{
@@ -1083,6 +1083,34 @@ void xfdashboard_css_selector_adjust_to_offset(XfdashboardCssSelector *self, gin
 	}
 }
 
+/* Set source, line and position of this selector, e.g. when it was recreated
+ * from its string representation stored in a cache.
+ */
+void xfdashboard_css_selector_adjust_to_source(XfdashboardCssSelector *self,
+												const gchar *inSource,
+												guint inLine,
+												guint inPosition)
+{
+	XfdashboardCssSelectorRule		*rule;
+
+	g_return_if_fail(XFDASHBOARD_IS_CSS_SELECTOR(self));
+
+	/* Set source at all rules of this selector */
+	for(rule=self->priv->rule; rule; rule=rule->parentRule)
+	{
+		if(rule->source) g_free(rule->source);
+		rule->source=g_strdup(inSource);
+	}
+
+	/* Set line and position at top-level rule */
+	rule=self->priv->rule;
+	if(rule)
+	{
+		rule->origLine=rule->line=inLine;
+		rule->origPosition=rule->position=inPosition;
+	}
+}
+
 /* Get rule parsed */
 XfdashboardCssSelectorRule* xfdashboard_css_selector_get_rule(XfdashboardCssSelector *self)
 {
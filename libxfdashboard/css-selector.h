@@ -95,6 +95,10 @@ gchar* xfdashboard_css_selector_to_string(XfdashboardCssSelector *self);
 gint xfdashboard_css_selector_score(XfdashboardCssSelector *self, XfdashboardStylable *inStylable);
 
 void xfdashboard_css_selector_adjust_to_offset(XfdashboardCssSelector *self, gint inLine, gint inPosition);
+void xfdashboard_css_selector_adjust_to_source(XfdashboardCssSelector *self,
+												const gchar *inSource,
+												guint inLine,
+												guint inPosition);
 
 XfdashboardCssSelectorRule* xfdashboard_css_selector_get_rule(XfdashboardCssSelector *self);
 
@@ -30,6 +30,8 @@
 
 #include <libxfdashboard/desktop-app-info.h>
 #include <libxfdashboard/application-database.h>
+#include <libxfdashboard/statistics.h>
+#include <libxfdashboard/profiler.h>
 #include <libxfdashboard/compat.h>
 #include <libxfdashboard/debug.h>
 
@@ -51,6 +53,7 @@ struct _XfdashboardDesktopAppInfoPrivate
 
 	GarconMenuItem		*item;
 	guint				itemChangedID;
+	gboolean			itemDeferred;
 
 	GKeyFile			*secondarySource;
 
@@ -61,6 +64,18 @@ struct _XfdashboardDesktopAppInfoPrivate
 
 	gboolean			needKeywords;
 	GList				*keywords;
+
+	gboolean			hasCachedData;
+	gchar				*cachedName;
+	gchar				*cachedComment;
+	gchar				*cachedIconName;
+	gchar				*cachedCommand;
+	gchar				*cachedStartupWMClass;
+	gchar				*cachedTryExec;
+	gboolean			cachedVisible;
+	gchar				**cachedCategories;
+
+	gchar				**launchEnvironment;
 };
 
 G_DEFINE_TYPE_WITH_CODE(XfdashboardDesktopAppInfo,
@@ -88,6 +103,7 @@ enum
 {
 	SIGNAL_CHANGED,
 	SIGNAL_RELOAD,
+	SIGNAL_LAUNCH_FAILED,
 
 	SIGNAL_LAST
 };
@@ -95,13 +111,19 @@ enum
 static guint XfdashboardDesktopAppInfoSignals[SIGNAL_LAST]={ 0, };
 
 /* IMPLEMENTATION: Private variables and methods */
+
+/* Forward declarations */
+static void _xfdashboard_desktop_app_info_ensure_item(XfdashboardDesktopAppInfo *self);
+
+#define LAUNCH_PID_LENGTH			20
+
 typedef struct
 {
-	gchar	*display;
-	gchar	*startupNotificationID;
-	gchar	*desktopFile;
+	gchar	*pidValue;
 } XfdashboardDesktopAppInfoChildSetupData;
 
+static GDBusConnection		*_xfdashboard_desktop_app_info_session_bus=NULL;
+
 /* Load secondary source file if not already done.
  * Note: It is called secondary source although it is the same file as used
  * for GarconMenuItem. But it is not the same source because the file is loaded
@@ -168,6 +190,26 @@ static gboolean _xfdashboard_desktop_app_info_load_secondary_source(XfdashboardD
 	return(TRUE);
 }
 
+/* Get path to executable file from command by striping white-space from the
+ * beginning of the command to execute when launching up to first white-space
+ * after the first command-line argument (which is the command).
+ */
+static gchar* _xfdashboard_desktop_app_info_get_binary_executable(const gchar *inCommand)
+{
+	const gchar								*commandStart;
+	const gchar								*commandEnd;
+
+	g_return_val_if_fail(inCommand, NULL);
+
+	while(*inCommand==' ') inCommand++;
+	commandStart=inCommand;
+
+	while(*inCommand && *inCommand!=' ') inCommand++;
+	commandEnd=inCommand;
+
+	return(g_strndup(commandStart, commandEnd-commandStart));
+}
+
 /* Get or update path to executable file for this application */
 static void _xfdashboard_desktop_app_info_update_binary_executable(XfdashboardDesktopAppInfo *self)
 {
@@ -177,10 +219,7 @@ static void _xfdashboard_desktop_app_info_update_binary_executable(XfdashboardDe
 
 	priv=self->priv;
 
-	/* Get path to executable file for this application by striping white-space from
-	 * the beginning of the command to execute when launching up to first white-space
-	 * after the first command-line argument (which is the command).
-	 */
+	/* Get path to executable file for this application */
 	if(priv->binaryExecutable)
 	{
 		g_free(priv->binaryExecutable);
@@ -189,19 +228,62 @@ static void _xfdashboard_desktop_app_info_update_binary_executable(XfdashboardDe
 
 	if(priv->item)
 	{
-		const gchar						*command;
-		const gchar						*commandStart;
-		const gchar						*commandEnd;
+		priv->binaryExecutable=_xfdashboard_desktop_app_info_get_binary_executable(garcon_menu_item_get_command(priv->item));
+	}
+}
+
+/* Release data of desktop file cached at application database */
+static void _xfdashboard_desktop_app_info_clear_cached_data(XfdashboardDesktopAppInfo *self)
+{
+	XfdashboardDesktopAppInfoPrivate		*priv;
 
-		command=garcon_menu_item_get_command(priv->item);
+	g_return_if_fail(XFDASHBOARD_IS_DESKTOP_APP_INFO(self));
 
-		while(*command==' ') command++;
-		commandStart=command;
+	priv=self->priv;
 
-		while(*command && *command!=' ') command++;
-		commandEnd=command;
+	priv->hasCachedData=FALSE;
+	priv->cachedVisible=FALSE;
 
-		priv->binaryExecutable=g_strndup(commandStart, commandEnd-commandStart);
+	if(priv->cachedName)
+	{
+		g_free(priv->cachedName);
+		priv->cachedName=NULL;
+	}
+
+	if(priv->cachedComment)
+	{
+		g_free(priv->cachedComment);
+		priv->cachedComment=NULL;
+	}
+
+	if(priv->cachedIconName)
+	{
+		g_free(priv->cachedIconName);
+		priv->cachedIconName=NULL;
+	}
+
+	if(priv->cachedCommand)
+	{
+		g_free(priv->cachedCommand);
+		priv->cachedCommand=NULL;
+	}
+
+	if(priv->cachedStartupWMClass)
+	{
+		g_free(priv->cachedStartupWMClass);
+		priv->cachedStartupWMClass=NULL;
+	}
+
+	if(priv->cachedTryExec)
+	{
+		g_free(priv->cachedTryExec);
+		priv->cachedTryExec=NULL;
+	}
+
+	if(priv->cachedCategories)
+	{
+		g_strfreev(priv->cachedCategories);
+		priv->cachedCategories=NULL;
 	}
 }
 
@@ -217,6 +299,8 @@ static void _xfdashboard_desktop_app_info_update_actions(XfdashboardDesktopAppIn
 	/* Reload only if needed */
 	if(!priv->needActions) return;
 
+	_xfdashboard_desktop_app_info_ensure_item(self);
+
 	/* Remove old actions loaded */
 	if(priv->actions)
 	{
@@ -413,6 +497,8 @@ static void _xfdashboard_desktop_app_info_update_keywords(XfdashboardDesktopAppI
 	/* Reload only if needed */
 	if(!priv->needKeywords) return;
 
+	_xfdashboard_desktop_app_info_ensure_item(self);
+
 	/* Remove old actions loaded */
 	if(priv->keywords)
 	{
@@ -506,6 +592,62 @@ static void _xfdashboard_desktop_app_info_on_item_changed(XfdashboardDesktopAppI
 	g_signal_emit(self, XfdashboardDesktopAppInfoSignals[SIGNAL_CHANGED], 0);
 }
 
+/* Take menu item loaded from desktop file which was not set before */
+static void _xfdashboard_desktop_app_info_take_item(XfdashboardDesktopAppInfo *self,
+														GarconMenuItem *inMenuItem)
+{
+	XfdashboardDesktopAppInfoPrivate		*priv;
+	gboolean								valid;
+
+	g_return_if_fail(XFDASHBOARD_IS_DESKTOP_APP_INFO(self));
+	g_return_if_fail(!inMenuItem || GARCON_IS_MENU_ITEM(inMenuItem));
+
+	priv=self->priv;
+
+	g_return_if_fail(priv->item==NULL);
+
+	/* Set menu item and connect signal to get notified about changes */
+	priv->item=inMenuItem;
+	if(priv->item)
+	{
+		priv->itemChangedID=g_signal_connect_swapped(priv->item,
+														"changed",
+														G_CALLBACK(_xfdashboard_desktop_app_info_on_item_changed),
+														self);
+	}
+
+	/* Get path to executable file for this application */
+	_xfdashboard_desktop_app_info_update_binary_executable(self);
+
+	/* Update valid flag if it differs from the one assumed before */
+	valid=(priv->item!=NULL);
+	if(priv->isValid!=valid)
+	{
+		/* Set value */
+		priv->isValid=valid;
+
+		/* Notify about property change */
+		g_object_notify_by_pspec(G_OBJECT(self), XfdashboardDesktopAppInfoProperties[PROP_VALID]);
+	}
+}
+
+/* Load menu item from desktop file if loading was deferred */
+static void _xfdashboard_desktop_app_info_ensure_item(XfdashboardDesktopAppInfo *self)
+{
+	XfdashboardDesktopAppInfoPrivate		*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_DESKTOP_APP_INFO(self));
+
+	priv=self->priv;
+
+	/* Do nothing if menu item was not deferred or is loaded already */
+	if(G_LIKELY(!priv->itemDeferred)) return;
+	priv->itemDeferred=FALSE;
+
+	/* Load menu item */
+	_xfdashboard_desktop_app_info_take_item(self, priv->file ? garcon_menu_item_new(priv->file) : NULL);
+}
+
 /* Set desktop ID */
 static void _xfdashboard_desktop_app_info_set_desktop_id(XfdashboardDesktopAppInfo *self,
 															const gchar *inDesktopID)
@@ -559,6 +701,9 @@ static void _xfdashboard_desktop_app_info_set_file(XfdashboardDesktopAppInfo *se
 			priv->secondarySource=NULL;
 		}
 
+		/* Release cached data which refers to previous file */
+		_xfdashboard_desktop_app_info_clear_cached_data(self);
+
 		/* Replace current file to menu item with new one */
 		if(priv->file)
 		{
@@ -567,7 +712,15 @@ static void _xfdashboard_desktop_app_info_set_file(XfdashboardDesktopAppInfo *se
 		}
 		if(inFile) priv->file=g_object_ref(inFile);
 
+		/* Prepared environment for launching refers to previous file */
+		if(priv->launchEnvironment)
+		{
+			g_strfreev(priv->launchEnvironment);
+			priv->launchEnvironment=NULL;
+		}
+
 		/* Replace current menu item with new one */
+		priv->itemDeferred=FALSE;
 		if(priv->item)
 		{
 			if(priv->itemChangedID)
@@ -837,65 +990,190 @@ static gboolean _xfdashboard_desktop_app_info_expand_macros(XfdashboardDesktopAp
 #endif
 
 /* Child process for launching application was spawned but application
- * was not executed yet so we can set up environment etc. now.
+ * was not executed yet. The environment was prepared before spawning but
+ * the PID of child process is only known now, so write it into the space
+ * reserved for it at environment.
  * 
  * Note: Do not use any kind of dynamically allocated memory like
  *       GObject instances or memory allocation functions like g_new,
  *       malloc etc., and also do not ref or unref any GObject instances
  *       because we cannot be sure that memory is cleaned up and references
  *       are incremented/decremented in spawned (forked) child process.
+ *       For the same reason the PID is not formatted by printf-like
+ *       functions but converted by hand.
  */
 static void _xfdashboard_desktop_app_info_on_child_spawned(gpointer inUserData)
 {
 	XfdashboardDesktopAppInfoChildSetupData		*data=(XfdashboardDesktopAppInfoChildSetupData*)inUserData;
+	gchar										buffer[LAUNCH_PID_LENGTH];
+	glong										pid;
+	gint										i;
 
-	g_return_if_fail(data);
+	if(!data || !data->pidValue) return;
 
-	/* Set up environment */
-	if(data->display)
+	/* Write PID backwards into buffer first, then copy it in right order */
+	pid=(glong)getpid();
+	i=0;
+	do
 	{
-		g_setenv("DISPLAY", data->display, TRUE);
+		buffer[i++]='0'+(pid % 10);
+		pid/=10;
 	}
+	while(pid>0 && i<LAUNCH_PID_LENGTH);
+
+	for(i--; i>=0; i--) *(data->pidValue++)=buffer[i];
+	*data->pidValue=0;
+}
 
-	if(data->startupNotificationID)
+/* Session bus connection was established. Keep it to send notifications about
+ * launched applications without blocking and send the notification message
+ * if one is pending.
+ */
+static void _xfdashboard_desktop_app_info_on_session_bus_ready(GObject *inSource,
+																GAsyncResult *inResult,
+																gpointer inUserData)
+{
+	GDBusMessage							*message;
+	GDBusConnection							*sessionBus;
+	GError									*error;
+
+	message=G_DBUS_MESSAGE(inUserData);
+	error=NULL;
+
+	/* Get session bus */
+	sessionBus=g_bus_get_finish(inResult, &error);
+	if(!sessionBus)
 	{
-		g_setenv("DESKTOP_STARTUP_ID", data->startupNotificationID, TRUE);
+		XFDASHBOARD_DEBUG(NULL, APPLICATIONS,
+							"Could not connect to session bus: %s",
+							(error && error->message) ? error->message : "Unknown error");
+
+		/* Release allocated resources */
+		if(error) g_error_free(error);
+		if(message) g_object_unref(message);
+
+		return;
 	}
 
-	if(data->desktopFile)
+	/* Keep session bus connection for further launches */
+	if(!_xfdashboard_desktop_app_info_session_bus)
 	{
-		gchar									pid[20];
+		_xfdashboard_desktop_app_info_session_bus=g_object_ref(sessionBus);
+	}
 
-		g_setenv("GIO_LAUNCHED_DESKTOP_FILE", data->desktopFile, TRUE);
+	/* Send pending notification message */
+	if(message)
+	{
+		g_dbus_connection_send_message(sessionBus, message, 0, NULL, NULL);
 
-		g_snprintf(pid, 20, "%ld", (long)getpid());
-		g_setenv("GIO_LAUNCHED_DESKTOP_FILE_PID", pid, TRUE);
+		/* It is safe to unreference DBUS session bus object after
+		 * calling flush function even if the flush function is
+		 * a asynchronous function because it takes its own reference
+		 * on the session bus to keep it alive until flush is complete.
+		 */
+		g_dbus_connection_flush(sessionBus, NULL, NULL, NULL);
+		g_object_unref(message);
 	}
+
+	/* Release allocated resources */
+	g_object_unref(sessionBus);
 }
 
-#if !LIBXFCE4UTIL_CHECK_VERSION(4, 15, 2)
+/* Connect to session bus ahead of time, so it is ready when an application
+ * is launched and the notification about it can be sent without blocking.
+ * It must be requested at main thread as the connection is established
+ * asynchronously at its main context.
+ */
+static void _xfdashboard_desktop_app_info_warmup_session_bus(void)
+{
+	static gboolean							requested=FALSE;
 
-static gboolean _xfdashboard_desktop_app_info_launch_appinfo_internal(XfdashboardDesktopAppInfo *self,
-																		const gchar *inCommand,
-																		GList *inURIs,
-																		GAppLaunchContext *inContext,
-																		GError **outError)
+	if(G_LIKELY(requested)) return;
+	if(!g_main_context_is_owner(g_main_context_default())) return;
+	requested=TRUE;
+
+	g_bus_get(G_BUS_TYPE_SESSION,
+				NULL,
+				_xfdashboard_desktop_app_info_on_session_bus_ready,
+				NULL);
+}
+
+/* Send notification message about launched application at session bus.
+ * If connection to session bus is not established yet, it is done
+ * asynchronously and the message is sent when it is ready.
+ */
+static void _xfdashboard_desktop_app_info_send_launched_message(GDBusMessage *inMessage)
+{
+	g_return_if_fail(G_IS_DBUS_MESSAGE(inMessage));
+
+	if(_xfdashboard_desktop_app_info_session_bus)
+	{
+		g_dbus_connection_send_message(_xfdashboard_desktop_app_info_session_bus, inMessage, 0, NULL, NULL);
+		g_dbus_connection_flush(_xfdashboard_desktop_app_info_session_bus, NULL, NULL, NULL);
+		return;
+	}
+
+	g_bus_get(G_BUS_TYPE_SESSION,
+				NULL,
+				_xfdashboard_desktop_app_info_on_session_bus_ready,
+				g_object_ref(inMessage));
+}
+
+/* Get environment to launch application with. It is the environment of this
+ * process plus the desktop file of this application. It is prepared once and
+ * cached as it does not change between launches of this application.
+ */
+static gchar** _xfdashboard_desktop_app_info_get_launch_environment(XfdashboardDesktopAppInfo *self)
+{
+	XfdashboardDesktopAppInfoPrivate			*priv;
+	gchar										*desktopFile;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_DESKTOP_APP_INFO(self), NULL);
+
+	priv=self->priv;
+
+	/* Return cached environment if available */
+	if(priv->launchEnvironment) return(priv->launchEnvironment);
+
+	/* Prepare environment */
+	priv->launchEnvironment=g_get_environ();
+
+	if(priv->file)
+	{
+		desktopFile=g_file_get_path(priv->file);
+		if(desktopFile)
+		{
+			priv->launchEnvironment=g_environ_setenv(priv->launchEnvironment, "GIO_LAUNCHED_DESKTOP_FILE", desktopFile, TRUE);
+			g_free(desktopFile);
+		}
+	}
+
+	xfdashboard_statistics_add("desktop-app-info.environment-prepared", 1);
+
+	return(priv->launchEnvironment);
+}
+
+/* Launch application with command-line arguments and notify about it */
+static gboolean _xfdashboard_desktop_app_info_launch_argv(XfdashboardDesktopAppInfo *self,
+															gchar **inArgv,
+															GList *inURIs,
+															GAppLaunchContext *inContext,
+															GError **outError)
 {
 	XfdashboardDesktopAppInfoPrivate			*priv;
-	GString										*expanded;
 	gchar										*display;
 	gchar										*startupNotificationID;
 	gchar										*desktopFile;
 	const gchar									*workingDirectory;
+	gchar										**envp;
 	gboolean									success;
 	GPid										launchedPID;
-	gint										argc;
-	gchar										**argv;
 	GError										*error;
+	gint64										spawnBeginTime;
 	XfdashboardDesktopAppInfoChildSetupData		childSetup;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_DESKTOP_APP_INFO(self), FALSE);
-	g_return_val_if_fail(inCommand && *inCommand, FALSE);
+	g_return_val_if_fail(inArgv && *inArgv, FALSE);
 	g_return_val_if_fail(!inContext || G_IS_APP_LAUNCH_CONTEXT(inContext), FALSE);
 	g_return_val_if_fail(outError && *outError==NULL, FALSE);
 
@@ -904,51 +1182,8 @@ static gboolean _xfdashboard_desktop_app_info_launch_appinfo_internal(Xfdashboar
 	startupNotificationID=NULL;
 	desktopFile=NULL;
 	success=FALSE;
-	argc=0;
-	argv=NULL;
 	error=NULL;
 
-	/* Get command-line with expanded macros */
-	expanded=g_string_new(NULL);
-	if(!expanded ||
-		!_xfdashboard_desktop_app_info_expand_macros(self, inCommand, inURIs, expanded))
-	{
-		/* Set error */
-		g_set_error_literal(outError,
-								G_IO_ERROR,
-								G_IO_ERROR_FAILED,
-								"Unable to expand macros at command-line.");
-
-		/* Release allocated resources */
-		if(expanded) g_string_free(expanded, TRUE);
-
-		/* Return error state */
-		return(FALSE);
-	}
-
-	/* If a terminal is required, prepend "exo-open" command.
-	 * NOTE: The space at end of command is important to separate
-	 *       the command we prepend from command-line of application.
-	 */
-	if(garcon_menu_item_requires_terminal(priv->item))
-	{
-		g_string_prepend(expanded, "exo-open --launch TerminalEmulator ");
-	}
-
-	/* Get command-line arguments as string list */
-	if(!g_shell_parse_argv(expanded->str, &argc, &argv, &error))
-	{
-		/* Propagate error */
-		g_propagate_error(outError, error);
-
-		/* Release allocated resources */
-		if(argv) g_strfreev(argv);
-		if(expanded) g_string_free(expanded, TRUE);
-
-		/* Return error state */
-		return(FALSE);
-	}
-
 	/* Set up launch context, e.g. display and startup notification */
 	if(inContext)
 	{
@@ -997,143 +1232,143 @@ static gboolean _xfdashboard_desktop_app_info_launch_appinfo_internal(Xfdashboar
 			/* Working directory does not exist or is not a directory */
 			g_warning("Working directory '%s' does not exist. It won't be used when launching '%s'.",
 						workingDirectory,
-						*argv);
+						*inArgv);
 
 			/* Do not set working directory */
 			workingDirectory=NULL;
 		}
 
 	/* Get desktop file of application to launch */
-	desktopFile=g_file_get_path(priv->file);
+	if(priv->file) desktopFile=g_file_get_path(priv->file);
+
+	/* Set up environment from prepared one and reserve space for PID of
+	 * child process which is set when child process was spawned.
+	 */
+	envp=g_strdupv(_xfdashboard_desktop_app_info_get_launch_environment(self));
+	if(display) envp=g_environ_setenv(envp, "DISPLAY", display, TRUE);
+	if(startupNotificationID) envp=g_environ_setenv(envp, "DESKTOP_STARTUP_ID", startupNotificationID, TRUE);
+
+	childSetup.pidValue=NULL;
+	if(g_environ_getenv(envp, "GIO_LAUNCHED_DESKTOP_FILE"))
+	{
+		gchar									*pidSpace;
+
+		pidSpace=g_strnfill(LAUNCH_PID_LENGTH, '0');
+		envp=g_environ_setenv(envp, "GIO_LAUNCHED_DESKTOP_FILE_PID", pidSpace, TRUE);
+		childSetup.pidValue=(gchar*)g_environ_getenv(envp, "GIO_LAUNCHED_DESKTOP_FILE_PID");
+		g_free(pidSpace);
+	}
 
 	/* Launch application */
-	childSetup.display=display;
-	childSetup.startupNotificationID=startupNotificationID;
-	childSetup.desktopFile=desktopFile;
+	spawnBeginTime=xfdashboard_profiler_begin("applications");
 	success=g_spawn_async(workingDirectory,
-							argv,
-							NULL,
+							inArgv,
+							envp,
 							G_SPAWN_SEARCH_PATH,
 							_xfdashboard_desktop_app_info_on_child_spawned,
 							&childSetup,
 							&launchedPID,
 							&error);
+	xfdashboard_profiler_end("applications", "desktop-app-info.spawn", spawnBeginTime);
+
 	if(success)
 	{
-		GDBusConnection							*sessionBus;
+		GDBusMessage							*message;
+		GVariantBuilder							uris;
+		GVariantBuilder							extras;
+		GList									*iter;
+		const gchar								*desktopFileID;
+		const gchar								*gioDesktopFile;
+		const gchar								*programName;
 
 		XFDASHBOARD_DEBUG(self, APPLICATIONS,
 							"Launching %s succeeded with PID %ld.",
 							garcon_menu_item_get_name(priv->item),
 							(long)launchedPID);
 
-		/* Open connection to DBUS session bus and send notification about
-		 * successful launch of application. Then flush and close DBUS
-		 * session bus connection.
-		 */
-		sessionBus=g_bus_get_sync(G_BUS_TYPE_SESSION, NULL, NULL);
-		if(sessionBus)
+		/* Build list of URIs */
+		g_variant_builder_init(&uris, G_VARIANT_TYPE("as"));
+		for(iter=inURIs; iter; iter=g_list_next(iter))
 		{
-			GDBusMessage						*message;
-			GVariantBuilder						uris;
-			GVariantBuilder						extras;
-			GList								*iter;
-			const gchar							*desktopFileID;
-			const gchar							*gioDesktopFile;
-			const gchar							*programName;
-
-			/* Build list of URIs */
-			g_variant_builder_init(&uris, G_VARIANT_TYPE("as"));
-			for(iter=inURIs; iter; iter=g_list_next(iter))
-			{
-				g_variant_builder_add(&uris, "s", (const gchar*)iter->data);
-			}
-
-			/* Build list of extra information */
-			g_variant_builder_init(&extras, G_VARIANT_TYPE("a{sv}"));
-			if(startupNotificationID &&
-				g_utf8_validate(startupNotificationID, -1, NULL))
-			{
-				g_variant_builder_add(&extras,
-										"{sv}",
-										"startup-id",
-										g_variant_new("s", startupNotificationID));
-			}
+			g_variant_builder_add(&uris, "s", (const gchar*)iter->data);
+		}
 
-			gioDesktopFile=g_getenv("GIO_LAUNCHED_DESKTOP_FILE");
-			if(gioDesktopFile)
-			{
-				g_variant_builder_add(&extras,
-										"{sv}",
-										"origin-desktop-file",
-										g_variant_new_bytestring(gioDesktopFile));
-			}
+		/* Build list of extra information */
+		g_variant_builder_init(&extras, G_VARIANT_TYPE("a{sv}"));
+		if(startupNotificationID &&
+			g_utf8_validate(startupNotificationID, -1, NULL))
+		{
+			g_variant_builder_add(&extras,
+									"{sv}",
+									"startup-id",
+									g_variant_new("s", startupNotificationID));
+		}
 
-			programName=g_get_prgname();
-			if(programName)
-			{
-				g_variant_builder_add(&extras,
-										"{sv}",
-										"origin-prgname",
-										g_variant_new_bytestring(programName));
-			}
+		gioDesktopFile=g_getenv("GIO_LAUNCHED_DESKTOP_FILE");
+		if(gioDesktopFile)
+		{
+			g_variant_builder_add(&extras,
+									"{sv}",
+									"origin-desktop-file",
+									g_variant_new_bytestring(gioDesktopFile));
+		}
 
+		programName=g_get_prgname();
+		if(programName)
+		{
 			g_variant_builder_add(&extras,
 									"{sv}",
-									"origin-pid",
-									g_variant_new("x", (gint64)getpid()));
-
-			if(priv->desktopID) desktopFileID=priv->desktopID;
-				else if(priv->file) desktopFileID=desktopFile;
-				else desktopFileID="";
-
-			message=g_dbus_message_new_signal("/org/gtk/gio/DesktopAppInfo",
-												"org.gtk.gio.DesktopAppInfo",
-												"Launched");
-			g_dbus_message_set_body(message,
-										g_variant_new
-										(
-											"(@aysxasa{sv})",
-											g_variant_new_bytestring(desktopFileID),
-											display ? display : "",
-											(gint64)launchedPID,
-											&uris,
-											&extras
-										));
-			g_dbus_connection_send_message(sessionBus,
-											message,
-											0,
-											NULL,
-											NULL);
+									"origin-prgname",
+									g_variant_new_bytestring(programName));
+		}
 
-			g_object_unref(message);
+		g_variant_builder_add(&extras,
+								"{sv}",
+								"origin-pid",
+								g_variant_new("x", (gint64)getpid()));
 
-			/* It is safe to unreference DBUS session bus object after
-			 * calling flush function even if the flush function is
-			 * a asynchronous function because it takes its own reference
-			 * on the session bus to keep it alive until flush is complete.
-			 */
-			g_dbus_connection_flush(sessionBus, NULL, NULL, NULL);
-			g_object_unref(sessionBus);
-		}
+		if(priv->desktopID) desktopFileID=priv->desktopID;
+			else if(desktopFile) desktopFileID=desktopFile;
+			else desktopFileID="";
+
+		/* Send notification about successful launch of application at
+		 * DBUS session bus without waiting for the connection to it.
+		 */
+		message=g_dbus_message_new_signal("/org/gtk/gio/DesktopAppInfo",
+											"org.gtk.gio.DesktopAppInfo",
+											"Launched");
+		g_dbus_message_set_body(message,
+									g_variant_new
+									(
+										"(@aysxasa{sv})",
+										g_variant_new_bytestring(desktopFileID),
+										display ? display : "",
+										(gint64)launchedPID,
+										&uris,
+										&extras
+									));
+		_xfdashboard_desktop_app_info_send_launched_message(message);
+		g_object_unref(message);
 	}
 		else
 		{
 			g_warning("Launching %s failed!", garcon_menu_item_get_name(priv->item));
 
-			/* Propagate error */
-			g_propagate_error(outError, error);
-
 			/* Tell context about failed application launch */
 			if(startupNotificationID)
 			{
 				g_app_launch_context_launch_failed(inContext, startupNotificationID);
 			}
+
+			/* Emit signal for failed application launch */
+			g_signal_emit(self, XfdashboardDesktopAppInfoSignals[SIGNAL_LAUNCH_FAILED], 0, error);
+
+			/* Propagate error */
+			g_propagate_error(outError, error);
 		}
 
 	/* Release allocated resources */
-	if(expanded) g_string_free(expanded, TRUE);
-	if(argv) g_strfreev(argv);
+	if(envp) g_strfreev(envp);
 	if(desktopFile) g_free(desktopFile);
 	if(startupNotificationID) g_free(startupNotificationID);
 	if(display) g_free(display);
@@ -1141,7 +1376,7 @@ static gboolean _xfdashboard_desktop_app_info_launch_appinfo_internal(Xfdashboar
 	return(success);
 }
 
-#else
+#if !LIBXFCE4UTIL_CHECK_VERSION(4, 15, 2)
 
 static gboolean _xfdashboard_desktop_app_info_launch_appinfo_internal(XfdashboardDesktopAppInfo *self,
 																		const gchar *inCommand,
@@ -1150,21 +1385,11 @@ static gboolean _xfdashboard_desktop_app_info_launch_appinfo_internal(Xfdashboar
 																		GError **outError)
 {
 	XfdashboardDesktopAppInfoPrivate			*priv;
-	GString										*string;
-	gchar										*expanded;
-	gchar										*uri;
-	gchar										*filename;
-	gchar										*display;
-	gchar										*startupNotificationID;
-	gchar										*desktopFile;
-	const gchar									*workingDirectory;
-	const gchar									*name;
+	GString										*expanded;
 	gboolean									success;
-	GPid										launchedPID;
 	gint										argc;
 	gchar										**argv;
 	GError										*error;
-	XfdashboardDesktopAppInfoChildSetupData		childSetup;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_DESKTOP_APP_INFO(self), FALSE);
 	g_return_val_if_fail(inCommand && *inCommand, FALSE);
@@ -1172,24 +1397,16 @@ static gboolean _xfdashboard_desktop_app_info_launch_appinfo_internal(Xfdashboar
 	g_return_val_if_fail(outError && *outError==NULL, FALSE);
 
 	priv=self->priv;
-	display=NULL;
-	startupNotificationID=NULL;
-	desktopFile=NULL;
+	_xfdashboard_desktop_app_info_ensure_item(self);
 	success=FALSE;
 	argc=0;
 	argv=NULL;
 	error=NULL;
 
 	/* Get command-line with expanded macros */
-	name=garcon_menu_item_get_name(priv->item);
-	uri=garcon_menu_item_get_uri(priv->item);
-	expanded=xfce_expand_desktop_entry_field_codes(inCommand, (GSList*)inURIs,
-													garcon_menu_item_get_icon_name(priv->item),
-													name, uri,
-													garcon_menu_item_requires_terminal(priv->item));
-	g_free(uri);
-
-	if(!expanded)
+	expanded=g_string_new(NULL);
+	if(!expanded ||
+		!_xfdashboard_desktop_app_info_expand_macros(self, inCommand, inURIs, expanded))
 	{
 		/* Set error */
 		g_set_error_literal(outError,
@@ -1197,229 +1414,136 @@ static gboolean _xfdashboard_desktop_app_info_launch_appinfo_internal(Xfdashboar
 								G_IO_ERROR_FAILED,
 								"Unable to expand macros at command-line.");
 
+		/* Release allocated resources */
+		if(expanded) g_string_free(expanded, TRUE);
+
 		/* Return error state */
 		return(FALSE);
 	}
 
-	/* If URIs was provided but not used (exec key does not contain %f, %F, %u, %U)
-	 * append first URI to expanded inCommand-line.
+	/* If a terminal is required, prepend "exo-open" command.
+	 * NOTE: The space at end of command is important to separate
+	 *       the command we prepend from command-line of application.
 	 */
-	if(inURIs && !g_regex_match_simple("%[fu]", inCommand, G_REGEX_CASELESS, 0))
+	if(garcon_menu_item_requires_terminal(priv->item))
 	{
-		string=g_string_new(expanded);
-		g_free(expanded);
-		g_string_append_c(string, ' ');
-		filename=g_filename_from_uri(inURIs->data, NULL, NULL);
-#if LIBXFCE4UTIL_CHECK_VERSION(4,17,2)
-		xfce_g_string_append_quoted(string, filename);
-#else
-		xfce_append_quoted(string, filename);
-#endif
-		g_free(filename);
-		expanded=g_string_free(string, FALSE);
+		g_string_prepend(expanded, "exo-open --launch TerminalEmulator ");
 	}
 
 	/* Get command-line arguments as string list */
-	if(!g_shell_parse_argv(expanded, &argc, &argv, &error))
+	if(!g_shell_parse_argv(expanded->str, &argc, &argv, &error))
 	{
 		/* Propagate error */
 		g_propagate_error(outError, error);
 
 		/* Release allocated resources */
 		if(argv) g_strfreev(argv);
-		if(expanded) g_free(expanded);
+		if(expanded) g_string_free(expanded, TRUE);
 
 		/* Return error state */
 		return(FALSE);
 	}
 
-	/* Set up launch context, e.g. display and startup notification */
-	if(inContext)
-	{
-		GList									*filesToLaunch;
-		GList									*iter;
-
-		/* Create GFile objects for URIs */
-		filesToLaunch=NULL;
-		for(iter=inURIs; iter; iter=g_list_next(iter))
-		{
-			GFile						*file;
-
-			file=g_file_new_for_uri((const gchar*)iter->data);
-			filesToLaunch=g_list_prepend(filesToLaunch, file);
-		}
-		filesToLaunch=g_list_reverse(filesToLaunch);
-
-		/* Get display where to launch application at */
-		display=g_app_launch_context_get_display(inContext,
-													G_APP_INFO(self),
-													filesToLaunch);
-
-		/* Get startup notification ID if it is supported by application */
-		if(garcon_menu_item_supports_startup_notification(priv->item))
-		{
-			startupNotificationID=g_app_launch_context_get_startup_notify_id(inContext,
-																				G_APP_INFO(self),
-																				filesToLaunch);
-		}
+	/* Launch application */
+	success=_xfdashboard_desktop_app_info_launch_argv(self, argv, inURIs, inContext, outError);
 
-		/* Release allocated resources */
-		g_list_free_full(filesToLaunch, g_object_unref);
-	}
+	/* Release allocated resources */
+	if(expanded) g_string_free(expanded, TRUE);
+	if(argv) g_strfreev(argv);
 
-	/* Get working directory and test if directory exists */
-	workingDirectory=garcon_menu_item_get_path(priv->item);
-	if(!workingDirectory || !*workingDirectory)
-	{
-		/* Working directory was either NULL or is an empty string,
-		 * so do not set working directory.
-		 */
-		workingDirectory=NULL;
-	}
-		else if(!g_file_test(workingDirectory, G_FILE_TEST_IS_DIR))
-		{
-			/* Working directory does not exist or is not a directory */
-			g_warning("Working directory '%s' does not exist. It won't be used when launching '%s'.",
-						workingDirectory,
-						*argv);
+	return(success);
+}
 
-			/* Do not set working directory */
-			workingDirectory=NULL;
-		}
+#else
 
-	/* Get desktop file of application to launch */
-	desktopFile=g_file_get_path(priv->file);
+static gboolean _xfdashboard_desktop_app_info_launch_appinfo_internal(XfdashboardDesktopAppInfo *self,
+																		const gchar *inCommand,
+																		GList *inURIs,
+																		GAppLaunchContext *inContext,
+																		GError **outError)
+{
+	XfdashboardDesktopAppInfoPrivate			*priv;
+	GString										*string;
+	gchar										*expanded;
+	gchar										*uri;
+	gchar										*filename;
+	gboolean									success;
+	gint										argc;
+	gchar										**argv;
+	GError										*error;
+	const gchar									*name;
 
-	/* Launch application */
-	childSetup.display=display;
-	childSetup.startupNotificationID=startupNotificationID;
-	childSetup.desktopFile=desktopFile;
-	success=g_spawn_async(workingDirectory,
-							argv,
-							NULL,
-							G_SPAWN_SEARCH_PATH,
-							_xfdashboard_desktop_app_info_on_child_spawned,
-							&childSetup,
-							&launchedPID,
-							&error);
-	if(success)
-	{
-		GDBusConnection							*sessionBus;
+	g_return_val_if_fail(XFDASHBOARD_IS_DESKTOP_APP_INFO(self), FALSE);
+	g_return_val_if_fail(inCommand && *inCommand, FALSE);
+	g_return_val_if_fail(!inContext || G_IS_APP_LAUNCH_CONTEXT(inContext), FALSE);
+	g_return_val_if_fail(outError && *outError==NULL, FALSE);
 
-		XFDASHBOARD_DEBUG(self, APPLICATIONS,
-							"Launching %s succeeded with PID %ld.",
-							name, (long)launchedPID);
+	priv=self->priv;
+	_xfdashboard_desktop_app_info_ensure_item(self);
+	success=FALSE;
+	argc=0;
+	argv=NULL;
+	error=NULL;
 
-		/* Open connection to DBUS session bus and send notification about
-		 * successful launch of application. Then flush and close DBUS
-		 * session bus connection.
-		 */
-		sessionBus=g_bus_get_sync(G_BUS_TYPE_SESSION, NULL, NULL);
-		if(sessionBus)
-		{
-			GDBusMessage						*message;
-			GVariantBuilder						uris;
-			GVariantBuilder						extras;
-			GList								*iter;
-			const gchar							*desktopFileID;
-			const gchar							*gioDesktopFile;
-			const gchar							*programName;
-
-			/* Build list of URIs */
-			g_variant_builder_init(&uris, G_VARIANT_TYPE("as"));
-			for(iter=inURIs; iter; iter=g_list_next(iter))
-			{
-				g_variant_builder_add(&uris, "s", (const gchar*)iter->data);
-			}
+	/* Get command-line with expanded macros */
+	name=garcon_menu_item_get_name(priv->item);
+	uri=garcon_menu_item_get_uri(priv->item);
+	expanded=xfce_expand_desktop_entry_field_codes(inCommand, (GSList*)inURIs,
+													garcon_menu_item_get_icon_name(priv->item),
+													name, uri,
+													garcon_menu_item_requires_terminal(priv->item));
+	g_free(uri);
 
-			/* Build list of extra information */
-			g_variant_builder_init(&extras, G_VARIANT_TYPE("a{sv}"));
-			if(startupNotificationID &&
-				g_utf8_validate(startupNotificationID, -1, NULL))
-			{
-				g_variant_builder_add(&extras,
-										"{sv}",
-										"startup-id",
-										g_variant_new("s", startupNotificationID));
-			}
+	if(!expanded)
+	{
+		/* Set error */
+		g_set_error_literal(outError,
+								G_IO_ERROR,
+								G_IO_ERROR_FAILED,
+								"Unable to expand macros at command-line.");
 
-			gioDesktopFile=g_getenv("GIO_LAUNCHED_DESKTOP_FILE");
-			if(gioDesktopFile)
-			{
-				g_variant_builder_add(&extras,
-										"{sv}",
-										"origin-desktop-file",
-										g_variant_new_bytestring(gioDesktopFile));
-			}
+		/* Return error state */
+		return(FALSE);
+	}
 
-			programName=g_get_prgname();
-			if(programName)
-			{
-				g_variant_builder_add(&extras,
-										"{sv}",
-										"origin-prgname",
-										g_variant_new_bytestring(programName));
-			}
+	/* If URIs was provided but not used (exec key does not contain %f, %F, %u, %U)
+	 * append first URI to expanded inCommand-line.
+	 */
+	if(inURIs && !g_regex_match_simple("%[fu]", inCommand, G_REGEX_CASELESS, 0))
+	{
+		string=g_string_new(expanded);
+		g_free(expanded);
+		g_string_append_c(string, ' ');
+		filename=g_filename_from_uri(inURIs->data, NULL, NULL);
+#if LIBXFCE4UTIL_CHECK_VERSION(4,17,2)
+		xfce_g_string_append_quoted(string, filename);
+#else
+		xfce_append_quoted(string, filename);
+#endif
+		g_free(filename);
+		expanded=g_string_free(string, FALSE);
+	}
 
-			g_variant_builder_add(&extras,
-									"{sv}",
-									"origin-pid",
-									g_variant_new("x", (gint64)getpid()));
-
-			if(priv->desktopID) desktopFileID=priv->desktopID;
-				else if(priv->file) desktopFileID=desktopFile;
-				else desktopFileID="";
-
-			message=g_dbus_message_new_signal("/org/gtk/gio/DesktopAppInfo",
-												"org.gtk.gio.DesktopAppInfo",
-												"Launched");
-			g_dbus_message_set_body(message,
-										g_variant_new
-										(
-											"(@aysxasa{sv})",
-											g_variant_new_bytestring(desktopFileID),
-											display ? display : "",
-											(gint64)launchedPID,
-											&uris,
-											&extras
-										));
-			g_dbus_connection_send_message(sessionBus,
-											message,
-											0,
-											NULL,
-											NULL);
+	/* Get command-line arguments as string list */
+	if(!g_shell_parse_argv(expanded, &argc, &argv, &error))
+	{
+		/* Propagate error */
+		g_propagate_error(outError, error);
 
-			g_object_unref(message);
+		/* Release allocated resources */
+		if(argv) g_strfreev(argv);
+		if(expanded) g_free(expanded);
 
-			/* It is safe to unreference DBUS session bus object after
-			 * calling flush function even if the flush function is
-			 * a asynchronous function because it takes its own reference
-			 * on the session bus to keep it alive until flush is complete.
-			 */
-			g_dbus_connection_flush(sessionBus, NULL, NULL, NULL);
-			g_object_unref(sessionBus);
-		}
+		/* Return error state */
+		return(FALSE);
 	}
-		else
-		{
-			g_warning("Launching %s failed!", name);
-
-			/* Propagate error */
-			g_propagate_error(outError, error);
 
-			/* Tell context about failed application launch */
-			if(startupNotificationID)
-			{
-				g_app_launch_context_launch_failed(inContext, startupNotificationID);
-			}
-		}
+	/* Launch application */
+	success=_xfdashboard_desktop_app_info_launch_argv(self, argv, inURIs, inContext, outError);
 
 	/* Release allocated resources */
 	if(expanded) g_free(expanded);
 	if(argv) g_strfreev(argv);
-	if(desktopFile) g_free(desktopFile);
-	if(startupNotificationID) g_free(startupNotificationID);
-	if(display) g_free(display);
 
 	return(success);
 }
@@ -1458,6 +1582,8 @@ static gboolean _xfdashboard_desktop_app_info_gappinfo_equal(GAppInfo *inLeft, G
 	/* Get object instance for this class of both GAppInfos */
 	left=XFDASHBOARD_DESKTOP_APP_INFO(inLeft);
 	right=XFDASHBOARD_DESKTOP_APP_INFO(inRight);
+	_xfdashboard_desktop_app_info_ensure_item(left);
+	_xfdashboard_desktop_app_info_ensure_item(right);
 
 	/* If one of both instance do not have a menu item return FALSE */
 	if(!left->priv->item || !right->priv->item) return(FALSE);
@@ -1493,6 +1619,11 @@ static const gchar* _xfdashboard_desktop_app_info_gappinfo_get_name(GAppInfo *in
 	self=XFDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
 	priv=self->priv;
 
+	/* Return cached name if available to avoid loading desktop file */
+	if(priv->hasCachedData) return(priv->cachedName);
+
+	_xfdashboard_desktop_app_info_ensure_item(self);
+
 	/* If desktop app info has no item return NULL here */
 	if(!priv->item) return(NULL);
 
@@ -1511,6 +1642,11 @@ static const gchar* _xfdashboard_desktop_app_info_gappinfo_get_description(GAppI
 	self=XFDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
 	priv=self->priv;
 
+	/* Return cached comment if available to avoid loading desktop file */
+	if(priv->hasCachedData) return(priv->cachedComment);
+
+	_xfdashboard_desktop_app_info_ensure_item(self);
+
 	/* If desktop app info has no item return NULL here */
 	if(!priv->item) return(NULL);
 
@@ -1529,6 +1665,9 @@ static const gchar* _xfdashboard_desktop_app_info_gappinfo_get_executable(GAppIn
 	self=XFDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
 	priv=self->priv;
 
+	/* Path to executable file was determined from cached command already */
+	if(!priv->hasCachedData) _xfdashboard_desktop_app_info_ensure_item(self);
+
 	/* Return comment of menu item as description */
 	return(priv->binaryExecutable);
 }
@@ -1547,22 +1686,27 @@ static GIcon* _xfdashboard_desktop_app_info_gappinfo_get_icon(GAppInfo *inAppInf
 	priv=self->priv;
 	icon=NULL;
 
+	/* Get icon name from cached data if available or from menu item */
+	iconFilename=NULL;
+	if(priv->hasCachedData) iconFilename=priv->cachedIconName;
+		else
+		{
+			_xfdashboard_desktop_app_info_ensure_item(self);
+			if(priv->item) iconFilename=garcon_menu_item_get_icon_name(priv->item);
+		}
+
 	/* Create icon from path of menu item */
-	if(priv->item)
+	if(iconFilename)
 	{
-		iconFilename=garcon_menu_item_get_icon_name(priv->item);
-		if(iconFilename)
-		{
-			if(!g_path_is_absolute(iconFilename)) icon=g_themed_icon_new(iconFilename);
-				else
-				{
-					GFile						*file;
+		if(!g_path_is_absolute(iconFilename)) icon=g_themed_icon_new(iconFilename);
+			else
+			{
+				GFile						*file;
 
-					file=g_file_new_for_path(iconFilename);
-					icon=g_file_icon_new(file);
-					g_object_unref(file);
-				}
-		}
+				file=g_file_new_for_path(iconFilename);
+				icon=g_file_icon_new(file);
+				g_object_unref(file);
+			}
 	}
 
 	/* Return icon created */
@@ -1583,17 +1727,22 @@ static gboolean _xfdashboard_desktop_app_info_gappinfo_supports_uris(GAppInfo *i
 	priv=self->priv;
 	result=FALSE;
 
+	/* Get command from cached data if available or from menu item */
+	command=NULL;
+	if(priv->hasCachedData) command=priv->cachedCommand;
+		else
+		{
+			_xfdashboard_desktop_app_info_ensure_item(self);
+			if(priv->item) command=garcon_menu_item_get_command(priv->item);
+		}
+
 	/* Check if command at menu item contains "%u" or "%U"
 	 * indicating URIs as command-line parameters.
 	 */
-	if(priv->item)
+	if(command)
 	{
-		command=garcon_menu_item_get_command(priv->item);
-		if(command)
-		{
-			if(!result && strstr(command, "%u")) result=TRUE;
-			if(!result && strstr(command, "%U")) result=TRUE;
-		}
+		if(!result && strstr(command, "%u")) result=TRUE;
+		if(!result && strstr(command, "%U")) result=TRUE;
 	}
 
 	/* Return result of check */
@@ -1614,17 +1763,22 @@ static gboolean _xfdashboard_desktop_app_info_gappinfo_supports_files(GAppInfo *
 	priv=self->priv;
 	result=FALSE;
 
+	/* Get command from cached data if available or from menu item */
+	command=NULL;
+	if(priv->hasCachedData) command=priv->cachedCommand;
+		else
+		{
+			_xfdashboard_desktop_app_info_ensure_item(self);
+			if(priv->item) command=garcon_menu_item_get_command(priv->item);
+		}
+
 	/* Check if command at menu item contains "%f" or "%F"
 	 * indicating file paths as command-line parameters.
 	 */
-	if(priv->item)
+	if(command)
 	{
-		command=garcon_menu_item_get_command(priv->item);
-		if(command)
-		{
-			if(!result && strstr(command, "%f")) result=TRUE;
-			if(!result && strstr(command, "%F")) result=TRUE;
-		}
+		if(!result && strstr(command, "%f")) result=TRUE;
+		if(!result && strstr(command, "%F")) result=TRUE;
 	}
 
 	/* Return result of check */
@@ -1650,6 +1804,7 @@ static gboolean _xfdashboard_desktop_app_info_gappinfo_launch(GAppInfo *inAppInf
 
 	self=XFDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
 	priv=self->priv;
+	_xfdashboard_desktop_app_info_ensure_item(self);
 	uris=NULL;
 
 	/* Create list of URIs for files */
@@ -1689,6 +1844,7 @@ static gboolean _xfdashboard_desktop_app_info_gappinfo_launch_uris(GAppInfo *inA
 
 	self=XFDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
 	priv=self->priv;
+	_xfdashboard_desktop_app_info_ensure_item(self);
 
 	/* Call function to launch application of XfdashboardDesktopAppInfo with URIs */
 	result=_xfdashboard_desktop_app_info_launch_appinfo_internal(self,
@@ -1711,6 +1867,37 @@ static gboolean _xfdashboard_desktop_app_info_gappinfo_should_show(GAppInfo *inA
 	self=XFDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
 	priv=self->priv;
 
+	/* Check cached visibility if available to avoid loading desktop file.
+	 * The program at "TryExec" may be installed or removed at any time
+	 * so check it each time like garcon does.
+	 */
+	if(priv->hasCachedData)
+	{
+		gchar							**argv;
+		gchar							*program;
+		gboolean						result;
+
+		if(!priv->cachedVisible) return(FALSE);
+		if(!priv->cachedTryExec ||
+			!g_shell_parse_argv(priv->cachedTryExec, NULL, &argv, NULL))
+		{
+			return(TRUE);
+		}
+
+		result=g_file_test(argv[0], G_FILE_TEST_EXISTS);
+		if(!result)
+		{
+			program=g_find_program_in_path(argv[0]);
+			result=(program!=NULL);
+			if(program) g_free(program);
+		}
+		g_strfreev(argv);
+
+		return(result);
+	}
+
+	_xfdashboard_desktop_app_info_ensure_item(self);
+
 	/* If desktop app info has no item return FALSE here */
 	if(!priv->item) return(FALSE);
 
@@ -1729,6 +1916,11 @@ static const gchar* _xfdashboard_desktop_app_info_gappinfo_get_commandline(GAppI
 	self=XFDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
 	priv=self->priv;
 
+	/* Return cached command if available to avoid loading desktop file */
+	if(priv->hasCachedData) return(priv->cachedCommand);
+
+	_xfdashboard_desktop_app_info_ensure_item(self);
+
 	/* If desktop app info has no item return NULL here */
 	if(!priv->item) return(NULL);
 
@@ -1747,6 +1939,11 @@ static const gchar* _xfdashboard_desktop_app_info_gappinfo_get_display_name(GApp
 	self=XFDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
 	priv=self->priv;
 
+	/* Return cached name if available to avoid loading desktop file */
+	if(priv->hasCachedData) return(priv->cachedName);
+
+	_xfdashboard_desktop_app_info_ensure_item(self);
+
 	/* If desktop app info has no item return NULL here */
 	if(!priv->item) return(NULL);
 
@@ -1798,12 +1995,20 @@ static void _xfdashboard_desktop_app_info_dispose(GObject *inObject)
 	}
 	priv->needActions=TRUE;
 
+	_xfdashboard_desktop_app_info_clear_cached_data(self);
+
 	if(priv->binaryExecutable)
 	{
 		g_free(priv->binaryExecutable);
 		priv->binaryExecutable=NULL;
 	}
 
+	if(priv->launchEnvironment)
+	{
+		g_strfreev(priv->launchEnvironment);
+		priv->launchEnvironment=NULL;
+	}
+
 	if(priv->item)
 	{
 		if(priv->itemChangedID)
@@ -1938,6 +2143,18 @@ static void xfdashboard_desktop_app_info_class_init(XfdashboardDesktopAppInfoCla
 						g_cclosure_marshal_VOID__VOID,
 						G_TYPE_NONE,
 						0);
+
+	XfdashboardDesktopAppInfoSignals[SIGNAL_LAUNCH_FAILED]=
+		g_signal_new("launch-failed",
+						G_TYPE_FROM_CLASS(klass),
+						G_SIGNAL_RUN_LAST,
+						G_STRUCT_OFFSET(XfdashboardDesktopAppInfoClass, launch_failed),
+						NULL,
+						NULL,
+						g_cclosure_marshal_VOID__BOXED,
+						G_TYPE_NONE,
+						1,
+						G_TYPE_ERROR);
 }
 
 /* Object initialization
@@ -1956,11 +2173,27 @@ static void xfdashboard_desktop_app_info_init(XfdashboardDesktopAppInfo *self)
 	priv->file=NULL;
 	priv->item=NULL;
 	priv->itemChangedID=0;
+	priv->itemDeferred=FALSE;
 	priv->binaryExecutable=NULL;
 	priv->actions=NULL;
 	priv->needActions=TRUE;
 	priv->keywords=NULL;
 	priv->needKeywords=TRUE;
+	priv->hasCachedData=FALSE;
+	priv->cachedName=NULL;
+	priv->cachedComment=NULL;
+	priv->cachedIconName=NULL;
+	priv->cachedCommand=NULL;
+	priv->cachedStartupWMClass=NULL;
+	priv->cachedTryExec=NULL;
+	priv->cachedVisible=FALSE;
+	priv->cachedCategories=NULL;
+	priv->launchEnvironment=NULL;
+
+	/* Connect to session bus early to notify about launched applications
+	 * without delay.
+	 */
+	_xfdashboard_desktop_app_info_warmup_session_bus();
 }
 
 /* IMPLEMENTATION: Public API */
@@ -2054,6 +2287,305 @@ GAppInfo* xfdashboard_desktop_app_info_new_from_file(GFile *inFile)
 									NULL)));
 }
 
+/** xfdashboard_desktop_app_info_new_deferred:
+ * @inDesktopID: The desktop ID
+ * @inFile: The file of type #GFile for desktop file
+ * @inIsValid: Whether the desktop file is known to be valid
+ *
+ * Creates a #XfdashboardDesktopAppInfo object for the desktop ID at @inDesktopID
+ * and file at @inFile but defers loading the desktop file until any information
+ * of the desktop file is requested. Until then the desktop app info is assumed
+ * to be valid as given at @inIsValid, e.g. as remembered from a previous load
+ * of the unchanged desktop file.
+ *
+ * Return value: A new #XfdashboardDesktopAppInfo
+ */
+GAppInfo* xfdashboard_desktop_app_info_new_deferred(const gchar *inDesktopID, GFile *inFile, gboolean inIsValid)
+{
+	XfdashboardDesktopAppInfo	*instance;
+
+	g_return_val_if_fail(inDesktopID && *inDesktopID, NULL);
+	g_return_val_if_fail(G_IS_FILE(inFile), NULL);
+
+	/* Create this class instance but do not set file by g_object_set to
+	 * prevent the property setter function _xfdashboard_desktop_app_info_set_file
+	 * to be called which would load the desktop file immediately.
+	 */
+	instance=XFDASHBOARD_DESKTOP_APP_INFO(g_object_new(XFDASHBOARD_TYPE_DESKTOP_APP_INFO,
+														"desktop-id", inDesktopID,
+														NULL));
+
+	instance->priv->file=G_FILE(g_object_ref(inFile));
+	instance->priv->itemDeferred=TRUE;
+	instance->priv->isValid=inIsValid;
+
+	/* Desktop app info is inited now */
+	instance->priv->inited=TRUE;
+
+	/* Return created instance */
+	return(G_APP_INFO(instance));
+}
+
+/** xfdashboard_desktop_app_info_new_from_data:
+ * @inDesktopID: The desktop ID
+ * @inFile: The file of type #GFile for desktop file
+ * @inData: The data of desktop file as returned by xfdashboard_desktop_app_info_data_new()
+ *
+ * Creates a #XfdashboardDesktopAppInfo object for the desktop ID at @inDesktopID
+ * and file at @inFile using the data at @inData which was collected from this
+ * file before, e.g. at another thread or at a previous session. The name,
+ * description, icon, command, keywords, application actions, categories and
+ * the StartupWMClass key are taken from @inData. The desktop file is loaded
+ * first when any other information is requested or the application is launched.
+ *
+ * Return value: A new #XfdashboardDesktopAppInfo
+ */
+GAppInfo* xfdashboard_desktop_app_info_new_from_data(const gchar *inDesktopID,
+														GFile *inFile,
+														GVariant *inData)
+{
+	XfdashboardDesktopAppInfo			*instance;
+	XfdashboardDesktopAppInfoPrivate	*priv;
+	gchar								**keywords;
+	gchar								**iter;
+	GVariantIter						*actionsIter;
+	const gchar							*actionName;
+	const gchar							*actionIcon;
+	const gchar							*actionExec;
+	XfdashboardDesktopAppInfoAction		*action;
+
+	g_return_val_if_fail(inDesktopID && *inDesktopID, NULL);
+	g_return_val_if_fail(G_IS_FILE(inFile), NULL);
+	g_return_val_if_fail(inData && g_variant_is_of_type(inData, G_VARIANT_TYPE(XFDASHBOARD_DESKTOP_APP_INFO_DATA_TYPE)), NULL);
+
+	/* Create this class instance but do not set file by g_object_set to
+	 * prevent the property setter function _xfdashboard_desktop_app_info_set_file
+	 * to be called which would load the desktop file immediately.
+	 */
+	instance=XFDASHBOARD_DESKTOP_APP_INFO(g_object_new(XFDASHBOARD_TYPE_DESKTOP_APP_INFO,
+														"desktop-id", inDesktopID,
+														NULL));
+	priv=instance->priv;
+
+	priv->file=G_FILE(g_object_ref(inFile));
+	priv->itemDeferred=TRUE;
+	priv->isValid=TRUE;
+
+	/* Take data of desktop file. Empty strings denote missing entries. */
+	g_variant_get(inData,
+					"(ssssssb^as^asa(sss))",
+					&priv->cachedName,
+					&priv->cachedComment,
+					&priv->cachedIconName,
+					&priv->cachedCommand,
+					&priv->cachedStartupWMClass,
+					&priv->cachedTryExec,
+					&priv->cachedVisible,
+					&keywords,
+					&priv->cachedCategories,
+					&actionsIter);
+	priv->hasCachedData=TRUE;
+
+	if(!*priv->cachedComment)
+	{
+		g_free(priv->cachedComment);
+		priv->cachedComment=NULL;
+	}
+
+	if(!*priv->cachedIconName)
+	{
+		g_free(priv->cachedIconName);
+		priv->cachedIconName=NULL;
+	}
+
+	if(!*priv->cachedStartupWMClass)
+	{
+		g_free(priv->cachedStartupWMClass);
+		priv->cachedStartupWMClass=NULL;
+	}
+
+	if(!*priv->cachedTryExec)
+	{
+		g_free(priv->cachedTryExec);
+		priv->cachedTryExec=NULL;
+	}
+
+	/* Get path to executable file for this application */
+	priv->binaryExecutable=_xfdashboard_desktop_app_info_get_binary_executable(priv->cachedCommand);
+
+	/* Take over keywords */
+	for(iter=keywords; *iter; iter++)
+	{
+		priv->keywords=g_list_prepend(priv->keywords, *iter);
+	}
+	priv->keywords=g_list_reverse(priv->keywords);
+	priv->needKeywords=FALSE;
+	g_free(keywords);
+
+	/* Create application actions */
+	while(g_variant_iter_next(actionsIter, "(&s&s&s)", &actionName, &actionIcon, &actionExec))
+	{
+		action=XFDASHBOARD_DESKTOP_APP_INFO_ACTION
+				(
+					g_object_new(XFDASHBOARD_TYPE_DESKTOP_APP_INFO_ACTION,
+									"name", actionName,
+									"icon-name", *actionIcon ? actionIcon : NULL,
+									"command", *actionExec ? actionExec : NULL,
+									NULL)
+				);
+		priv->actions=g_list_prepend(priv->actions, action);
+	}
+	priv->actions=g_list_reverse(priv->actions);
+	priv->needActions=FALSE;
+	g_variant_iter_free(actionsIter);
+
+	/* Desktop app info is inited now */
+	priv->inited=TRUE;
+
+	/* Return created instance */
+	return(G_APP_INFO(instance));
+}
+
+/** xfdashboard_desktop_app_info_data_new:
+ * @inMenuItem: The menu item of type #GarconMenuItem
+ *
+ * Collects the data of the desktop file of menu item at @inMenuItem which is
+ * needed to create a #XfdashboardDesktopAppInfo by calling
+ * xfdashboard_desktop_app_info_new_from_data() without loading the desktop
+ * file again, e.g. to store it in a cache. This function only accesses
+ * @inMenuItem and its desktop file, so it can be called at any thread.
+ *
+ * Return value: (transfer full): A new #GVariant of type
+ *   %XFDASHBOARD_DESKTOP_APP_INFO_DATA_TYPE. Use g_variant_unref() when done.
+ */
+GVariant* xfdashboard_desktop_app_info_data_new(GarconMenuItem *inMenuItem)
+{
+	GFile								*file;
+	gchar								*path;
+	GKeyFile							*keyfile;
+	GVariantBuilder						keywordsBuilder;
+	GVariantBuilder						categoriesBuilder;
+	GVariantBuilder						actionsBuilder;
+	GList								*categories;
+	GList								*listIter;
+	gchar								**values;
+	gchar								**iter;
+	gchar								*startupWMClass;
+	const gchar							*value;
+	gboolean							visible;
+	GVariant							*data;
+
+	g_return_val_if_fail(GARCON_IS_MENU_ITEM(inMenuItem), NULL);
+
+	/* Load desktop file as key file to get entries not provided by garcon */
+	file=garcon_menu_item_get_file(inMenuItem);
+	path=(file ? g_file_get_path(file) : NULL);
+
+	keyfile=g_key_file_new();
+	if(!path ||
+		!g_key_file_load_from_file(keyfile, path, G_KEY_FILE_KEEP_TRANSLATIONS, NULL))
+	{
+		g_key_file_unref(keyfile);
+		keyfile=NULL;
+	}
+
+	/* Get keywords */
+	g_variant_builder_init(&keywordsBuilder, G_VARIANT_TYPE_STRING_ARRAY);
+#if GARCON_CHECK_VERSION(0, 6, 3)
+	for(listIter=(GList*)garcon_menu_item_get_keywords(inMenuItem); listIter; listIter=g_list_next(listIter))
+	{
+		g_variant_builder_add(&keywordsBuilder, "s", (const gchar*)listIter->data);
+	}
+#else
+	if(keyfile)
+	{
+		values=g_key_file_get_string_list(keyfile, G_KEY_FILE_DESKTOP_GROUP, "Keywords", NULL, NULL);
+		for(iter=values; iter && *iter; iter++)
+		{
+			g_variant_builder_add(&keywordsBuilder, "s", *iter);
+		}
+		if(values) g_strfreev(values);
+	}
+#endif
+
+	/* Get categories */
+	g_variant_builder_init(&categoriesBuilder, G_VARIANT_TYPE_STRING_ARRAY);
+	categories=garcon_menu_item_get_categories(inMenuItem);
+	for(listIter=categories; listIter; listIter=g_list_next(listIter))
+	{
+		g_variant_builder_add(&categoriesBuilder, "s", (const gchar*)listIter->data);
+	}
+
+	/* Get application actions in the order as listed in "Actions" key. The
+	 * "Name" key is required for an action, so skip actions without it.
+	 */
+	g_variant_builder_init(&actionsBuilder, G_VARIANT_TYPE("a(sss)"));
+	startupWMClass=NULL;
+	if(keyfile)
+	{
+		values=g_key_file_get_string_list(keyfile, G_KEY_FILE_DESKTOP_GROUP, G_KEY_FILE_DESKTOP_KEY_ACTIONS, NULL, NULL);
+		for(iter=values; iter && *iter; iter++)
+		{
+			gchar						*actionGroup;
+			gchar						*actionName;
+			gchar						*actionIcon;
+			gchar						*actionExec;
+
+			actionGroup=g_strdup_printf("Desktop Action %s", *iter);
+			actionName=g_key_file_get_locale_string(keyfile, actionGroup, G_KEY_FILE_DESKTOP_KEY_NAME, NULL, NULL);
+			if(actionName)
+			{
+				actionIcon=g_key_file_get_string(keyfile, actionGroup, G_KEY_FILE_DESKTOP_KEY_ICON, NULL);
+				actionExec=g_key_file_get_string(keyfile, actionGroup, G_KEY_FILE_DESKTOP_KEY_EXEC, NULL);
+
+				g_variant_builder_add(&actionsBuilder,
+										"(sss)",
+										actionName,
+										actionIcon ? actionIcon : "",
+										actionExec ? actionExec : "");
+
+				if(actionExec) g_free(actionExec);
+				if(actionIcon) g_free(actionIcon);
+				g_free(actionName);
+			}
+			g_free(actionGroup);
+		}
+		if(values) g_strfreev(values);
+
+		/* Get key used to match windows to this application */
+		startupWMClass=g_key_file_get_string(keyfile, G_KEY_FILE_DESKTOP_GROUP, G_KEY_FILE_DESKTOP_KEY_STARTUP_WM_CLASS, NULL);
+	}
+
+	/* Get visibility of menu item as garcon determines it but without checking
+	 * the program at "TryExec" which could be installed or removed any time.
+	 */
+	visible=(!garcon_menu_item_get_hidden(inMenuItem) &&
+				!garcon_menu_item_get_no_display(inMenuItem) &&
+				garcon_menu_item_get_show_in_environment(inMenuItem));
+
+	/* Create data */
+	value=garcon_menu_item_get_try_exec(inMenuItem);
+	data=g_variant_new(XFDASHBOARD_DESKTOP_APP_INFO_DATA_TYPE,
+						garcon_menu_item_get_name(inMenuItem) ? garcon_menu_item_get_name(inMenuItem) : "",
+						garcon_menu_item_get_comment(inMenuItem) ? garcon_menu_item_get_comment(inMenuItem) : "",
+						garcon_menu_item_get_icon_name(inMenuItem) ? garcon_menu_item_get_icon_name(inMenuItem) : "",
+						garcon_menu_item_get_command(inMenuItem) ? garcon_menu_item_get_command(inMenuItem) : "",
+						startupWMClass ? startupWMClass : "",
+						value ? value : "",
+						visible,
+						&keywordsBuilder,
+						&categoriesBuilder,
+						&actionsBuilder);
+
+	/* Release allocated resources */
+	if(startupWMClass) g_free(startupWMClass);
+	if(keyfile) g_key_file_unref(keyfile);
+	if(path) g_free(path);
+	if(file) g_object_unref(file);
+
+	return(g_variant_ref_sink(data));
+}
+
 /** xfdashboard_desktop_app_info_new_from_menu_item:
  * @inFile: The menu item of type #GarconMenuItem for desktop file
  *
@@ -2142,6 +2674,7 @@ gboolean xfdashboard_desktop_app_info_reload(XfdashboardDesktopAppInfo *self)
 	g_return_val_if_fail(XFDASHBOARD_IS_DESKTOP_APP_INFO(self), FALSE);
 
 	priv=self->priv;
+	_xfdashboard_desktop_app_info_ensure_item(self);
 	success=FALSE;
 
 	/* Release secondary source if available to enforce reload when updating
@@ -2153,6 +2686,9 @@ gboolean xfdashboard_desktop_app_info_reload(XfdashboardDesktopAppInfo *self)
 		priv->secondarySource=NULL;
 	}
 
+	/* Release cached data as it may be outdated now */
+	_xfdashboard_desktop_app_info_clear_cached_data(self);
+
 	/* Reload menu item */
 	if(priv->item)
 	{
@@ -2372,6 +2908,8 @@ const GList* xfdashboard_desktop_app_info_get_keywords(XfdashboardDesktopAppInfo
  * desktop app file although it is the same file as used by #GarconMenuItem but
  * this time as #GKeyFile object to get access to entries not provided by garcon
  * or implemented in an inaccessible way for xfdashboard.
+ * The key %G_KEY_FILE_DESKTOP_KEY_STARTUP_WM_CLASS is taken from the data cached by #XfdashboardApplicationDatabase
+ * if available without loading the secondary source.
 
  * Return value: %TRUE if key exists or %FALSE if it does not exists.
  */
@@ -2387,6 +2925,13 @@ gboolean xfdashboard_desktop_app_info_has_key(XfdashboardDesktopAppInfo *self, c
 	priv=self->priv;
 	error=NULL;
 
+	/* Look up keys cached at application database without loading secondary source */
+	if(priv->hasCachedData &&
+		g_strcmp0(inKey, G_KEY_FILE_DESKTOP_KEY_STARTUP_WM_CLASS)==0)
+	{
+		return(priv->cachedStartupWMClass!=NULL);
+	}
+
 	/* Garcon does not provide an accessor function to get other entries from
 	 * desktop app info. So load them ourselve from secondary source.
 	 */
@@ -2425,6 +2970,8 @@ gboolean xfdashboard_desktop_app_info_has_key(XfdashboardDesktopAppInfo *self, c
  * desktop app file although it is the same file as used by #GarconMenuItem but
  * this time as #GKeyFile object to get access to entries not provided by garcon
  * or implemented in an inaccessible way for xfdashboard.
+ * The key %G_KEY_FILE_DESKTOP_KEY_STARTUP_WM_CLASS is taken from the data cached by #XfdashboardApplicationDatabase
+ * if available without loading the secondary source.
 
  * Return value: The value as string or %NULL if key does not exists. The
  *   returned value must be freed with g_free().
@@ -2441,6 +2988,13 @@ gchar* xfdashboard_desktop_app_info_get_string(XfdashboardDesktopAppInfo *self,
 	priv=self->priv;
 	error=NULL;
 
+	/* Get keys cached at application database without loading secondary source */
+	if(priv->hasCachedData &&
+		g_strcmp0(inKey, G_KEY_FILE_DESKTOP_KEY_STARTUP_WM_CLASS)==0)
+	{
+		return(g_strdup(priv->cachedStartupWMClass));
+	}
+
 	/* Garcon does not provide an accessor function to get other entries from
 	 * desktop app info. So load them ourselve from secondary source.
 	 */
@@ -2545,6 +3099,8 @@ gchar* xfdashboard_desktop_app_info_get_locale_string(XfdashboardDesktopAppInfo
  * desktop app file although it is the same file as used by #GarconMenuItem but
  * this time as #GKeyFile object to get access to entries not provided by garcon
  * or implemented in an inaccessible way for xfdashboard.
+ * The key %G_KEY_FILE_DESKTOP_KEY_CATEGORIES is taken from the data cached by #XfdashboardApplicationDatabase
+ * if available without loading the secondary source.
 
  * Return value: (array zero-terminated=1 length=length) (element-type utf8) (transfer full):
  *   A %NULL-terminated string array or %NULL if key does not exists. The
@@ -2562,6 +3118,13 @@ gchar** xfdashboard_desktop_app_info_get_string_list(XfdashboardDesktopAppInfo *
 	priv=self->priv;
 	error=NULL;
 
+	/* Get keys cached at application database without loading secondary source */
+	if(priv->hasCachedData &&
+		g_strcmp0(inKey, G_KEY_FILE_DESKTOP_KEY_CATEGORIES)==0)
+	{
+		return(g_strdupv(priv->cachedCategories));
+	}
+
 	/* Garcon does not provide an accessor function to get other entries from
 	 * desktop app info. So load them ourselve from secondary source.
 	 */
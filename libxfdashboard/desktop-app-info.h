@@ -41,6 +41,9 @@ G_BEGIN_DECLS
 #define XFDASHBOARD_IS_DESKTOP_APP_INFO_CLASS(klass)	(G_TYPE_CHECK_CLASS_TYPE((klass), XFDASHBOARD_TYPE_DESKTOP_APP_INFO))
 #define XFDASHBOARD_DESKTOP_APP_INFO_GET_CLASS(obj)		(G_TYPE_INSTANCE_GET_CLASS((obj), XFDASHBOARD_TYPE_DESKTOP_APP_INFO, XfdashboardDesktopAppInfoClass))
 
+/* Type of variant holding the parsed data of a desktop file */
+#define XFDASHBOARD_DESKTOP_APP_INFO_DATA_TYPE			"(ssssssbasasa(sss))"
+
 typedef struct _XfdashboardDesktopAppInfo				XfdashboardDesktopAppInfo;
 typedef struct _XfdashboardDesktopAppInfoClass			XfdashboardDesktopAppInfoClass;
 typedef struct _XfdashboardDesktopAppInfoPrivate		XfdashboardDesktopAppInfoPrivate;
@@ -64,6 +67,7 @@ struct _XfdashboardDesktopAppInfoClass
 	/*< public >*/
 	/* Virtual functions */
 	void (*changed)(XfdashboardDesktopAppInfo *self);
+	void (*launch_failed)(XfdashboardDesktopAppInfo *self, const GError *inError);
 };
 
 /* Public API */
@@ -73,6 +77,10 @@ GAppInfo* xfdashboard_desktop_app_info_new_from_desktop_id(const gchar *inDeskto
 GAppInfo* xfdashboard_desktop_app_info_new_from_path(const gchar *inPath);
 GAppInfo* xfdashboard_desktop_app_info_new_from_file(GFile *inFile);
 GAppInfo* xfdashboard_desktop_app_info_new_from_menu_item(GarconMenuItem *inMenuItem);
+GAppInfo* xfdashboard_desktop_app_info_new_deferred(const gchar *inDesktopID, GFile *inFile, gboolean inIsValid);
+GAppInfo* xfdashboard_desktop_app_info_new_from_data(const gchar *inDesktopID, GFile *inFile, GVariant *inData);
+
+GVariant* xfdashboard_desktop_app_info_data_new(GarconMenuItem *inMenuItem);
 
 gboolean xfdashboard_desktop_app_info_is_valid(XfdashboardDesktopAppInfo *self);
 
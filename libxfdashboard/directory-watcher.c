@@ -0,0 +1,774 @@
+/*
+ * directory-watcher: Watches directories for changes at their files and
+ *                    sub-directories and reports them in batches
+ * 
+ * Copyright 2012-2021 Stephan Haller <nomad@froevel.de>
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ * 
+ * 
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <libxfdashboard/directory-watcher.h>
+
+#include <glib/gi18n-lib.h>
+#ifdef HAVE_SYS_INOTIFY_H
+#include <glib-unix.h>
+#include <sys/inotify.h>
+#include <errno.h>
+#include <limits.h>
+#include <unistd.h>
+#endif
+
+#include <libxfdashboard/statistics.h>
+#include <libxfdashboard/profiler.h>
+#include <libxfdashboard/compat.h>
+#include <libxfdashboard/debug.h>
+
+
+/* Define this class in GObject system */
+struct _XfdashboardDirectoryWatcherPrivate
+{
+	/* Instance related */
+	GHashTable			*watchesByPath;
+
+#ifdef HAVE_SYS_INOTIFY_H
+	gint				inotifyFD;
+	guint				inotifySourceID;
+	GHashTable			*watchesByDescriptor;
+#endif
+};
+
+G_DEFINE_TYPE_WITH_PRIVATE(XfdashboardDirectoryWatcher,
+							xfdashboard_directory_watcher,
+							G_TYPE_OBJECT)
+
+/* Signals */
+enum
+{
+	SIGNAL_CHANGED,
+
+	SIGNAL_LAST
+};
+
+static guint XfdashboardDirectoryWatcherSignals[SIGNAL_LAST]={ 0, };
+
+
+/* IMPLEMENTATION: Private variables and methods */
+
+/* A watch at a directory. If inotify is available all directories are
+ * watched by one inotify instance and the watch is looked up by its watch
+ * descriptor. The same directory could be reached by different paths,
+ * e.g. by symbolic links, but inotify returns the same watch descriptor
+ * for all of them, so a watch keeps all paths it was added for and reports
+ * changes for each of them. Otherwise each directory is watched by its own
+ * file monitor.
+ */
+typedef struct _XfdashboardDirectoryWatcherWatch	XfdashboardDirectoryWatcherWatch;
+struct _XfdashboardDirectoryWatcherWatch
+{
+	GPtrArray			*directories;
+
+#ifdef HAVE_SYS_INOTIFY_H
+	gint				descriptor;
+#else
+	GFileMonitor		*monitor;
+	guint				changedID;
+#endif
+};
+
+#ifdef HAVE_SYS_INOTIFY_H
+#define XFDASHBOARD_DIRECTORY_WATCHER_INOTIFY_MASK			(IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE | \
+															 IN_MOVED_FROM | IN_MOVED_TO | \
+															 IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR)
+#define XFDASHBOARD_DIRECTORY_WATCHER_INOTIFY_BUFFER_SIZE	(64*(sizeof(struct inotify_event)+NAME_MAX+1))
+#endif
+
+/* Create and free watch */
+static XfdashboardDirectoryWatcherWatch* _xfdashboard_directory_watcher_watch_new(void)
+{
+	XfdashboardDirectoryWatcherWatch		*watch;
+
+	watch=g_new0(XfdashboardDirectoryWatcherWatch, 1);
+	watch->directories=g_ptr_array_new_with_free_func(g_object_unref);
+#ifdef HAVE_SYS_INOTIFY_H
+	watch->descriptor=-1;
+#endif
+
+	return(watch);
+}
+
+static void _xfdashboard_directory_watcher_watch_free(XfdashboardDirectoryWatcherWatch *inWatch)
+{
+	g_return_if_fail(inWatch);
+
+	/* Release allocated resources */
+#ifndef HAVE_SYS_INOTIFY_H
+	if(inWatch->monitor)
+	{
+		if(inWatch->changedID) g_signal_handler_disconnect(inWatch->monitor, inWatch->changedID);
+		g_file_monitor_cancel(inWatch->monitor);
+		g_object_unref(inWatch->monitor);
+	}
+#endif
+
+	if(inWatch->directories) g_ptr_array_unref(inWatch->directories);
+	g_free(inWatch);
+}
+
+/* Free change at file or directory */
+static void _xfdashboard_directory_watcher_event_free(XfdashboardDirectoryWatcherEvent *inEvent)
+{
+	g_return_if_fail(inEvent);
+
+	if(inEvent->file) g_object_unref(inEvent->file);
+	g_free(inEvent);
+}
+
+/* Add change at file or directory to batch of changes but skip it if it
+ * repeats the last change, e.g. a file modified by many small writes.
+ */
+static void _xfdashboard_directory_watcher_add_event(GPtrArray *ioEvents,
+														GFile *inFile,
+														GFileMonitorEvent inEventType,
+														gboolean inIsDirectory)
+{
+	XfdashboardDirectoryWatcherEvent		*event;
+
+	g_return_if_fail(ioEvents);
+	g_return_if_fail(G_IS_FILE(inFile));
+
+	if(ioEvents->len>0)
+	{
+		event=(XfdashboardDirectoryWatcherEvent*)g_ptr_array_index(ioEvents, ioEvents->len-1);
+		if(event->eventType==inEventType &&
+			event->isDirectory==inIsDirectory &&
+			g_file_equal(event->file, inFile))
+		{
+			return;
+		}
+	}
+
+	event=g_new0(XfdashboardDirectoryWatcherEvent, 1);
+	event->file=g_object_ref(inFile);
+	event->eventType=inEventType;
+	event->isDirectory=inIsDirectory;
+	g_ptr_array_add(ioEvents, event);
+}
+
+/* Emit signal for batch of changes if it is not empty */
+static void _xfdashboard_directory_watcher_emit_events(XfdashboardDirectoryWatcher *self,
+														GPtrArray *inEvents)
+{
+	g_return_if_fail(XFDASHBOARD_IS_DIRECTORY_WATCHER(self));
+	g_return_if_fail(inEvents);
+
+	if(inEvents->len==0) return;
+
+	XFDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Reporting %u changes at watched directories",
+						inEvents->len);
+	xfdashboard_statistics_add("directory-watcher.events", inEvents->len);
+
+	g_signal_emit(self, XfdashboardDirectoryWatcherSignals[SIGNAL_CHANGED], 0, inEvents);
+}
+
+#ifdef HAVE_SYS_INOTIFY_H
+/* Remove watch from all lookup tables and destroy it */
+static void _xfdashboard_directory_watcher_destroy_watch(XfdashboardDirectoryWatcher *self,
+															XfdashboardDirectoryWatcherWatch *inWatch,
+															gboolean inRemoveFromInotify)
+{
+	XfdashboardDirectoryWatcherPrivate		*priv;
+	guint									i;
+
+	g_return_if_fail(XFDASHBOARD_IS_DIRECTORY_WATCHER(self));
+	g_return_if_fail(inWatch);
+
+	priv=self->priv;
+
+	/* Remove all paths of watch from lookup table */
+	for(i=0; i<inWatch->directories->len; i++)
+	{
+		gchar								*path;
+
+		path=g_file_get_path(G_FILE(g_ptr_array_index(inWatch->directories, i)));
+		if(path)
+		{
+			g_hash_table_remove(priv->watchesByPath, path);
+			g_free(path);
+		}
+	}
+
+	/* Remove watch from inotify instance if it was not removed already */
+	if(inRemoveFromInotify && priv->inotifyFD>=0)
+	{
+		inotify_rm_watch(priv->inotifyFD, inWatch->descriptor);
+	}
+
+	/* Destroy watch by removing it from lookup table owning it */
+	g_hash_table_remove(priv->watchesByDescriptor, GINT_TO_POINTER(inWatch->descriptor));
+}
+
+/* Convert inotify event to changes and add them to batch of changes */
+static void _xfdashboard_directory_watcher_process_inotify_event(XfdashboardDirectoryWatcher *self,
+																	const struct inotify_event *inEvent,
+																	GPtrArray *ioEvents)
+{
+	XfdashboardDirectoryWatcherPrivate		*priv;
+	XfdashboardDirectoryWatcherWatch		*watch;
+	GFileMonitorEvent						eventType;
+	gboolean								isDirectory;
+	guint									i;
+
+	g_return_if_fail(XFDASHBOARD_IS_DIRECTORY_WATCHER(self));
+	g_return_if_fail(inEvent);
+	g_return_if_fail(ioEvents);
+
+	priv=self->priv;
+
+	/* If the kernel's event queue overflowed changes were lost, so report
+	 * all watched directories as changed to get them rescanned.
+	 */
+	if(inEvent->mask & IN_Q_OVERFLOW)
+	{
+		GHashTableIter						iter;
+
+		g_warning("Too many changes at watched directories at once - rescanning all watched directories");
+		xfdashboard_statistics_add("directory-watcher.overflows", 1);
+
+		g_hash_table_iter_init(&iter, priv->watchesByDescriptor);
+		while(g_hash_table_iter_next(&iter, NULL, (gpointer*)&watch))
+		{
+			for(i=0; i<watch->directories->len; i++)
+			{
+				_xfdashboard_directory_watcher_add_event(ioEvents,
+															G_FILE(g_ptr_array_index(watch->directories, i)),
+															G_FILE_MONITOR_EVENT_CHANGED,
+															TRUE);
+			}
+		}
+
+		return;
+	}
+
+	/* Lookup watch for event. Events of watches removed already
+	 * can still be queued so ignore them.
+	 */
+	watch=(XfdashboardDirectoryWatcherWatch*)g_hash_table_lookup(priv->watchesByDescriptor, GINT_TO_POINTER(inEvent->wd));
+	if(!watch) return;
+
+	/* The watch was removed by the kernel, e.g. its directory was removed */
+	if(inEvent->mask & IN_IGNORED)
+	{
+		_xfdashboard_directory_watcher_destroy_watch(self, watch, FALSE);
+		return;
+	}
+
+	/* The watched directory itself was removed or moved away so report
+	 * its removal and stop watching it.
+	 */
+	if(inEvent->mask & (IN_DELETE_SELF | IN_MOVE_SELF))
+	{
+		for(i=0; i<watch->directories->len; i++)
+		{
+			_xfdashboard_directory_watcher_add_event(ioEvents,
+														G_FILE(g_ptr_array_index(watch->directories, i)),
+														G_FILE_MONITOR_EVENT_DELETED,
+														TRUE);
+		}
+
+		_xfdashboard_directory_watcher_destroy_watch(self, watch, TRUE);
+		return;
+	}
+
+	/* All other events are about an entry in watched directory */
+	if(inEvent->len==0 || !*inEvent->name) return;
+
+	if(inEvent->mask & (IN_CREATE | IN_MOVED_TO)) eventType=G_FILE_MONITOR_EVENT_CREATED;
+		else if(inEvent->mask & (IN_DELETE | IN_MOVED_FROM)) eventType=G_FILE_MONITOR_EVENT_DELETED;
+		else if(inEvent->mask & (IN_MODIFY | IN_CLOSE_WRITE)) eventType=G_FILE_MONITOR_EVENT_CHANGED;
+		else return;
+
+	isDirectory=((inEvent->mask & IN_ISDIR) ? TRUE : FALSE);
+
+	/* Report change for each path the watched directory was added for */
+	for(i=0; i<watch->directories->len; i++)
+	{
+		GFile								*file;
+
+		file=g_file_get_child(G_FILE(g_ptr_array_index(watch->directories, i)), inEvent->name);
+		_xfdashboard_directory_watcher_add_event(ioEvents, file, eventType, isDirectory);
+		g_object_unref(file);
+	}
+}
+
+/* Inotify instance has events to read */
+static gboolean _xfdashboard_directory_watcher_on_inotify_readable(gint inFD,
+																	GIOCondition inCondition,
+																	gpointer inUserData)
+{
+	XfdashboardDirectoryWatcher				*self;
+	GPtrArray								*events;
+	gchar									buffer[XFDASHBOARD_DIRECTORY_WATCHER_INOTIFY_BUFFER_SIZE] __attribute__((aligned(__alignof__(struct inotify_event))));
+	gssize									length;
+	gssize									offset;
+	gint64									profilerBegin;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_DIRECTORY_WATCHER(inUserData), G_SOURCE_REMOVE);
+
+	self=XFDASHBOARD_DIRECTORY_WATCHER(inUserData);
+	profilerBegin=xfdashboard_profiler_begin("applications");
+
+	/* Read all queued events and collect their changes to report them at once */
+	events=g_ptr_array_new_with_free_func((GDestroyNotify)_xfdashboard_directory_watcher_event_free);
+	while(TRUE)
+	{
+		length=read(inFD, buffer, sizeof(buffer));
+		if(length<0)
+		{
+			if(errno==EINTR) continue;
+
+			if(errno!=EAGAIN)
+			{
+				g_warning("Could not read changes at watched directories: %s",
+							g_strerror(errno));
+			}
+			break;
+		}
+
+		if(length==0) break;
+
+		for(offset=0; offset<length; offset+=sizeof(struct inotify_event)+((const struct inotify_event*)(buffer+offset))->len)
+		{
+			_xfdashboard_directory_watcher_process_inotify_event(self,
+																	(const struct inotify_event*)(buffer+offset),
+																	events);
+		}
+	}
+
+	/* Report changes */
+	_xfdashboard_directory_watcher_emit_events(self, events);
+
+	/* Release allocated resources */
+	g_ptr_array_unref(events);
+
+	xfdashboard_profiler_end("applications", "directory-watcher.read-events", profilerBegin);
+
+	return(G_SOURCE_CONTINUE);
+}
+
+/* Create inotify instance if it does not exist */
+static gboolean _xfdashboard_directory_watcher_ensure_inotify(XfdashboardDirectoryWatcher *self,
+																GError **outError)
+{
+	XfdashboardDirectoryWatcherPrivate		*priv;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_DIRECTORY_WATCHER(self), FALSE);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
+
+	priv=self->priv;
+
+	if(priv->inotifyFD>=0) return(TRUE);
+
+	priv->inotifyFD=inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if(priv->inotifyFD<0)
+	{
+		gint								errorCode=errno;
+
+		g_set_error(outError,
+					G_IO_ERROR,
+					g_io_error_from_errno(errorCode),
+					"Unable to create inotify instance: %s",
+					g_strerror(errorCode));
+		return(FALSE);
+	}
+
+	priv->inotifySourceID=g_unix_fd_add(priv->inotifyFD,
+											G_IO_IN,
+											_xfdashboard_directory_watcher_on_inotify_readable,
+											self);
+
+	return(TRUE);
+}
+#else
+/* A file monitor of a watched directory has changed */
+static void _xfdashboard_directory_watcher_on_monitor_changed(XfdashboardDirectoryWatcher *self,
+																GFile *inFile,
+																GFile *inOtherFile,
+																GFileMonitorEvent inEventType,
+																gpointer inUserData)
+{
+	XfdashboardDirectoryWatcherPrivate		*priv;
+	GPtrArray								*events;
+	gboolean								isDirectory;
+
+	g_return_if_fail(XFDASHBOARD_IS_DIRECTORY_WATCHER(self));
+	g_return_if_fail(G_IS_FILE(inFile));
+
+	priv=self->priv;
+
+	/* Only creation, modification and removal are reported */
+	if(inEventType!=G_FILE_MONITOR_EVENT_CREATED &&
+		inEventType!=G_FILE_MONITOR_EVENT_CHANGED &&
+		inEventType!=G_FILE_MONITOR_EVENT_DELETED)
+	{
+		return;
+	}
+
+	/* A removed file cannot be queried for its type anymore but if it was
+	 * a directory it is likely watched.
+	 */
+	if(inEventType==G_FILE_MONITOR_EVENT_DELETED)
+	{
+		gchar								*path;
+
+		path=g_file_get_path(inFile);
+		isDirectory=(path && g_hash_table_contains(priv->watchesByPath, path));
+		g_free(path);
+	}
+		else
+		{
+			isDirectory=(g_file_query_file_type(inFile, G_FILE_QUERY_INFO_NONE, NULL)==G_FILE_TYPE_DIRECTORY);
+		}
+
+	/* A directory reported as changed requests a rescan of it, so do not
+	 * report modifications of a directory itself, e.g. of its attributes.
+	 */
+	if(isDirectory && inEventType==G_FILE_MONITOR_EVENT_CHANGED) return;
+
+	/* File monitors report each change on its own */
+	events=g_ptr_array_new_with_free_func((GDestroyNotify)_xfdashboard_directory_watcher_event_free);
+	_xfdashboard_directory_watcher_add_event(events, inFile, inEventType, isDirectory);
+	_xfdashboard_directory_watcher_emit_events(self, events);
+	g_ptr_array_unref(events);
+}
+#endif
+
+
+/* IMPLEMENTATION: GObject */
+
+/* Dispose this object */
+static void _xfdashboard_directory_watcher_dispose(GObject *inObject)
+{
+	XfdashboardDirectoryWatcher				*self=XFDASHBOARD_DIRECTORY_WATCHER(inObject);
+	XfdashboardDirectoryWatcherPrivate		*priv=self->priv;
+
+	/* Release allocated resources */
+#ifdef HAVE_SYS_INOTIFY_H
+	if(priv->inotifySourceID)
+	{
+		g_source_remove(priv->inotifySourceID);
+		priv->inotifySourceID=0;
+	}
+
+	if(priv->inotifyFD>=0)
+	{
+		/* Closing inotify instance removes all its watches */
+		close(priv->inotifyFD);
+		priv->inotifyFD=-1;
+	}
+#endif
+
+	if(priv->watchesByPath)
+	{
+		g_hash_table_destroy(priv->watchesByPath);
+		priv->watchesByPath=NULL;
+	}
+
+#ifdef HAVE_SYS_INOTIFY_H
+	if(priv->watchesByDescriptor)
+	{
+		g_hash_table_destroy(priv->watchesByDescriptor);
+		priv->watchesByDescriptor=NULL;
+	}
+#endif
+
+	/* Call parent's class dispose method */
+	G_OBJECT_CLASS(xfdashboard_directory_watcher_parent_class)->dispose(inObject);
+}
+
+/* Class initialization
+ * Override functions in parent classes and define properties
+ * and signals
+ */
+static void xfdashboard_directory_watcher_class_init(XfdashboardDirectoryWatcherClass *klass)
+{
+	GObjectClass		*gobjectClass=G_OBJECT_CLASS(klass);
+
+	/* Override functions */
+	gobjectClass->dispose=_xfdashboard_directory_watcher_dispose;
+
+	/* Define signals */
+	XfdashboardDirectoryWatcherSignals[SIGNAL_CHANGED]=
+		g_signal_new("changed",
+						G_TYPE_FROM_CLASS(klass),
+						G_SIGNAL_RUN_LAST,
+						G_STRUCT_OFFSET(XfdashboardDirectoryWatcherClass, changed),
+						NULL,
+						NULL,
+						g_cclosure_marshal_VOID__POINTER,
+						G_TYPE_NONE,
+						1,
+						G_TYPE_POINTER);
+}
+
+/* Object initialization
+ * Create private structure and set up default values
+ */
+static void xfdashboard_directory_watcher_init(XfdashboardDirectoryWatcher *self)
+{
+	XfdashboardDirectoryWatcherPrivate		*priv;
+
+	priv=self->priv=xfdashboard_directory_watcher_get_instance_private(self);
+
+	/* Set up default values. If inotify is available the watches are owned
+	 * by the lookup table of watch descriptors because a watch could be
+	 * added for more than one path, otherwise by the one of paths.
+	 */
+#ifdef HAVE_SYS_INOTIFY_H
+	priv->inotifyFD=-1;
+	priv->inotifySourceID=0;
+	priv->watchesByDescriptor=g_hash_table_new_full(g_direct_hash,
+													g_direct_equal,
+													NULL,
+													(GDestroyNotify)_xfdashboard_directory_watcher_watch_free);
+	priv->watchesByPath=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+#else
+	priv->watchesByPath=g_hash_table_new_full(g_str_hash,
+												g_str_equal,
+												g_free,
+												(GDestroyNotify)_xfdashboard_directory_watcher_watch_free);
+#endif
+}
+
+
+/* IMPLEMENTATION: Public API */
+
+/* Create new instance */
+XfdashboardDirectoryWatcher* xfdashboard_directory_watcher_new(void)
+{
+	return(XFDASHBOARD_DIRECTORY_WATCHER(g_object_new(XFDASHBOARD_TYPE_DIRECTORY_WATCHER, NULL)));
+}
+
+/* Start watching a directory. Adding a directory watched already succeeds
+ * without doing anything.
+ */
+gboolean xfdashboard_directory_watcher_add(XfdashboardDirectoryWatcher *self,
+											GFile *inDirectory,
+											GError **outError)
+{
+	XfdashboardDirectoryWatcherPrivate		*priv;
+	XfdashboardDirectoryWatcherWatch		*watch;
+	gchar									*path;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_DIRECTORY_WATCHER(self), FALSE);
+	g_return_val_if_fail(G_IS_FILE(inDirectory), FALSE);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
+
+	priv=self->priv;
+
+	/* Only local directories can be watched */
+	path=g_file_get_path(inDirectory);
+	if(!path)
+	{
+		gchar								*uri;
+
+		uri=g_file_get_uri(inDirectory);
+		g_set_error(outError,
+					G_IO_ERROR,
+					G_IO_ERROR_NOT_SUPPORTED,
+					"Unable to watch non-local directory '%s'",
+					uri);
+		g_free(uri);
+
+		return(FALSE);
+	}
+
+	/* Check if directory is watched already */
+	if(g_hash_table_contains(priv->watchesByPath, path))
+	{
+		g_free(path);
+		return(TRUE);
+	}
+
+#ifdef HAVE_SYS_INOTIFY_H
+	{
+		gint								descriptor;
+
+		/* Add directory to inotify instance */
+		if(!_xfdashboard_directory_watcher_ensure_inotify(self, outError))
+		{
+			g_free(path);
+			return(FALSE);
+		}
+
+		descriptor=inotify_add_watch(priv->inotifyFD, path, XFDASHBOARD_DIRECTORY_WATCHER_INOTIFY_MASK);
+		if(descriptor<0)
+		{
+			gint							errorCode=errno;
+
+			g_set_error(outError,
+						G_IO_ERROR,
+						g_io_error_from_errno(errorCode),
+						"Unable to watch directory '%s': %s",
+						path,
+						g_strerror(errorCode));
+			g_free(path);
+
+			return(FALSE);
+		}
+
+		/* Get watch for watch descriptor or create a new one if the
+		 * directory was not reached by any other path before.
+		 */
+		watch=(XfdashboardDirectoryWatcherWatch*)g_hash_table_lookup(priv->watchesByDescriptor, GINT_TO_POINTER(descriptor));
+		if(!watch)
+		{
+			watch=_xfdashboard_directory_watcher_watch_new();
+			watch->descriptor=descriptor;
+			g_hash_table_insert(priv->watchesByDescriptor, GINT_TO_POINTER(descriptor), watch);
+		}
+	}
+#else
+	{
+		GFileMonitor						*monitor;
+		GError								*error;
+
+		/* Create file monitor for directory */
+		error=NULL;
+		monitor=g_file_monitor_directory(inDirectory, G_FILE_MONITOR_NONE, NULL, &error);
+		if(!monitor)
+		{
+			g_propagate_error(outError, error);
+			g_free(path);
+
+			return(FALSE);
+		}
+
+		watch=_xfdashboard_directory_watcher_watch_new();
+		watch->monitor=monitor;
+		watch->changedID=g_signal_connect_swapped(monitor,
+													"changed",
+													G_CALLBACK(_xfdashboard_directory_watcher_on_monitor_changed),
+													self);
+	}
+#endif
+
+	/* Remember path of watch. Lookup table takes ownership of path. */
+	g_ptr_array_add(watch->directories, g_object_ref(inDirectory));
+	g_hash_table_insert(priv->watchesByPath, path, watch);
+
+	XFDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Watching directory '%s' - now watching %u directories",
+						path,
+						g_hash_table_size(priv->watchesByPath));
+
+	return(TRUE);
+}
+
+/* Stop watching a directory. Returns FALSE if directory was not watched. */
+gboolean xfdashboard_directory_watcher_remove(XfdashboardDirectoryWatcher *self,
+												GFile *inDirectory)
+{
+	XfdashboardDirectoryWatcherPrivate		*priv;
+	XfdashboardDirectoryWatcherWatch		*watch;
+	gchar									*path;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_DIRECTORY_WATCHER(self), FALSE);
+	g_return_val_if_fail(G_IS_FILE(inDirectory), FALSE);
+
+	priv=self->priv;
+
+	/* Lookup watch for directory */
+	path=g_file_get_path(inDirectory);
+	if(!path) return(FALSE);
+
+	watch=(XfdashboardDirectoryWatcherWatch*)g_hash_table_lookup(priv->watchesByPath, path);
+	if(!watch)
+	{
+		g_free(path);
+		return(FALSE);
+	}
+
+	XFDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Stop watching directory '%s'",
+						path);
+
+#ifdef HAVE_SYS_INOTIFY_H
+	{
+		guint								i;
+
+		/* Remove path from watch and remove watch from inotify instance
+		 * if it is not watched for any other path.
+		 */
+		g_hash_table_remove(priv->watchesByPath, path);
+
+		for(i=0; i<watch->directories->len; i++)
+		{
+			if(g_file_equal(G_FILE(g_ptr_array_index(watch->directories, i)), inDirectory))
+			{
+				g_ptr_array_remove_index(watch->directories, i);
+				break;
+			}
+		}
+
+		if(watch->directories->len==0)
+		{
+			_xfdashboard_directory_watcher_destroy_watch(self, watch, TRUE);
+		}
+	}
+#else
+	/* Removing path from lookup table destroys watch */
+	g_hash_table_remove(priv->watchesByPath, path);
+#endif
+
+	/* Release allocated resources */
+	g_free(path);
+
+	return(TRUE);
+}
+
+/* Check if directory is watched */
+gboolean xfdashboard_directory_watcher_has_directory(XfdashboardDirectoryWatcher *self,
+														GFile *inDirectory)
+{
+	gchar									*path;
+	gboolean								result;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_DIRECTORY_WATCHER(self), FALSE);
+	g_return_val_if_fail(G_IS_FILE(inDirectory), FALSE);
+
+	path=g_file_get_path(inDirectory);
+	if(!path) return(FALSE);
+
+	result=g_hash_table_contains(self->priv->watchesByPath, path);
+	g_free(path);
+
+	return(result);
+}
+
+/* Get number of watched directories */
+guint xfdashboard_directory_watcher_get_count(XfdashboardDirectoryWatcher *self)
+{
+	g_return_val_if_fail(XFDASHBOARD_IS_DIRECTORY_WATCHER(self), 0);
+
+	return(g_hash_table_size(self->priv->watchesByPath));
+}
@@ -0,0 +1,98 @@
+/*
+ * directory-watcher: Watches directories for changes at their files and
+ *                    sub-directories and reports them in batches
+ * 
+ * Copyright 2012-2021 Stephan Haller <nomad@froevel.de>
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ * 
+ * 
+ */
+
+#ifndef __LIBXFDASHBOARD_DIRECTORY_WATCHER__
+#define __LIBXFDASHBOARD_DIRECTORY_WATCHER__
+
+#if !defined(__LIBXFDASHBOARD_H_INSIDE__) && !defined(LIBXFDASHBOARD_COMPILATION)
+#error "Only <libxfdashboard/libxfdashboard.h> can be included directly."
+#endif
+
+#include <gio/gio.h>
+
+G_BEGIN_DECLS
+
+#define XFDASHBOARD_TYPE_DIRECTORY_WATCHER				(xfdashboard_directory_watcher_get_type())
+#define XFDASHBOARD_DIRECTORY_WATCHER(obj)				(G_TYPE_CHECK_INSTANCE_CAST((obj), XFDASHBOARD_TYPE_DIRECTORY_WATCHER, XfdashboardDirectoryWatcher))
+#define XFDASHBOARD_IS_DIRECTORY_WATCHER(obj)			(G_TYPE_CHECK_INSTANCE_TYPE((obj), XFDASHBOARD_TYPE_DIRECTORY_WATCHER))
+#define XFDASHBOARD_DIRECTORY_WATCHER_CLASS(klass)		(G_TYPE_CHECK_CLASS_CAST((klass), XFDASHBOARD_TYPE_DIRECTORY_WATCHER, XfdashboardDirectoryWatcherClass))
+#define XFDASHBOARD_IS_DIRECTORY_WATCHER_CLASS(klass)	(G_TYPE_CHECK_CLASS_TYPE((klass), XFDASHBOARD_TYPE_DIRECTORY_WATCHER))
+#define XFDASHBOARD_DIRECTORY_WATCHER_GET_CLASS(obj)	(G_TYPE_INSTANCE_GET_CLASS((obj), XFDASHBOARD_TYPE_DIRECTORY_WATCHER, XfdashboardDirectoryWatcherClass))
+
+typedef struct _XfdashboardDirectoryWatcher				XfdashboardDirectoryWatcher;
+typedef struct _XfdashboardDirectoryWatcherClass		XfdashboardDirectoryWatcherClass;
+typedef struct _XfdashboardDirectoryWatcherPrivate		XfdashboardDirectoryWatcherPrivate;
+
+struct _XfdashboardDirectoryWatcher
+{
+	/*< private >*/
+	/* Parent instance */
+	GObject								parent_instance;
+
+	/* Private structure */
+	XfdashboardDirectoryWatcherPrivate	*priv;
+};
+
+struct _XfdashboardDirectoryWatcherClass
+{
+	/*< private >*/
+	/* Parent class */
+	GObjectClass						parent_class;
+
+	/*< public >*/
+	/* Virtual functions */
+	void (*changed)(XfdashboardDirectoryWatcher *self, const GPtrArray *inEvents);
+};
+
+/* A change at a file or directory in a watched directory. Signal "changed"
+ * is emitted with an array of these changes. A watched directory itself
+ * reported as changed (G_FILE_MONITOR_EVENT_CHANGED) means that changes in
+ * it were missed, so it has to be rescanned.
+ */
+typedef struct _XfdashboardDirectoryWatcherEvent		XfdashboardDirectoryWatcherEvent;
+struct _XfdashboardDirectoryWatcherEvent
+{
+	GFile								*file;
+	GFileMonitorEvent					eventType;
+	gboolean							isDirectory;
+};
+
+/* Public API */
+GType xfdashboard_directory_watcher_get_type(void) G_GNUC_CONST;
+
+XfdashboardDirectoryWatcher* xfdashboard_directory_watcher_new(void);
+
+gboolean xfdashboard_directory_watcher_add(XfdashboardDirectoryWatcher *self,
+											GFile *inDirectory,
+											GError **outError);
+gboolean xfdashboard_directory_watcher_remove(XfdashboardDirectoryWatcher *self,
+												GFile *inDirectory);
+gboolean xfdashboard_directory_watcher_has_directory(XfdashboardDirectoryWatcher *self,
+														GFile *inDirectory);
+
+guint xfdashboard_directory_watcher_get_count(XfdashboardDirectoryWatcher *self);
+
+G_END_DECLS
+
+#endif	/* __LIBXFDASHBOARD_DIRECTORY_WATCHER__ */
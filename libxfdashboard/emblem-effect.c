@@ -41,6 +41,8 @@
 
 
 /* Define this class in GObject system */
+typedef struct _XfdashboardEmblemEffectShared		XfdashboardEmblemEffectShared;
+
 struct _XfdashboardEmblemEffectPrivate
 {
 	/* Properties related */
@@ -52,11 +54,7 @@ struct _XfdashboardEmblemEffectPrivate
 	XfdashboardAnchorPoint		anchorPoint;
 
 	/* Instance related */
-	ClutterContent				*icon;
-	guint						loadSuccessSignalID;
-	guint						loadFailedSignalID;
-
-	CoglPipeline				*pipeline;
+	XfdashboardEmblemEffectShared	*shared;
 };
 
 G_DEFINE_TYPE_WITH_PRIVATE(XfdashboardEmblemEffect,
@@ -82,36 +80,169 @@ static GParamSpec* XfdashboardEmblemEffectProperties[PROP_LAST]={ 0, };
 
 /* IMPLEMENTATION: Private variables and methods */
 static CoglPipeline		*_xfdashboard_emblem_effect_base_pipeline=NULL;
+static GHashTable		*_xfdashboard_emblem_effect_shared=NULL;
+
+/* Image and pipeline of an emblem shared by all emblem effects using the same
+ * icon name and size. Sharing the pipeline lets Cogl batch all emblems of the
+ * same kind into one draw call instead of switching state for each actor.
+ */
+struct _XfdashboardEmblemEffectShared
+{
+	gchar						*key;
+	gint						refCount;
+
+	ClutterContent				*icon;
+	guint						loadSuccessSignalID;
+	guint						loadFailedSignalID;
+
+	CoglPipeline				*pipeline;
+	CoglTexture					*texture;
+
+	GSList						*effects;
+};
+
+/* Shared icon image was loaded */
+static void _xfdashboard_emblem_effect_shared_on_load_finished(XfdashboardImageContent *inImage, gpointer inUserData)
+{
+	XfdashboardEmblemEffectShared		*shared;
+	GSList								*iter;
+
+	g_return_if_fail(XFDASHBOARD_IS_IMAGE_CONTENT(inImage));
+	g_return_if_fail(inUserData);
+
+	shared=(XfdashboardEmblemEffectShared*)inUserData;
+
+	/* Disconnect signal handlers */
+	if(shared->loadSuccessSignalID)
+	{
+		g_signal_handler_disconnect(shared->icon, shared->loadSuccessSignalID);
+		shared->loadSuccessSignalID=0;
+	}
+
+	if(shared->loadFailedSignalID)
+	{
+		g_signal_handler_disconnect(shared->icon, shared->loadFailedSignalID);
+		shared->loadFailedSignalID=0;
+	}
 
-/* Icon image was loaded */
-static void _xfdashboard_emblem_effect_on_load_finished(XfdashboardEmblemEffect *self, gpointer inUserData)
+	/* Invalidate all effects using this emblem to get them redrawn */
+	for(iter=shared->effects; iter; iter=g_slist_next(iter))
+	{
+		clutter_effect_queue_repaint(CLUTTER_EFFECT(iter->data));
+	}
+}
+
+/* Get shared emblem image and pipeline for icon name and size */
+static XfdashboardEmblemEffectShared* _xfdashboard_emblem_effect_shared_acquire(XfdashboardEmblemEffect *self)
 {
 	XfdashboardEmblemEffectPrivate		*priv;
+	XfdashboardEmblemEffectShared		*shared;
+	XfdashboardImageContentLoadingState	loadingState;
+	gchar								*key;
 
-	g_return_if_fail(XFDASHBOARD_IS_EMBLEM_EFFECT(self));
+	g_return_val_if_fail(XFDASHBOARD_IS_EMBLEM_EFFECT(self), NULL);
 
 	priv=self->priv;
 
-	/* Disconnect signal handlers */
-	if(priv->loadSuccessSignalID)
+	/* Check if a shared emblem exists already for icon name and size */
+	key=g_strdup_printf("%s|%d", priv->iconName, priv->iconSize);
+	if(G_UNLIKELY(!_xfdashboard_emblem_effect_shared))
+	{
+		_xfdashboard_emblem_effect_shared=g_hash_table_new(g_str_hash, g_str_equal);
+	}
+
+	shared=(XfdashboardEmblemEffectShared*)g_hash_table_lookup(_xfdashboard_emblem_effect_shared, key);
+	if(shared)
 	{
-		g_signal_handler_disconnect(priv->icon, priv->loadSuccessSignalID);
-		priv->loadSuccessSignalID=0;
+		g_free(key);
+
+		shared->refCount++;
+		shared->effects=g_slist_prepend(shared->effects, self);
+
+		return(shared);
+	}
+
+	/* Create shared emblem */
+	shared=g_new0(XfdashboardEmblemEffectShared, 1);
+	shared->key=key;
+	shared->refCount=1;
+	shared->effects=g_slist_prepend(NULL, self);
+	shared->icon=xfdashboard_image_content_new_for_icon_name(priv->iconName, priv->iconSize);
+	shared->pipeline=cogl_pipeline_copy(_xfdashboard_emblem_effect_base_pipeline);
+	shared->texture=NULL;
+
+	g_hash_table_insert(_xfdashboard_emblem_effect_shared, shared->key, shared);
+
+	/* Ensure image is being loaded */
+	loadingState=xfdashboard_image_content_get_state(XFDASHBOARD_IMAGE_CONTENT(shared->icon));
+	if(loadingState==XFDASHBOARD_IMAGE_CONTENT_LOADING_STATE_NONE ||
+		loadingState==XFDASHBOARD_IMAGE_CONTENT_LOADING_STATE_LOADING)
+	{
+		/* Connect signals just because we need to wait for image being loaded */
+		shared->loadSuccessSignalID=g_signal_connect(shared->icon,
+														"loaded",
+														G_CALLBACK(_xfdashboard_emblem_effect_shared_on_load_finished),
+														shared);
+		shared->loadFailedSignalID=g_signal_connect(shared->icon,
+														"loading-failed",
+														G_CALLBACK(_xfdashboard_emblem_effect_shared_on_load_finished),
+														shared);
+
+		/* If image is not being loaded currently enforce loading now */
+		if(loadingState==XFDASHBOARD_IMAGE_CONTENT_LOADING_STATE_NONE)
+		{
+			xfdashboard_image_content_force_load(XFDASHBOARD_IMAGE_CONTENT(shared->icon));
+		}
 	}
 
-	if(priv->loadFailedSignalID)
+	XFDASHBOARD_DEBUG(self, ACTOR,
+						"Created shared emblem for key '%s'",
+						shared->key);
+
+	return(shared);
+}
+
+/* Release shared emblem image and pipeline used by emblem effect */
+static void _xfdashboard_emblem_effect_shared_release(XfdashboardEmblemEffect *self)
+{
+	XfdashboardEmblemEffectPrivate		*priv;
+	XfdashboardEmblemEffectShared		*shared;
+
+	g_return_if_fail(XFDASHBOARD_IS_EMBLEM_EFFECT(self));
+
+	priv=self->priv;
+
+	/* Do nothing if effect does not use any shared emblem */
+	if(!priv->shared) return;
+
+	shared=priv->shared;
+	priv->shared=NULL;
+
+	/* Decrease reference counter and return if it is still in use */
+	shared->effects=g_slist_remove(shared->effects, self);
+	shared->refCount--;
+	if(shared->refCount>0) return;
+
+	/* Shared emblem is not used anymore so destroy it */
+	g_hash_table_remove(_xfdashboard_emblem_effect_shared, shared->key);
+
+	if(shared->loadSuccessSignalID)
 	{
-		g_signal_handler_disconnect(priv->icon, priv->loadFailedSignalID);
-		priv->loadFailedSignalID=0;
+		g_signal_handler_disconnect(shared->icon, shared->loadSuccessSignalID);
+		shared->loadSuccessSignalID=0;
 	}
 
-	/* Set image at pipeline */
-	cogl_pipeline_set_layer_texture(priv->pipeline,
-									0,
-									clutter_image_get_texture(CLUTTER_IMAGE(priv->icon)));
+	if(shared->loadFailedSignalID)
+	{
+		g_signal_handler_disconnect(shared->icon, shared->loadFailedSignalID);
+		shared->loadFailedSignalID=0;
+	}
 
-	/* Invalidate effect to get it redrawn */
-	clutter_effect_queue_repaint(CLUTTER_EFFECT(self));
+	g_object_unref(shared->icon);
+	cogl_object_unref(shared->pipeline);
+	g_slist_free(shared->effects);
+	g_free(shared->key);
+	g_free(shared);
 }
 
 /* IMPLEMENTATION: ClutterEffect */
@@ -121,6 +252,7 @@ static void _xfdashboard_emblem_effect_paint(ClutterEffect *inEffect, ClutterEff
 {
 	XfdashboardEmblemEffect					*self;
 	XfdashboardEmblemEffectPrivate			*priv;
+	XfdashboardEmblemEffectShared			*shared;
 	ClutterActor							*target;
 	gfloat									actorWidth;
 	gfloat									actorHeight;
@@ -130,6 +262,8 @@ static void _xfdashboard_emblem_effect_paint(ClutterEffect *inEffect, ClutterEff
 	gfloat									textureWidth;
 	gfloat									textureHeight;
 	ClutterActorBox							textureCoordBox;
+	ClutterActorBox							subTextureBox;
+	CoglTexture								*texture;
 	gfloat									offset;
 	gfloat									oversize;
 	CoglFramebuffer							*framebuffer;
@@ -146,41 +280,9 @@ static void _xfdashboard_emblem_effect_paint(ClutterEffect *inEffect, ClutterEff
 	/* If no icon name is set do not apply this effect */
 	if(!priv->iconName) return;
 
-	/* Load image if not done yet */
-	if(!priv->icon)
-	{
-		/* Get image from cache */
-		priv->icon=xfdashboard_image_content_new_for_icon_name(priv->iconName, priv->iconSize);
-
-		/* Ensure image is being loaded */
-		loadingState=xfdashboard_image_content_get_state(XFDASHBOARD_IMAGE_CONTENT(priv->icon));
-		if(loadingState==XFDASHBOARD_IMAGE_CONTENT_LOADING_STATE_NONE ||
-			loadingState==XFDASHBOARD_IMAGE_CONTENT_LOADING_STATE_LOADING)
-		{
-			/* Connect signals just because we need to wait for image being loaded */
-			priv->loadSuccessSignalID=g_signal_connect_swapped(priv->icon,
-																"loaded",
-																G_CALLBACK(_xfdashboard_emblem_effect_on_load_finished),
-																self);
-			priv->loadFailedSignalID=g_signal_connect_swapped(priv->icon,
-																"loading-failed",
-																G_CALLBACK(_xfdashboard_emblem_effect_on_load_finished),
-																self);
-
-			/* If image is not being loaded currently enforce loading now */
-			if(loadingState==XFDASHBOARD_IMAGE_CONTENT_LOADING_STATE_NONE)
-			{
-				xfdashboard_image_content_force_load(XFDASHBOARD_IMAGE_CONTENT(priv->icon));
-			}
-		}
-			else
-			{
-				/* Image is already loaded so set image at pipeline */
-				cogl_pipeline_set_layer_texture(priv->pipeline,
-												0,
-												clutter_image_get_texture(CLUTTER_IMAGE(priv->icon)));
-			}
-	}
+	/* Get shared emblem image and pipeline if not done yet */
+	if(!priv->shared) priv->shared=_xfdashboard_emblem_effect_shared_acquire(self);
+	shared=priv->shared;
 
 	/* Get actor size and apply padding. If actor width or height will drop
 	 * to zero or below then the emblem could not be drawn and we return here.
@@ -204,7 +306,7 @@ static void _xfdashboard_emblem_effect_paint(ClutterEffect *inEffect, ClutterEff
 	actorHeight=actorBox.y2-actorBox.y1;
 
 	/* Get texture size */
-	clutter_content_get_preferred_size(CLUTTER_CONTENT(priv->icon), &textureWidth, &textureHeight);
+	clutter_content_get_preferred_size(shared->icon, &textureWidth, &textureHeight);
 	clutter_actor_box_init(&textureCoordBox, 0.0f, 0.0f, 1.0f, 1.0f);
 
 	/* Get boundary in X axis depending on anchorPoint and scaled width */
@@ -304,7 +406,7 @@ static void _xfdashboard_emblem_effect_paint(ClutterEffect *inEffect, ClutterEff
 	}
 
 	/* Draw icon if image was loaded */
-	loadingState=xfdashboard_image_content_get_state(XFDASHBOARD_IMAGE_CONTENT(priv->icon));
+	loadingState=xfdashboard_image_content_get_state(XFDASHBOARD_IMAGE_CONTENT(shared->icon));
 	if(loadingState!=XFDASHBOARD_IMAGE_CONTENT_LOADING_STATE_LOADED_SUCCESSFULLY &&
 		loadingState!=XFDASHBOARD_IMAGE_CONTENT_LOADING_STATE_LOADED_FAILED)
 	{
@@ -315,9 +417,29 @@ static void _xfdashboard_emblem_effect_paint(ClutterEffect *inEffect, ClutterEff
 		return;
 	}
 
+	/* Get texture of image which might be a sub-texture in a page of the texture
+	 * atlas and set it at shared pipeline if it has changed. As the pipeline is
+	 * shared this happens only once for all effects drawing this emblem.
+	 */
+	texture=xfdashboard_image_content_get_texture(XFDASHBOARD_IMAGE_CONTENT(shared->icon), &subTextureBox);
+	if(!texture) return;
+
+	if(texture!=shared->texture)
+	{
+		cogl_pipeline_set_layer_texture(shared->pipeline, 0, texture);
+		shared->texture=texture;
+	}
+
+	/* Map texture coordinates into sub-texture of image */
+	textureCoordBox.x1=subTextureBox.x1+(textureCoordBox.x1*(subTextureBox.x2-subTextureBox.x1));
+	textureCoordBox.x2=subTextureBox.x1+(textureCoordBox.x2*(subTextureBox.x2-subTextureBox.x1));
+	textureCoordBox.y1=subTextureBox.y1+(textureCoordBox.y1*(subTextureBox.y2-subTextureBox.y1));
+	textureCoordBox.y2=subTextureBox.y1+(textureCoordBox.y2*(subTextureBox.y2-subTextureBox.y1));
+
+	/* Draw emblem */
 	framebuffer=cogl_get_draw_framebuffer();
 	cogl_framebuffer_draw_textured_rectangle(framebuffer,
-												priv->pipeline,
+												shared->pipeline,
 												rectangleBox.x1, rectangleBox.y1,
 												rectangleBox.x2, rectangleBox.y2,
 												textureCoordBox.x1, textureCoordBox.y1,
@@ -333,31 +455,8 @@ static void _xfdashboard_emblem_effect_dispose(GObject *inObject)
 	XfdashboardEmblemEffect			*self=XFDASHBOARD_EMBLEM_EFFECT(inObject);
 	XfdashboardEmblemEffectPrivate	*priv=self->priv;
 
-	if(priv->pipeline)
-	{
-		cogl_object_unref(priv->pipeline);
-		priv->pipeline=NULL;
-	}
-
-	if(priv->icon)
-	{
-		/* Disconnect any connected signal handler */
-		if(priv->loadSuccessSignalID)
-		{
-			g_signal_handler_disconnect(priv->icon, priv->loadSuccessSignalID);
-			priv->loadSuccessSignalID=0;
-		}
-
-		if(priv->loadFailedSignalID)
-		{
-			g_signal_handler_disconnect(priv->icon, priv->loadFailedSignalID);
-			priv->loadFailedSignalID=0;
-		}
-
-		/* Release image itself */
-		g_object_unref(priv->icon);
-		priv->icon=NULL;
-	}
+	/* Release shared emblem image and pipeline */
+	_xfdashboard_emblem_effect_shared_release(self);
 
 	if(priv->iconName)
 	{
@@ -532,11 +631,9 @@ static void xfdashboard_emblem_effect_init(XfdashboardEmblemEffect *self)
 	priv->xAlign=0.0f;
 	priv->yAlign=0.0f;
 	priv->anchorPoint=XFDASHBOARD_ANCHOR_POINT_NONE;
-	priv->icon=NULL;
-	priv->loadSuccessSignalID=0;
-	priv->loadFailedSignalID=0;
+	priv->shared=NULL;
 
-	/* Set up pipeline */
+	/* Set up base pipeline shared emblem pipelines are copied from */
 	if(G_UNLIKELY(!_xfdashboard_emblem_effect_base_pipeline))
     {
 		CoglContext					*context;
@@ -550,8 +647,6 @@ static void xfdashboard_emblem_effect_init(XfdashboardEmblemEffect *self)
 												0, /* layer number */
 												COGL_TEXTURE_TYPE_2D);
 	}
-
-	priv->pipeline=cogl_pipeline_copy(_xfdashboard_emblem_effect_base_pipeline);
 }
 
 /* IMPLEMENTATION: Public API */
@@ -580,18 +675,14 @@ void xfdashboard_emblem_effect_set_icon_name(XfdashboardEmblemEffect *self, cons
 	priv=self->priv;
 
 	/* Set value if changed */
-	if(priv->icon || g_strcmp0(priv->iconName, inIconName)!=0)
+	if(priv->shared || g_strcmp0(priv->iconName, inIconName)!=0)
 	{
 		/* Set value */
 		if(priv->iconName) g_free(priv->iconName);
 		priv->iconName=g_strdup(inIconName);
 
-		/* Dispose any icon image loaded */
-		if(priv->icon)
-		{
-			g_object_unref(priv->icon);
-			priv->icon=NULL;
-		}
+		/* Release shared emblem of previous icon */
+		_xfdashboard_emblem_effect_shared_release(self);
 
 		/* Invalidate effect to get it redrawn */
 		clutter_effect_queue_repaint(CLUTTER_EFFECT(self));
@@ -624,12 +715,8 @@ void xfdashboard_emblem_effect_set_icon_size(XfdashboardEmblemEffect *self, cons
 		/* Set value */
 		priv->iconSize=inSize;
 
-		/* Dispose any icon image loaded */
-		if(priv->icon)
-		{
-			g_object_unref(priv->icon);
-			priv->icon=NULL;
-		}
+		/* Release shared emblem of previous icon */
+		_xfdashboard_emblem_effect_shared_release(self);
 
 		/* Invalidate effect to get it redrawn */
 		clutter_effect_queue_repaint(CLUTTER_EFFECT(self));
@@ -1150,6 +1150,133 @@ void xfdashboard_gradient_color_interpolate(const XfdashboardGradientColor *self
 	g_assert_not_reached();
 }
 
+/**
+ * xfdashboard_gradient_color_get_linear_points:
+ * @self: A #XfdashboardGradientColor
+ * @inWidth: The width of area to fill with linear gradient
+ * @inHeight: The height of area to fill with linear gradient
+ * @outStartX: (out) (allow-none): A return location for the x coordinate of start point
+ * @outStartY: (out) (allow-none): A return location for the y coordinate of start point
+ * @outEndX: (out) (allow-none): A return location for the x coordinate of end point
+ * @outEndY: (out) (allow-none): A return location for the y coordinate of end point
+ *
+ * Calculates the start and end point of the linear gradient @self when filling
+ * an area of size @inWidth x @inHeight. The first color stop is located at the
+ * start point and the last one at the end point. If the gradient repeats the
+ * end point is moved towards the start point to match the length of the
+ * gradient.
+ */
+void xfdashboard_gradient_color_get_linear_points(const XfdashboardGradientColor *self,
+													gdouble inWidth,
+													gdouble inHeight,
+													gdouble *outStartX,
+													gdouble *outStartY,
+													gdouble *outEndX,
+													gdouble *outEndY)
+{
+	gdouble							midX, midY;
+	gdouble							startX, startY;
+	gdouble							endX, endY;
+	gdouble							angle;
+	gdouble							atanRectangle;
+	gdouble							tanAngle;
+
+	g_return_if_fail(self);
+	g_return_if_fail(self->type==XFDASHBOARD_GRADIENT_TYPE_LINEAR_GRADIENT);
+
+	/* Adjust angle to find region */
+	angle=(2*M_PI)-self->gradientAngle;
+	while(angle<-M_PI) angle+=(2*M_PI);
+	while(angle>M_PI) angle-=(2*M_PI);
+
+	/* I do not know why but exactly at radians of 0.0 and M_PI the
+	 * start and end points are mirrored so this is a dirty workaround
+	 * to swap angles. Maybe it is because tan(angle) resolves to -0.0
+	 * instead of 0.0. Looks like a sign error.
+	 */
+	if(angle==0.0) angle=M_PI;
+		else if(angle==M_PI) angle=0.0;
+
+	/* Find region and calculates points */
+	atanRectangle=atan2(inHeight, inWidth);
+	tanAngle=tan(angle);
+
+	midX=(inWidth/2.0);
+	midY=(inHeight/2.0);
+
+	if(angle!=0.0 && (angle>-atanRectangle) && (angle<=atanRectangle))
+	{
+		/* Region 1 */
+		startX=midX+(inWidth/2.0);
+		startY=midY-((inWidth/2.0)*tanAngle);
+
+		endX=midX-(inWidth/2.0);
+		endY=midY+((inWidth/2.0)*tanAngle);
+	}
+		else if((angle>atanRectangle) && (angle<=(M_PI-atanRectangle)))
+		{
+			/* Region 2 */
+			startX=midX+(inHeight/(2.0*tanAngle));
+			startY=midY-(inHeight/2.0);
+
+			endX=midX-(inHeight/(2.0*tanAngle));
+			endY=midY+(inHeight/2.0);
+		}
+		else if(angle==0.0 || (angle>(M_PI-atanRectangle)) || (angle<=-(M_PI-atanRectangle)))
+		{
+			/* Region 3 */
+			startX=midX-(inWidth/2.0);
+			startY=midY+((inWidth/2.0)*tanAngle);
+
+			endX=midX+(inWidth/2.0);
+			endY=midY-((inWidth/2.0)*tanAngle);
+		}
+		else
+		{
+			/* Region 4 */
+			startX=midX-(inHeight/(2.0*tanAngle));
+			startY=midY+(inHeight/2.0);
+
+			endX=midX+(inHeight/(2.0*tanAngle));
+			endY=midY-(inHeight/2.0);
+		}
+
+	/* Reduce full length to requested length if gradient should be repeated */
+	if(self->gradientRepeat)
+	{
+		gdouble						vectorX, vectorY;
+		gdouble						distance;
+
+		/* Calculate distance between start and end point as this is the current
+		 * length of pattern.
+		 */
+		vectorX=endX-startX;
+		vectorY=endY-startY;
+		distance=sqrt((vectorX*vectorX) + (vectorY*vectorY));
+
+		/* Reduce distance by percentage or absolute length */
+		if(self->gradientLength<0.0)
+		{
+			vectorX*=-self->gradientLength;
+			vectorY*=-self->gradientLength;
+		}
+			else
+			{
+				vectorX=(vectorX/distance)*self->gradientLength;
+				vectorY=(vectorY/distance)*self->gradientLength;
+			}
+
+		endX=startX+vectorX;
+		endY=startY+vectorY;
+	}
+
+	/* Store result */
+	if(outStartX) *outStartX=startX;
+	if(outStartY) *outStartY=startY;
+	if(outEndX) *outEndX=endX;
+	if(outEndY) *outEndY=endY;
+}
+
 
 /* IMPLEMENTATION: Private variables and methods (XfdashboardParamSpecGradientColor) */
 
@@ -113,6 +113,14 @@ void xfdashboard_gradient_color_interpolate(const XfdashboardGradientColor *self
 											gdouble inProgress,
 											ClutterColor *outColor);
 
+void xfdashboard_gradient_color_get_linear_points(const XfdashboardGradientColor *self,
+													gdouble inWidth,
+													gdouble inHeight,
+													gdouble *outStartX,
+													gdouble *outStartY,
+													gdouble *outEndX,
+													gdouble *outEndY);
+
 
 /* Object declaration (XfdashboardParamSpecGradientColor) */
 
@@ -0,0 +1,391 @@
+/*
+ * gradient-pipeline: Cogl pipelines drawing rounded rectangles filled or
+ *                    outlined with gradient colors on GPU
+ * 
+ * Copyright 2012-2021 Stephan Haller <nomad@froevel.de>
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ * 
+ * 
+ */
+
+/**
+ * SECTION:gradient-pipeline
+ * @short_description: GPU rendering of rounded rectangles with gradient colors
+ * @include: xfdashboard/gradient-pipeline.h
+ *
+ * These functions create #CoglPipeline<!-- -->s which draw a rectangle with
+ * optionally rounded corners, either filled or as an outline, colored by
+ * a #XfdashboardGradientColor. Shape and gradient are evaluated per fragment
+ * by a shader so nothing has to be drawn by cairo and uploaded as texture.
+ * Changing the size only needs a new pipeline which shares its shader
+ * program with all other pipelines created by these functions.
+ *
+ * The pipeline has to be drawn as a textured rectangle covering the area
+ * of the requested size with texture coordinates from 0.0 to 1.0. The
+ * alpha value of the pipeline's color is used as paint opacity.
+ *
+ * Rendering by shaders needs GLSL support. Check with
+ * xfdashboard_gradient_pipeline_is_supported() if a gradient color can be
+ * drawn this way and fall back to drawing with cairo if not.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#define COGL_ENABLE_EXPERIMENTAL_API
+#define CLUTTER_ENABLE_EXPERIMENTAL_API
+
+#include <libxfdashboard/gradient-pipeline.h>
+
+#include <glib/gi18n-lib.h>
+#include <math.h>
+#include <string.h>
+
+#include <libxfdashboard/compat.h>
+
+
+/* IMPLEMENTATION: Private variables and methods */
+
+/* Maximum number of color stops supported. It must match the size of
+ * the uniform arrays and the loop in fragment shader.
+ */
+#define XFDASHBOARD_GRADIENT_PIPELINE_MAX_STOPS			8
+
+enum
+{
+	XFDASHBOARD_GRADIENT_PIPELINE_TYPE_SOLID=0,
+	XFDASHBOARD_GRADIENT_PIPELINE_TYPE_LINEAR=1,
+	XFDASHBOARD_GRADIENT_PIPELINE_TYPE_PATH=2
+};
+
+static const gchar		*_xfdashboard_gradient_pipeline_declarations=
+	"uniform vec2 xfdashboard_size;\n"
+	"uniform vec4 xfdashboard_radii;\n"
+	"uniform float xfdashboard_line_width;\n"
+	"uniform int xfdashboard_gradient_type;\n"
+	"uniform vec4 xfdashboard_linear_points;\n"
+	"uniform float xfdashboard_repeat;\n"
+	"uniform float xfdashboard_path_extent;\n"
+	"uniform int xfdashboard_stops;\n"
+	"uniform float xfdashboard_stop_offsets[8];\n"
+	"uniform vec4 xfdashboard_stop_colors[8];\n"
+	"\n"
+	"float xfdashboard_rounded_rectangle_distance(vec2 inPoint)\n"
+	"{\n"
+	"	vec2 halfSize=xfdashboard_size*0.5;\n"
+	"	vec2 point=inPoint-halfSize;\n"
+	"	vec2 delta;\n"
+	"	float radius;\n"
+	"\n"
+	"	if(point.x<0.0) radius=(point.y<0.0) ? xfdashboard_radii.x : xfdashboard_radii.w;\n"
+	"		else radius=(point.y<0.0) ? xfdashboard_radii.y : xfdashboard_radii.z;\n"
+	"\n"
+	"	delta=abs(point)-halfSize+vec2(radius);\n"
+	"	return(min(max(delta.x, delta.y), 0.0)+length(max(delta, 0.0))-radius);\n"
+	"}\n"
+	"\n"
+	"vec4 xfdashboard_gradient_color(float inProgress)\n"
+	"{\n"
+	"	vec4 color=xfdashboard_stop_colors[0];\n"
+	"\n"
+	"	for(int i=1; i<8; i++)\n"
+	"	{\n"
+	"		if(i<xfdashboard_stops && inProgress>xfdashboard_stop_offsets[i-1])\n"
+	"		{\n"
+	"			float range=xfdashboard_stop_offsets[i]-xfdashboard_stop_offsets[i-1];\n"
+	"			float factor=(range>0.0) ? clamp((inProgress-xfdashboard_stop_offsets[i-1])/range, 0.0, 1.0) : 1.0;\n"
+	"\n"
+	"			color=mix(xfdashboard_stop_colors[i-1], xfdashboard_stop_colors[i], factor);\n"
+	"		}\n"
+	"	}\n"
+	"\n"
+	"	return(color);\n"
+	"}\n";
+
+static const gchar		*_xfdashboard_gradient_pipeline_fragment=
+	"vec2 point=cogl_tex_coord_in[0].st*xfdashboard_size;\n"
+	"float edgeDistance=xfdashboard_rounded_rectangle_distance(point);\n"
+	"float coverage=clamp(0.5-edgeDistance, 0.0, 1.0);\n"
+	"float progress=0.0;\n"
+	"vec4 color;\n"
+	"\n"
+	"if(xfdashboard_line_width>0.0) coverage*=clamp(edgeDistance+xfdashboard_line_width+0.5, 0.0, 1.0);\n"
+	"\n"
+	"if(xfdashboard_gradient_type==1)\n"
+	"{\n"
+	"	vec2 direction=xfdashboard_linear_points.zw-xfdashboard_linear_points.xy;\n"
+	"\n"
+	"	progress=dot(point-xfdashboard_linear_points.xy, direction)/max(dot(direction, direction), 0.0001);\n"
+	"	if(xfdashboard_repeat>0.5) progress=fract(progress);\n"
+	"		else progress=clamp(progress, 0.0, 1.0);\n"
+	"}\n"
+	"	else if(xfdashboard_gradient_type==2)\n"
+	"	{\n"
+	"		progress=clamp(-edgeDistance/xfdashboard_path_extent, 0.0, 1.0);\n"
+	"	}\n"
+	"\n"
+	"color=xfdashboard_gradient_color(progress);\n"
+	"cogl_color_out=vec4(color.rgb*color.a, color.a)*(coverage*cogl_color_in.a);\n";
+
+static gint				_xfdashboard_gradient_pipeline_has_glsl=-1;
+static CoglPipeline		*_xfdashboard_gradient_pipeline_base=NULL;
+
+/* Get base pipeline with shader snippet which all pipelines are copied from
+ * so that they share the same shader program.
+ */
+static CoglPipeline* _xfdashboard_gradient_pipeline_get_base(void)
+{
+	CoglContext			*context;
+	CoglSnippet			*snippet;
+
+	/* Return base pipeline if created already */
+	if(G_LIKELY(_xfdashboard_gradient_pipeline_base)) return(_xfdashboard_gradient_pipeline_base);
+
+	/* Create base pipeline with a layer to get texture coordinates from
+	 * and the fragment shader snippet replacing the color of the layer.
+	 */
+	context=clutter_backend_get_cogl_context(clutter_get_default_backend());
+
+	_xfdashboard_gradient_pipeline_base=cogl_pipeline_new(context);
+	cogl_pipeline_set_layer_null_texture(_xfdashboard_gradient_pipeline_base,
+											0, /* layer number */
+											COGL_TEXTURE_TYPE_2D);
+
+	snippet=cogl_snippet_new(COGL_SNIPPET_HOOK_FRAGMENT,
+								_xfdashboard_gradient_pipeline_declarations,
+								_xfdashboard_gradient_pipeline_fragment);
+	cogl_pipeline_add_snippet(_xfdashboard_gradient_pipeline_base, snippet);
+	cogl_object_unref(snippet);
+
+	return(_xfdashboard_gradient_pipeline_base);
+}
+
+/* Set float uniform at pipeline */
+static void _xfdashboard_gradient_pipeline_set_uniform(CoglPipeline *inPipeline,
+														const gchar *inName,
+														gint inComponents,
+														gint inCount,
+														const gfloat *inValues)
+{
+	gint				location;
+
+	location=cogl_pipeline_get_uniform_location(inPipeline, inName);
+	cogl_pipeline_set_uniform_float(inPipeline, location, inComponents, inCount, inValues);
+}
+
+/* Store color in array of floats */
+static void _xfdashboard_gradient_pipeline_store_color(const ClutterColor *inColor, gfloat *outValues)
+{
+	outValues[0]=inColor->red/255.0f;
+	outValues[1]=inColor->green/255.0f;
+	outValues[2]=inColor->blue/255.0f;
+	outValues[3]=inColor->alpha/255.0f;
+}
+
+
+/* IMPLEMENTATION: Public API */
+
+/**
+ * xfdashboard_gradient_pipeline_is_supported:
+ * @inColor: The #XfdashboardGradientColor to draw
+ *
+ * Checks if the gradient color @inColor can be drawn by a pipeline
+ * created with xfdashboard_gradient_pipeline_new(). This is not the case
+ * if shaders are not supported or if the gradient has too many color stops.
+ *
+ * Returns: %TRUE if @inColor can be drawn by shaders, otherwise %FALSE
+ */
+gboolean xfdashboard_gradient_pipeline_is_supported(const XfdashboardGradientColor *inColor)
+{
+	XfdashboardGradientType		type;
+
+	g_return_val_if_fail(inColor, FALSE);
+
+	/* Check once if shaders are supported at all */
+	if(G_UNLIKELY(_xfdashboard_gradient_pipeline_has_glsl<0))
+	{
+		CoglContext				*context;
+
+		context=clutter_backend_get_cogl_context(clutter_get_default_backend());
+		_xfdashboard_gradient_pipeline_has_glsl=(cogl_has_feature(context, COGL_FEATURE_ID_GLSL) ? 1 : 0);
+	}
+
+	if(!_xfdashboard_gradient_pipeline_has_glsl) return(FALSE);
+
+	/* Check if type of gradient color is supported */
+	type=xfdashboard_gradient_color_get_gradient_type(inColor);
+	if(type==XFDASHBOARD_GRADIENT_TYPE_SOLID) return(TRUE);
+
+	if(type!=XFDASHBOARD_GRADIENT_TYPE_LINEAR_GRADIENT &&
+		type!=XFDASHBOARD_GRADIENT_TYPE_PATH_GRADIENT)
+	{
+		return(FALSE);
+	}
+
+	/* Check if number of color stops is supported */
+	return(xfdashboard_gradient_color_get_number_stops(inColor)<=XFDASHBOARD_GRADIENT_PIPELINE_MAX_STOPS);
+}
+
+/**
+ * xfdashboard_gradient_pipeline_new:
+ * @inColor: The #XfdashboardGradientColor to draw
+ * @inWidth: The width of rectangle to draw
+ * @inHeight: The height of rectangle to draw
+ * @inCorners: The corners of rectangle to round
+ * @inRadius: The radius of rounded corners at the outer edge
+ * @inLineWidth: The width of outline to draw or 0.0 to fill rectangle
+ *
+ * Creates a pipeline drawing a rectangle of size @inWidth x @inHeight with
+ * the corners at @inCorners rounded by @inRadius. If @inLineWidth is greater
+ * than zero only an outline of this width is drawn along the edge of the
+ * rectangle, otherwise the rectangle is filled.
+ *
+ * Linear gradients span the whole rectangle. Path gradients progress from
+ * the edge to the inner edge of the outline or, when filling, to the centre
+ * of the rectangle.
+ *
+ * The gradient color @inColor must be supported as checked by
+ * xfdashboard_gradient_pipeline_is_supported().
+ *
+ * Returns: (transfer full): The newly created #CoglPipeline or %NULL if
+ *   @inColor is not supported. Use cogl_object_unref() when done.
+ */
+CoglPipeline* xfdashboard_gradient_pipeline_new(const XfdashboardGradientColor *inColor,
+												gfloat inWidth,
+												gfloat inHeight,
+												XfdashboardCorners inCorners,
+												gfloat inRadius,
+												gfloat inLineWidth)
+{
+	CoglPipeline				*pipeline;
+	XfdashboardGradientType		type;
+	gfloat						values[4];
+	gfloat						stopOffsets[XFDASHBOARD_GRADIENT_PIPELINE_MAX_STOPS];
+	gfloat						stopColors[XFDASHBOARD_GRADIENT_PIPELINE_MAX_STOPS*4];
+	gint						stops;
+	gint						i;
+
+	g_return_val_if_fail(inColor, NULL);
+	g_return_val_if_fail(inWidth>0.0f, NULL);
+	g_return_val_if_fail(inHeight>0.0f, NULL);
+	g_return_val_if_fail(inRadius>=0.0f, NULL);
+	g_return_val_if_fail(inLineWidth>=0.0f, NULL);
+
+	/* Check if gradient color is supported */
+	if(!xfdashboard_gradient_pipeline_is_supported(inColor)) return(NULL);
+
+	/* Create pipeline sharing shader with base pipeline */
+	pipeline=cogl_pipeline_copy(_xfdashboard_gradient_pipeline_get_base());
+
+	/* Set up shape */
+	values[0]=inWidth;
+	values[1]=inHeight;
+	_xfdashboard_gradient_pipeline_set_uniform(pipeline, "xfdashboard_size", 2, 1, values);
+
+	inRadius=MIN(inRadius, inWidth/2.0f);
+	inRadius=MIN(inRadius, inHeight/2.0f);
+	values[0]=(inCorners & XFDASHBOARD_CORNERS_TOP_LEFT) ? inRadius : 0.0f;
+	values[1]=(inCorners & XFDASHBOARD_CORNERS_TOP_RIGHT) ? inRadius : 0.0f;
+	values[2]=(inCorners & XFDASHBOARD_CORNERS_BOTTOM_RIGHT) ? inRadius : 0.0f;
+	values[3]=(inCorners & XFDASHBOARD_CORNERS_BOTTOM_LEFT) ? inRadius : 0.0f;
+	_xfdashboard_gradient_pipeline_set_uniform(pipeline, "xfdashboard_radii", 4, 1, values);
+
+	values[0]=inLineWidth;
+	_xfdashboard_gradient_pipeline_set_uniform(pipeline, "xfdashboard_line_width", 1, 1, values);
+
+	/* Set up color stops. A solid color is a gradient with one color stop. */
+	memset(stopOffsets, 0, sizeof(stopOffsets));
+	memset(stopColors, 0, sizeof(stopColors));
+
+	type=xfdashboard_gradient_color_get_gradient_type(inColor);
+	if(type==XFDASHBOARD_GRADIENT_TYPE_SOLID)
+	{
+		stops=1;
+		_xfdashboard_gradient_pipeline_store_color(xfdashboard_gradient_color_get_solid_color(inColor), stopColors);
+	}
+		else
+		{
+			stops=xfdashboard_gradient_color_get_number_stops(inColor);
+			for(i=0; i<stops; i++)
+			{
+				gdouble			offset;
+				ClutterColor	color;
+
+				xfdashboard_gradient_color_get_stop(inColor, i, &offset, &color);
+				stopOffsets[i]=offset;
+				_xfdashboard_gradient_pipeline_store_color(&color, &stopColors[i*4]);
+			}
+		}
+
+	cogl_pipeline_set_uniform_1i(pipeline,
+									cogl_pipeline_get_uniform_location(pipeline, "xfdashboard_stops"),
+									stops);
+	_xfdashboard_gradient_pipeline_set_uniform(pipeline, "xfdashboard_stop_offsets", 1, XFDASHBOARD_GRADIENT_PIPELINE_MAX_STOPS, stopOffsets);
+	_xfdashboard_gradient_pipeline_set_uniform(pipeline, "xfdashboard_stop_colors", 4, XFDASHBOARD_GRADIENT_PIPELINE_MAX_STOPS, stopColors);
+
+	/* Set up gradient type and its parameters */
+	switch(type)
+	{
+		case XFDASHBOARD_GRADIENT_TYPE_LINEAR_GRADIENT:
+			{
+				gdouble			startX, startY;
+				gdouble			endX, endY;
+
+				xfdashboard_gradient_color_get_linear_points(inColor,
+																inWidth,
+																inHeight,
+																&startX,
+																&startY,
+																&endX,
+																&endY);
+				values[0]=startX;
+				values[1]=startY;
+				values[2]=endX;
+				values[3]=endY;
+				_xfdashboard_gradient_pipeline_set_uniform(pipeline, "xfdashboard_linear_points", 4, 1, values);
+
+				values[0]=(xfdashboard_gradient_color_get_repeat(inColor) ? 1.0f : 0.0f);
+				_xfdashboard_gradient_pipeline_set_uniform(pipeline, "xfdashboard_repeat", 1, 1, values);
+
+				cogl_pipeline_set_uniform_1i(pipeline,
+												cogl_pipeline_get_uniform_location(pipeline, "xfdashboard_gradient_type"),
+												XFDASHBOARD_GRADIENT_PIPELINE_TYPE_LINEAR);
+			}
+			break;
+
+		case XFDASHBOARD_GRADIENT_TYPE_PATH_GRADIENT:
+			/* Path gradients progress over the outline or up to the centre */
+			if(inLineWidth>0.0f) values[0]=inLineWidth;
+				else values[0]=MAX(1.0f, MIN(inWidth, inHeight)/2.0f);
+			_xfdashboard_gradient_pipeline_set_uniform(pipeline, "xfdashboard_path_extent", 1, 1, values);
+
+			cogl_pipeline_set_uniform_1i(pipeline,
+											cogl_pipeline_get_uniform_location(pipeline, "xfdashboard_gradient_type"),
+											XFDASHBOARD_GRADIENT_PIPELINE_TYPE_PATH);
+			break;
+
+		default:
+			cogl_pipeline_set_uniform_1i(pipeline,
+											cogl_pipeline_get_uniform_location(pipeline, "xfdashboard_gradient_type"),
+											XFDASHBOARD_GRADIENT_PIPELINE_TYPE_SOLID);
+			break;
+	}
+
+	/* Return created pipeline */
+	return(pipeline);
+}
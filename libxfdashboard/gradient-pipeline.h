@@ -0,0 +1,51 @@
+/*
+ * gradient-pipeline: Cogl pipelines drawing rounded rectangles filled or
+ *                    outlined with gradient colors on GPU
+ * 
+ * Copyright 2012-2021 Stephan Haller <nomad@froevel.de>
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ * 
+ * 
+ */
+
+#ifndef __LIBXFDASHBOARD_GRADIENT_PIPELINE__
+#define __LIBXFDASHBOARD_GRADIENT_PIPELINE__
+
+#if !defined(__LIBXFDASHBOARD_H_INSIDE__) && !defined(LIBXFDASHBOARD_COMPILATION)
+#error "Only <libxfdashboard/libxfdashboard.h> can be included directly."
+#endif
+
+#include <clutter/clutter.h>
+
+#include <libxfdashboard/gradient-color.h>
+#include <libxfdashboard/types.h>
+
+G_BEGIN_DECLS
+
+/* Public API */
+gboolean xfdashboard_gradient_pipeline_is_supported(const XfdashboardGradientColor *inColor);
+
+CoglPipeline* xfdashboard_gradient_pipeline_new(const XfdashboardGradientColor *inColor,
+												gfloat inWidth,
+												gfloat inHeight,
+												XfdashboardCorners inCorners,
+												gfloat inRadius,
+												gfloat inLineWidth);
+
+G_END_DECLS
+
+#endif	/* __LIBXFDASHBOARD_GRADIENT_PIPELINE__ */
@@ -28,11 +28,17 @@
 #include <libxfdashboard/image-content.h>
 
 #include <glib/gi18n-lib.h>
+#include <glib/gstdio.h>
 #include <gtk/gtk.h>
 #include <math.h>
+#include <string.h>
 
 #include <libxfdashboard/core.h>
+#include <libxfdashboard/settings.h>
 #include <libxfdashboard/stylable.h>
+#include <libxfdashboard/statistics.h>
+#include <libxfdashboard/profiler.h>
+#include <libxfdashboard/utils.h>
 #include <libxfdashboard/compat.h>
 #include <libxfdashboard/debug.h>
 
@@ -54,8 +60,13 @@ typedef enum /*< skip,prefix=XFDASHBOARD_IMAGE_TYPE >*/
 } XfdashboardImageType;
 
 /* Define this class in GObject system */
+static void _xfdashboard_image_content_clutter_content_iface_init(ClutterContentIface *iface);
 static void _xfdashboard_image_content_stylable_iface_init(XfdashboardStylableInterface *iface);
 
+typedef struct _XfdashboardImageContentAtlasPage	XfdashboardImageContentAtlasPage;
+typedef struct _XfdashboardImageContentAtlasSlot	XfdashboardImageContentAtlasSlot;
+typedef struct _XfdashboardImageContentLoadJob		XfdashboardImageContentLoadJob;
+
 struct _XfdashboardImageContentPrivate
 {
 	/* Properties related */
@@ -75,12 +86,31 @@ struct _XfdashboardImageContentPrivate
 	guint								contentAttachedSignalID;
 	guint								contentDetachedSignalID;
 	guint								iconThemeChangedSignalID;
+
+	gchar								*diskCacheFile;
+	gchar								*diskCacheSourceFile;
+
+	XfdashboardImageContentAtlasPage	*atlasPage;
+	gint								atlasX;
+	gint								atlasY;
+	gint								atlasWidth;
+	gint								atlasHeight;
+	gint								atlasSlotWidth;
+	gint								atlasSlotHeight;
+
+	gsize								dataSize;
+
+	GList								*retainedLink;
+	gsize								retainedSize;
+
+	XfdashboardImageContentLoadJob		*loadJob;
 };
 
 G_DEFINE_TYPE_WITH_CODE(XfdashboardImageContent,
 						xfdashboard_image_content,
 						CLUTTER_TYPE_IMAGE,
 						G_ADD_PRIVATE(XfdashboardImageContent)
+						G_IMPLEMENT_INTERFACE(CLUTTER_TYPE_CONTENT, _xfdashboard_image_content_clutter_content_iface_init)
 						G_IMPLEMENT_INTERFACE(XFDASHBOARD_TYPE_STYLABLE, _xfdashboard_image_content_stylable_iface_init))
 
 /* Properties */
@@ -115,8 +145,131 @@ static guint XfdashboardImageContentSignals[SIGNAL_LAST]={ 0, };
 static GHashTable*	_xfdashboard_image_content_cache=NULL;
 static guint		_xfdashboard_image_content_cache_shutdownSignalID=0;
 
+static GQueue		_xfdashboard_image_content_retained=G_QUEUE_INIT;
+static gsize		_xfdashboard_image_content_retained_size=0;
+
+static ClutterContentIface	*_xfdashboard_image_content_parent_content_iface=NULL;
+
 #define XFDASHBOARD_IMAGE_CONTENT_DEFAULT_FALLBACK_ICON_NAME		"image-missing"
 
+/* Small icons are placed into pages of a shared texture atlas instead of their
+ * own texture, so that many icons are drawn from the same texture which allows
+ * Cogl to batch them. Each page is filled shelf by shelf from top to bottom and
+ * from left to right. The slot of an icon is returned to its page when the icon
+ * is released and will be reused by the smallest icon fitting into it. A page
+ * is destroyed as soon as no icon uses it anymore. Icons are separated by a
+ * transparent border to prevent bleeding of neighbour icons when filtering.
+ *
+ * Images placed into the atlas have no texture of their own, so
+ * clutter_image_get_texture() returns NULL for them. Use
+ * xfdashboard_image_content_get_texture() to get the texture and the texture
+ * coordinates of an image instead.
+ */
+#define XFDASHBOARD_IMAGE_CONTENT_ATLAS_PAGE_SIZE					1024
+#define XFDASHBOARD_IMAGE_CONTENT_ATLAS_PADDING						1
+
+struct _XfdashboardImageContentAtlasPage
+{
+	CoglTexture							*texture;
+	gint								shelfX;
+	gint								shelfY;
+	gint								shelfHeight;
+	guint								usedCount;
+	GSList								*freeSlots;		/* 0, 1 or more entries of XfdashboardImageContentAtlasSlot */
+};
+
+struct _XfdashboardImageContentAtlasSlot
+{
+	gint								x;
+	gint								y;
+	gint								width;
+	gint								height;
+};
+
+static GList*		_xfdashboard_image_content_atlas_pages=NULL;
+
+/* Images are decoded by a bounded pool of worker threads. Queued jobs of images
+ * used by mapped actors are processed before jobs of images used by unmapped
+ * ones and jobs are processed in the order they were queued otherwise. A job
+ * which has not been started yet is cancelled if no actor using the image is
+ * mapped anymore and the image will be loaded again when it gets mapped.
+ */
+#define XFDASHBOARD_IMAGE_CONTENT_LOAD_MAX_THREADS					4
+
+typedef enum
+{
+	XFDASHBOARD_IMAGE_CONTENT_LOAD_JOB_STATE_QUEUED=0,
+	XFDASHBOARD_IMAGE_CONTENT_LOAD_JOB_STATE_RUNNING,
+	XFDASHBOARD_IMAGE_CONTENT_LOAD_JOB_STATE_CANCELLED
+} XfdashboardImageContentLoadJobState;
+
+struct _XfdashboardImageContentLoadJob
+{
+	XfdashboardImageContent				*image;
+	gchar								*filename;
+	gint								size;
+	guint								sequence;
+	volatile gint						priority;
+	volatile gint						state;
+
+	GdkPixbuf							*pixbuf;
+	GError								*error;
+};
+
+static GThreadPool*	_xfdashboard_image_content_load_pool=NULL;
+static guint		_xfdashboard_image_content_load_sequence=0;
+static guint		_xfdashboard_image_content_load_pool_resort_id=0;
+
+static GHashTable*	_xfdashboard_image_content_supported_extensions=NULL;
+
+/* Forward declarations */
+static void _xfdashboard_image_content_load(XfdashboardImageContent *self);
+static void _xfdashboard_image_content_on_actor_mapped(XfdashboardImageContent *self,
+														GParamSpec *inSpec,
+														gpointer inUserData);
+
+/* The on-disk cache of decoded icons stores one file per icon which contains
+ * a header followed by the premultiplied RGBA pixels of icon. The name of file
+ * is the SHA1 checksum of the icon theme, the icon and the resolved file name
+ * of icon. The modification time (in nanoseconds) and size of the resolved
+ * file are stored in header to detect outdated cache files.
+ *
+ * The modification time of a cache file is updated when it is used but at most
+ * once per touch interval, so it tells when the cache file was used the last
+ * time. Once per process the cache is pruned by removing cache files not used
+ * for the maximum age and then the least recently used ones until the total
+ * size of all cache files does not exceed the maximum size.
+ */
+#define XFDASHBOARD_IMAGE_CONTENT_DISK_CACHE_SUBPATH				"icons"
+#define XFDASHBOARD_IMAGE_CONTENT_DISK_CACHE_MAGIC					"XFDBICON"
+#define XFDASHBOARD_IMAGE_CONTENT_DISK_CACHE_VERSION				2
+#define XFDASHBOARD_IMAGE_CONTENT_DISK_CACHE_SUFFIX					".icon"
+#define XFDASHBOARD_IMAGE_CONTENT_DISK_CACHE_TOUCH_INTERVAL			(24*60*60)			/* in seconds */
+#define XFDASHBOARD_IMAGE_CONTENT_DISK_CACHE_MAX_AGE				(30*24*60*60)		/* in seconds */
+#define XFDASHBOARD_IMAGE_CONTENT_DISK_CACHE_MAX_SIZE				(32*1024*1024)		/* in bytes */
+
+typedef struct _XfdashboardImageContentDiskCacheHeader		XfdashboardImageContentDiskCacheHeader;
+struct _XfdashboardImageContentDiskCacheHeader
+{
+	gchar								magic[8];
+	guint32								version;
+	guint32								width;
+	guint32								height;
+	guint32								rowstride;
+	gint64								sourceMTime;
+	gint64								sourceSize;
+};
+
+typedef struct _XfdashboardImageContentDiskCacheEntry		XfdashboardImageContentDiskCacheEntry;
+struct _XfdashboardImageContentDiskCacheEntry
+{
+	gchar								*path;
+	gint64								mtime;
+	gint64								size;
+};
+
+static gboolean		_xfdashboard_image_content_disk_cache_prune_started=FALSE;
+
 /* Get image from cache if available */
 static ClutterImage* _xfdashboard_image_content_get_cached_image(const gchar *inKey)
 {
@@ -126,14 +279,28 @@ static ClutterImage* _xfdashboard_image_content_get_cached_image(const gchar *in
 	if(!inKey || *inKey==0) return(NULL);
 
 	/* If we have no hash table no image is cached */
-	if(!_xfdashboard_image_content_cache) return(NULL);
+	if(!_xfdashboard_image_content_cache)
+	{
+		xfdashboard_statistics_add("image.cache-miss", 1);
+		return(NULL);
+	}
 
 	/* Lookup key in cache and return image if found */
-	if(!g_hash_table_contains(_xfdashboard_image_content_cache, inKey)) return(NULL);
+	if(!g_hash_table_contains(_xfdashboard_image_content_cache, inKey))
+	{
+		xfdashboard_statistics_add("image.cache-miss", 1);
+		return(NULL);
+	}
 
 	/* Get loaded image and reference it */
 	image=CLUTTER_IMAGE(g_hash_table_lookup(_xfdashboard_image_content_cache, inKey));
 	g_object_ref(image);
+
+	xfdashboard_statistics_add("image.cache-hit", 1);
+	if(XFDASHBOARD_IMAGE_CONTENT(image)->priv->retainedLink)
+	{
+		xfdashboard_statistics_add("image.cache-retained-hit", 1);
+	}
 	XFDASHBOARD_DEBUG(image, IMAGES,
 						"Using cached image '%s' - ref-count is now %d" ,
 						inKey,
@@ -142,6 +309,99 @@ static ClutterImage* _xfdashboard_image_content_get_cached_image(const gchar *in
 	return(image);
 }
 
+/* Stop retaining an unused image. The reference taken when the image was
+ * retained is returned to caller which must release it.
+ */
+static gboolean _xfdashboard_image_content_unretain(XfdashboardImageContent *self)
+{
+	XfdashboardImageContentPrivate		*priv;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_IMAGE_CONTENT(self), FALSE);
+
+	priv=self->priv;
+
+	/* Do nothing if image is not retained */
+	if(!priv->retainedLink) return(FALSE);
+
+	/* Remove image from list of retained images */
+	g_queue_delete_link(&_xfdashboard_image_content_retained, priv->retainedLink);
+	priv->retainedLink=NULL;
+
+	_xfdashboard_image_content_retained_size-=priv->retainedSize;
+	priv->retainedSize=0;
+
+	return(TRUE);
+}
+
+/* Release least recently used images until size of all retained images
+ * does not exceed requested size.
+ */
+static void _xfdashboard_image_content_evict_retained(gsize inMaxSize)
+{
+	XfdashboardImageContent				*image;
+
+	while(_xfdashboard_image_content_retained_size>inMaxSize &&
+			!g_queue_is_empty(&_xfdashboard_image_content_retained))
+	{
+		/* Least recently used image is at tail of list */
+		image=XFDASHBOARD_IMAGE_CONTENT(g_queue_peek_tail(&_xfdashboard_image_content_retained));
+
+		XFDASHBOARD_DEBUG(image, IMAGES,
+							"Evicting unused image '%s' of %" G_GSIZE_FORMAT " bytes from cache",
+							image->priv->key,
+							image->priv->retainedSize);
+
+		/* Release reference of retained image which may destroy it */
+		_xfdashboard_image_content_unretain(image);
+		g_object_unref(image);
+
+		xfdashboard_statistics_add("image.cache-eviction", 1);
+	}
+}
+
+/* Keep an image which is not used anymore alive for a while so it can be
+ * reused without loading it again.
+ */
+static void _xfdashboard_image_content_retain(XfdashboardImageContent *self)
+{
+	XfdashboardImageContentPrivate		*priv;
+	XfdashboardSettings					*settings;
+	gsize								maxSize;
+
+	g_return_if_fail(XFDASHBOARD_IS_IMAGE_CONTENT(self));
+
+	priv=self->priv;
+
+	/* Only cached images can be reused so there is no need to retain other ones */
+	if(!priv->key || priv->retainedLink) return;
+
+	/* Get number of bytes to retain at most */
+	settings=xfdashboard_core_get_settings(NULL);
+	if(!settings) return;
+
+	maxSize=xfdashboard_settings_get_image_cache_size(settings);
+	if(maxSize==0) return;
+
+	/* Retain image by taking a reference and adding it as most recently used
+	 * image to list of retained images. The size is the one of the image data
+	 * uploaded last which may differ from the requested icon size, e.g. for
+	 * images of GIcons which are loaded at their real size.
+	 */
+	priv->retainedSize=priv->dataSize;
+	g_queue_push_head(&_xfdashboard_image_content_retained, g_object_ref(self));
+	priv->retainedLink=g_queue_peek_head_link(&_xfdashboard_image_content_retained);
+	_xfdashboard_image_content_retained_size+=priv->retainedSize;
+
+	XFDASHBOARD_DEBUG(self, IMAGES,
+						"Retaining unused image '%s' of %" G_GSIZE_FORMAT " bytes - retaining %" G_GSIZE_FORMAT " bytes in total",
+						priv->key,
+						priv->retainedSize,
+						_xfdashboard_image_content_retained_size);
+
+	/* Release least recently used images if too many bytes are retained */
+	_xfdashboard_image_content_evict_retained(maxSize);
+}
+
 /* Destroy cache hashtable */
 static void _xfdashboard_image_content_destroy_cache(void)
 {
@@ -151,6 +411,9 @@ static void _xfdashboard_image_content_destroy_cache(void)
 	/* Only an existing cache can be destroyed */
 	if(!_xfdashboard_image_content_cache) return;
 
+	/* Release all retained images */
+	_xfdashboard_image_content_evict_retained(0);
+
 	/* Disconnect application "shutdown" signal handler */
 	core=xfdashboard_core_get_default();
 	g_signal_handler_disconnect(core, _xfdashboard_image_content_cache_shutdownSignalID);
@@ -279,6 +542,381 @@ static void _xfdashboard_image_content_store_in_cache(XfdashboardImageContent *s
 						G_OBJECT(self)->ref_count);
 }
 
+/* Create a new and empty page for texture atlas */
+static XfdashboardImageContentAtlasPage* _xfdashboard_image_content_atlas_page_new(void)
+{
+	XfdashboardImageContentAtlasPage	*page;
+	guint8								*data;
+#if COGL_VERSION_CHECK(1, 18, 0)
+	CoglContext							*context;
+	CoglError							*error;
+#endif
+
+	/* Create texture initialized with transparent pixels */
+	data=g_malloc0(XFDASHBOARD_IMAGE_CONTENT_ATLAS_PAGE_SIZE*XFDASHBOARD_IMAGE_CONTENT_ATLAS_PAGE_SIZE*4);
+
+	page=g_new0(XfdashboardImageContentAtlasPage, 1);
+#if COGL_VERSION_CHECK(1, 18, 0)
+	error=NULL;
+
+	context=clutter_backend_get_cogl_context(clutter_get_default_backend());
+	page->texture=cogl_texture_2d_new_from_data(context,
+												XFDASHBOARD_IMAGE_CONTENT_ATLAS_PAGE_SIZE,
+												XFDASHBOARD_IMAGE_CONTENT_ATLAS_PAGE_SIZE,
+												COGL_PIXEL_FORMAT_RGBA_8888_PRE,
+												XFDASHBOARD_IMAGE_CONTENT_ATLAS_PAGE_SIZE*4,
+												data,
+												&error);
+	if(!page->texture || error)
+	{
+		g_warning("Could not create texture for icon atlas: %s",
+					(error && error->message) ? error->message : "Unknown error");
+
+		/* Release allocated resources */
+		if(page->texture)
+		{
+			cogl_object_unref(page->texture);
+			page->texture=NULL;
+		}
+
+		if(error)
+		{
+			cogl_error_free(error);
+			error=NULL;
+		}
+	}
+#else
+	page->texture=cogl_texture_new_from_data(XFDASHBOARD_IMAGE_CONTENT_ATLAS_PAGE_SIZE,
+												XFDASHBOARD_IMAGE_CONTENT_ATLAS_PAGE_SIZE,
+												COGL_TEXTURE_NO_SLICING,
+												COGL_PIXEL_FORMAT_RGBA_8888_PRE,
+												COGL_PIXEL_FORMAT_RGBA_8888_PRE,
+												XFDASHBOARD_IMAGE_CONTENT_ATLAS_PAGE_SIZE*4,
+												data);
+	if(!page->texture) g_warning("Could not create texture for icon atlas");
+#endif
+
+	/* Release allocated resources */
+	g_free(data);
+
+	/* If texture could not be created then there is no page */
+	if(!page->texture)
+	{
+		g_free(page);
+		return(NULL);
+	}
+
+	/* Start first shelf with a border */
+	page->shelfX=XFDASHBOARD_IMAGE_CONTENT_ATLAS_PADDING;
+	page->shelfY=XFDASHBOARD_IMAGE_CONTENT_ATLAS_PADDING;
+	page->shelfHeight=0;
+	page->usedCount=0;
+
+	XFDASHBOARD_DEBUG(NULL, IMAGES,
+						"Created icon atlas page %p of size %dx%d",
+						page,
+						XFDASHBOARD_IMAGE_CONTENT_ATLAS_PAGE_SIZE,
+						XFDASHBOARD_IMAGE_CONTENT_ATLAS_PAGE_SIZE);
+
+	return(page);
+}
+
+/* Find space for an icon of requested size in a page of texture atlas */
+static gboolean _xfdashboard_image_content_atlas_page_allocate(XfdashboardImageContentAtlasPage *inPage,
+																gint inWidth,
+																gint inHeight,
+																gint *outX,
+																gint *outY,
+																gint *outSlotWidth,
+																gint *outSlotHeight,
+																gboolean *outReused)
+{
+	XfdashboardImageContentAtlasSlot	*slot;
+	GSList								*bestSlot;
+	GSList								*iter;
+	gint								needWidth;
+	gint								needHeight;
+
+	g_return_val_if_fail(inPage, FALSE);
+
+	needWidth=inWidth+XFDASHBOARD_IMAGE_CONTENT_ATLAS_PADDING;
+	needHeight=inHeight+XFDASHBOARD_IMAGE_CONTENT_ATLAS_PADDING;
+
+	/* Reuse smallest slot of a released icon the icon fits into ... */
+	bestSlot=NULL;
+	for(iter=inPage->freeSlots; iter; iter=g_slist_next(iter))
+	{
+		slot=(XfdashboardImageContentAtlasSlot*)iter->data;
+		if(slot->width<needWidth || slot->height<needHeight) continue;
+
+		if(!bestSlot ||
+			(slot->width*slot->height)<(((XfdashboardImageContentAtlasSlot*)bestSlot->data)->width*((XfdashboardImageContentAtlasSlot*)bestSlot->data)->height))
+		{
+			bestSlot=iter;
+		}
+	}
+
+	if(bestSlot)
+	{
+		slot=(XfdashboardImageContentAtlasSlot*)bestSlot->data;
+
+		*outX=slot->x;
+		*outY=slot->y;
+		*outSlotWidth=slot->width;
+		*outSlotHeight=slot->height;
+		*outReused=TRUE;
+
+		inPage->freeSlots=g_slist_delete_link(inPage->freeSlots, bestSlot);
+		g_free(slot);
+
+		return(TRUE);
+	}
+
+	*outReused=FALSE;
+	*outSlotWidth=needWidth;
+	*outSlotHeight=needHeight;
+
+	/* ... otherwise check if icon fits into current shelf ... */
+	if(inPage->shelfX+needWidth<=XFDASHBOARD_IMAGE_CONTENT_ATLAS_PAGE_SIZE &&
+		inPage->shelfY+MAX(inPage->shelfHeight, needHeight)<=XFDASHBOARD_IMAGE_CONTENT_ATLAS_PAGE_SIZE)
+	{
+		*outX=inPage->shelfX;
+		*outY=inPage->shelfY;
+
+		inPage->shelfX+=needWidth;
+		inPage->shelfHeight=MAX(inPage->shelfHeight, needHeight);
+
+		return(TRUE);
+	}
+
+	/* ... otherwise check if icon fits into a new shelf below current one */
+	if(XFDASHBOARD_IMAGE_CONTENT_ATLAS_PADDING+needWidth<=XFDASHBOARD_IMAGE_CONTENT_ATLAS_PAGE_SIZE &&
+		inPage->shelfY+inPage->shelfHeight+needHeight<=XFDASHBOARD_IMAGE_CONTENT_ATLAS_PAGE_SIZE)
+	{
+		inPage->shelfY+=inPage->shelfHeight;
+		inPage->shelfX=XFDASHBOARD_IMAGE_CONTENT_ATLAS_PADDING;
+		inPage->shelfHeight=needHeight;
+
+		*outX=inPage->shelfX;
+		*outY=inPage->shelfY;
+
+		inPage->shelfX+=needWidth;
+
+		return(TRUE);
+	}
+
+	/* Icon does not fit into this page */
+	return(FALSE);
+}
+
+/* Release space of image in texture atlas */
+static void _xfdashboard_image_content_atlas_release(XfdashboardImageContent *self)
+{
+	XfdashboardImageContentPrivate		*priv;
+	XfdashboardImageContentAtlasPage	*page;
+	XfdashboardImageContentAtlasSlot	*slot;
+
+	g_return_if_fail(XFDASHBOARD_IS_IMAGE_CONTENT(self));
+
+	priv=self->priv;
+
+	/* Do nothing if image is not in texture atlas */
+	if(!priv->atlasPage) return;
+
+	page=priv->atlasPage;
+	priv->atlasPage=NULL;
+
+	/* Destroy page if it is not used anymore ... */
+	page->usedCount--;
+	if(page->usedCount==0)
+	{
+		XFDASHBOARD_DEBUG(self, IMAGES,
+							"Destroying unused icon atlas page %p",
+							page);
+
+		_xfdashboard_image_content_atlas_pages=g_list_remove(_xfdashboard_image_content_atlas_pages, page);
+		g_slist_free_full(page->freeSlots, g_free);
+		cogl_object_unref(page->texture);
+		g_free(page);
+		return;
+	}
+
+	/* ... otherwise return slot of image to page to get reused */
+	slot=g_new0(XfdashboardImageContentAtlasSlot, 1);
+	slot->x=priv->atlasX;
+	slot->y=priv->atlasY;
+	slot->width=priv->atlasSlotWidth;
+	slot->height=priv->atlasSlotHeight;
+	page->freeSlots=g_slist_prepend(page->freeSlots, slot);
+}
+
+/* Store image data in texture atlas. Returns TRUE if image data is stored in
+ * texture atlas or FALSE if image should get its own texture.
+ */
+static gboolean _xfdashboard_image_content_atlas_store(XfdashboardImageContent *self,
+														const guint8 *inData,
+														CoglPixelFormat inPixelFormat,
+														guint inWidth,
+														guint inHeight,
+														guint inRowstride)
+{
+	XfdashboardImageContentPrivate		*priv;
+	XfdashboardSettings					*settings;
+	guint								maxSize;
+	XfdashboardImageContentAtlasPage	*page;
+	GList								*iter;
+	gint								x, y;
+	gint								slotWidth, slotHeight;
+	gboolean							isReused;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_IMAGE_CONTENT(self), FALSE);
+	g_return_val_if_fail(inData, FALSE);
+
+	priv=self->priv;
+
+	/* Check if image is small enough to be stored in texture atlas */
+	settings=xfdashboard_core_get_settings(NULL);
+	if(!settings) return(FALSE);
+
+	maxSize=xfdashboard_settings_get_icon_atlas_max_size(settings);
+	maxSize=MIN(maxSize, XFDASHBOARD_IMAGE_CONTENT_ATLAS_PAGE_SIZE-(2*XFDASHBOARD_IMAGE_CONTENT_ATLAS_PADDING));
+	if(inWidth==0 || inHeight==0 || inWidth>maxSize || inHeight>maxSize) return(FALSE);
+
+	/* Find a page having space for image or create a new page */
+	page=NULL;
+	for(iter=_xfdashboard_image_content_atlas_pages; iter && !page; iter=g_list_next(iter))
+	{
+		if(_xfdashboard_image_content_atlas_page_allocate((XfdashboardImageContentAtlasPage*)iter->data, inWidth, inHeight, &x, &y, &slotWidth, &slotHeight, &isReused))
+		{
+			page=(XfdashboardImageContentAtlasPage*)iter->data;
+		}
+	}
+
+	if(!page)
+	{
+		page=_xfdashboard_image_content_atlas_page_new();
+		if(!page) return(FALSE);
+
+		_xfdashboard_image_content_atlas_pages=g_list_append(_xfdashboard_image_content_atlas_pages, page);
+		if(!_xfdashboard_image_content_atlas_page_allocate(page, inWidth, inHeight, &x, &y, &slotWidth, &slotHeight, &isReused))
+		{
+			/* Should never happen as image size was checked before */
+			return(FALSE);
+		}
+	}
+
+	/* A reused slot might be larger than image and still contains the pixels
+	 * of the released icon, so clear it to keep the transparent border.
+	 */
+	if(isReused)
+	{
+		guint8							*transparent;
+
+		transparent=g_malloc0(slotWidth*slotHeight*4);
+		cogl_texture_set_region(page->texture,
+								0, 0,
+								x, y,
+								slotWidth, slotHeight,
+								slotWidth, slotHeight,
+								COGL_PIXEL_FORMAT_RGBA_8888_PRE,
+								slotWidth*4,
+								transparent);
+		g_free(transparent);
+	}
+
+	/* Upload image data to its space in page. Cogl converts the pixel format. */
+	if(!cogl_texture_set_region(page->texture,
+								0, 0,
+								x, y,
+								inWidth, inHeight,
+								inWidth, inHeight,
+								inPixelFormat,
+								inRowstride,
+								inData))
+	{
+		XfdashboardImageContentAtlasSlot	*slot;
+
+		g_warning("Could not upload image for key '%s' to icon atlas",
+					priv->key ? priv->key : "<nil>");
+
+		/* Return allocated slot to page */
+		slot=g_new0(XfdashboardImageContentAtlasSlot, 1);
+		slot->x=x;
+		slot->y=y;
+		slot->width=slotWidth;
+		slot->height=slotHeight;
+		page->freeSlots=g_slist_prepend(page->freeSlots, slot);
+
+		return(FALSE);
+	}
+
+	/* Remember space of image in page */
+	priv->atlasPage=page;
+	priv->atlasX=x;
+	priv->atlasY=y;
+	priv->atlasWidth=inWidth;
+	priv->atlasHeight=inHeight;
+	priv->atlasSlotWidth=slotWidth;
+	priv->atlasSlotHeight=slotHeight;
+	page->usedCount++;
+
+	XFDASHBOARD_DEBUG(self, IMAGES,
+						"Stored image for key '%s' of size %ux%u in icon atlas page %p at %d,%d",
+						priv->key ? priv->key : "<nil>",
+						inWidth,
+						inHeight,
+						page,
+						x,
+						y);
+
+	return(TRUE);
+}
+
+/* Set image data either in texture atlas or in own texture */
+static gboolean _xfdashboard_image_content_set_data(XfdashboardImageContent *self,
+													const guint8 *inData,
+													CoglPixelFormat inPixelFormat,
+													guint inWidth,
+													guint inHeight,
+													guint inRowstride,
+													GError **outError)
+{
+	XfdashboardImageContentPrivate		*priv;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_IMAGE_CONTENT(self), FALSE);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
+
+	priv=self->priv;
+
+	/* Release space of previous image in texture atlas */
+	_xfdashboard_image_content_atlas_release(self);
+
+	/* Remember size of image data as uploaded to GPU (in RGBA) */
+	priv->dataSize=(gsize)inWidth*(gsize)inHeight*4;
+
+	/* Try to store image in texture atlas */
+	if(_xfdashboard_image_content_atlas_store(self, inData, inPixelFormat, inWidth, inHeight, inRowstride))
+	{
+		clutter_content_invalidate(CLUTTER_CONTENT(self));
+		return(TRUE);
+	}
+
+	/* Image is not stored in texture atlas so set up its own texture */
+	if(!clutter_image_set_data(CLUTTER_IMAGE(self),
+								inData,
+								inPixelFormat,
+								inWidth,
+								inHeight,
+								inRowstride,
+								outError))
+	{
+		priv->dataSize=0;
+		return(FALSE);
+	}
+
+	return(TRUE);
+}
+
 /* Set an empty image of size 1x1 pixels (e.g. when loading asynchronously) */
 static void _xfdashboard_image_content_set_empty_image(XfdashboardImageContent *self)
 {
@@ -286,6 +924,11 @@ static void _xfdashboard_image_content_set_empty_image(XfdashboardImageContent *
 
 	g_return_if_fail(XFDASHBOARD_IS_IMAGE_CONTENT(self));
 
+	/* Release space of previous image in texture atlas */
+	_xfdashboard_image_content_atlas_release(self);
+
+	self->priv->dataSize=sizeof(empty);
+
 	clutter_image_set_data(CLUTTER_IMAGE(self),
 							empty,
 							COGL_PIXEL_FORMAT_RGBA_8888,
@@ -295,28 +938,482 @@ static void _xfdashboard_image_content_set_empty_image(XfdashboardImageContent *
 							NULL);
 }
 
-/* Callback when loading icon asynchronously has finished */
-static void _xfdashboard_image_content_loading_async_callback(GObject *inSource, GAsyncResult *inResult, gpointer inUserData)
+/* Free entry of on-disk cache collected when pruning cache */
+static void _xfdashboard_image_content_disk_cache_entry_free(gpointer inData)
+{
+	XfdashboardImageContentDiskCacheEntry	*entry=(XfdashboardImageContentDiskCacheEntry*)inData;
+
+	g_free(entry->path);
+	g_free(entry);
+}
+
+/* Sort entries of on-disk cache by their last use, least recently used first */
+static gint _xfdashboard_image_content_disk_cache_entry_compare(gconstpointer inLeft, gconstpointer inRight)
+{
+	const XfdashboardImageContentDiskCacheEntry	*left=*((XfdashboardImageContentDiskCacheEntry**)inLeft);
+	const XfdashboardImageContentDiskCacheEntry	*right=*((XfdashboardImageContentDiskCacheEntry**)inRight);
+
+	if(left->mtime<right->mtime) return(-1);
+	if(left->mtime>right->mtime) return(1);
+	return(0);
+}
+
+/* Update modification time of cache file to current time if it was not
+ * updated within touch interval to mark it as recently used.
+ */
+static void _xfdashboard_image_content_disk_cache_touch(const gchar *inCacheFile)
+{
+	GStatBuf								cacheStat;
+	gint64									now;
+
+	g_return_if_fail(inCacheFile && *inCacheFile);
+
+	if(g_stat(inCacheFile, &cacheStat)!=0) return;
+
+	now=g_get_real_time()/G_USEC_PER_SEC;
+	if(now-(gint64)cacheStat.st_mtime<XFDASHBOARD_IMAGE_CONTENT_DISK_CACHE_TOUCH_INTERVAL) return;
+
+	g_utime(inCacheFile, NULL);
+}
+
+/* Prune on-disk cache. This function runs in its own thread. */
+static gpointer _xfdashboard_image_content_disk_cache_prune(gpointer inUserData)
+{
+	gchar									*cacheDirectory;
+	GDir									*directory;
+	const gchar								*filename;
+	GPtrArray								*entries;
+	XfdashboardImageContentDiskCacheEntry	*entry;
+	GStatBuf								cacheStat;
+	gint64									now;
+	gint64									totalSize;
+	guint									removed;
+	guint									i;
+
+	cacheDirectory=(gchar*)inUserData;
+	entries=g_ptr_array_new_with_free_func(_xfdashboard_image_content_disk_cache_entry_free);
+	now=g_get_real_time()/G_USEC_PER_SEC;
+	totalSize=0;
+	removed=0;
+
+	/* Remove all cache files which were not used for maximum age and collect
+	 * the remaining ones.
+	 */
+	directory=g_dir_open(cacheDirectory, 0, NULL);
+	if(directory)
+	{
+		while((filename=g_dir_read_name(directory)))
+		{
+			gchar							*path;
+
+			if(!g_str_has_suffix(filename, XFDASHBOARD_IMAGE_CONTENT_DISK_CACHE_SUFFIX)) continue;
+
+			path=g_build_filename(cacheDirectory, filename, NULL);
+			if(g_stat(path, &cacheStat)!=0)
+			{
+				g_free(path);
+				continue;
+			}
+
+			if(now-(gint64)cacheStat.st_mtime>XFDASHBOARD_IMAGE_CONTENT_DISK_CACHE_MAX_AGE)
+			{
+				if(g_remove(path)==0) removed++;
+				g_free(path);
+				continue;
+			}
+
+			entry=g_new0(XfdashboardImageContentDiskCacheEntry, 1);
+			entry->path=path;
+			entry->mtime=(gint64)cacheStat.st_mtime;
+			entry->size=(gint64)cacheStat.st_size;
+			g_ptr_array_add(entries, entry);
+
+			totalSize+=entry->size;
+		}
+
+		g_dir_close(directory);
+	}
+
+	/* Remove least recently used cache files until total size of all cache
+	 * files does not exceed maximum size anymore.
+	 */
+	if(totalSize>XFDASHBOARD_IMAGE_CONTENT_DISK_CACHE_MAX_SIZE)
+	{
+		g_ptr_array_sort(entries, _xfdashboard_image_content_disk_cache_entry_compare);
+
+		for(i=0; i<entries->len && totalSize>XFDASHBOARD_IMAGE_CONTENT_DISK_CACHE_MAX_SIZE; i++)
+		{
+			entry=(XfdashboardImageContentDiskCacheEntry*)g_ptr_array_index(entries, i);
+			if(g_remove(entry->path)==0)
+			{
+				totalSize-=entry->size;
+				removed++;
+			}
+		}
+	}
+
+	XFDASHBOARD_DEBUG(NULL, IMAGES,
+						"Pruned %u files from icon cache at %s which keeps %" G_GINT64_FORMAT " bytes now",
+						removed,
+						cacheDirectory,
+						totalSize);
+
+	/* Release allocated resources */
+	g_ptr_array_free(entries, TRUE);
+	g_free(cacheDirectory);
+
+	return(NULL);
+}
+
+/* Start pruning on-disk cache in background if not done before */
+static void _xfdashboard_image_content_disk_cache_start_prune(const gchar *inCachePath)
+{
+	gchar									*cacheDirectory;
+	GThread									*thread;
+	GError									*error;
+
+	g_return_if_fail(inCachePath && *inCachePath);
+
+	if(_xfdashboard_image_content_disk_cache_prune_started) return;
+	_xfdashboard_image_content_disk_cache_prune_started=TRUE;
+
+	/* The thread takes ownership of the path to cache directory */
+	error=NULL;
+	cacheDirectory=g_build_filename(inCachePath, XFDASHBOARD_IMAGE_CONTENT_DISK_CACHE_SUBPATH, NULL);
+	thread=g_thread_try_new("xfdashboard-icon-cache-prune",
+							_xfdashboard_image_content_disk_cache_prune,
+							cacheDirectory,
+							&error);
+	if(!thread)
+	{
+		g_warning("Could not create thread to prune icon cache: %s",
+					error ? error->message : "Unknown error");
+		if(error) g_error_free(error);
+		g_free(cacheDirectory);
+		return;
+	}
+
+	g_thread_unref(thread);
+}
+
+/* Get path to file in on-disk cache for image loaded from source file.
+ * Returns NULL if no cache path is configured. Caller must free returned path
+ * with g_free if not needed anymore.
+ */
+static gchar* _xfdashboard_image_content_disk_cache_get_file(XfdashboardImageContent *self,
+																const gchar *inSourceFile)
+{
+	XfdashboardImageContentPrivate		*priv;
+	XfdashboardSettings					*settings;
+	const gchar							*cachePath;
+	gchar								*iconThemeName;
+	gchar								*identifier;
+	gchar								*key;
+	gchar								*checksum;
+	gchar								*filename;
+	gchar								*cacheFile;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_IMAGE_CONTENT(self), NULL);
+	g_return_val_if_fail(inSourceFile && *inSourceFile, NULL);
+
+	priv=self->priv;
+
+	/* Check if a cache path is configured */
+	settings=xfdashboard_core_get_settings(NULL);
+	if(!settings) return(NULL);
+
+	cachePath=xfdashboard_settings_get_cache_path(settings);
+	if(!cachePath) return(NULL);
+
+	/* Prune cache once per process before it is used the first time */
+	_xfdashboard_image_content_disk_cache_start_prune(cachePath);
+
+	/* Build key from icon theme, icon, size and resolved source file */
+	iconThemeName=NULL;
+	g_object_get(gtk_settings_get_default(), "gtk-icon-theme-name", &iconThemeName, NULL);
+
+	if(priv->type==XFDASHBOARD_IMAGE_TYPE_GICON) identifier=g_icon_to_string(priv->gicon);
+		else identifier=g_strdup(priv->iconName);
+
+	key=g_strdup_printf("%s\n%d\n%s\n%d\n%s",
+						iconThemeName ? iconThemeName : "",
+						priv->type,
+						identifier ? identifier : "",
+						priv->iconSize,
+						inSourceFile);
+
+	/* Build path to cache file */
+	checksum=g_compute_checksum_for_string(G_CHECKSUM_SHA1, key, -1);
+	filename=g_strconcat(checksum, XFDASHBOARD_IMAGE_CONTENT_DISK_CACHE_SUFFIX, NULL);
+	cacheFile=g_build_filename(cachePath, XFDASHBOARD_IMAGE_CONTENT_DISK_CACHE_SUBPATH, filename, NULL);
+
+	/* Release allocated resources */
+	g_free(filename);
+	g_free(checksum);
+	g_free(key);
+	if(identifier) g_free(identifier);
+	if(iconThemeName) g_free(iconThemeName);
+
+	return(cacheFile);
+}
+
+/* Load image from file in on-disk cache if it is still valid for source file */
+static gboolean _xfdashboard_image_content_disk_cache_load(XfdashboardImageContent *self,
+															const gchar *inCacheFile,
+															const gchar *inSourceFile)
+{
+	GStatBuf								sourceStat;
+	GMappedFile								*mappedFile;
+	const gchar								*data;
+	gsize									length;
+	XfdashboardImageContentDiskCacheHeader	header;
+	GError									*error;
+	gboolean								success;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_IMAGE_CONTENT(self), FALSE);
+	g_return_val_if_fail(inCacheFile && *inCacheFile, FALSE);
+	g_return_val_if_fail(inSourceFile && *inSourceFile, FALSE);
+
+	error=NULL;
+	success=FALSE;
+
+	/* Get modification time and size of source file to validate cache file */
+	if(g_stat(inSourceFile, &sourceStat)!=0) return(FALSE);
+
+	/* Map cache file into memory */
+	mappedFile=g_mapped_file_new(inCacheFile, FALSE, NULL);
+	if(!mappedFile) return(FALSE);
+
+	data=g_mapped_file_get_contents(mappedFile);
+	length=g_mapped_file_get_length(mappedFile);
+
+	/* Check header of cache file */
+	if(data && length>=sizeof(header))
+	{
+		memcpy(&header, data, sizeof(header));
+
+		if(memcmp(header.magic, XFDASHBOARD_IMAGE_CONTENT_DISK_CACHE_MAGIC, sizeof(header.magic))==0 &&
+			header.version==XFDASHBOARD_IMAGE_CONTENT_DISK_CACHE_VERSION &&
+			header.sourceMTime==xfdashboard_get_modification_time(&sourceStat) &&
+			header.sourceSize==(gint64)sourceStat.st_size &&
+			header.width>0 &&
+			header.height>0 &&
+			header.rowstride>=header.width*4 &&
+			length-sizeof(header)>=(gsize)header.rowstride*header.height)
+		{
+			/* Upload pixels directly from mapped cache file to texture */
+			success=_xfdashboard_image_content_set_data(self,
+														(const guint8*)(data+sizeof(header)),
+														COGL_PIXEL_FORMAT_RGBA_8888_PRE,
+														header.width,
+														header.height,
+														header.rowstride,
+														&error);
+			if(!success)
+			{
+				XFDASHBOARD_DEBUG(self, IMAGES,
+									"Failed to load image data from cache file %s: %s",
+									inCacheFile,
+									error ? error->message : "Unknown error");
+				if(error) g_error_free(error);
+			}
+		}
+	}
+
+	/* Release allocated resources */
+	g_mapped_file_unref(mappedFile);
+
+	/* Mark cache file as recently used to keep it when pruning cache */
+	if(success) _xfdashboard_image_content_disk_cache_touch(inCacheFile);
+
+	return(success);
+}
+
+/* Store pixels of loaded image for source file in on-disk cache */
+static void _xfdashboard_image_content_disk_cache_save(XfdashboardImageContent *self,
+														const gchar *inCacheFile,
+														const gchar *inSourceFile,
+														GdkPixbuf *inPixbuf)
+{
+	GStatBuf								sourceStat;
+	XfdashboardImageContentDiskCacheHeader	header;
+	gint									width, height;
+	gint									channels;
+	gint									sourceRowstride;
+	const guchar							*sourcePixels;
+	gsize									length;
+	guchar									*data;
+	guchar									*target;
+	gint									x, y;
+	gchar									*cacheDirectory;
+	GError									*error;
+
+	g_return_if_fail(XFDASHBOARD_IS_IMAGE_CONTENT(self));
+	g_return_if_fail(inCacheFile && *inCacheFile);
+	g_return_if_fail(inSourceFile && *inSourceFile);
+	g_return_if_fail(GDK_IS_PIXBUF(inPixbuf));
+
+	error=NULL;
+
+	/* Only 8-bit RGB and RGBA pixbufs are supported */
+	channels=gdk_pixbuf_get_n_channels(inPixbuf);
+	if(gdk_pixbuf_get_colorspace(inPixbuf)!=GDK_COLORSPACE_RGB ||
+		gdk_pixbuf_get_bits_per_sample(inPixbuf)!=8 ||
+		(channels!=3 && channels!=4))
+	{
+		return;
+	}
+
+	/* Get modification time and size of source file to validate cache file later */
+	if(g_stat(inSourceFile, &sourceStat)!=0) return;
+
+	/* Set up header */
+	width=gdk_pixbuf_get_width(inPixbuf);
+	height=gdk_pixbuf_get_height(inPixbuf);
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, XFDASHBOARD_IMAGE_CONTENT_DISK_CACHE_MAGIC, sizeof(header.magic));
+	header.version=XFDASHBOARD_IMAGE_CONTENT_DISK_CACHE_VERSION;
+	header.width=width;
+	header.height=height;
+	header.rowstride=width*4;
+	header.sourceMTime=xfdashboard_get_modification_time(&sourceStat);
+	header.sourceSize=(gint64)sourceStat.st_size;
+
+	/* Build contents of cache file by converting pixels to premultiplied RGBA */
+	length=sizeof(header)+((gsize)header.rowstride*height);
+	data=g_malloc(length);
+	memcpy(data, &header, sizeof(header));
+
+	sourcePixels=gdk_pixbuf_get_pixels(inPixbuf);
+	sourceRowstride=gdk_pixbuf_get_rowstride(inPixbuf);
+	target=data+sizeof(header);
+	for(y=0; y<height; y++)
+	{
+		const guchar						*source;
+
+		source=sourcePixels+(y*sourceRowstride);
+		for(x=0; x<width; x++)
+		{
+			guint							alpha;
+
+			alpha=(channels==4 ? source[3] : 0xff);
+			target[0]=(source[0]*alpha+127)/255;
+			target[1]=(source[1]*alpha+127)/255;
+			target[2]=(source[2]*alpha+127)/255;
+			target[3]=alpha;
+
+			source+=channels;
+			target+=4;
+		}
+	}
+
+	/* Write cache file but failing to do so is not an error */
+	cacheDirectory=g_path_get_dirname(inCacheFile);
+	if(g_mkdir_with_parents(cacheDirectory, 0700)!=0 ||
+		!g_file_set_contents(inCacheFile, (const gchar*)data, length, &error))
+	{
+		XFDASHBOARD_DEBUG(self, IMAGES,
+							"Could not store image of source file %s in cache file %s: %s",
+							inSourceFile,
+							inCacheFile,
+							error ? error->message : "Could not create cache directory");
+		if(error) g_error_free(error);
+	}
+		else
+		{
+			XFDASHBOARD_DEBUG(self, IMAGES,
+								"Stored image of source file %s in cache file %s",
+								inSourceFile,
+								inCacheFile);
+		}
+
+	/* Release allocated resources */
+	g_free(cacheDirectory);
+	g_free(data);
+}
+
+/* Try to load image for source file from on-disk cache. If the image is not
+ * in cache, remember the cache file to store the image in when it was loaded.
+ * Returns TRUE if image was loaded from cache.
+ */
+static gboolean _xfdashboard_image_content_disk_cache_try_load(XfdashboardImageContent *self,
+																const gchar *inSourceFile)
+{
+	XfdashboardImageContentPrivate		*priv;
+	gchar								*cacheFile;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_IMAGE_CONTENT(self), FALSE);
+	g_return_val_if_fail(inSourceFile && *inSourceFile, FALSE);
+
+	priv=self->priv;
+
+	/* Forget any cache file set up by a previous load */
+	if(priv->diskCacheFile)
+	{
+		g_free(priv->diskCacheFile);
+		priv->diskCacheFile=NULL;
+	}
+
+	if(priv->diskCacheSourceFile)
+	{
+		g_free(priv->diskCacheSourceFile);
+		priv->diskCacheSourceFile=NULL;
+	}
+
+	/* Get cache file and do nothing if on-disk cache is not available */
+	cacheFile=_xfdashboard_image_content_disk_cache_get_file(self, inSourceFile);
+	if(!cacheFile) return(FALSE);
+
+	/* Try to load image from cache file */
+	if(_xfdashboard_image_content_disk_cache_load(self, cacheFile, inSourceFile))
+	{
+		XFDASHBOARD_DEBUG(self, IMAGES,
+							"Loaded image for key '%s' from cache file %s",
+							priv->key ? priv->key : "<nil>",
+							cacheFile);
+		xfdashboard_statistics_add("image.disk-cache-hit", 1);
+
+		/* Release allocated resources */
+		g_free(cacheFile);
+
+		/* Set state and emit "loaded" signal as loading was successful */
+		priv->loadState=XFDASHBOARD_IMAGE_CONTENT_LOADING_STATE_LOADED_SUCCESSFULLY;
+		g_signal_emit(self, XfdashboardImageContentSignals[SIGNAL_LOADED], 0);
+
+		return(TRUE);
+	}
+
+	/* Image is not cached so remember cache file to store image when loaded */
+	xfdashboard_statistics_add("image.disk-cache-miss", 1);
+
+	priv->diskCacheFile=cacheFile;
+	priv->diskCacheSourceFile=g_strdup(inSourceFile);
+
+	return(FALSE);
+}
+
+/* Loading icon asynchronously has finished */
+static void _xfdashboard_image_content_loading_finished(XfdashboardImageContent *self,
+														GdkPixbuf *inPixbuf,
+														const GError *inError)
 {
-	XfdashboardImageContent				*self=XFDASHBOARD_IMAGE_CONTENT(inUserData);
 	XfdashboardImageContentPrivate		*priv=self->priv;
-	GdkPixbuf							*pixbuf;
 	GError								*error=NULL;
 
 	priv->loadState=XFDASHBOARD_IMAGE_CONTENT_LOADING_STATE_LOADED_SUCCESSFULLY;
 
-	/* Get pixbuf loaded */
-	pixbuf=gdk_pixbuf_new_from_stream_finish(inResult, &error);
-	if(pixbuf)
+	/* Set up loaded inPixbuf */
+	if(inPixbuf)
 	{
 		/* Set image data into content */
-		if(!clutter_image_set_data(CLUTTER_IMAGE(self),
-									gdk_pixbuf_get_pixels(pixbuf),
-									gdk_pixbuf_get_has_alpha(pixbuf) ? COGL_PIXEL_FORMAT_RGBA_8888 : COGL_PIXEL_FORMAT_RGB_888,
-									gdk_pixbuf_get_width(pixbuf),
-									gdk_pixbuf_get_height(pixbuf),
-									gdk_pixbuf_get_rowstride(pixbuf),
-									&error))
+		if(!_xfdashboard_image_content_set_data(self,
+												gdk_pixbuf_get_pixels(inPixbuf),
+												gdk_pixbuf_get_has_alpha(inPixbuf) ? COGL_PIXEL_FORMAT_RGBA_8888 : COGL_PIXEL_FORMAT_RGB_888,
+												gdk_pixbuf_get_width(inPixbuf),
+												gdk_pixbuf_get_height(inPixbuf),
+												gdk_pixbuf_get_rowstride(inPixbuf),
+												&error))
 		{
 			g_warning("Failed to load image data into content for key '%s': %s",
 						priv->key ? priv->key : "<nil>",
@@ -331,17 +1428,20 @@ static void _xfdashboard_image_content_loading_async_callback(GObject *inSource,
 			_xfdashboard_image_content_set_empty_image(self);
 			priv->loadState=XFDASHBOARD_IMAGE_CONTENT_LOADING_STATE_LOADED_FAILED;
 		}
+			/* Store loaded image in on-disk cache */
+			else if(priv->diskCacheFile && priv->diskCacheSourceFile)
+			{
+				_xfdashboard_image_content_disk_cache_save(self,
+															priv->diskCacheFile,
+															priv->diskCacheSourceFile,
+															inPixbuf);
+			}
 	}
 		else
 		{
 			g_warning("Failed to load image for key '%s': %s",
 						priv->key ? priv->key : "<nil>",
-						error ? error->message : "Unknown error");
-			if(error)
-			{
-				g_error_free(error);
-				error=NULL;
-			}
+						inError ? inError->message : "Unknown error");
 
 			/* Set failed state and empty image */
 			_xfdashboard_image_content_set_empty_image(self);
@@ -349,7 +1449,17 @@ static void _xfdashboard_image_content_loading_async_callback(GObject *inSource,
 		}
 
 	/* Release allocated resources */
-	if(pixbuf) g_object_unref(pixbuf);
+	if(priv->diskCacheFile)
+	{
+		g_free(priv->diskCacheFile);
+		priv->diskCacheFile=NULL;
+	}
+
+	if(priv->diskCacheSourceFile)
+	{
+		g_free(priv->diskCacheSourceFile);
+		priv->diskCacheSourceFile=NULL;
+	}
 
 	/* Emit "loaded" signal if loading was successful ... */
 	if(priv->loadState==XFDASHBOARD_IMAGE_CONTENT_LOADING_STATE_LOADED_SUCCESSFULLY)
@@ -367,11 +1477,309 @@ static void _xfdashboard_image_content_loading_async_callback(GObject *inSource,
 								"Failed to load image for key '%s' asynchronously",
 								priv->key ? priv->key : "<nil>");
 		}
+}
+
+/* Check if any actor using this image is mapped */
+static gboolean _xfdashboard_image_content_is_visible(XfdashboardImageContent *self)
+{
+	GList								*iter;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_IMAGE_CONTENT(self), FALSE);
+
+	for(iter=self->priv->actors; iter; iter=g_list_next(iter))
+	{
+		if(clutter_actor_is_mapped(CLUTTER_ACTOR(iter->data))) return(TRUE);
+	}
+
+	return(FALSE);
+}
+
+/* Sort queued load jobs by priority and order they were queued */
+static gint _xfdashboard_image_content_load_job_compare(gconstpointer inLeft,
+														gconstpointer inRight,
+														gpointer inUserData)
+{
+	const XfdashboardImageContentLoadJob	*left=(const XfdashboardImageContentLoadJob*)inLeft;
+	const XfdashboardImageContentLoadJob	*right=(const XfdashboardImageContentLoadJob*)inRight;
+	gint									leftPriority;
+	gint									rightPriority;
+
+	/* Higher priority first */
+	leftPriority=g_atomic_int_get(&left->priority);
+	rightPriority=g_atomic_int_get(&right->priority);
+	if(leftPriority!=rightPriority) return(rightPriority-leftPriority);
+
+	/* Older jobs first */
+	if(left->sequence<right->sequence) return(-1);
+	if(left->sequence>right->sequence) return(1);
+	return(0);
+}
+
+/* Resort queue of worker pool after priorities of load jobs have changed.
+ * Many actors are usually mapped or unmapped at once, e.g. when a view is
+ * scrolled, so the queue is resorted only once for all of them.
+ */
+static gboolean _xfdashboard_image_content_load_pool_resort(gpointer inUserData)
+{
+	_xfdashboard_image_content_load_pool_resort_id=0;
+
+	if(_xfdashboard_image_content_load_pool)
+	{
+		g_thread_pool_set_sort_function(_xfdashboard_image_content_load_pool,
+										_xfdashboard_image_content_load_job_compare,
+										NULL);
+	}
+
+	return(G_SOURCE_REMOVE);
+}
+
+static void _xfdashboard_image_content_load_pool_queue_resort(void)
+{
+	if(_xfdashboard_image_content_load_pool_resort_id) return;
+
+	_xfdashboard_image_content_load_pool_resort_id=
+		clutter_threads_add_idle_full(G_PRIORITY_HIGH_IDLE,
+										_xfdashboard_image_content_load_pool_resort,
+										NULL,
+										NULL);
+}
+
+/* Free load job */
+static void _xfdashboard_image_content_load_job_free(gpointer inData)
+{
+	XfdashboardImageContentLoadJob		*job=(XfdashboardImageContentLoadJob*)inData;
+
+	g_return_if_fail(job);
+
+	/* Release allocated resources */
+	if(job->image) g_object_unref(job->image);
+	if(job->filename) g_free(job->filename);
+	if(job->pixbuf) g_object_unref(job->pixbuf);
+	if(job->error) g_error_free(job->error);
+	g_free(job);
+}
+
+/* Actor using an image being loaded was mapped or unmapped */
+static void _xfdashboard_image_content_on_loading_actor_mapped_changed(XfdashboardImageContent *self,
+																		GParamSpec *inSpec,
+																		gpointer inUserData)
+{
+	XfdashboardImageContentPrivate		*priv;
+	XfdashboardImageContentLoadJob		*job;
+	gboolean							isVisible;
+
+	g_return_if_fail(XFDASHBOARD_IS_IMAGE_CONTENT(self));
+
+	priv=self->priv;
+	job=priv->loadJob;
+
+	/* Do nothing if image is not being loaded by a worker */
+	if(!job) return;
+
+	/* Update priority of load job and mark queue of worker pool to get resorted */
+	isVisible=_xfdashboard_image_content_is_visible(self);
+	if(g_atomic_int_get(&job->priority)!=(isVisible ? 1 : 0))
+	{
+		g_atomic_int_set(&job->priority, isVisible ? 1 : 0);
+		_xfdashboard_image_content_load_pool_queue_resort();
+	}
+
+	/* Cancel load job if no actor is mapped anymore and it has not been started */
+	if(!isVisible &&
+		g_atomic_int_compare_and_exchange(&job->state,
+											XFDASHBOARD_IMAGE_CONTENT_LOAD_JOB_STATE_QUEUED,
+											XFDASHBOARD_IMAGE_CONTENT_LOAD_JOB_STATE_CANCELLED))
+	{
+		XFDASHBOARD_DEBUG(self, IMAGES,
+							"Cancelled loading image with key '%s' as no actor using it is mapped",
+							priv->key);
+		xfdashboard_statistics_add("image.load-cancelled", 1);
+	}
+}
+
+/* Connect or disconnect signal handlers to get notified when actor using
+ * an image being loaded gets mapped or unmapped.
+ */
+static void _xfdashboard_image_content_connect_loading_actor(gpointer inData,
+																gpointer inUserData)
+{
+	g_return_if_fail(CLUTTER_IS_ACTOR(inData));
+	g_return_if_fail(XFDASHBOARD_IS_IMAGE_CONTENT(inUserData));
+
+	g_signal_connect_swapped(inData,
+								"notify::mapped",
+								G_CALLBACK(_xfdashboard_image_content_on_loading_actor_mapped_changed),
+								inUserData);
+}
+
+static void _xfdashboard_image_content_disconnect_loading_actor(gpointer inData,
+																gpointer inUserData)
+{
+	g_return_if_fail(CLUTTER_IS_ACTOR(inData));
+	g_return_if_fail(XFDASHBOARD_IS_IMAGE_CONTENT(inUserData));
+
+	g_signal_handlers_disconnect_by_func(inData,
+											G_CALLBACK(_xfdashboard_image_content_on_loading_actor_mapped_changed),
+											inUserData);
+}
+
+/* Connect signal handler to get notified when actor using an image which
+ * is not loaded yet gets mapped.
+ */
+static void _xfdashboard_image_content_connect_actor_mapped(gpointer inData,
+															gpointer inUserData)
+{
+	g_return_if_fail(CLUTTER_IS_ACTOR(inData));
+	g_return_if_fail(XFDASHBOARD_IS_IMAGE_CONTENT(inUserData));
+
+	g_signal_connect_swapped(inData,
+								"notify::mapped",
+								G_CALLBACK(_xfdashboard_image_content_on_actor_mapped),
+								inUserData);
+}
+
+/* Load job was processed by worker, so set up image at main thread */
+static gboolean _xfdashboard_image_content_on_load_job_done(gpointer inUserData)
+{
+	XfdashboardImageContentLoadJob		*job=(XfdashboardImageContentLoadJob*)inUserData;
+	XfdashboardImageContent				*self;
+	XfdashboardImageContentPrivate		*priv;
+	gint64								profilerBegin;
+
+	g_return_val_if_fail(job, G_SOURCE_REMOVE);
+	g_return_val_if_fail(XFDASHBOARD_IS_IMAGE_CONTENT(job->image), G_SOURCE_REMOVE);
+
+	self=job->image;
+	priv=self->priv;
+
+	/* Do nothing if this job is not the current one of image anymore */
+	if(priv->loadJob!=job) return(G_SOURCE_REMOVE);
+	priv->loadJob=NULL;
+
+	/* Stop tracking mapped state of actors using this image */
+	g_list_foreach(priv->actors, _xfdashboard_image_content_disconnect_loading_actor, self);
+
+	/* If job was cancelled reset loading state, so the image gets loaded
+	 * when any actor using it is mapped.
+	 */
+	if(g_atomic_int_get(&job->state)==XFDASHBOARD_IMAGE_CONTENT_LOAD_JOB_STATE_CANCELLED)
+	{
+		priv->loadState=XFDASHBOARD_IMAGE_CONTENT_LOADING_STATE_NONE;
+
+		if(_xfdashboard_image_content_is_visible(self))
+		{
+			_xfdashboard_image_content_load(self);
+		}
+			else
+			{
+				g_list_foreach(priv->actors, _xfdashboard_image_content_connect_actor_mapped, self);
+			}
+
+		return(G_SOURCE_REMOVE);
+	}
+
+	/* Set up image with loaded pixbuf */
+	profilerBegin=xfdashboard_profiler_begin("image");
+	_xfdashboard_image_content_loading_finished(self, job->pixbuf, job->error);
+	xfdashboard_profiler_end("image", "image.upload", profilerBegin);
+
+	return(G_SOURCE_REMOVE);
+}
+
+/* Load image of job at worker thread */
+static void _xfdashboard_image_content_load_job_run(gpointer inData, gpointer inUserData)
+{
+	XfdashboardImageContentLoadJob		*job=(XfdashboardImageContentLoadJob*)inData;
+	gint64								profilerBegin;
+
+	g_return_if_fail(job);
+
+	/* Load image if job was not cancelled */
+	if(g_atomic_int_compare_and_exchange(&job->state,
+											XFDASHBOARD_IMAGE_CONTENT_LOAD_JOB_STATE_QUEUED,
+											XFDASHBOARD_IMAGE_CONTENT_LOAD_JOB_STATE_RUNNING))
+	{
+		profilerBegin=xfdashboard_profiler_begin("image");
+		if(job->size>0)
+		{
+			job->pixbuf=gdk_pixbuf_new_from_file_at_scale(job->filename,
+															job->size,
+															job->size,
+															TRUE,
+															&job->error);
+		}
+			else job->pixbuf=gdk_pixbuf_new_from_file(job->filename, &job->error);
+		xfdashboard_profiler_end("image", "image.decode", profilerBegin);
+	}
+
+	/* Hand over job to main thread */
+	clutter_threads_add_idle_full(G_PRIORITY_DEFAULT,
+									_xfdashboard_image_content_on_load_job_done,
+									job,
+									_xfdashboard_image_content_load_job_free);
+}
+
+/* Queue loading image from file at given size (or at its real size if size
+ * is zero) at worker pool.
+ */
+static void _xfdashboard_image_content_queue_load(XfdashboardImageContent *self,
+													const gchar *inFilename,
+													gint inSize)
+{
+	XfdashboardImageContentPrivate		*priv;
+	XfdashboardImageContentLoadJob		*job;
+	GError								*error;
+
+	g_return_if_fail(XFDASHBOARD_IS_IMAGE_CONTENT(self));
+	g_return_if_fail(inFilename && *inFilename);
+
+	priv=self->priv;
+	error=NULL;
+
+	/* Create worker pool if not done yet */
+	if(!_xfdashboard_image_content_load_pool)
+	{
+		_xfdashboard_image_content_load_pool=g_thread_pool_new(_xfdashboard_image_content_load_job_run,
+																NULL,
+																CLAMP((gint)g_get_num_processors(), 1, XFDASHBOARD_IMAGE_CONTENT_LOAD_MAX_THREADS),
+																FALSE,
+																&error);
+		if(!_xfdashboard_image_content_load_pool)
+		{
+			g_warning("Could not create worker pool for loading images: %s",
+						error ? error->message : "Unknown error");
+			if(error) g_error_free(error);
+
+			_xfdashboard_image_content_set_empty_image(self);
+			priv->loadState=XFDASHBOARD_IMAGE_CONTENT_LOADING_STATE_LOADED_FAILED;
+			return;
+		}
+
+		g_thread_pool_set_sort_function(_xfdashboard_image_content_load_pool,
+										_xfdashboard_image_content_load_job_compare,
+										NULL);
+	}
 
-	/* Now release the extra reference we took to keep this instance alive
-	 * while loading asynchronously.
+	/* Create load job. It keeps this image instance alive until the job
+	 * was processed.
 	 */
-	g_object_unref(self);
+	job=g_new0(XfdashboardImageContentLoadJob, 1);
+	job->image=g_object_ref(self);
+	job->filename=g_strdup(inFilename);
+	job->size=inSize;
+	job->sequence=_xfdashboard_image_content_load_sequence++;
+	job->priority=(_xfdashboard_image_content_is_visible(self) ? 1 : 0);
+	job->state=XFDASHBOARD_IMAGE_CONTENT_LOAD_JOB_STATE_QUEUED;
+
+	priv->loadJob=job;
+
+	/* Track mapped state of actors using this image to update priority of job
+	 * or to cancel it.
+	 */
+	g_list_foreach(priv->actors, _xfdashboard_image_content_connect_loading_actor, self);
+
+	/* Queue job */
+	g_thread_pool_push(_xfdashboard_image_content_load_pool, job, NULL);
 }
 
 /* Load image from file */
@@ -447,13 +1855,13 @@ static void _xfdashboard_image_content_load_from_file(XfdashboardImageContent *s
 			GError						*error=NULL;
 
 			iconPixbuf=gtk_icon_info_get_builtin_pixbuf(iconInfo);
-			if(!clutter_image_set_data(CLUTTER_IMAGE(self),
-										gdk_pixbuf_get_pixels(iconPixbuf),
-										gdk_pixbuf_get_has_alpha(iconPixbuf) ? COGL_PIXEL_FORMAT_RGBA_8888 : COGL_PIXEL_FORMAT_RGB_888,
-										gdk_pixbuf_get_width(iconPixbuf),
-										gdk_pixbuf_get_height(iconPixbuf),
-										gdk_pixbuf_get_rowstride(iconPixbuf),
-										&error))
+			if(!_xfdashboard_image_content_set_data(self,
+													gdk_pixbuf_get_pixels(iconPixbuf),
+													gdk_pixbuf_get_has_alpha(iconPixbuf) ? COGL_PIXEL_FORMAT_RGBA_8888 : COGL_PIXEL_FORMAT_RGB_888,
+													gdk_pixbuf_get_width(iconPixbuf),
+													gdk_pixbuf_get_height(iconPixbuf),
+													gdk_pixbuf_get_rowstride(iconPixbuf),
+													&error))
 			{
 				g_warning("Failed to load image data into content for icon '%s': %s",
 							priv->iconName,
@@ -484,46 +1892,18 @@ static void _xfdashboard_image_content_load_from_file(XfdashboardImageContent *s
 	/* Load image asynchronously if filename is given */
 	if(filename)
 	{
-		GFile						*file;
-		GInputStream				*stream;
-		GError						*error=NULL;
-
-		/* Create stream for loading async */
-		file=g_file_new_for_path(filename);
-		stream=G_INPUT_STREAM(g_file_read(file, NULL, &error));
-		if(!stream)
+		/* Check if decoded image is in on-disk cache */
+		if(_xfdashboard_image_content_disk_cache_try_load(self, filename))
 		{
-			g_warning("Could not create stream for file '%s' of icon '%s': %s",
-						filename,
-						priv->iconName,
-						error ? error->message : "Unknown error");
-
-			if(error!=NULL)
-			{
-				g_error_free(error);
-				error=NULL;
-			}
-
 			/* Release allocated resources */
-			g_object_unref(file);
 			g_free(lookupFilename);
 			g_free(filename);
 
 			return;
 		}
 
-		/* We are going to load the icon asynchronously. To keep this
-		 * image instance alive until async loading finishs and calls
-		 * the callback function we take an extra reference on this
-		 * instance. It will be release in callback function.
-		 */
-		gdk_pixbuf_new_from_stream_at_scale_async(stream,
-													priv->iconSize,
-													priv->iconSize,
-													TRUE,
-													NULL,
-													(GAsyncReadyCallback)_xfdashboard_image_content_loading_async_callback,
-													g_object_ref(self));
+		/* Queue loading image at worker pool */
+		_xfdashboard_image_content_queue_load(self, filename, priv->iconSize);
 
 		XFDASHBOARD_DEBUG(self, IMAGES,
 							"Loading icon '%s' from file %s",
@@ -531,8 +1911,6 @@ static void _xfdashboard_image_content_load_from_file(XfdashboardImageContent *s
 							filename);
 
 		/* Release allocated resources */
-		g_object_unref(stream);
-		g_object_unref(file);
 		g_free(filename);
 	}
 
@@ -540,40 +1918,43 @@ static void _xfdashboard_image_content_load_from_file(XfdashboardImageContent *s
 	g_free(lookupFilename);
 }
 
-/* Load image from icon theme */
-static gboolean _xfdashboard_image_content_load_from_icon_name_is_supported_suffix(GdkPixbufFormat *inFormat,
-																					const gchar *inExtension)
+/* Check if file extension is supported by any gdk-pixbuf format. The list of
+ * extensions is built once when needed the first time.
+ */
+static gboolean _xfdashboard_image_content_is_supported_extension(const gchar *inExtension)
 {
-	gchar			**extensions, **entry;
-	gboolean		isSupported;
-
-	g_return_val_if_fail(inFormat, FALSE);
 	g_return_val_if_fail(inExtension && *inExtension=='.' && *(inExtension+1), FALSE);
 
-	/* Get extensions supported by gdk-pixbuf format */
-	extensions=gdk_pixbuf_format_get_extensions(inFormat);
-
-	/* Iterate through list of extensions supported by format and check
-	 * if any of them matches given extension.
-	 */
-	isSupported=FALSE;
-	for(entry=extensions; *entry && !isSupported; entry++)
+	/* Build list of extensions supported by any gdk-pixbuf format */
+	if(!_xfdashboard_image_content_supported_extensions)
 	{
-		if(g_strcmp0(inExtension+1, *entry)==0)
+		GSList							*supportedFormats, *entry;
+		gchar							**extensions, **extension;
+
+		_xfdashboard_image_content_supported_extensions=g_hash_table_new_full(g_str_hash,
+																				g_str_equal,
+																				g_free,
+																				NULL);
+
+		supportedFormats=gdk_pixbuf_get_formats();
+		for(entry=supportedFormats; entry; entry=g_slist_next(entry))
 		{
-			isSupported=TRUE;
-			XFDASHBOARD_DEBUG(NULL, IMAGES,
-								"Extension '%s' is supported by '%s'",
-								inExtension+1,
-								gdk_pixbuf_format_get_description(inFormat));
+			extensions=gdk_pixbuf_format_get_extensions((GdkPixbufFormat*)entry->data);
+			for(extension=extensions; *extension; extension++)
+			{
+				XFDASHBOARD_DEBUG(NULL, IMAGES,
+									"Extension '%s' is supported by '%s'",
+									*extension,
+									gdk_pixbuf_format_get_description((GdkPixbufFormat*)entry->data));
+				g_hash_table_add(_xfdashboard_image_content_supported_extensions, g_strdup(*extension));
+			}
+			g_strfreev(extensions);
 		}
+		g_slist_free(supportedFormats);
 	}
 
-	/* Free allocated resources */
-	g_strfreev(extensions);
-
 	/* Return status if extension is known and supported */
-	return(isSupported);
+	return(g_hash_table_contains(_xfdashboard_image_content_supported_extensions, inExtension+1));
 }
 
 static void _xfdashboard_image_content_load_from_icon_name(XfdashboardImageContent *self)
@@ -612,8 +1993,6 @@ static void _xfdashboard_image_content_load_from_icon_name(XfdashboardImageConte
 		if(extensionPosition)
 		{
 			gchar						*extension;
-			GSList						*supportedFormats, *entry;
-			GdkPixbufFormat				*format;
 			gboolean					isSupported;
 
 			/* Get suffix - the file extension */
@@ -623,21 +2002,8 @@ static void _xfdashboard_image_content_load_from_icon_name(XfdashboardImageConte
 								priv->iconName,
 								extensionPosition);
 
-			/* Get all formats supported by gdk-pixbuf and check if
-			 * suffix matches any of them.
-			 */
-			isSupported=FALSE;
-			supportedFormats=gdk_pixbuf_get_formats();
-			for(entry=supportedFormats; entry && !isSupported; entry=g_slist_next(entry))
-			{
-				format=(GdkPixbufFormat*)entry->data;
-
-				if(_xfdashboard_image_content_load_from_icon_name_is_supported_suffix(format, extension))
-				{
-					isSupported=TRUE;
-				}
-			}
-			g_slist_free(supportedFormats);
+			/* Check if suffix is supported by any format of gdk-pixbuf */
+			isSupported=_xfdashboard_image_content_is_supported_extension(extension);
 
 			/* If extension is supported truncate filename by extension
 			 * and try again to retrieve icon info.
@@ -720,13 +2086,13 @@ static void _xfdashboard_image_content_load_from_icon_name(XfdashboardImageConte
 		GError							*error=NULL;
 
 		iconPixbuf=gtk_icon_info_get_builtin_pixbuf(iconInfo);
-		if(!clutter_image_set_data(CLUTTER_IMAGE(self),
-									gdk_pixbuf_get_pixels(iconPixbuf),
-									gdk_pixbuf_get_has_alpha(iconPixbuf) ? COGL_PIXEL_FORMAT_RGBA_8888 : COGL_PIXEL_FORMAT_RGB_888,
-									gdk_pixbuf_get_width(iconPixbuf),
-									gdk_pixbuf_get_height(iconPixbuf),
-									gdk_pixbuf_get_rowstride(iconPixbuf),
-									&error))
+		if(!_xfdashboard_image_content_set_data(self,
+												gdk_pixbuf_get_pixels(iconPixbuf),
+												gdk_pixbuf_get_has_alpha(iconPixbuf) ? COGL_PIXEL_FORMAT_RGBA_8888 : COGL_PIXEL_FORMAT_RGB_888,
+												gdk_pixbuf_get_width(iconPixbuf),
+												gdk_pixbuf_get_height(iconPixbuf),
+												gdk_pixbuf_get_rowstride(iconPixbuf),
+												&error))
 		{
 			g_warning("Failed to load image data into content for icon '%s': %s",
 						priv->iconName,
@@ -750,48 +2116,17 @@ static void _xfdashboard_image_content_load_from_icon_name(XfdashboardImageConte
 		else
 #endif
 		{
-			GFile						*file;
-			GInputStream				*stream;
-			GError						*error=NULL;
-
-			/* Create stream for loading async */
-			file=g_file_new_for_path(filename);
-			stream=G_INPUT_STREAM(g_file_read(file, NULL, &error));
-			if(!stream)
+			/* Check if decoded image is in on-disk cache */
+			if(_xfdashboard_image_content_disk_cache_try_load(self, filename))
 			{
-				g_warning("Could not create stream for icon file %s of icon '%s': %s",
-							filename,
-							priv->iconName,
-							error ? error->message : "Unknown error");
-
-				if(error!=NULL)
-				{
-					g_error_free(error);
-					error=NULL;
-				}
-
 				/* Release allocated resources */
-				g_object_unref(file);
+				g_object_unref(iconInfo);
 
 				return;
 			}
 
-			/* We are going to load the icon asynchronously. To keep this
-			 * image instance alive until async loading finishs and calls
-			 * the callback function we take an extra reference on this
-			 * instance. It will be release in callback function.
-			 */
-			gdk_pixbuf_new_from_stream_at_scale_async(stream,
-														priv->iconSize,
-														priv->iconSize,
-														TRUE,
-														NULL,
-														(GAsyncReadyCallback)_xfdashboard_image_content_loading_async_callback,
-														g_object_ref(self));
-
-			/* Release allocated resources */
-			g_object_unref(stream);
-			g_object_unref(file);
+			/* Queue loading image at worker pool */
+			_xfdashboard_image_content_queue_load(self, filename, priv->iconSize);
 
 			XFDASHBOARD_DEBUG(self, IMAGES,
 								"Loading icon '%s' from icon file %s",
@@ -856,13 +2191,13 @@ static void _xfdashboard_image_content_load_from_gicon(XfdashboardImageContent *
 		GError							*error=NULL;
 
 		iconPixbuf=gtk_icon_info_get_builtin_pixbuf(iconInfo);
-		if(!clutter_image_set_data(CLUTTER_IMAGE(self),
-									gdk_pixbuf_get_pixels(iconPixbuf),
-									gdk_pixbuf_get_has_alpha(iconPixbuf) ? COGL_PIXEL_FORMAT_RGBA_8888 : COGL_PIXEL_FORMAT_RGB_888,
-									gdk_pixbuf_get_width(iconPixbuf),
-									gdk_pixbuf_get_height(iconPixbuf),
-									gdk_pixbuf_get_rowstride(iconPixbuf),
-									&error))
+		if(!_xfdashboard_image_content_set_data(self,
+												gdk_pixbuf_get_pixels(iconPixbuf),
+												gdk_pixbuf_get_has_alpha(iconPixbuf) ? COGL_PIXEL_FORMAT_RGBA_8888 : COGL_PIXEL_FORMAT_RGB_888,
+												gdk_pixbuf_get_width(iconPixbuf),
+												gdk_pixbuf_get_height(iconPixbuf),
+												gdk_pixbuf_get_rowstride(iconPixbuf),
+												&error))
 		{
 			g_warning("Failed to load image data into content for gicon '%s': %s",
 						g_icon_to_string(priv->gicon),
@@ -886,50 +2221,26 @@ static void _xfdashboard_image_content_load_from_gicon(XfdashboardImageContent *
 		else
 #endif
 		{
-			GFile						*file;
-			GInputStream				*stream;
-			GError						*error=NULL;
+			gchar						*iconString;
 
-			/* Create stream for loading async */
-			file=g_file_new_for_path(filename);
-			stream=G_INPUT_STREAM(g_file_read(file, NULL, &error));
-			if(!stream)
+			/* Check if decoded image is in on-disk cache */
+			if(_xfdashboard_image_content_disk_cache_try_load(self, filename))
 			{
-				g_warning("Could not create stream for file %s of gicon '%s': %s",
-							filename,
-							g_icon_to_string(priv->gicon),
-							error ? error->message : "Unknown error");
-
-				if(error!=NULL)
-				{
-					g_error_free(error);
-					error=NULL;
-				}
-
 				/* Release allocated resources */
-				g_object_unref(file);
+				g_object_unref(iconInfo);
 
 				return;
 			}
 
-			/* We are going to load the icon asynchronously. To keep this
-			 * image instance alive until async loading finishs and calls
-			 * the callback function we take an extra reference on this
-			 * instance. It will be release in callback function.
-			 */
-			gdk_pixbuf_new_from_stream_async(stream,
-												NULL,
-												(GAsyncReadyCallback)_xfdashboard_image_content_loading_async_callback,
-												g_object_ref(self));
-
-			/* Release allocated resources */
-			g_object_unref(stream);
-			g_object_unref(file);
+			/* Queue loading image at worker pool at its real size */
+			_xfdashboard_image_content_queue_load(self, filename, 0);
 
+			iconString=g_icon_to_string(priv->gicon);
 			XFDASHBOARD_DEBUG(self, IMAGES,
 								"Loading gicon '%s' from file %s",
-								g_icon_to_string(priv->gicon),
+								iconString,
 								filename);
+			g_free(iconString);
 		}
 
 	/* Release allocated resources */
@@ -1148,6 +2459,88 @@ static void _xfdashboard_image_content_on_actor_mapped(XfdashboardImageContent *
 
 /* IMPLEMENTATION: ClutterContent */
 
+/* Paint image either from texture atlas or from its own texture */
+static void _xfdashboard_image_content_clutter_content_iface_paint_content(ClutterContent *inContent,
+																			ClutterActor *inActor,
+																			ClutterPaintNode *inRootNode)
+{
+	XfdashboardImageContent				*self=XFDASHBOARD_IMAGE_CONTENT(inContent);
+	XfdashboardImageContentPrivate		*priv=self->priv;
+	ClutterScalingFilter				minFilter, magFilter;
+	ClutterPaintNode					*node;
+	ClutterActorBox						box;
+	ClutterColor						color;
+	guint8								opacity;
+	gfloat								pageSize;
+
+	/* If image is not in texture atlas let parent class paint its own texture */
+	if(!priv->atlasPage)
+	{
+		if(_xfdashboard_image_content_parent_content_iface->paint_content)
+		{
+			_xfdashboard_image_content_parent_content_iface->paint_content(inContent, inActor, inRootNode);
+		}
+		return;
+	}
+
+	/* Get needed data for painting */
+	clutter_actor_get_content_box(inActor, &box);
+	clutter_actor_get_content_scaling_filters(inActor, &minFilter, &magFilter);
+	opacity=clutter_actor_get_paint_opacity(inActor);
+
+	color.red=opacity;
+	color.green=opacity;
+	color.blue=opacity;
+	color.alpha=opacity;
+
+	/* Paint sub-texture of image in page of texture atlas */
+	pageSize=(gfloat)XFDASHBOARD_IMAGE_CONTENT_ATLAS_PAGE_SIZE;
+
+	node=clutter_texture_node_new(priv->atlasPage->texture, &color, minFilter, magFilter);
+	clutter_paint_node_set_name(node, G_OBJECT_TYPE_NAME(self));
+	clutter_paint_node_add_texture_rectangle(node,
+												&box,
+												priv->atlasX/pageSize,
+												priv->atlasY/pageSize,
+												(priv->atlasX+priv->atlasWidth)/pageSize,
+												(priv->atlasY+priv->atlasHeight)/pageSize);
+	clutter_paint_node_add_child(inRootNode, node);
+	clutter_paint_node_unref(node);
+}
+
+/* Get preferred size of image */
+static gboolean _xfdashboard_image_content_clutter_content_iface_get_preferred_size(ClutterContent *inContent,
+																					gfloat *outWidth,
+																					gfloat *outHeight)
+{
+	XfdashboardImageContentPrivate		*priv=XFDASHBOARD_IMAGE_CONTENT(inContent)->priv;
+
+	/* If image is not in texture atlas get size of its own texture from parent class */
+	if(!priv->atlasPage)
+	{
+		if(_xfdashboard_image_content_parent_content_iface->get_preferred_size)
+		{
+			return(_xfdashboard_image_content_parent_content_iface->get_preferred_size(inContent, outWidth, outHeight));
+		}
+		return(FALSE);
+	}
+
+	/* Set result values */
+	if(outWidth) *outWidth=priv->atlasWidth;
+	if(outHeight) *outHeight=priv->atlasHeight;
+
+	return(TRUE);
+}
+
+/* Initialize interface of type ClutterContent */
+static void _xfdashboard_image_content_clutter_content_iface_init(ClutterContentIface *iface)
+{
+	_xfdashboard_image_content_parent_content_iface=g_type_interface_peek_parent(iface);
+
+	iface->get_preferred_size=_xfdashboard_image_content_clutter_content_iface_get_preferred_size;
+	iface->paint_content=_xfdashboard_image_content_clutter_content_iface_paint_content;
+}
+
 /* Image was attached to an actor */
 static void _xfdashboard_image_content_on_attached(ClutterContent *inContent,
 													ClutterActor *inActor,
@@ -1184,8 +2577,32 @@ static void _xfdashboard_image_content_on_attached(ClutterContent *inContent,
 		}
 	}
 
-	/* If image is being loaded then do nothing */
-	if(priv->loadState==XFDASHBOARD_IMAGE_CONTENT_LOADING_STATE_LOADING) return;
+	/* Image is used again so stop retaining it. The reference taken while
+	 * retaining can be released as the actor holds a reference now.
+	 */
+	if(_xfdashboard_image_content_unretain(self))
+	{
+		XFDASHBOARD_DEBUG(self, IMAGES,
+							"Reusing retained image '%s'",
+							priv->key);
+		g_object_unref(self);
+	}
+
+	/* If image is being loaded then track mapped state of actor to update
+	 * priority of loading but do nothing else.
+	 */
+	if(priv->loadState==XFDASHBOARD_IMAGE_CONTENT_LOADING_STATE_LOADING)
+	{
+		if(priv->loadJob &&
+			inActor &&
+			CLUTTER_IS_ACTOR(inActor))
+		{
+			_xfdashboard_image_content_connect_loading_actor(inActor, self);
+			_xfdashboard_image_content_on_loading_actor_mapped_changed(self, NULL, inActor);
+		}
+
+		return;
+	}
 
 	/* Check if image was already loaded then emit signal
 	 * appropiate for last load status.
@@ -1275,6 +2692,12 @@ static void _xfdashboard_image_content_on_detached(ClutterContent *inContent,
 							inActor ? G_OBJECT_TYPE_NAME(inActor) : "<nil>",
 							inActor);
 	}
+
+	/* Update priority of loading image or cancel it */
+	if(priv->loadJob) _xfdashboard_image_content_on_loading_actor_mapped_changed(self, NULL, inActor);
+
+	/* If image is not used by any actor anymore then retain it for a while */
+	if(!priv->actors) _xfdashboard_image_content_retain(self);
 }
 
 /* IMPLEMENTATION: Interface XfdashboardStylable */
@@ -1386,6 +2809,22 @@ static void _xfdashboard_image_content_dispose(GObject *inObject)
 		priv->missingIconName=NULL;
 	}
 
+	if(priv->diskCacheFile)
+	{
+		g_free(priv->diskCacheFile);
+		priv->diskCacheFile=NULL;
+	}
+
+	if(priv->diskCacheSourceFile)
+	{
+		g_free(priv->diskCacheSourceFile);
+		priv->diskCacheSourceFile=NULL;
+	}
+
+	_xfdashboard_image_content_atlas_release(self);
+
+	_xfdashboard_image_content_unretain(self);
+
 	/* Call parent's class dispose method */
 	G_OBJECT_CLASS(xfdashboard_image_content_parent_class)->dispose(inObject);
 }
@@ -1522,6 +2961,13 @@ void xfdashboard_image_content_init(XfdashboardImageContent *self)
 	priv->iconTheme=gtk_icon_theme_get_default();
 	priv->missingIconName=g_strdup(XFDASHBOARD_IMAGE_CONTENT_DEFAULT_FALLBACK_ICON_NAME);
 	priv->actors=NULL;
+	priv->diskCacheFile=NULL;
+	priv->diskCacheSourceFile=NULL;
+	priv->atlasPage=NULL;
+	priv->dataSize=0;
+	priv->retainedLink=NULL;
+	priv->retainedSize=0;
+	priv->loadJob=NULL;
 
 	/* Style content */
 	xfdashboard_stylable_invalidate(XFDASHBOARD_STYLABLE(self));
@@ -1802,3 +3248,38 @@ void xfdashboard_image_content_force_load(XfdashboardImageContent *self)
 		_xfdashboard_image_content_load(self);
 	}
 }
+
+/* Get texture containing image and the texture coordinates of image in texture.
+ * The texture might be a shared page of texture atlas so the returned texture
+ * coordinates must be used when drawing. The returned texture is owned by
+ * image and must not be unreffed. NULL is returned if no texture is available.
+ */
+CoglTexture* xfdashboard_image_content_get_texture(XfdashboardImageContent *self, ClutterActorBox *outTextureCoords)
+{
+	XfdashboardImageContentPrivate		*priv;
+	gfloat								pageSize;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_IMAGE_CONTENT(self), NULL);
+
+	priv=self->priv;
+
+	/* If image is not in texture atlas it uses the whole texture of parent class */
+	if(!priv->atlasPage)
+	{
+		if(outTextureCoords) clutter_actor_box_init(outTextureCoords, 0.0f, 0.0f, 1.0f, 1.0f);
+		return(clutter_image_get_texture(CLUTTER_IMAGE(self)));
+	}
+
+	/* Image is a sub-texture in page of texture atlas */
+	if(outTextureCoords)
+	{
+		pageSize=(gfloat)XFDASHBOARD_IMAGE_CONTENT_ATLAS_PAGE_SIZE;
+		clutter_actor_box_init(outTextureCoords,
+								priv->atlasX/pageSize,
+								priv->atlasY/pageSize,
+								(priv->atlasX+priv->atlasWidth)/pageSize,
+								(priv->atlasY+priv->atlasHeight)/pageSize);
+	}
+
+	return(priv->atlasPage->texture);
+}
@@ -88,6 +88,8 @@ XfdashboardImageContentLoadingState xfdashboard_image_content_get_state(Xfdashbo
 
 void xfdashboard_image_content_force_load(XfdashboardImageContent *self);
 
+CoglTexture* xfdashboard_image_content_get_texture(XfdashboardImageContent *self, ClutterActorBox *outTextureCoords);
+
 G_END_DECLS
 
 #endif	/* __LIBXFDASHBOARD_IMAGE_CONTENT__ */
@@ -33,6 +33,7 @@
 
 #include <libxfdashboard/enums.h>
 #include <libxfdashboard/image-content.h>
+#include <libxfdashboard/statistics.h>
 #include <libxfdashboard/compat.h>
 
 
@@ -60,6 +61,7 @@ struct _XfdashboardLabelPrivate
 	gint						iconSize;
 	XfdashboardOrientation		iconOrientation;
 
+	gchar						*text;
 	gchar						*font;
 	ClutterColor				*labelColor;
 	PangoEllipsizeMode			labelEllipsize;
@@ -107,6 +109,128 @@ static GParamSpec* XfdashboardLabelProperties[PROP_LAST]={ 0, };
 
 
 /* IMPLEMENTATION: Private variables and methods */
+#define XFDASHBOARD_LABEL_MEASURE_CACHE_MAX_ENTRIES		4096
+
+typedef struct _XfdashboardLabelMeasure				XfdashboardLabelMeasure;
+struct _XfdashboardLabelMeasure
+{
+	gfloat		minimumSize;
+	gfloat		naturalSize;
+	GList		link;			/* Link in LRU queue, its data is the key in cache */
+};
+
+static GHashTable	*_xfdashboard_label_measure_cache=NULL;
+static GQueue		_xfdashboard_label_measure_cache_lru=G_QUEUE_INIT;
+
+/* Font or resolution of backend changed so all cached text measurements
+ * are invalid now.
+ */
+static void _xfdashboard_label_on_backend_font_changed(ClutterBackend *inBackend, gpointer inUserData)
+{
+	if(_xfdashboard_label_measure_cache)
+	{
+		g_queue_init(&_xfdashboard_label_measure_cache_lru);
+		g_hash_table_remove_all(_xfdashboard_label_measure_cache);
+	}
+}
+
+/* Get preferred width or height of text actor. Measurements are shared
+ * between all labels and are looked up by text, font, all layout affecting
+ * settings and the requested size in opposite direction. So labels with the
+ * same text and style as well as repeated relayouts at the same size will
+ * not need to lay out the text by Pango again. If the cache is full, the
+ * least recently used measurement is dropped.
+ */
+static void _xfdashboard_label_get_text_preferred_size(XfdashboardLabel *self,
+														ClutterOrientation inOrientation,
+														gfloat inForSize,
+														gfloat *outMinimumSize,
+														gfloat *outNaturalSize)
+{
+	XfdashboardLabelPrivate		*priv;
+	ClutterText					*text;
+	gchar						*key;
+	XfdashboardLabelMeasure		*measure;
+
+	g_return_if_fail(XFDASHBOARD_IS_LABEL(self));
+
+	priv=self->priv;
+	text=CLUTTER_TEXT(priv->actorLabel);
+
+	/* Build key for cache. The text is put at the end as it may contain
+	 * any character also the ones used to separate the values.
+	 */
+	key=g_strdup_printf("%c|%s|%d|%d|%d|%d|%d|%.2f|%s",
+						inOrientation==CLUTTER_ORIENTATION_HORIZONTAL ? 'w' : 'h',
+						clutter_text_get_font_name(text),
+						clutter_text_get_ellipsize(text),
+						clutter_text_get_single_line_mode(text),
+						clutter_text_get_line_wrap(text),
+						clutter_text_get_line_wrap_mode(text),
+						clutter_text_get_line_alignment(text),
+						inForSize,
+						priv->text ? priv->text : "");
+
+	/* Look up measurement in cache */
+	if(G_UNLIKELY(!_xfdashboard_label_measure_cache))
+	{
+		_xfdashboard_label_measure_cache=g_hash_table_new_full(g_str_hash,
+																g_str_equal,
+																g_free,
+																g_free);
+	}
+
+	measure=(XfdashboardLabelMeasure*)g_hash_table_lookup(_xfdashboard_label_measure_cache, key);
+	if(measure)
+	{
+		xfdashboard_statistics_add("label.measure-cache-hit", 1);
+		g_free(key);
+
+		/* Mark measurement as most recently used */
+		g_queue_unlink(&_xfdashboard_label_measure_cache_lru, &measure->link);
+		g_queue_push_head_link(&_xfdashboard_label_measure_cache_lru, &measure->link);
+	}
+		else
+		{
+			xfdashboard_statistics_add("label.measure-cache-miss", 1);
+
+			/* Measure text actor */
+			measure=g_new0(XfdashboardLabelMeasure, 1);
+			if(inOrientation==CLUTTER_ORIENTATION_HORIZONTAL)
+			{
+				clutter_actor_get_preferred_width(priv->actorLabel,
+													inForSize,
+													&measure->minimumSize,
+													&measure->naturalSize);
+			}
+				else
+				{
+					clutter_actor_get_preferred_height(priv->actorLabel,
+														inForSize,
+														&measure->minimumSize,
+														&measure->naturalSize);
+				}
+
+			/* Store measurement in cache but drop least recently used
+			 * measurement before if cache is full.
+			 */
+			if(g_hash_table_size(_xfdashboard_label_measure_cache)>=XFDASHBOARD_LABEL_MEASURE_CACHE_MAX_ENTRIES)
+			{
+				GList					*oldest;
+
+				oldest=g_queue_pop_tail_link(&_xfdashboard_label_measure_cache_lru);
+				if(oldest) g_hash_table_remove(_xfdashboard_label_measure_cache, oldest->data);
+			}
+
+			measure->link.data=key;
+			g_hash_table_insert(_xfdashboard_label_measure_cache, key, measure);
+			g_queue_push_head_link(&_xfdashboard_label_measure_cache_lru, &measure->link);
+		}
+
+	/* Set result values */
+	if(outMinimumSize) *outMinimumSize=measure->minimumSize;
+	if(outNaturalSize) *outNaturalSize=measure->naturalSize;
+}
 
 /* Get preferred width of icon and label child actors
  * We do not respect paddings here so if height is given it must be
@@ -145,9 +269,10 @@ static void _xfdashboard_label_get_preferred_width_intern(XfdashboardLabel *self
 			gfloat		labelHeight;
 
 			/* Get size of label */
-			clutter_actor_get_preferred_width(CLUTTER_ACTOR(priv->actorLabel),
-												inForHeight,
-												&minSize, &naturalSize);
+			_xfdashboard_label_get_text_preferred_size(self,
+															CLUTTER_ORIENTATION_HORIZONTAL,
+															inForHeight,
+															&minSize, &naturalSize);
 			labelSize=(inGetPreferred==TRUE ? naturalSize : minSize);
 
 			/* Get size of icon depending on orientation */
@@ -155,9 +280,10 @@ static void _xfdashboard_label_get_preferred_width_intern(XfdashboardLabel *self
 				priv->iconOrientation==XFDASHBOARD_ORIENTATION_RIGHT)
 			{
 				/* Get both sizes of label to calculate icon size */
-				clutter_actor_get_preferred_height(CLUTTER_ACTOR(priv->actorLabel),
-													labelSize,
-													&minSize, &naturalSize);
+				_xfdashboard_label_get_text_preferred_size(self,
+																CLUTTER_ORIENTATION_VERTICAL,
+																labelSize,
+																&minSize, &naturalSize);
 				labelHeight=(inGetPreferred==TRUE ? naturalSize : minSize);
 
 				/* Get size of icon depending on opposize size of label */
@@ -177,9 +303,10 @@ static void _xfdashboard_label_get_preferred_width_intern(XfdashboardLabel *self
 				/* Get size of label if visible */
 				if(clutter_actor_is_visible(priv->actorLabel))
 				{
-					clutter_actor_get_preferred_width(CLUTTER_ACTOR(priv->actorLabel),
-														inForHeight,
-														&minSize, &naturalSize);
+					_xfdashboard_label_get_text_preferred_size(self,
+																	CLUTTER_ORIENTATION_HORIZONTAL,
+																	inForHeight,
+																	&minSize, &naturalSize);
 					labelSize=(inGetPreferred==TRUE ? naturalSize : minSize);
 				}
 
@@ -224,9 +351,10 @@ static void _xfdashboard_label_get_preferred_width_intern(XfdashboardLabel *self
 			/* Get minimum size of label because we should never
 			 * go down below this minimum size
 			 */
-			clutter_actor_get_preferred_height(CLUTTER_ACTOR(priv->actorLabel),
-												-1.0f,
-												&labelMinimumSize, NULL);
+			_xfdashboard_label_get_text_preferred_size(self,
+															CLUTTER_ORIENTATION_VERTICAL,
+															-1.0f,
+															&labelMinimumSize, NULL);
 
 			/* Initialize height with value if it could occupy 100% width and
 			 * set icon size to negative value to show that its value was not
@@ -234,9 +362,10 @@ static void _xfdashboard_label_get_preferred_width_intern(XfdashboardLabel *self
 			 */
 			iconSize=-1.0f;
 
-			clutter_actor_get_preferred_width(CLUTTER_ACTOR(priv->actorLabel),
-												inForHeight,
-												&minSize, &naturalSize);
+			_xfdashboard_label_get_text_preferred_size(self,
+															CLUTTER_ORIENTATION_HORIZONTAL,
+															inForHeight,
+															&minSize, &naturalSize);
 			requestSize=(inGetPreferred==TRUE ? naturalSize : minSize);
 
 			if(priv->labelEllipsize==PANGO_ELLIPSIZE_NONE ||
@@ -251,9 +380,10 @@ static void _xfdashboard_label_get_preferred_width_intern(XfdashboardLabel *self
 					/* Reduce size for label by size of icon and
 					 * get its opposize size
 					 */
-					clutter_actor_get_preferred_width(CLUTTER_ACTOR(priv->actorLabel),
-														inForHeight-iconHeight,
-														&minSize, &naturalSize);
+					_xfdashboard_label_get_text_preferred_size(self,
+																	CLUTTER_ORIENTATION_HORIZONTAL,
+																	inForHeight-iconHeight,
+																	&minSize, &naturalSize);
 					newRequestSize=(inGetPreferred==TRUE ? naturalSize : minSize);
 
 					/* If new opposite size is equal (or unexpectly lower) than
@@ -328,9 +458,10 @@ static void _xfdashboard_label_get_preferred_width_intern(XfdashboardLabel *self
 					inForHeight-=iconSize;
 				}
 
-				clutter_actor_get_preferred_width(CLUTTER_ACTOR(priv->actorLabel),
-													inForHeight,
-													&minSize, &naturalSize);
+				_xfdashboard_label_get_text_preferred_size(self,
+																CLUTTER_ORIENTATION_HORIZONTAL,
+																inForHeight,
+																&minSize, &naturalSize);
 				labelSize=(inGetPreferred==TRUE ? naturalSize : minSize);
 			}
 		}
@@ -377,9 +508,10 @@ static void _xfdashboard_label_get_preferred_height_intern(XfdashboardLabel *sel
 			gfloat		labelWidth;
 
 			/* Get size of label */
-			clutter_actor_get_preferred_height(CLUTTER_ACTOR(priv->actorLabel),
-												inForWidth,
-												&minSize, &naturalSize);
+			_xfdashboard_label_get_text_preferred_size(self,
+															CLUTTER_ORIENTATION_VERTICAL,
+															inForWidth,
+															&minSize, &naturalSize);
 			labelSize=(inGetPreferred==TRUE ? naturalSize : minSize);
 
 			/* Get size of icon depending on orientation */
@@ -387,9 +519,10 @@ static void _xfdashboard_label_get_preferred_height_intern(XfdashboardLabel *sel
 				priv->iconOrientation==XFDASHBOARD_ORIENTATION_BOTTOM)
 			{
 				/* Get both sizes of label to calculate icon size */
-				clutter_actor_get_preferred_width(CLUTTER_ACTOR(priv->actorLabel),
-													labelSize,
-													&minSize, &naturalSize);
+				_xfdashboard_label_get_text_preferred_size(self,
+																CLUTTER_ORIENTATION_HORIZONTAL,
+																labelSize,
+																&minSize, &naturalSize);
 				labelWidth=(inGetPreferred==TRUE ? naturalSize : minSize);
 
 				/* Get size of icon depending on opposize size of label */
@@ -417,9 +550,10 @@ static void _xfdashboard_label_get_preferred_height_intern(XfdashboardLabel *sel
 
 				if(clutter_actor_is_visible(priv->actorLabel))
 				{
-					clutter_actor_get_preferred_height(CLUTTER_ACTOR(priv->actorLabel),
-														inForWidth,
-														&minSize, &naturalSize);
+					_xfdashboard_label_get_text_preferred_size(self,
+																	CLUTTER_ORIENTATION_VERTICAL,
+																	inForWidth,
+																	&minSize, &naturalSize);
 					labelSize=(inGetPreferred==TRUE ? naturalSize : minSize);
 				}
 			}
@@ -455,9 +589,10 @@ static void _xfdashboard_label_get_preferred_height_intern(XfdashboardLabel *sel
 			/* Get minimum size of label because we should never
 			 * go down below this minimum size
 			 */
-			clutter_actor_get_preferred_width(CLUTTER_ACTOR(priv->actorLabel),
-												-1.0f,
-												&labelMinimumSize, NULL);
+			_xfdashboard_label_get_text_preferred_size(self,
+															CLUTTER_ORIENTATION_HORIZONTAL,
+															-1.0f,
+															&labelMinimumSize, NULL);
 
 			/* Initialize height with value if it could occupy 100% width and
 			 * set icon size to negative value to show that its value was not
@@ -465,9 +600,10 @@ static void _xfdashboard_label_get_preferred_height_intern(XfdashboardLabel *sel
 			 */
 			iconSize=-1.0f;
 
-			clutter_actor_get_preferred_height(CLUTTER_ACTOR(priv->actorLabel),
-												inForWidth,
-												&minSize, &naturalSize);
+			_xfdashboard_label_get_text_preferred_size(self,
+															CLUTTER_ORIENTATION_VERTICAL,
+															inForWidth,
+															&minSize, &naturalSize);
 			requestSize=(inGetPreferred==TRUE ? naturalSize : minSize);
 
 			if(priv->labelEllipsize==PANGO_ELLIPSIZE_NONE ||
@@ -482,9 +618,10 @@ static void _xfdashboard_label_get_preferred_height_intern(XfdashboardLabel *sel
 					/* Reduce size for label by size of icon and
 					 * get its opposize size
 					 */
-					clutter_actor_get_preferred_height(CLUTTER_ACTOR(priv->actorLabel),
-														inForWidth-iconWidth,
-														&minSize, &naturalSize);
+					_xfdashboard_label_get_text_preferred_size(self,
+																	CLUTTER_ORIENTATION_VERTICAL,
+																	inForWidth-iconWidth,
+																	&minSize, &naturalSize);
 					newRequestSize=(inGetPreferred==TRUE ? naturalSize : minSize);
 
 					/* If new opposite size is equal (or unexpectly lower) than
@@ -558,9 +695,10 @@ static void _xfdashboard_label_get_preferred_height_intern(XfdashboardLabel *sel
 					inForWidth-=iconSize;
 				}
 
-				clutter_actor_get_preferred_height(CLUTTER_ACTOR(priv->actorLabel),
-													inForWidth,
-													&minSize, &naturalSize);
+				_xfdashboard_label_get_text_preferred_size(self,
+																CLUTTER_ORIENTATION_VERTICAL,
+																inForWidth,
+																&minSize, &naturalSize);
 				labelSize=(inGetPreferred==TRUE ? naturalSize : minSize);
 			}
 		}
@@ -592,9 +730,14 @@ static void _xfdashboard_label_update_icon_image_size(XfdashboardLabel *self)
 		gfloat					labelWidth, labelHeight;
 
 		/* Get size of label */
-		clutter_actor_get_preferred_size(CLUTTER_ACTOR(priv->actorLabel),
-											NULL, NULL,
-											&labelWidth, &labelHeight);
+		_xfdashboard_label_get_text_preferred_size(self,
+													CLUTTER_ORIENTATION_HORIZONTAL,
+													-1.0f,
+													NULL, &labelWidth);
+		_xfdashboard_label_get_text_preferred_size(self,
+													CLUTTER_ORIENTATION_VERTICAL,
+													labelWidth,
+													NULL, &labelHeight);
 
 		if(priv->iconOrientation==XFDASHBOARD_ORIENTATION_TOP ||
 			priv->iconOrientation==XFDASHBOARD_ORIENTATION_BOTTOM)
@@ -1050,6 +1193,12 @@ static void _xfdashboard_label_dispose(GObject *inObject)
 		priv->iconImage=NULL;
 	}
 
+	if(priv->text)
+	{
+		g_free(priv->text);
+		priv->text=NULL;
+	}
+
 	if(priv->font)
 	{
 		g_free(priv->font);
@@ -1240,6 +1389,16 @@ static void xfdashboard_label_class_init(XfdashboardLabelClass *klass)
 	clutterActorClass->allocate=_xfdashboard_label_allocate;
 	clutterActorClass->destroy=_xfdashboard_label_destroy;
 
+	/* Cached text measurements get invalid if font or resolution changes */
+	g_signal_connect(clutter_get_default_backend(),
+						"font-changed",
+						G_CALLBACK(_xfdashboard_label_on_backend_font_changed),
+						NULL);
+	g_signal_connect(clutter_get_default_backend(),
+						"resolution-changed",
+						G_CALLBACK(_xfdashboard_label_on_backend_font_changed),
+						NULL);
+
 	/* Define properties */
 	XfdashboardLabelProperties[PROP_PADDING]=
 		g_param_spec_float("padding",
@@ -1393,6 +1552,7 @@ static void xfdashboard_label_init(XfdashboardLabel *self)
 	priv->iconSyncSize=TRUE;
 	priv->iconSize=16;
 	priv->iconOrientation=-1;
+	priv->text=NULL;
 	priv->font=NULL;
 	priv->labelColor=NULL;
 	priv->labelEllipsize=-1;
@@ -1859,10 +2019,16 @@ void xfdashboard_label_set_text(XfdashboardLabel *self, const gchar *inMarkupTex
 
 	priv=self->priv;
 
-	/* Set value if changed */
-	if(g_strcmp0(clutter_text_get_text(CLUTTER_TEXT(priv->actorLabel)), inMarkupText)!=0)
+	/* Set value if changed. Compare against the markup text set last time
+	 * and not against the text of text actor which has the markup stripped
+	 * already. Otherwise any markup text would be parsed again each time.
+	 */
+	if(g_strcmp0(priv->text, inMarkupText)!=0)
 	{
 		/* Set value */
+		if(priv->text) g_free(priv->text);
+		priv->text=g_strdup(inMarkupText);
+
 		clutter_text_set_markup(CLUTTER_TEXT(priv->actorLabel), inMarkupText);
 		clutter_actor_queue_relayout(CLUTTER_ACTOR(priv->actorLabel));
 
@@ -40,6 +40,7 @@
 #include <libxfdashboard/bindings-pool.h>
 #include <libxfdashboard/box-layout.h>
 #include <libxfdashboard/button.h>
+#include <libxfdashboard/cache-effect.h>
 #include <libxfdashboard/click-action.h>
 #include <libxfdashboard/collapse-box.h>
 #include <libxfdashboard/compat.h>
@@ -48,6 +49,7 @@
 #include <libxfdashboard/debug.h>
 #include <libxfdashboard/desktop-app-info.h>
 #include <libxfdashboard/desktop-app-info-action.h>
+#include <libxfdashboard/directory-watcher.h>
 #include <libxfdashboard/drag-action.h>
 #include <libxfdashboard/drop-action.h>
 #include <libxfdashboard/dynamic-table-layout.h>
@@ -56,6 +58,7 @@
 #include <libxfdashboard/focusable.h>
 #include <libxfdashboard/focus-manager.h>
 #include <libxfdashboard/gradient-color.h>
+#include <libxfdashboard/gradient-pipeline.h>
 #include <libxfdashboard/image-content.h>
 #include <libxfdashboard/label.h>
 #include <libxfdashboard/live-window.h>
@@ -70,6 +73,7 @@
 #include <libxfdashboard/popup-menu-item.h>
 #include <libxfdashboard/popup-menu-item-button.h>
 #include <libxfdashboard/popup-menu-item-separator.h>
+#include <libxfdashboard/profiler.h>
 #include <libxfdashboard/quicklaunch.h>
 #include <libxfdashboard/scaled-table-layout.h>
 #include <libxfdashboard/scrollbar.h>
@@ -81,6 +85,7 @@
 #include <libxfdashboard/settings.h>
 #include <libxfdashboard/stage.h>
 #include <libxfdashboard/stage-interface.h>
+#include <libxfdashboard/statistics.h>
 #include <libxfdashboard/stylable.h>
 #include <libxfdashboard/text-box.h>
 #include <libxfdashboard/theme.h>
@@ -29,6 +29,11 @@
 
 #include <glib/gi18n-lib.h>
 
+#include <libxfdashboard/marshal.h>
+
+
+/* Forward declarations */
+typedef struct _XfdashboardModelIndex				XfdashboardModelIndex;
 
 /* Define theses classes in GObject system */
 struct _XfdashboardModelPrivate
@@ -44,6 +49,11 @@ struct _XfdashboardModelPrivate
 	XfdashboardModelFilterFunc	filterCallback;
 	gpointer					filterUserData;
 	GDestroyNotify				filterUserDataDestroyCallback;
+	XfdashboardModelIndex		*filterIndex;
+	gchar						*filterIndexKey;
+	GHashTable					*filterVisibleRows;
+
+	GHashTable					*indexes;
 };
 
 G_DEFINE_TYPE_WITH_PRIVATE(XfdashboardModel,
@@ -82,8 +92,11 @@ enum
 	SIGNAL_ROW_ADDED,
 	SIGNAL_ROW_REMOVED,
 	SIGNAL_ROW_CHANGED,
+	SIGNAL_ROWS_ADDED,
+	SIGNAL_ROWS_REMOVED,
 	SIGNAL_SORT_CHANGED,
 	SIGNAL_FILTER_CHANGED,
+	SIGNAL_FILTER_CHANGED_ROWS,
 
 	SIGNAL_LAST
 };
@@ -101,6 +114,23 @@ struct _XfdashboardModelSortData
 	XfdashboardModelIter		*rightIter;
 };
 
+/* A secondary index maps the key returned by the index function for each
+ * row to the rows having this key. Rows are stored by their sequence
+ * iterators as they stay valid until the row is removed, even if the
+ * model is sorted.
+ */
+struct _XfdashboardModelIndex
+{
+	gchar						*name;
+
+	XfdashboardModelIndexFunc	indexCallback;
+	gpointer					indexUserData;
+	GDestroyNotify				indexUserDataDestroyCallback;
+
+	GHashTable					*rowsByKey;
+	GHashTable					*keysByRow;
+};
+
 /* Checks for valid iterator for model */
 G_GNUC_UNUSED static gboolean _xfdashboard_model_iter_is_valid(XfdashboardModelIter *self, gboolean inNeedsIter)
 {
@@ -179,6 +209,335 @@ static gint _xfdashboard_model_sort_internal(GSequenceIter *inLeft,
 	return(result);
 }
 
+/* Create a new secondary index */
+static XfdashboardModelIndex* _xfdashboard_model_index_new(const gchar *inName,
+															XfdashboardModelIndexFunc inIndexCallback,
+															gpointer inUserData,
+															GDestroyNotify inUserDataDestroyCallback)
+{
+	XfdashboardModelIndex			*index;
+
+	g_return_val_if_fail(inName && *inName, NULL);
+	g_return_val_if_fail(inIndexCallback, NULL);
+
+	/* Create index */
+	index=g_new0(XfdashboardModelIndex, 1);
+	index->name=g_strdup(inName);
+	index->indexCallback=inIndexCallback;
+	index->indexUserData=inUserData;
+	index->indexUserDataDestroyCallback=inUserDataDestroyCallback;
+	index->rowsByKey=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, (GDestroyNotify)g_hash_table_destroy);
+	index->keysByRow=g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+
+	/* Return new index */
+	return(index);
+}
+
+/* Free a secondary index */
+static void _xfdashboard_model_index_free(XfdashboardModelIndex *inIndex)
+{
+	if(inIndex)
+	{
+		/* Release allocated resources in index */
+		if(inIndex->indexUserData &&
+			inIndex->indexUserDataDestroyCallback)
+		{
+			(inIndex->indexUserDataDestroyCallback)(inIndex->indexUserData);
+		}
+
+		if(inIndex->rowsByKey) g_hash_table_destroy(inIndex->rowsByKey);
+		if(inIndex->keysByRow) g_hash_table_destroy(inIndex->keysByRow);
+		if(inIndex->name) g_free(inIndex->name);
+
+		/* Free index */
+		g_free(inIndex);
+	}
+}
+
+/* Add row at iterator to secondary index */
+static void _xfdashboard_model_index_add_row(XfdashboardModelIndex *inIndex,
+												XfdashboardModelIter *inIter)
+{
+	const gchar						*key;
+	GHashTable						*rows;
+
+	g_return_if_fail(inIndex);
+	g_return_if_fail(XFDASHBOARD_IS_MODEL_ITER(inIter));
+
+	/* Get key of row. Rows without a key are not indexed. */
+	key=(inIndex->indexCallback)(inIter, inIndex->indexUserData);
+	if(!key) return;
+
+	/* Add row to rows having this key */
+	rows=(GHashTable*)g_hash_table_lookup(inIndex->rowsByKey, key);
+	if(!rows)
+	{
+		rows=g_hash_table_new(g_direct_hash, g_direct_equal);
+		g_hash_table_insert(inIndex->rowsByKey, g_strdup(key), rows);
+	}
+	g_hash_table_add(rows, inIter->priv->iter);
+
+	/* Remember key of row to remove it from index later */
+	g_hash_table_insert(inIndex->keysByRow, inIter->priv->iter, g_strdup(key));
+}
+
+/* Remove row at sequence iterator from secondary index */
+static void _xfdashboard_model_index_remove_row(XfdashboardModelIndex *inIndex,
+												GSequenceIter *inSeqIter)
+{
+	const gchar						*key;
+	GHashTable						*rows;
+
+	g_return_if_fail(inIndex);
+	g_return_if_fail(inSeqIter);
+
+	/* Get key of row. If it has no key it was not indexed. */
+	key=(const gchar*)g_hash_table_lookup(inIndex->keysByRow, inSeqIter);
+	if(!key) return;
+
+	/* Remove row from rows having this key and also the key
+	 * if no more rows have this key.
+	 */
+	rows=(GHashTable*)g_hash_table_lookup(inIndex->rowsByKey, key);
+	if(rows)
+	{
+		g_hash_table_remove(rows, inSeqIter);
+		if(g_hash_table_size(rows)==0) g_hash_table_remove(inIndex->rowsByKey, key);
+	}
+
+	g_hash_table_remove(inIndex->keysByRow, inSeqIter);
+}
+
+/* Internal filter function used when filtering by a key of a secondary index */
+static gboolean _xfdashboard_model_filter_by_index(XfdashboardModelIter *inIter,
+													gpointer inUserData)
+{
+	XfdashboardModelPrivate			*modelPriv;
+	const gchar						*key;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_MODEL_ITER(inIter), FALSE);
+
+	modelPriv=inIter->priv->model->priv;
+	g_return_val_if_fail(modelPriv->filterIndex, FALSE);
+
+	/* Row is visible if its key at index matches the requested one */
+	key=(const gchar*)g_hash_table_lookup(modelPriv->filterIndex->keysByRow, inIter->priv->iter);
+	return(g_strcmp0(key, modelPriv->filterIndexKey)==0);
+}
+
+/* Add row at iterator to all secondary indexes and to the cached filter result */
+static void _xfdashboard_model_track_row(XfdashboardModel *self,
+											XfdashboardModelIter *inIter)
+{
+	XfdashboardModelPrivate			*priv;
+	GHashTableIter					hashIter;
+	XfdashboardModelIndex			*index;
+
+	g_return_if_fail(XFDASHBOARD_IS_MODEL(self));
+	g_return_if_fail(XFDASHBOARD_IS_MODEL_ITER(inIter));
+
+	priv=self->priv;
+
+	/* Add row to indexes first as filter function may use them */
+	g_hash_table_iter_init(&hashIter, priv->indexes);
+	while(g_hash_table_iter_next(&hashIter, NULL, (gpointer*)&index))
+	{
+		_xfdashboard_model_index_add_row(index, inIter);
+	}
+
+	/* Filter row and remember it if it is visible */
+	if(priv->filterVisibleRows &&
+		(priv->filterCallback)(inIter, priv->filterUserData))
+	{
+		g_hash_table_add(priv->filterVisibleRows, inIter->priv->iter);
+	}
+}
+
+/* Remove row at sequence iterator from all secondary indexes and from the
+ * cached filter result
+ */
+static void _xfdashboard_model_untrack_row(XfdashboardModel *self,
+											GSequenceIter *inSeqIter)
+{
+	XfdashboardModelPrivate			*priv;
+	GHashTableIter					hashIter;
+	XfdashboardModelIndex			*index;
+
+	g_return_if_fail(XFDASHBOARD_IS_MODEL(self));
+	g_return_if_fail(inSeqIter);
+
+	priv=self->priv;
+
+	g_hash_table_iter_init(&hashIter, priv->indexes);
+	while(g_hash_table_iter_next(&hashIter, NULL, (gpointer*)&index))
+	{
+		_xfdashboard_model_index_remove_row(index, inSeqIter);
+	}
+
+	if(priv->filterVisibleRows) g_hash_table_remove(priv->filterVisibleRows, inSeqIter);
+}
+
+/* Sort function to order iterators by the rows they point to */
+static gint _xfdashboard_model_sort_iters_by_row(gconstpointer inLeft, gconstpointer inRight)
+{
+	XfdashboardModelIter			*left;
+	XfdashboardModelIter			*right;
+
+	left=*((XfdashboardModelIter**)inLeft);
+	right=*((XfdashboardModelIter**)inRight);
+
+	return(g_sequence_iter_compare(left->priv->iter, right->priv->iter));
+}
+
+/* Filter all rows again and update cached filter result. Signal "filter-changed-rows"
+ * is emitted with the rows which became visible or hidden. If filter is set
+ * by a secondary index only the rows at index are looked up and the filter
+ * function is not called for each row.
+ */
+static void _xfdashboard_model_update_filter(XfdashboardModel *self)
+{
+	XfdashboardModelPrivate			*priv;
+	GHashTable						*oldVisibleRows;
+	GHashTable						*newVisibleRows;
+	GPtrArray						*shownRows;
+	GPtrArray						*hiddenRows;
+	GSequenceIter					*seqIter;
+	GHashTableIter					hashIter;
+	XfdashboardModelIter			*iter;
+
+	g_return_if_fail(XFDASHBOARD_IS_MODEL(self));
+
+	priv=self->priv;
+
+	/* If model was not filtered and is still not filtered nothing changed */
+	oldVisibleRows=priv->filterVisibleRows;
+	if(!oldVisibleRows && !priv->filterCallback) return;
+
+	/* Determine visible rows with new filter */
+	newVisibleRows=NULL;
+	if(priv->filterIndex)
+	{
+		GHashTable					*indexRows;
+
+		newVisibleRows=g_hash_table_new(g_direct_hash, g_direct_equal);
+
+		indexRows=(GHashTable*)g_hash_table_lookup(priv->filterIndex->rowsByKey, priv->filterIndexKey);
+		if(indexRows)
+		{
+			g_hash_table_iter_init(&hashIter, indexRows);
+			while(g_hash_table_iter_next(&hashIter, (gpointer*)&seqIter, NULL))
+			{
+				g_hash_table_add(newVisibleRows, seqIter);
+			}
+		}
+	}
+		else if(priv->filterCallback)
+		{
+			newVisibleRows=g_hash_table_new(g_direct_hash, g_direct_equal);
+
+			iter=xfdashboard_model_iter_new(self);
+			for(seqIter=g_sequence_get_begin_iter(priv->data);
+				!g_sequence_iter_is_end(seqIter);
+				seqIter=g_sequence_iter_next(seqIter))
+			{
+				iter->priv->iter=seqIter;
+				if((priv->filterCallback)(iter, priv->filterUserData)) g_hash_table_add(newVisibleRows, seqIter);
+			}
+			g_object_unref(iter);
+		}
+
+	/* Determine rows which became visible or hidden. If model was or is not
+	 * filtered all rows need to be checked, otherwise only the visible ones.
+	 */
+	shownRows=g_ptr_array_new_with_free_func(g_object_unref);
+	hiddenRows=g_ptr_array_new_with_free_func(g_object_unref);
+
+	if(!oldVisibleRows || !newVisibleRows)
+	{
+		for(seqIter=g_sequence_get_begin_iter(priv->data);
+			!g_sequence_iter_is_end(seqIter);
+			seqIter=g_sequence_iter_next(seqIter))
+		{
+			gboolean				wasVisible;
+			gboolean				isVisible;
+
+			wasVisible=(!oldVisibleRows || g_hash_table_contains(oldVisibleRows, seqIter));
+			isVisible=(!newVisibleRows || g_hash_table_contains(newVisibleRows, seqIter));
+			if(wasVisible==isVisible) continue;
+
+			iter=xfdashboard_model_iter_new(self);
+			iter->priv->iter=seqIter;
+			if(isVisible) g_ptr_array_add(shownRows, iter);
+				else g_ptr_array_add(hiddenRows, iter);
+		}
+	}
+		else
+		{
+			g_hash_table_iter_init(&hashIter, newVisibleRows);
+			while(g_hash_table_iter_next(&hashIter, (gpointer*)&seqIter, NULL))
+			{
+				if(g_hash_table_contains(oldVisibleRows, seqIter)) continue;
+
+				iter=xfdashboard_model_iter_new(self);
+				iter->priv->iter=seqIter;
+				g_ptr_array_add(shownRows, iter);
+			}
+
+			g_hash_table_iter_init(&hashIter, oldVisibleRows);
+			while(g_hash_table_iter_next(&hashIter, (gpointer*)&seqIter, NULL))
+			{
+				if(g_hash_table_contains(newVisibleRows, seqIter)) continue;
+
+				iter=xfdashboard_model_iter_new(self);
+				iter->priv->iter=seqIter;
+				g_ptr_array_add(hiddenRows, iter);
+			}
+
+			g_ptr_array_sort(shownRows, _xfdashboard_model_sort_iters_by_row);
+			g_ptr_array_sort(hiddenRows, _xfdashboard_model_sort_iters_by_row);
+		}
+
+	/* Set new cached filter result */
+	priv->filterVisibleRows=newVisibleRows;
+	if(oldVisibleRows) g_hash_table_destroy(oldVisibleRows);
+
+	/* Emit signal if any row became visible or hidden */
+	if(shownRows->len>0 || hiddenRows->len>0)
+	{
+		g_signal_emit(self, XfdashboardModelSignals[SIGNAL_FILTER_CHANGED_ROWS], 0, shownRows, hiddenRows);
+	}
+
+	/* Release allocated resources */
+	g_ptr_array_unref(shownRows);
+	g_ptr_array_unref(hiddenRows);
+}
+
+/* Release filter function or secondary index currently used for filtering */
+static void _xfdashboard_model_release_filter(XfdashboardModel *self)
+{
+	XfdashboardModelPrivate			*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_MODEL(self));
+
+	priv=self->priv;
+
+	if(priv->filterUserData &&
+		priv->filterUserDataDestroyCallback)
+	{
+		(priv->filterUserDataDestroyCallback)(priv->filterUserData);
+	}
+	priv->filterUserDataDestroyCallback=NULL;
+	priv->filterUserData=NULL;
+	priv->filterCallback=NULL;
+
+	if(priv->filterIndexKey)
+	{
+		g_free(priv->filterIndexKey);
+		priv->filterIndexKey=NULL;
+	}
+	priv->filterIndex=NULL;
+}
+
 /* IMPLEMENTATION: GObject */
 
 /* Dispose this object of type XfdashboardModel */
@@ -197,14 +556,19 @@ static void _xfdashboard_model_dispose(GObject *inObject)
 	priv->sortUserData=NULL;
 	priv->sortCallback=NULL;
 
-	if(priv->filterUserData &&
-		priv->filterUserDataDestroyCallback)
+	_xfdashboard_model_release_filter(self);
+
+	if(priv->filterVisibleRows)
 	{
-		(priv->filterUserDataDestroyCallback)(priv->filterUserData);
+		g_hash_table_destroy(priv->filterVisibleRows);
+		priv->filterVisibleRows=NULL;
+	}
+
+	if(priv->indexes)
+	{
+		g_hash_table_destroy(priv->indexes);
+		priv->indexes=NULL;
 	}
-	priv->filterUserDataDestroyCallback=NULL;
-	priv->filterUserData=NULL;
-	priv->filterCallback=NULL;
 
 	if(priv->data)
 	{
@@ -345,6 +709,32 @@ static void xfdashboard_model_class_init(XfdashboardModelClass *klass)
 						1,
 						XFDASHBOARD_TYPE_MODEL_ITER);
 
+	XfdashboardModelSignals[SIGNAL_ROWS_ADDED]=
+		g_signal_new("rows-added",
+						G_TYPE_FROM_CLASS(klass),
+						G_SIGNAL_RUN_LAST,
+						G_STRUCT_OFFSET(XfdashboardModelClass, rows_added),
+						NULL,
+						NULL,
+						_xfdashboard_marshal_VOID__INT_INT,
+						G_TYPE_NONE,
+						2,
+						G_TYPE_INT,
+						G_TYPE_INT);
+
+	XfdashboardModelSignals[SIGNAL_ROWS_REMOVED]=
+		g_signal_new("rows-removed",
+						G_TYPE_FROM_CLASS(klass),
+						G_SIGNAL_RUN_LAST,
+						G_STRUCT_OFFSET(XfdashboardModelClass, rows_removed),
+						NULL,
+						NULL,
+						_xfdashboard_marshal_VOID__INT_INT,
+						G_TYPE_NONE,
+						2,
+						G_TYPE_INT,
+						G_TYPE_INT);
+
 	XfdashboardModelSignals[SIGNAL_SORT_CHANGED]=
 		g_signal_new("sort-changed",
 						G_TYPE_FROM_CLASS(klass),
@@ -366,6 +756,19 @@ static void xfdashboard_model_class_init(XfdashboardModelClass *klass)
 						g_cclosure_marshal_VOID__VOID,
 						G_TYPE_NONE,
 						0);
+
+	XfdashboardModelSignals[SIGNAL_FILTER_CHANGED_ROWS]=
+		g_signal_new("filter-changed-rows",
+						G_TYPE_FROM_CLASS(klass),
+						G_SIGNAL_RUN_LAST,
+						G_STRUCT_OFFSET(XfdashboardModelClass, filter_changed_rows),
+						NULL,
+						NULL,
+						_xfdashboard_marshal_VOID__BOXED_BOXED,
+						G_TYPE_NONE,
+						2,
+						G_TYPE_PTR_ARRAY,
+						G_TYPE_PTR_ARRAY);
 }
 
 /* Object initialization of type XfdashboardModel
@@ -388,6 +791,11 @@ static void xfdashboard_model_init(XfdashboardModel *self)
 	priv->filterCallback=NULL;
 	priv->filterUserData=NULL;
 	priv->filterUserDataDestroyCallback=NULL;
+	priv->filterIndex=NULL;
+	priv->filterIndexKey=NULL;
+	priv->filterVisibleRows=NULL;
+
+	priv->indexes=g_hash_table_new_full(g_str_hash, g_str_equal, NULL, (GDestroyNotify)_xfdashboard_model_index_free);
 }
 
 /* Dispose this object of type XfdashboardModelIter */
@@ -503,6 +911,9 @@ gboolean xfdashboard_model_append(XfdashboardModel *self,
 	iter=xfdashboard_model_iter_new(self);
 	iter->priv->iter=seqIter;
 
+	/* Add row to indexes and filter it */
+	_xfdashboard_model_track_row(self, iter);
+
 	/* Emit signal */
 	g_signal_emit(self, XfdashboardModelSignals[SIGNAL_ROW_ADDED], 0, iter);
 
@@ -537,6 +948,9 @@ gboolean xfdashboard_model_prepend(XfdashboardModel *self,
 	iter=xfdashboard_model_iter_new(self);
 	iter->priv->iter=seqIter;
 
+	/* Add row to indexes and filter it */
+	_xfdashboard_model_track_row(self, iter);
+
 	/* Emit signal */
 	g_signal_emit(self, XfdashboardModelSignals[SIGNAL_ROW_ADDED], 0, iter);
 
@@ -579,6 +993,9 @@ gboolean xfdashboard_model_insert(XfdashboardModel *self,
 	iter=xfdashboard_model_iter_new(self);
 	iter->priv->iter=seqIter;
 
+	/* Add row to indexes and filter it */
+	_xfdashboard_model_track_row(self, iter);
+
 	/* Emit signal */
 	g_signal_emit(self, XfdashboardModelSignals[SIGNAL_ROW_ADDED], 0, iter);
 
@@ -610,6 +1027,9 @@ gboolean xfdashboard_model_set(XfdashboardModel *self,
 	/* Create sequence iterator to row which is set */
 	seqIter=g_sequence_get_iter_at_pos(priv->data, inRow);
 
+	/* Remove row from indexes as its data will change */
+	_xfdashboard_model_untrack_row(self, seqIter);
+
 	/* If a function is provided to free data on removal then call it now */
 	if(priv->freeDataCallback)
 	{
@@ -629,6 +1049,9 @@ gboolean xfdashboard_model_set(XfdashboardModel *self,
 	iter=xfdashboard_model_iter_new(self);
 	iter->priv->iter=seqIter;
 
+	/* Add row with new data to indexes and filter it again */
+	_xfdashboard_model_track_row(self, iter);
+
 	/* Emit signal */
 	g_signal_emit(self, XfdashboardModelSignals[SIGNAL_ROW_CHANGED], 0, iter);
 
@@ -666,6 +1089,9 @@ gboolean xfdashboard_model_remove(XfdashboardModel *self, gint inRow)
 	 */
 	g_signal_emit(self, XfdashboardModelSignals[SIGNAL_ROW_REMOVED], 0, iter);
 
+	/* Remove row from indexes */
+	_xfdashboard_model_untrack_row(self, seqIter);
+
 	/* If a function is provided to free data on removal then call it now */
 	if(priv->freeDataCallback)
 	{
@@ -710,11 +1136,16 @@ void xfdashboard_model_remove_all(XfdashboardModel *self)
 	 */
 	while(!g_sequence_iter_is_end(iter->priv->iter))
 	{
+		GSequenceIter				*seqIter;
+
 		/* Emit signal before removal to give signal handlers a changed
 		 * to access the data at iterator a last time.
 		 */
 		g_signal_emit(self, XfdashboardModelSignals[SIGNAL_ROW_REMOVED], 0, iter);
 
+		/* Remove row from indexes */
+		_xfdashboard_model_untrack_row(self, iter->priv->iter);
+
 		/* If a function is provided to free data on removal then call it now */
 		if(priv->freeDataCallback)
 		{
@@ -727,15 +1158,123 @@ void xfdashboard_model_remove_all(XfdashboardModel *self)
 			(priv->freeDataCallback)(oldData);
 		}
 
+		/* Move iterator to next item in model's data before removing data
+		 * as the sequence iterator is not valid anymore after removal.
+		 */
+		seqIter=iter->priv->iter;
+		iter->priv->iter=g_sequence_iter_next(seqIter);
+
 		/* Remove data from model's data */
-		g_sequence_remove(iter->priv->iter);
+		g_sequence_remove(seqIter);
+	}
+
+	/* Release allocated resources */
+	if(iter) g_object_unref(iter);
+}
+
+/* Insert many items at once at requested row (i.e. before the item at
+ * requested row) or at end of model's data if requested row is the number
+ * of rows in model. Only one signal "rows-added" is emitted for all items
+ * inserted instead of signal "row-added" for each item.
+ */
+gboolean xfdashboard_model_insert_many(XfdashboardModel *self,
+										gint inRow,
+										GPtrArray *inData)
+{
+	XfdashboardModelPrivate			*priv;
+	XfdashboardModelIter			*iter;
+	GSequenceIter					*insertIter;
+	guint							i;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_MODEL(self), FALSE);
+	g_return_val_if_fail(inRow>=0 && inRow<=xfdashboard_model_get_rows_count(self), FALSE);
+	g_return_val_if_fail(inData, FALSE);
+
+	priv=self->priv;
+
+	/* If there is nothing to insert return immediately */
+	if(inData->len==0) return(TRUE);
+
+	/* Create sequence iterator where to insert new data at */
+	insertIter=g_sequence_get_iter_at_pos(priv->data, inRow);
+
+	/* Insert all data before "insert iterator" in the order given */
+	iter=xfdashboard_model_iter_new(self);
+	for(i=0; i<inData->len; i++)
+	{
+		iter->priv->iter=g_sequence_insert_before(insertIter, g_ptr_array_index(inData, i));
 
-		/* Move iterator to next item in model's data */
-		iter->priv->iter=g_sequence_iter_next(iter->priv->iter);
+		/* Add row to indexes and filter it */
+		_xfdashboard_model_track_row(self, iter);
 	}
 
+	/* Emit signal */
+	g_signal_emit(self, XfdashboardModelSignals[SIGNAL_ROWS_ADDED], 0, inRow, (gint)inData->len);
+
 	/* Release allocated resources */
 	if(iter) g_object_unref(iter);
+
+	/* Return TRUE for success */
+	return(TRUE);
+}
+
+/* Add many items at once to end of model's data */
+gboolean xfdashboard_model_append_many(XfdashboardModel *self, GPtrArray *inData)
+{
+	g_return_val_if_fail(XFDASHBOARD_IS_MODEL(self), FALSE);
+	g_return_val_if_fail(inData, FALSE);
+
+	return(xfdashboard_model_insert_many(self, xfdashboard_model_get_rows_count(self), inData));
+}
+
+/* Remove many rows at once beginning at requested row. Only one signal
+ * "rows-removed" is emitted for all rows removed instead of signal
+ * "row-removed" for each row.
+ */
+gboolean xfdashboard_model_remove_many(XfdashboardModel *self,
+										gint inRow,
+										gint inCount)
+{
+	XfdashboardModelPrivate			*priv;
+	GSequenceIter					*seqIter;
+	GSequenceIter					*endIter;
+	GSequenceIter					*nextIter;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_MODEL(self), FALSE);
+	g_return_val_if_fail(_xfdashboard_model_is_valid_row(self, inRow), FALSE);
+	g_return_val_if_fail(inCount>0 && inRow+inCount<=xfdashboard_model_get_rows_count(self), FALSE);
+
+	priv=self->priv;
+
+	/* Emit signal before removal to give signal handlers a changed
+	 * to access the data at these rows a last time.
+	 */
+	g_signal_emit(self, XfdashboardModelSignals[SIGNAL_ROWS_REMOVED], 0, inRow, inCount);
+
+	/* Remove all rows in requested range */
+	seqIter=g_sequence_get_iter_at_pos(priv->data, inRow);
+	endIter=g_sequence_get_iter_at_pos(priv->data, inRow+inCount);
+	while(seqIter!=endIter)
+	{
+		nextIter=g_sequence_iter_next(seqIter);
+
+		/* Remove row from indexes */
+		_xfdashboard_model_untrack_row(self, seqIter);
+
+		/* If a function is provided to free data on removal then call it now */
+		if(priv->freeDataCallback)
+		{
+			(priv->freeDataCallback)(g_sequence_get(seqIter));
+		}
+
+		/* Remove data from model's data */
+		g_sequence_remove(seqIter);
+
+		seqIter=nextIter;
+	}
+
+	/* Return TRUE for success */
+	return(TRUE);
 }
 
 /* Iterate through all items in model's data and call user supplied callback
@@ -923,20 +1462,16 @@ void xfdashboard_model_set_filter(XfdashboardModel *self,
 		oldFilterIsSet=xfdashboard_model_is_filtered(self);
 
 		/* Release old values */
-		if(priv->filterUserData &&
-			priv->filterUserDataDestroyCallback)
-		{
-			(priv->filterUserDataDestroyCallback)(priv->filterUserData);
-		}
-		priv->filterUserDataDestroyCallback=NULL;
-		priv->filterUserData=NULL;
-		priv->filterCallback=NULL;
+		_xfdashboard_model_release_filter(self);
 
 		/* Set value */
 		priv->filterCallback=inFilterCallback;
 		priv->filterUserData=inUserData;
 		priv->filterUserDataDestroyCallback=inUserDataDestroyCallback;
 
+		/* Filter all rows with new filter function */
+		_xfdashboard_model_update_filter(self);
+
 		/* Get new "sort-set" value to determine if this property has
 		 * changed also.
 		 */
@@ -955,11 +1490,82 @@ void xfdashboard_model_set_filter(XfdashboardModel *self,
 	}
 }
 
+/* Set filter to show only rows having requested key at secondary index */
+void xfdashboard_model_set_filter_by_index(XfdashboardModel *self,
+											const gchar *inIndexName,
+											const gchar *inKey)
+{
+	XfdashboardModelPrivate			*priv;
+	XfdashboardModelIndex			*index;
+
+	g_return_if_fail(XFDASHBOARD_IS_MODEL(self));
+	g_return_if_fail(inIndexName && *inIndexName);
+	g_return_if_fail(inKey);
+
+	priv=self->priv;
+
+	/* Lookup index */
+	index=(XfdashboardModelIndex*)g_hash_table_lookup(priv->indexes, inIndexName);
+	if(!index)
+	{
+		g_warning("Cannot filter model by unknown index '%s'", inIndexName);
+		return;
+	}
+
+	/* Set value if changed */
+	if(priv->filterIndex!=index ||
+		g_strcmp0(priv->filterIndexKey, inKey)!=0)
+	{
+		gboolean				oldFilterIsSet;
+
+		/* Get old "filter-set" value. It is used later to determine if this
+		 * property has changed also.
+		 */
+		oldFilterIsSet=xfdashboard_model_is_filtered(self);
+
+		/* Release old values */
+		_xfdashboard_model_release_filter(self);
+
+		/* Set value */
+		priv->filterCallback=_xfdashboard_model_filter_by_index;
+		priv->filterIndex=index;
+		priv->filterIndexKey=g_strdup(inKey);
+
+		/* Filter all rows by looking up rows at index */
+		_xfdashboard_model_update_filter(self);
+
+		/* Notify about change of 'filter-set' if changed */
+		if(!oldFilterIsSet)
+		{
+			g_object_notify_by_pspec(G_OBJECT(self), XfdashboardModelProperties[PROP_FILTER_SET]);
+		}
+
+		/* Emit signal that filter has changed */
+		g_signal_emit(self, XfdashboardModelSignals[SIGNAL_FILTER_CHANGED], 0);
+	}
+}
+
+/* Filter all rows again, e.g. if filter function depends on data outside of
+ * model which has changed
+ */
+void xfdashboard_model_refilter(XfdashboardModel *self)
+{
+	g_return_if_fail(XFDASHBOARD_IS_MODEL(self));
+
+	/* If no filter is set there is nothing to do */
+	if(!xfdashboard_model_is_filtered(self)) return;
+
+	/* Filter all rows again */
+	_xfdashboard_model_update_filter(self);
+
+	/* Emit signal that filter has changed */
+	g_signal_emit(self, XfdashboardModelSignals[SIGNAL_FILTER_CHANGED], 0);
+}
+
 /* Check if requested row is filtered */
 gboolean xfdashboard_model_filter_row(XfdashboardModel *self, gint inRow)
 {
 	XfdashboardModelPrivate			*priv;
-	XfdashboardModelIter			*iter;
 	gboolean						isVisible;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_MODEL(self), FALSE);
@@ -968,25 +1574,127 @@ gboolean xfdashboard_model_filter_row(XfdashboardModel *self, gint inRow)
 	priv=self->priv;
 	isVisible=TRUE;
 
-	/* Call user supplied filter callback function to determine if this
-	 * row should be filtered or not but only if filter function is set.
-	 */
-	if(priv->filterCallback)
+	/* Lookup row at cached filter result but only if filter is set */
+	if(priv->filterVisibleRows)
 	{
-		/* Create iterator */
-		iter=xfdashboard_model_iter_new_for_row(self, inRow);
-
-		/* Determine if row is filtered */
-		isVisible=(priv->filterCallback)(iter, priv->filterUserData);
-
-		/* Release allocated resources */
-		if(iter) g_object_unref(iter);
+		isVisible=g_hash_table_contains(priv->filterVisibleRows, g_sequence_get_iter_at_pos(priv->data, inRow));
 	}
 
 	/* Return filter status */
 	return(isVisible);
 }
 
+/* Get number of rows not filtered */
+gint xfdashboard_model_get_filtered_rows_count(XfdashboardModel *self)
+{
+	XfdashboardModelPrivate			*priv;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_MODEL(self), 0);
+
+	priv=self->priv;
+
+	/* If a filter is set return number of visible rows ... */
+	if(priv->filterVisibleRows) return(g_hash_table_size(priv->filterVisibleRows));
+
+	/* ... otherwise all rows are visible */
+	return(xfdashboard_model_get_rows_count(self));
+}
+
+/* Model secondary index functions */
+gboolean xfdashboard_model_add_index(XfdashboardModel *self,
+										const gchar *inName,
+										XfdashboardModelIndexFunc inIndexCallback,
+										gpointer inUserData,
+										GDestroyNotify inUserDataDestroyCallback)
+{
+	XfdashboardModelPrivate			*priv;
+	XfdashboardModelIndex			*index;
+	XfdashboardModelIter			*iter;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_MODEL(self), FALSE);
+	g_return_val_if_fail(inName && *inName, FALSE);
+	g_return_val_if_fail(inIndexCallback, FALSE);
+
+	priv=self->priv;
+
+	/* Check that index does not exist already */
+	if(g_hash_table_contains(priv->indexes, inName))
+	{
+		g_warning("Index '%s' exists already at model", inName);
+		return(FALSE);
+	}
+
+	/* Create index and add all existing rows to it */
+	index=_xfdashboard_model_index_new(inName, inIndexCallback, inUserData, inUserDataDestroyCallback);
+
+	iter=xfdashboard_model_iter_new(self);
+	while(xfdashboard_model_iter_next(iter))
+	{
+		_xfdashboard_model_index_add_row(index, iter);
+	}
+	g_object_unref(iter);
+
+	g_hash_table_insert(priv->indexes, index->name, index);
+
+	/* Return TRUE for success */
+	return(TRUE);
+}
+
+gboolean xfdashboard_model_remove_index(XfdashboardModel *self, const gchar *inName)
+{
+	XfdashboardModelPrivate			*priv;
+	XfdashboardModelIndex			*index;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_MODEL(self), FALSE);
+	g_return_val_if_fail(inName && *inName, FALSE);
+
+	priv=self->priv;
+
+	/* Lookup index */
+	index=(XfdashboardModelIndex*)g_hash_table_lookup(priv->indexes, inName);
+	if(!index) return(FALSE);
+
+	/* If model is filtered by this index unset filter */
+	if(priv->filterIndex==index) xfdashboard_model_set_filter(self, NULL, NULL, NULL);
+
+	/* Remove and free index */
+	g_hash_table_remove(priv->indexes, inName);
+
+	/* Return TRUE for success */
+	return(TRUE);
+}
+
+gboolean xfdashboard_model_has_index(XfdashboardModel *self, const gchar *inName)
+{
+	g_return_val_if_fail(XFDASHBOARD_IS_MODEL(self), FALSE);
+	g_return_val_if_fail(inName && *inName, FALSE);
+
+	return(g_hash_table_contains(self->priv->indexes, inName));
+}
+
+/* Get number of rows having requested key at secondary index */
+gint xfdashboard_model_get_index_rows_count(XfdashboardModel *self,
+											const gchar *inName,
+											const gchar *inKey)
+{
+	XfdashboardModelIndex			*index;
+	GHashTable						*rows;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_MODEL(self), 0);
+	g_return_val_if_fail(inName && *inName, 0);
+	g_return_val_if_fail(inKey, 0);
+
+	/* Lookup index */
+	index=(XfdashboardModelIndex*)g_hash_table_lookup(self->priv->indexes, inName);
+	if(!index) return(0);
+
+	/* Lookup rows having requested key */
+	rows=(GHashTable*)g_hash_table_lookup(index->rowsByKey, inKey);
+	if(!rows) return(0);
+
+	return(g_hash_table_size(rows));
+}
+
 /* Create iterator for model */
 XfdashboardModelIter* xfdashboard_model_iter_new(XfdashboardModel *inModel)
 {
@@ -1205,6 +1913,9 @@ gboolean xfdashboard_model_iter_set(XfdashboardModelIter *self, gpointer inData)
 	priv=self->priv;
 	modelPriv=priv->model->priv;
 
+	/* Remove row from indexes as its data will change */
+	_xfdashboard_model_untrack_row(priv->model, priv->iter);
+
 	/* If a function at model is provided to free data on removal
 	 * then call it now.
 	 */
@@ -1222,8 +1933,11 @@ gboolean xfdashboard_model_iter_set(XfdashboardModelIter *self, gpointer inData)
 	/* Set new data at iterator */
 	g_sequence_set(priv->iter, inData);
 
+	/* Add row with new data to indexes and filter it again */
+	_xfdashboard_model_track_row(priv->model, self);
+
 	/* Emit signal */
-	g_signal_emit(self, XfdashboardModelSignals[SIGNAL_ROW_CHANGED], 0, self);
+	g_signal_emit(priv->model, XfdashboardModelSignals[SIGNAL_ROW_CHANGED], 0, self);
 
 	/* Return TRUE for success */
 	return(TRUE);
@@ -1243,7 +1957,10 @@ gboolean xfdashboard_model_iter_remove(XfdashboardModelIter *self)
 	/* Emit signal before removal to give signal handlers a changed
 	 * to access the data at iterator a last time.
 	 */
-	g_signal_emit(self, XfdashboardModelSignals[SIGNAL_ROW_REMOVED], 0, self);
+	g_signal_emit(priv->model, XfdashboardModelSignals[SIGNAL_ROW_REMOVED], 0, self);
+
+	/* Remove row from indexes */
+	_xfdashboard_model_untrack_row(priv->model, priv->iter);
 
 	/* If a function at model is provided to free data on removal
 	 * then call it now.
@@ -1279,13 +1996,10 @@ gboolean xfdashboard_model_iter_filter(XfdashboardModelIter *self)
 	modelPriv=priv->model->priv;
 	isVisible=TRUE;
 
-	/* Call user supplied filter callback function to determine if this
-	 * row should be filtered or not but only if filter function is set.
-	 */
-	if(modelPriv->filterCallback)
+	/* Lookup row at cached filter result but only if filter is set */
+	if(modelPriv->filterVisibleRows)
 	{
-		/* Determine if row is filtered */
-		isVisible=(modelPriv->filterCallback)(self, modelPriv->filterUserData);
+		isVisible=g_hash_table_contains(modelPriv->filterVisibleRows, priv->iter);
 	}
 
 	/* Return filter status */
@@ -104,6 +104,16 @@ struct _XfdashboardModelClass
 	void (*sort_changed)(XfdashboardModel *self);
 
 	void (*filter_changed)(XfdashboardModel *self);
+
+	void (*filter_changed_rows)(XfdashboardModel *self,
+								GPtrArray *inShownRows,
+								GPtrArray *inHiddenRows);
+	void (*rows_added)(XfdashboardModel *self,
+						gint inRow,
+						gint inCount);
+	void (*rows_removed)(XfdashboardModel *self,
+							gint inRow,
+							gint inCount);
 };
 
 
@@ -116,6 +126,8 @@ typedef gint (*XfdashboardModelSortFunc)(XfdashboardModelIter *inLeftIter,
 											gpointer inUserData);
 typedef gboolean (*XfdashboardModelFilterFunc)(XfdashboardModelIter *inIter,
 												gpointer inUserData);
+typedef const gchar* (*XfdashboardModelIndexFunc)(XfdashboardModelIter *inIter,
+													gpointer inUserData);
 
 GType xfdashboard_model_get_type(void) G_GNUC_CONST;
 GType xfdashboard_model_iter_get_type(void) G_GNUC_CONST;
@@ -148,6 +160,14 @@ gboolean xfdashboard_model_set(XfdashboardModel *self,
 gboolean xfdashboard_model_remove(XfdashboardModel *self, gint inRow);
 void xfdashboard_model_remove_all(XfdashboardModel *self);
 
+gboolean xfdashboard_model_insert_many(XfdashboardModel *self,
+										gint inRow,
+										GPtrArray *inData);
+gboolean xfdashboard_model_append_many(XfdashboardModel *self, GPtrArray *inData);
+gboolean xfdashboard_model_remove_many(XfdashboardModel *self,
+										gint inRow,
+										gint inCount);
+
 /* Model foreach functions */
 void xfdashboard_model_foreach(XfdashboardModel *self,
 								XfdashboardModelForeachFunc inForeachCallback,
@@ -167,7 +187,24 @@ void xfdashboard_model_set_filter(XfdashboardModel *self,
 									XfdashboardModelFilterFunc inFilterCallback,
 									gpointer inUserData,
 									GDestroyNotify inUserDataDestroyCallback);
+void xfdashboard_model_set_filter_by_index(XfdashboardModel *self,
+											const gchar *inIndexName,
+											const gchar *inKey);
+void xfdashboard_model_refilter(XfdashboardModel *self);
 gboolean xfdashboard_model_filter_row(XfdashboardModel *self, gint inRow);
+gint xfdashboard_model_get_filtered_rows_count(XfdashboardModel *self);
+
+/* Model secondary index functions */
+gboolean xfdashboard_model_add_index(XfdashboardModel *self,
+										const gchar *inName,
+										XfdashboardModelIndexFunc inIndexCallback,
+										gpointer inUserData,
+										GDestroyNotify inUserDataDestroyCallback);
+gboolean xfdashboard_model_remove_index(XfdashboardModel *self, const gchar *inName);
+gboolean xfdashboard_model_has_index(XfdashboardModel *self, const gchar *inName);
+gint xfdashboard_model_get_index_rows_count(XfdashboardModel *self,
+											const gchar *inName,
+											const gchar *inKey);
 
 
 /* Model iterator functions */
@@ -34,10 +34,15 @@
 #include <math.h>
 
 #include <libxfdashboard/enums.h>
+#include <libxfdashboard/gradient-pipeline.h>
+#include <libxfdashboard/statistics.h>
+#include <libxfdashboard/utils.h>
 #include <libxfdashboard/compat.h>
 
 
 /* Define this class in GObject system */
+typedef struct _XfdashboardOutlineEffectNineSlice		XfdashboardOutlineEffectNineSlice;
+
 struct _XfdashboardOutlineEffectPrivate
 {
 	/* Properties related */
@@ -50,6 +55,10 @@ struct _XfdashboardOutlineEffectPrivate
 	/* Instance related */
 	CoglPipeline				*pipeline;
 	CoglTexture					*texture;
+	XfdashboardOutlineEffectNineSlice	*nineSlice;
+	CoglPipeline				*shaderPipeline;
+	gfloat						shaderWidth;
+	gfloat						shaderHeight;
 	gint						drawLineWidth;
 	gfloat						drawRadius;
 };
@@ -76,7 +85,125 @@ static GParamSpec* XfdashboardOutlineEffectProperties[PROP_LAST]={ 0, };
 
 /* IMPLEMENTATION: Private variables and methods */
 
+struct _XfdashboardOutlineEffectNineSlice
+{
+	gchar						*key;
+	CoglTexture					*texture;
+	gint						sliceSize;
+	gint						refCount;
+};
+
 static CoglPipeline		*_xfdashboard_outline_effect_base_pipeline=NULL;
+static GHashTable		*_xfdashboard_outline_effect_nine_slices=NULL;
+
+static CoglTexture* _xfdashboard_outline_effect_create_texture(XfdashboardOutlineEffect *self,
+																gint inWidth,
+																gint inHeight);
+
+/* Get nine-slice texture for outline style of this effect from shared cache
+ * or create it if no other outline effect uses this style yet. Returns NULL
+ * if outline style cannot be stretched.
+ */
+static XfdashboardOutlineEffectNineSlice* _xfdashboard_outline_effect_nine_slice_acquire(XfdashboardOutlineEffect *self)
+{
+	XfdashboardOutlineEffectPrivate		*priv;
+	XfdashboardOutlineEffectNineSlice	*nineSlice;
+	gchar								*colorString;
+	gchar								*key;
+	gint								sliceSize;
+	CoglTexture							*texture;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_OUTLINE_EFFECT(self), NULL);
+
+	priv=self->priv;
+
+	/* Linear gradients span the whole outline and depend on its size so
+	 * they cannot be stretched.
+	 */
+	if(!priv->color ||
+		xfdashboard_gradient_color_get_gradient_type(priv->color)==XFDASHBOARD_GRADIENT_TYPE_LINEAR_GRADIENT)
+	{
+		return(NULL);
+	}
+
+	/* Build key of outline style from the values used when drawing outline */
+	priv->drawLineWidth=floor(priv->width+0.5f);
+	priv->drawRadius=MAX(priv->cornersRadius, priv->drawLineWidth);
+
+	colorString=xfdashboard_gradient_color_to_string(priv->color);
+	key=g_strdup_printf("%s|%d|%.3f|%u|%u",
+						colorString,
+						priv->drawLineWidth,
+						priv->drawRadius,
+						priv->borders,
+						priv->corners);
+	g_free(colorString);
+
+	/* Check if another outline effect has already drawn this outline style */
+	if(_xfdashboard_outline_effect_nine_slices)
+	{
+		nineSlice=(XfdashboardOutlineEffectNineSlice*)g_hash_table_lookup(_xfdashboard_outline_effect_nine_slices, key);
+		if(nineSlice)
+		{
+			xfdashboard_statistics_add("outline.nine-slice-hit", 1);
+
+			nineSlice->refCount++;
+			g_free(key);
+			return(nineSlice);
+		}
+	}
+
+	/* Draw outline once into a texture which is just large enough to hold
+	 * all corners and one pixel between them to stretch.
+	 */
+	xfdashboard_statistics_add("outline.nine-slice-miss", 1);
+
+	sliceSize=ceil(priv->drawRadius+priv->drawLineWidth)+1;
+	texture=_xfdashboard_outline_effect_create_texture(self, (2*sliceSize)+1, (2*sliceSize)+1);
+	if(!texture)
+	{
+		g_free(key);
+		return(NULL);
+	}
+
+	/* Store texture in shared cache */
+	nineSlice=g_new0(XfdashboardOutlineEffectNineSlice, 1);
+	nineSlice->key=key;
+	nineSlice->texture=texture;
+	nineSlice->sliceSize=sliceSize;
+	nineSlice->refCount=1;
+
+	if(!_xfdashboard_outline_effect_nine_slices)
+	{
+		_xfdashboard_outline_effect_nine_slices=g_hash_table_new(g_str_hash, g_str_equal);
+	}
+	g_hash_table_insert(_xfdashboard_outline_effect_nine_slices, nineSlice->key, nineSlice);
+
+	return(nineSlice);
+}
+
+/* Release nine-slice texture and remove it from shared cache if it is not
+ * used anymore.
+ */
+static void _xfdashboard_outline_effect_nine_slice_release(XfdashboardOutlineEffectNineSlice *inNineSlice)
+{
+	g_return_if_fail(inNineSlice);
+	g_return_if_fail(inNineSlice->refCount>0);
+
+	/* Decrease usage counter and return if still in use */
+	inNineSlice->refCount--;
+	if(inNineSlice->refCount>0) return;
+
+	/* Remove from shared cache and release allocated resources */
+	if(_xfdashboard_outline_effect_nine_slices)
+	{
+		g_hash_table_remove(_xfdashboard_outline_effect_nine_slices, inNineSlice->key);
+	}
+
+	cogl_object_unref(inNineSlice->texture);
+	g_free(inNineSlice->key);
+	g_free(inNineSlice);
+}
 
 /* Invalidate cached texture */
 static void _xfdashboard_outline_effect_invalidate(XfdashboardOutlineEffect *self)
@@ -93,6 +220,90 @@ static void _xfdashboard_outline_effect_invalidate(XfdashboardOutlineEffect *sel
 		cogl_object_unref(priv->texture);
 		priv->texture=NULL;
 	}
+
+	/* Release shared nine-slice texture */
+	if(priv->nineSlice)
+	{
+		_xfdashboard_outline_effect_nine_slice_release(priv->nineSlice);
+		priv->nineSlice=NULL;
+	}
+
+	/* Release shader pipeline */
+	if(priv->shaderPipeline)
+	{
+		cogl_object_unref(priv->shaderPipeline);
+		priv->shaderPipeline=NULL;
+	}
+}
+
+/* Create pipeline drawing outline by shader. Returns NULL if outline cannot
+ * be drawn by shader, e.g. if not all borders are drawn.
+ */
+static CoglPipeline* _xfdashboard_outline_effect_create_shader_pipeline(XfdashboardOutlineEffect *self,
+																		gfloat inWidth,
+																		gfloat inHeight)
+{
+	XfdashboardOutlineEffectPrivate		*priv;
+	XfdashboardGradientColor			*solidColor;
+	const XfdashboardGradientColor		*color;
+	gboolean							isPathGradient;
+	gfloat								radius;
+	CoglPipeline						*pipeline;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_OUTLINE_EFFECT(self), NULL);
+
+	priv=self->priv;
+	solidColor=NULL;
+
+	/* Shader only draws closed outlines */
+	if((priv->borders & XFDASHBOARD_BORDERS_ALL)!=XFDASHBOARD_BORDERS_ALL ||
+		!priv->color ||
+		!xfdashboard_gradient_pipeline_is_supported(priv->color))
+	{
+		return(NULL);
+	}
+
+	priv->drawLineWidth=floor(priv->width+0.5f);
+	priv->drawRadius=MAX(priv->cornersRadius, priv->drawLineWidth);
+	if(priv->drawLineWidth<1) return(NULL);
+
+	/* Path gradients of small line widths are drawn in the end color of
+	 * the path gradient like the cairo drawing function does.
+	 */
+	color=priv->color;
+	isPathGradient=(xfdashboard_gradient_color_get_gradient_type(priv->color)==XFDASHBOARD_GRADIENT_TYPE_PATH_GRADIENT);
+	if(isPathGradient && priv->drawLineWidth<2)
+	{
+		ClutterColor					lastColor;
+
+		xfdashboard_gradient_color_get_stop(priv->color,
+											xfdashboard_gradient_color_get_number_stops(priv->color)-1,
+											NULL,
+											&lastColor);
+		solidColor=xfdashboard_gradient_color_new_solid(&lastColor);
+		color=solidColor;
+		isPathGradient=FALSE;
+	}
+
+	/* The cairo drawing function strokes rounded corners around a center
+	 * inset by half of line width unless it draws a path gradient so
+	 * determine the radius at outer edge of outline the same way.
+	 */
+	if(isPathGradient) radius=priv->drawRadius;
+		else radius=priv->drawRadius+(priv->drawLineWidth/2.0f);
+
+	pipeline=xfdashboard_gradient_pipeline_new(color,
+												inWidth,
+												inHeight,
+												priv->corners,
+												radius,
+												priv->drawLineWidth);
+
+	/* Release allocated resources */
+	if(solidColor) xfdashboard_gradient_color_free(solidColor);
+
+	/* Return created pipeline */
+	return(pipeline);
 }
 
 /* Draw a single outline with current cairo context (line width, pattern etc.) */
@@ -352,106 +563,18 @@ static cairo_pattern_t* _xfdashboard_outline_effect_create_pattern(XfdashboardOu
 	/* Create linear gradient pattern if gradient is linear */
 	if(type==XFDASHBOARD_GRADIENT_TYPE_LINEAR_GRADIENT)
 	{
-		gdouble						width, height;
-		gdouble						midX, midY;
 		gdouble						startX, startY;
 		gdouble						endX, endY;
-		gdouble						angle;
-		gdouble						atanRectangle;
-		gdouble						tanAngle;
 		guint						i, stops;
 
-		/* Adjust angle to find region */
-		angle=(2*M_PI)-xfdashboard_gradient_color_get_angle(priv->color);
-		while(angle<-M_PI) angle+=(2*M_PI);
-		while(angle>M_PI) angle-=(2*M_PI);
-
-		/* I do not know why but exactly at radians of 0.0 and M_PI the
-		 * start and end points are mirrored so this is a dirty workaround
-		 * to swap angles. Maybe it is because tan(angle) resolves to -0.0
-		 * instead of 0.0. Looks like a sign error.
-		 */
-		if(angle==0.0) angle=M_PI;
-			else if(angle==M_PI) angle=0.0;
-
-		/* Get size of region */
-		width=inWidth;
-		height=inHeight;
-
-		/* Find region and calculates points */
-		atanRectangle=atan2(height, width);
-		tanAngle=tan(angle);
-
-		midX=(width/2.0);
-		midY=(height/2.0);
-
-		if(angle!=0.0 && (angle>-atanRectangle) && (angle<=atanRectangle))
-		{
-			/* Region 1 */
-			startX=midX+(width/2.0);
-			startY=midY-((width/2.0)*tanAngle);
-
-			endX=midX-(width/2.0);
-			endY=midY+((width/2.0)*tanAngle);
-		}
-			else if((angle>atanRectangle) && (angle<=(M_PI-atanRectangle)))
-			{
-				/* Region 2 */
-				startX=midX+(height/(2.0*tanAngle));
-				startY=midY-(height/2.0);
-
-				endX=midX-(height/(2.0*tanAngle));
-				endY=midY+(height/2.0);
-			}
-			else if(angle==0.0 || (angle>(M_PI-atanRectangle)) || (angle<=-(M_PI-atanRectangle)))
-			{
-				/* Region 3 */
-				startX=midX-(width/2.0);
-				startY=midY+((width/2.0)*tanAngle);
-
-				endX=midX+(width/2.0);
-				endY=midY-((width/2.0)*tanAngle);
-			}
-			else
-			{
-				/* Region 4 */
-				startX=midX-(height/(2.0*tanAngle));
-				startY=midY+(height/2.0);
-
-				endX=midX+(height/(2.0*tanAngle));
-				endY=midY-(height/2.0);
-			}
-
-		/* Reduce full length to requested length if gradient should be repeated */
-		if(xfdashboard_gradient_color_get_repeat(priv->color))
-		{
-			gdouble					vectorX, vectorY;
-			gdouble					distance;
-			gdouble					requestedLength;
-
-			/* Calculate distance between start and end point as this is the current
-			 * length of pattern.
-			 */
-			vectorX=endX-startX;
-			vectorY=endY-startY;
-			distance=sqrt((vectorX*vectorX) + (vectorY*vectorY));
-
-			/* Reduce distance by percentage or absolute length */
-			requestedLength=xfdashboard_gradient_color_get_length(priv->color);
-			if(requestedLength<0.0)
-			{
-				vectorX*=-requestedLength;
-				vectorY*=-requestedLength;
-			}
-				else
-				{
-					vectorX=(vectorX/distance)*requestedLength;
-					vectorY=(vectorY/distance)*requestedLength;
-				}
-
-			endX=startX+vectorX;
-			endY=startY+vectorY;
-		}
+		/* Calculate start and end point of gradient */
+		xfdashboard_gradient_color_get_linear_points(priv->color,
+														inWidth,
+														inHeight,
+														&startX,
+														&startY,
+														&endX,
+														&endY);
 
 		/* Create pattern based on calculated points */
 		pattern=cairo_pattern_create_linear(startX, startY, endX, endY);
@@ -691,6 +814,67 @@ static void _xfdashboard_outline_effect_paint(ClutterEffect *inEffect, ClutterEf
 		return;
 	}
 
+	framebuffer=cogl_get_draw_framebuffer();
+
+	/* Draw outline by shader if possible as it needs no texture at all.
+	 * The pipeline only needs to be created again if the size changed.
+	 */
+	if(priv->shaderPipeline &&
+		(priv->shaderWidth!=width || priv->shaderHeight!=height))
+	{
+		cogl_object_unref(priv->shaderPipeline);
+		priv->shaderPipeline=NULL;
+	}
+
+	if(!priv->shaderPipeline)
+	{
+		priv->shaderPipeline=_xfdashboard_outline_effect_create_shader_pipeline(self, width, height);
+		priv->shaderWidth=width;
+		priv->shaderHeight=height;
+	}
+
+	if(priv->shaderPipeline)
+	{
+		cogl_framebuffer_draw_textured_rectangle(framebuffer,
+													priv->shaderPipeline,
+													0, 0, width, height,
+													0.0f, 0.0f, 1.0f, 1.0f);
+		return;
+	}
+
+	/* Get nine-slice texture of outline style shared with all other outline
+	 * effects using the same style. If the actor is large enough to show its
+	 * corners unscaled stretch the slices to actor's size. So resizing the
+	 * actor does not need to draw the outline again.
+	 */
+	if(!priv->nineSlice) priv->nineSlice=_xfdashboard_outline_effect_nine_slice_acquire(self);
+
+	if(priv->nineSlice &&
+		width>=((2*priv->nineSlice->sliceSize)+1) &&
+		height>=((2*priv->nineSlice->sliceSize)+1))
+	{
+		gfloat							coordinates[XFDASHBOARD_NINE_SLICE_RECTANGLES*8];
+
+		/* Release texture drawn for a smaller size as it is not needed anymore */
+		if(priv->texture)
+		{
+			cogl_object_unref(priv->texture);
+			priv->texture=NULL;
+		}
+
+		/* Draw slices to stage in actor's space */
+		xfdashboard_get_nine_slice_rectangles(width, height, priv->nineSlice->sliceSize, coordinates);
+
+		cogl_pipeline_set_layer_texture(priv->pipeline,
+											0,
+											priv->nineSlice->texture);
+		cogl_framebuffer_draw_textured_rectangles(framebuffer,
+													priv->pipeline,
+													coordinates,
+													XFDASHBOARD_NINE_SLICE_RECTANGLES);
+		return;
+	}
+
 	/* Check if size has changed. If so, destroy texture to create a new one
 	 * matching the new size.
 	 */
@@ -699,7 +883,8 @@ static void _xfdashboard_outline_effect_paint(ClutterEffect *inEffect, ClutterEf
 		if(cogl_texture_get_width(priv->texture)!=width ||
 			cogl_texture_get_height(priv->texture)!=height)
 		{
-			_xfdashboard_outline_effect_invalidate(self);
+			cogl_object_unref(priv->texture);
+			priv->texture=NULL;
 		}
 	}
 
@@ -711,17 +896,12 @@ static void _xfdashboard_outline_effect_paint(ClutterEffect *inEffect, ClutterEf
 
 		/* If we still have no texture, do nothing and return */
 		if(!priv->texture) return;
-
-		/* We only need to set texture at pipeline once after the texture
-		 * was created.
-		 */
-		cogl_pipeline_set_layer_texture(priv->pipeline,
-											0,
-											priv->texture);
 	}
 
 	/* Draw texture to stage in actor's space */
-	framebuffer=cogl_get_draw_framebuffer();
+	cogl_pipeline_set_layer_texture(priv->pipeline,
+										0,
+										priv->texture);
 	cogl_framebuffer_draw_textured_rectangle(framebuffer,
 												priv->pipeline,
 												0, 0, width, height,
@@ -744,6 +924,18 @@ static void _xfdashboard_outline_effect_dispose(GObject *inObject)
 		priv->texture=NULL;
 	}
 
+	if(priv->nineSlice)
+	{
+		_xfdashboard_outline_effect_nine_slice_release(priv->nineSlice);
+		priv->nineSlice=NULL;
+	}
+
+	if(priv->shaderPipeline)
+	{
+		cogl_object_unref(priv->shaderPipeline);
+		priv->shaderPipeline=NULL;
+	}
+
 	if(priv->pipeline)
 	{
 		cogl_object_unref(priv->pipeline);
@@ -914,6 +1106,8 @@ static void xfdashboard_outline_effect_init(XfdashboardOutlineEffect *self)
 	priv->corners=XFDASHBOARD_CORNERS_ALL;
 	priv->cornersRadius=0.0f;
 	priv->texture=NULL;
+	priv->nineSlice=NULL;
+	priv->shaderPipeline=NULL;
 
 	/* Set up pipeline */
 	if(G_UNLIKELY(!_xfdashboard_outline_effect_base_pipeline))
@@ -0,0 +1,667 @@
+/*
+ * profiler: Records frame timings and exports them as trace
+ * 
+ * Copyright 2012-2021 Stephan Haller <nomad@froevel.de>
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ * 
+ * 
+ */
+
+/**
+ * SECTION:profiler
+ * @short_description: Frame timings with on-stage graph and trace export
+ * @include: xfdashboard/profiler.h
+ *
+ * The profiler records the time spent in style invalidation, layout, paint,
+ * window content updates, image loading and searching and assigns it to the
+ * frame being drawn next. The timings of the most recent frames are shown as
+ * stacked bars in a graph at the bottom left corner of the stage. Each bar is
+ * one frame and the colors of its segments are:
+ *
+ * - purple: style invalidation
+ * - blue: layout
+ * - green: paint
+ * - orange: window content updates
+ * - yellow: image loading
+ * - red: search
+ * - grey: any other time between start and end of frame
+ *
+ * The horizontal lines mark 16.7 and 33.3 milliseconds. The timings of the
+ * categories are not exclusive, e.g. an image loaded while painting counts
+ * for both, image loading and painting.
+ *
+ * Additionally all recorded timings are kept as trace events. When the core
+ * instance is destroyed they are written in Chrome's trace event format to
+ * the destination which can be loaded in chrome://tracing or any other
+ * compatible trace viewer for offline analysis.
+ *
+ * The profiler is disabled by default. It can be enabled by setting the
+ * environment variable `XFDASHBOARD_PROFILER` to the path of the trace file
+ * or to `stdout` or `stderr`, or by the command-line option `--profile`
+ * of the application.
+ *
+ * xfdashboard_profiler_begin() and xfdashboard_profiler_end() also add the
+ * measured time to the statistics (see xfdashboard_statistics_add()) under
+ * the name of the operation, so one pair of calls feeds both if enabled.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <libxfdashboard/profiler.h>
+
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <cogl/cogl.h>
+
+#include <libxfdashboard/statistics.h>
+
+
+/* IMPLEMENTATION: Private variables and methods */
+#define XFDASHBOARD_PROFILER_MAX_EVENTS				200000
+#define XFDASHBOARD_PROFILER_MAX_FRAMES				240
+
+#define XFDASHBOARD_PROFILER_OVERLAY_BAR_WIDTH		2.0f
+#define XFDASHBOARD_PROFILER_OVERLAY_PIXELS_PER_MS	4.0f
+#define XFDASHBOARD_PROFILER_OVERLAY_MAX_MS			50.0f
+#define XFDASHBOARD_PROFILER_OVERLAY_MARGIN			8.0f
+
+typedef enum
+{
+	XFDASHBOARD_PROFILER_CATEGORY_STYLE=0,
+	XFDASHBOARD_PROFILER_CATEGORY_LAYOUT,
+	XFDASHBOARD_PROFILER_CATEGORY_PAINT,
+	XFDASHBOARD_PROFILER_CATEGORY_WINDOW_CONTENT,
+	XFDASHBOARD_PROFILER_CATEGORY_IMAGE,
+	XFDASHBOARD_PROFILER_CATEGORY_SEARCH,
+
+	XFDASHBOARD_PROFILER_CATEGORY_LAST
+} XfdashboardProfilerCategory;
+
+typedef struct _XfdashboardProfilerCategoryInfo		XfdashboardProfilerCategoryInfo;
+struct _XfdashboardProfilerCategoryInfo
+{
+	const gchar		*name;
+	guint8			red, green, blue;
+};
+
+static const XfdashboardProfilerCategoryInfo _xfdashboard_profiler_categories[XFDASHBOARD_PROFILER_CATEGORY_LAST]=
+{
+	{ "style", 0xad, 0x7f, 0xa8 },
+	{ "layout", 0x34, 0x65, 0xa4 },
+	{ "paint", 0x73, 0xd2, 0x16 },
+	{ "window-content", 0xf5, 0x79, 0x00 },
+	{ "image", 0xed, 0xd4, 0x00 },
+	{ "search", 0xcc, 0x00, 0x00 }
+};
+
+typedef struct _XfdashboardProfilerEvent			XfdashboardProfilerEvent;
+struct _XfdashboardProfilerEvent
+{
+	const gchar		*category;
+	const gchar		*name;
+	gchar			phase;
+	guint			threadID;
+	gint64			timestamp;
+	gint64			duration;
+};
+
+typedef struct _XfdashboardProfilerFrame			XfdashboardProfilerFrame;
+struct _XfdashboardProfilerFrame
+{
+	gint64			duration;
+	gint64			categories[XFDASHBOARD_PROFILER_CATEGORY_LAST];
+};
+
+static gchar						*_xfdashboard_profiler_destination=NULL;
+static gint64						_xfdashboard_profiler_start_time=0;
+static GThread						*_xfdashboard_profiler_main_thread=NULL;
+static gint							_xfdashboard_profiler_next_thread_id=1;
+static GPrivate						_xfdashboard_profiler_thread_id;
+
+static XfdashboardProfilerEvent		*_xfdashboard_profiler_events=NULL;
+static guint						_xfdashboard_profiler_events_count=0;
+static guint						_xfdashboard_profiler_events_next=0;
+
+static XfdashboardProfilerFrame		_xfdashboard_profiler_frames[XFDASHBOARD_PROFILER_MAX_FRAMES];
+static guint						_xfdashboard_profiler_frames_count=0;
+static guint						_xfdashboard_profiler_frames_next=0;
+static XfdashboardProfilerFrame		_xfdashboard_profiler_current_frame;
+static gint64						_xfdashboard_profiler_frame_begin=0;
+static gint							_xfdashboard_profiler_depth[XFDASHBOARD_PROFILER_CATEGORY_LAST];
+
+static CoglPipeline					*_xfdashboard_profiler_pipelines[XFDASHBOARD_PROFILER_CATEGORY_LAST+3];
+
+G_LOCK_DEFINE_STATIC(_xfdashboard_profiler_lock);
+
+/* Get category by its name or XFDASHBOARD_PROFILER_CATEGORY_LAST if unknown */
+static XfdashboardProfilerCategory _xfdashboard_profiler_get_category(const gchar *inCategory)
+{
+	gint		i;
+
+	for(i=0; i<XFDASHBOARD_PROFILER_CATEGORY_LAST; i++)
+	{
+		if(g_strcmp0(_xfdashboard_profiler_categories[i].name, inCategory)==0) return(i);
+	}
+
+	return(XFDASHBOARD_PROFILER_CATEGORY_LAST);
+}
+
+/* Get small number identifying calling thread in trace */
+static guint _xfdashboard_profiler_get_thread_id(void)
+{
+	guint		threadID;
+
+	threadID=GPOINTER_TO_UINT(g_private_get(&_xfdashboard_profiler_thread_id));
+	if(!threadID)
+	{
+		threadID=(guint)g_atomic_int_add(&_xfdashboard_profiler_next_thread_id, 1);
+		g_private_set(&_xfdashboard_profiler_thread_id, GUINT_TO_POINTER(threadID));
+	}
+
+	return(threadID);
+}
+
+/* Add event to trace. If maximum number of events is reached the oldest
+ * event will be overwritten. Lock must be held when calling this function.
+ */
+static void _xfdashboard_profiler_add_event(const gchar *inCategory,
+											const gchar *inName,
+											gchar inPhase,
+											gint64 inTimestamp,
+											gint64 inDuration)
+{
+	XfdashboardProfilerEvent	*event;
+
+	event=&_xfdashboard_profiler_events[_xfdashboard_profiler_events_next];
+	event->category=g_intern_string(inCategory);
+	event->name=g_intern_string(inName);
+	event->phase=inPhase;
+	event->threadID=_xfdashboard_profiler_get_thread_id();
+	event->timestamp=inTimestamp-_xfdashboard_profiler_start_time;
+	event->duration=inDuration;
+
+	_xfdashboard_profiler_events_next=(_xfdashboard_profiler_events_next+1) % XFDASHBOARD_PROFILER_MAX_EVENTS;
+	if(_xfdashboard_profiler_events_count<XFDASHBOARD_PROFILER_MAX_EVENTS) _xfdashboard_profiler_events_count++;
+}
+
+/* A new frame is going to be drawn */
+static gboolean _xfdashboard_profiler_on_pre_paint(gpointer inUserData)
+{
+	_xfdashboard_profiler_main_thread=g_thread_self();
+	_xfdashboard_profiler_frame_begin=g_get_monotonic_time();
+
+	return(G_SOURCE_CONTINUE);
+}
+
+/* Frame was drawn so store its timings in history */
+static gboolean _xfdashboard_profiler_on_post_paint(gpointer inUserData)
+{
+	gint64						now;
+
+	if(_xfdashboard_profiler_frame_begin==0) return(G_SOURCE_CONTINUE);
+
+	now=g_get_monotonic_time();
+
+	G_LOCK(_xfdashboard_profiler_lock);
+
+	/* Add frame to trace */
+	_xfdashboard_profiler_add_event("frame",
+									"frame",
+									'X',
+									_xfdashboard_profiler_frame_begin,
+									now-_xfdashboard_profiler_frame_begin);
+
+	/* Add frame to history shown in overlay and reset timings for next frame */
+	_xfdashboard_profiler_current_frame.duration=now-_xfdashboard_profiler_frame_begin;
+	_xfdashboard_profiler_frames[_xfdashboard_profiler_frames_next]=_xfdashboard_profiler_current_frame;
+	_xfdashboard_profiler_frames_next=(_xfdashboard_profiler_frames_next+1) % XFDASHBOARD_PROFILER_MAX_FRAMES;
+	if(_xfdashboard_profiler_frames_count<XFDASHBOARD_PROFILER_MAX_FRAMES) _xfdashboard_profiler_frames_count++;
+
+	memset(&_xfdashboard_profiler_current_frame, 0, sizeof(_xfdashboard_profiler_current_frame));
+	_xfdashboard_profiler_frame_begin=0;
+
+	G_UNLOCK(_xfdashboard_profiler_lock);
+
+	return(G_SOURCE_CONTINUE);
+}
+
+/* Set up profiler to write trace to destination. Lock must be held when
+ * calling this function.
+ */
+static void _xfdashboard_profiler_setup(const gchar *inTraceDestination)
+{
+	g_return_if_fail(inTraceDestination && *inTraceDestination);
+
+	/* Set or replace destination */
+	if(_xfdashboard_profiler_destination) g_free(_xfdashboard_profiler_destination);
+	_xfdashboard_profiler_destination=g_strdup(inTraceDestination);
+
+	/* If profiler was set up already we are done */
+	if(_xfdashboard_profiler_events) return;
+
+	_xfdashboard_profiler_start_time=g_get_monotonic_time();
+	_xfdashboard_profiler_events=g_new0(XfdashboardProfilerEvent, XFDASHBOARD_PROFILER_MAX_EVENTS);
+
+	/* Get notified when a frame begins and ends */
+	clutter_threads_add_repaint_func_full(CLUTTER_REPAINT_FLAGS_PRE_PAINT,
+											_xfdashboard_profiler_on_pre_paint,
+											NULL,
+											NULL);
+	clutter_threads_add_repaint_func_full(CLUTTER_REPAINT_FLAGS_POST_PAINT,
+											_xfdashboard_profiler_on_post_paint,
+											NULL,
+											NULL);
+}
+
+/* Check environment once if profiler should be enabled */
+static gboolean _xfdashboard_profiler_check_enabled(void)
+{
+	static gsize		initialized=0;
+
+	if(g_once_init_enter(&initialized))
+	{
+		const gchar		*environment;
+
+		environment=g_getenv("XFDASHBOARD_PROFILER");
+		if(environment && *environment)
+		{
+			G_LOCK(_xfdashboard_profiler_lock);
+			_xfdashboard_profiler_setup(environment);
+			G_UNLOCK(_xfdashboard_profiler_lock);
+		}
+
+		g_once_init_leave(&initialized, 1);
+	}
+
+	return(_xfdashboard_profiler_events!=NULL);
+}
+
+/* Write all recorded events to stream in Chrome's trace event format */
+static void _xfdashboard_profiler_write(FILE *inStream)
+{
+	XfdashboardProfilerEvent	*event;
+	guint						first;
+	guint						i;
+	gint						pid;
+
+	g_return_if_fail(inStream);
+
+	pid=(gint)getpid();
+
+	fprintf(inStream, "{\"traceEvents\":[\n");
+	fprintf(inStream,
+			"{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":0,\"args\":{\"name\":\"xfdashboard %s\"}}",
+			pid,
+			PACKAGE_VERSION);
+
+	/* Write events from oldest to newest */
+	first=(_xfdashboard_profiler_events_next+XFDASHBOARD_PROFILER_MAX_EVENTS-_xfdashboard_profiler_events_count) % XFDASHBOARD_PROFILER_MAX_EVENTS;
+	for(i=0; i<_xfdashboard_profiler_events_count; i++)
+	{
+		event=&_xfdashboard_profiler_events[(first+i) % XFDASHBOARD_PROFILER_MAX_EVENTS];
+
+		if(event->phase=='X')
+		{
+			fprintf(inStream,
+					",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%" G_GINT64_FORMAT ",\"dur\":%" G_GINT64_FORMAT ",\"pid\":%d,\"tid\":%u}",
+					event->name,
+					event->category,
+					event->timestamp,
+					event->duration,
+					pid,
+					event->threadID);
+		}
+			else
+			{
+				fprintf(inStream,
+						",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%" G_GINT64_FORMAT ",\"pid\":%d,\"tid\":%u}",
+						event->name,
+						event->category,
+						event->timestamp,
+						pid,
+						event->threadID);
+			}
+	}
+
+	fprintf(inStream, "\n],\"displayTimeUnit\":\"ms\"}\n");
+}
+
+/* Get pipeline to draw overlay with. Index is either a category or one of
+ * the three additional pipelines for background, other time and marker lines.
+ */
+static CoglPipeline* _xfdashboard_profiler_get_pipeline(gint inIndex)
+{
+	CoglContext			*context;
+
+	if(G_UNLIKELY(!_xfdashboard_profiler_pipelines[inIndex]))
+	{
+		context=clutter_backend_get_cogl_context(clutter_get_default_backend());
+		_xfdashboard_profiler_pipelines[inIndex]=cogl_pipeline_new(context);
+
+		if(inIndex<XFDASHBOARD_PROFILER_CATEGORY_LAST)
+		{
+			cogl_pipeline_set_color4ub(_xfdashboard_profiler_pipelines[inIndex],
+										_xfdashboard_profiler_categories[inIndex].red,
+										_xfdashboard_profiler_categories[inIndex].green,
+										_xfdashboard_profiler_categories[inIndex].blue,
+										0xff);
+		}
+			else if(inIndex==XFDASHBOARD_PROFILER_CATEGORY_LAST)
+			{
+				/* Background (premultiplied) */
+				cogl_pipeline_set_color4ub(_xfdashboard_profiler_pipelines[inIndex], 0x00, 0x00, 0x00, 0xa0);
+			}
+			else if(inIndex==XFDASHBOARD_PROFILER_CATEGORY_LAST+1)
+			{
+				/* Other time of frame */
+				cogl_pipeline_set_color4ub(_xfdashboard_profiler_pipelines[inIndex], 0x88, 0x8a, 0x85, 0xff);
+			}
+			else
+			{
+				/* Marker lines (premultiplied) */
+				cogl_pipeline_set_color4ub(_xfdashboard_profiler_pipelines[inIndex], 0x80, 0x80, 0x80, 0x80);
+			}
+	}
+
+	return(_xfdashboard_profiler_pipelines[inIndex]);
+}
+
+
+/* IMPLEMENTATION: Public API */
+
+/**
+ * xfdashboard_profiler_is_enabled:
+ *
+ * Determines if the profiler is enabled, i.e. if environment variable
+ * `XFDASHBOARD_PROFILER` is set or xfdashboard_profiler_enable() was called.
+ *
+ * Return value: %TRUE if profiler is enabled, otherwise %FALSE
+ */
+gboolean xfdashboard_profiler_is_enabled(void)
+{
+	return(_xfdashboard_profiler_check_enabled());
+}
+
+/**
+ * xfdashboard_profiler_enable:
+ * @inTraceDestination: The path of file or `stdout` or `stderr` to write
+ *   trace to
+ *
+ * Enables the profiler and sets the destination where the recorded trace
+ * is written to. If the profiler was already enabled by environment variable
+ * `XFDASHBOARD_PROFILER` only the destination is changed.
+ *
+ * This function must be called at the main thread after Clutter was
+ * initialized, i.e. after clutter_init() returned, because the profiler
+ * hooks into Clutter's repaint cycle to record frames. It should be called
+ * before the core is initialized to record the timings of start-up also.
+ */
+void xfdashboard_profiler_enable(const gchar *inTraceDestination)
+{
+	g_return_if_fail(inTraceDestination && *inTraceDestination);
+
+	_xfdashboard_profiler_check_enabled();
+
+	G_LOCK(_xfdashboard_profiler_lock);
+	_xfdashboard_profiler_setup(inTraceDestination);
+	G_UNLOCK(_xfdashboard_profiler_lock);
+}
+
+/**
+ * xfdashboard_profiler_begin:
+ * @inCategory: The category of operation to measure
+ *
+ * Starts measuring an operation of category @inCategory. The returned
+ * value must be passed to xfdashboard_profiler_end() with the same category
+ * when the measured operation has finished.
+ *
+ * Return value: The current monotonic time or zero if neither profiler
+ *   nor statistics are enabled
+ */
+gint64 xfdashboard_profiler_begin(const gchar *inCategory)
+{
+	XfdashboardProfilerCategory		category;
+
+	g_return_val_if_fail(inCategory && *inCategory, 0);
+
+	if(G_LIKELY(!_xfdashboard_profiler_check_enabled()))
+	{
+		return(xfdashboard_statistics_begin());
+	}
+
+	/* Track nesting of category at main thread to count time only once */
+	if(g_thread_self()==_xfdashboard_profiler_main_thread)
+	{
+		category=_xfdashboard_profiler_get_category(inCategory);
+		if(category<XFDASHBOARD_PROFILER_CATEGORY_LAST) _xfdashboard_profiler_depth[category]++;
+	}
+
+	return(g_get_monotonic_time());
+}
+
+/**
+ * xfdashboard_profiler_end:
+ * @inCategory: The category of operation
+ * @inName: The name of operation
+ * @inBeginTime: The value returned by xfdashboard_profiler_begin()
+ *
+ * Stops measuring an operation started with xfdashboard_profiler_begin().
+ * The operation is added as event named @inName to the trace and if called
+ * at main thread the elapsed time is added to the timings of category
+ * @inCategory of the frame drawn next. If statistics are collected the
+ * elapsed time is also added to the statistics named @inName.
+ * This function is thread-safe.
+ *
+ * The category and name must be plain ASCII strings which do not need to be
+ * escaped in JSON.
+ */
+void xfdashboard_profiler_end(const gchar *inCategory, const gchar *inName, gint64 inBeginTime)
+{
+	XfdashboardProfilerCategory		category;
+	gint64							now;
+
+	g_return_if_fail(inCategory && *inCategory);
+	g_return_if_fail(inName && *inName);
+
+	if(G_LIKELY(inBeginTime==0)) return;
+
+	now=g_get_monotonic_time();
+
+	/* Add elapsed time to statistics */
+	xfdashboard_statistics_add(inName, now-inBeginTime);
+
+	/* Statistics may be collected while profiler is disabled */
+	if(!_xfdashboard_profiler_check_enabled()) return;
+
+	G_LOCK(_xfdashboard_profiler_lock);
+
+	_xfdashboard_profiler_add_event(inCategory, inName, 'X', inBeginTime, now-inBeginTime);
+
+	if(g_thread_self()==_xfdashboard_profiler_main_thread)
+	{
+		category=_xfdashboard_profiler_get_category(inCategory);
+		if(category<XFDASHBOARD_PROFILER_CATEGORY_LAST &&
+			_xfdashboard_profiler_depth[category]>0)
+		{
+			_xfdashboard_profiler_depth[category]--;
+			if(_xfdashboard_profiler_depth[category]==0)
+			{
+				_xfdashboard_profiler_current_frame.categories[category]+=(now-inBeginTime);
+			}
+		}
+	}
+
+	G_UNLOCK(_xfdashboard_profiler_lock);
+}
+
+/**
+ * xfdashboard_profiler_mark:
+ * @inCategory: The category of event
+ * @inName: The name of event
+ *
+ * Adds an instant event named @inName, e.g. a received notification, to
+ * the trace if profiler is enabled. This function is thread-safe.
+ */
+void xfdashboard_profiler_mark(const gchar *inCategory, const gchar *inName)
+{
+	g_return_if_fail(inCategory && *inCategory);
+	g_return_if_fail(inName && *inName);
+
+	if(G_LIKELY(!_xfdashboard_profiler_check_enabled())) return;
+
+	G_LOCK(_xfdashboard_profiler_lock);
+	_xfdashboard_profiler_add_event(inCategory, inName, 'i', g_get_monotonic_time(), 0);
+	G_UNLOCK(_xfdashboard_profiler_lock);
+}
+
+/**
+ * xfdashboard_profiler_paint_overlay:
+ * @inStage: The stage to draw graph at
+ *
+ * Draws the graph of timings of the most recent frames at the bottom left
+ * corner of stage @inStage if profiler is enabled. This function is meant
+ * to be called by the paint function of stage after all children were
+ * painted.
+ */
+void xfdashboard_profiler_paint_overlay(ClutterActor *inStage)
+{
+	CoglFramebuffer					*framebuffer;
+	XfdashboardProfilerFrame		*frame;
+	gfloat							stageHeight;
+	gfloat							graphHeight;
+	gfloat							graphWidth;
+	gfloat							left, bottom;
+	gfloat							x, y, height;
+	gint64							sum;
+	guint							first;
+	guint							i;
+	gint							j;
+
+	g_return_if_fail(CLUTTER_IS_ACTOR(inStage));
+
+	if(G_LIKELY(!_xfdashboard_profiler_check_enabled())) return;
+
+	framebuffer=cogl_get_draw_framebuffer();
+	stageHeight=clutter_actor_get_height(inStage);
+
+	/* Draw background of graph */
+	graphWidth=XFDASHBOARD_PROFILER_MAX_FRAMES*XFDASHBOARD_PROFILER_OVERLAY_BAR_WIDTH;
+	graphHeight=XFDASHBOARD_PROFILER_OVERLAY_MAX_MS*XFDASHBOARD_PROFILER_OVERLAY_PIXELS_PER_MS;
+	left=XFDASHBOARD_PROFILER_OVERLAY_MARGIN;
+	bottom=stageHeight-XFDASHBOARD_PROFILER_OVERLAY_MARGIN;
+
+	cogl_framebuffer_draw_rectangle(framebuffer,
+									_xfdashboard_profiler_get_pipeline(XFDASHBOARD_PROFILER_CATEGORY_LAST),
+									left, bottom-graphHeight,
+									left+graphWidth, bottom);
+
+	/* Draw one stacked bar for each frame from oldest to newest */
+	G_LOCK(_xfdashboard_profiler_lock);
+
+	first=(_xfdashboard_profiler_frames_next+XFDASHBOARD_PROFILER_MAX_FRAMES-_xfdashboard_profiler_frames_count) % XFDASHBOARD_PROFILER_MAX_FRAMES;
+	for(i=0; i<_xfdashboard_profiler_frames_count; i++)
+	{
+		frame=&_xfdashboard_profiler_frames[(first+i) % XFDASHBOARD_PROFILER_MAX_FRAMES];
+
+		x=left+((XFDASHBOARD_PROFILER_MAX_FRAMES-_xfdashboard_profiler_frames_count+i)*XFDASHBOARD_PROFILER_OVERLAY_BAR_WIDTH);
+		y=bottom;
+		sum=0;
+
+		for(j=0; j<XFDASHBOARD_PROFILER_CATEGORY_LAST; j++)
+		{
+			if(frame->categories[j]<=0) continue;
+
+			height=MIN((frame->categories[j]/1000.0f)*XFDASHBOARD_PROFILER_OVERLAY_PIXELS_PER_MS, y-(bottom-graphHeight));
+			cogl_framebuffer_draw_rectangle(framebuffer,
+											_xfdashboard_profiler_get_pipeline(j),
+											x, y-height,
+											x+XFDASHBOARD_PROFILER_OVERLAY_BAR_WIDTH, y);
+			y-=height;
+			sum+=frame->categories[j];
+		}
+
+		/* Draw remaining time of frame not covered by any category */
+		if(frame->duration>sum)
+		{
+			height=MIN(((frame->duration-sum)/1000.0f)*XFDASHBOARD_PROFILER_OVERLAY_PIXELS_PER_MS, y-(bottom-graphHeight));
+			cogl_framebuffer_draw_rectangle(framebuffer,
+											_xfdashboard_profiler_get_pipeline(XFDASHBOARD_PROFILER_CATEGORY_LAST+1),
+											x, y-height,
+											x+XFDASHBOARD_PROFILER_OVERLAY_BAR_WIDTH, y);
+		}
+	}
+
+	G_UNLOCK(_xfdashboard_profiler_lock);
+
+	/* Draw marker lines at 16.7ms (60 fps) and 33.3ms (30 fps) */
+	for(j=1; j<=2; j++)
+	{
+		y=bottom-((j*1000.0f/60.0f)*XFDASHBOARD_PROFILER_OVERLAY_PIXELS_PER_MS);
+		cogl_framebuffer_draw_rectangle(framebuffer,
+										_xfdashboard_profiler_get_pipeline(XFDASHBOARD_PROFILER_CATEGORY_LAST+2),
+										left, y,
+										left+graphWidth, y+1.0f);
+	}
+}
+
+/**
+ * xfdashboard_profiler_dump:
+ *
+ * Writes all events recorded so far as trace to the destination set in
+ * environment variable `XFDASHBOARD_PROFILER` or by
+ * xfdashboard_profiler_enable(). This function is called automatically
+ * when the core instance is destroyed.
+ */
+void xfdashboard_profiler_dump(void)
+{
+	FILE							*stream;
+
+	if(!_xfdashboard_profiler_check_enabled()) return;
+
+	G_LOCK(_xfdashboard_profiler_lock);
+
+	if(g_strcmp0(_xfdashboard_profiler_destination, "stdout")==0)
+	{
+		_xfdashboard_profiler_write(stdout);
+		fflush(stdout);
+	}
+		else if(g_strcmp0(_xfdashboard_profiler_destination, "stderr")==0)
+		{
+			_xfdashboard_profiler_write(stderr);
+		}
+		else
+		{
+			stream=fopen(_xfdashboard_profiler_destination, "w");
+			if(stream)
+			{
+				_xfdashboard_profiler_write(stream);
+				fclose(stream);
+			}
+				else
+				{
+					g_warning("Could not write profiler trace to %s: %s",
+								_xfdashboard_profiler_destination,
+								g_strerror(errno));
+				}
+		}
+
+	G_UNLOCK(_xfdashboard_profiler_lock);
+}
@@ -0,0 +1,50 @@
+/*
+ * profiler: Records frame timings and exports them as trace
+ * 
+ * Copyright 2012-2021 Stephan Haller <nomad@froevel.de>
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ * 
+ * 
+ */
+
+#ifndef __LIBXFDASHBOARD_PROFILER__
+#define __LIBXFDASHBOARD_PROFILER__
+
+#if !defined(__LIBXFDASHBOARD_H_INSIDE__) && !defined(LIBXFDASHBOARD_COMPILATION)
+#error "Only <libxfdashboard/libxfdashboard.h> can be included directly."
+#endif
+
+#include <clutter/clutter.h>
+
+G_BEGIN_DECLS
+
+/* Public API */
+gboolean xfdashboard_profiler_is_enabled(void);
+void xfdashboard_profiler_enable(const gchar *inTraceDestination);
+
+gint64 xfdashboard_profiler_begin(const gchar *inCategory);
+void xfdashboard_profiler_end(const gchar *inCategory, const gchar *inName, gint64 inBeginTime);
+
+void xfdashboard_profiler_mark(const gchar *inCategory, const gchar *inName);
+
+void xfdashboard_profiler_paint_overlay(ClutterActor *inStage);
+
+void xfdashboard_profiler_dump(void);
+
+G_END_DECLS
+
+#endif	/* __LIBXFDASHBOARD_PROFILER__ */
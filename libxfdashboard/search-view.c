@@ -59,6 +59,7 @@
 #include <libxfdashboard/enums.h>
 #include <libxfdashboard/core.h>
 #include <libxfdashboard/settings.h>
+#include <libxfdashboard/profiler.h>
 #include <libxfdashboard/compat.h>
 #include <libxfdashboard/debug.h>
 
@@ -750,6 +751,7 @@ static guint _xfdashboard_search_view_perform_search(XfdashboardSearchView *self
 	ClutterActor								*reselectOldSelection;
 	XfdashboardSearchViewProviderData			*reselectProvider;
 	XfdashboardSelectionTarget					reselectDirection;
+	gint64										profilerBegin;
 #ifdef DEBUG
 	GTimer										*timer=NULL;
 #endif
@@ -759,6 +761,7 @@ static guint _xfdashboard_search_view_perform_search(XfdashboardSearchView *self
 
 	priv=self->priv;
 	numberResults=0;
+	profilerBegin=xfdashboard_profiler_begin("search");
 
 #ifdef DEBUG
 	/* Start timer for debug search performance */
@@ -954,6 +957,8 @@ static guint _xfdashboard_search_view_perform_search(XfdashboardSearchView *self
 	/* Emit signal that search was updated */
 	g_signal_emit(self, XfdashboardSearchViewSignals[SIGNAL_SEARCH_UPDATED], 0);
 
+	xfdashboard_profiler_end("search", "search.perform", profilerBegin);
+
 	/* Return number of results */
 	return(numberResults);
 }
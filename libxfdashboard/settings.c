@@ -62,6 +62,9 @@ struct _XfdashboardSettingsPrivate
 	gboolean										resetSearchOnResume;
 	gchar											*switchToViewOnResume;
 	gboolean										reselectThemeFocusOnResume;
+	guint											iconAtlasMaxSize;
+	guint											imageCacheSize;
+	guint											applicationDatabaseReloadDelay;
 
 	/* Application search provider settings */
 	XfdashboardApplicationsSearchProviderSortMode	applicationsSearchProviderSortMode;
@@ -81,6 +84,7 @@ struct _XfdashboardSettingsPrivate
 	gchar											**pluginSearchPaths;
 	gchar											*configPath;
 	gchar											*dataPath;
+	gchar											*cachePath;
 
 	/* Instance related */
 	GList											*plugins;
@@ -108,6 +112,9 @@ enum
 	PROP_RESET_SEARCH_ON_RESUME,
 	PROP_SWITCH_TO_VIEW_ON_RESUME,
 	PROP_RESELECT_THEME_FOCUS_ON_RESUME,
+	PROP_ICON_ATLAS_MAX_SIZE,
+	PROP_IMAGE_CACHE_SIZE,
+	PROP_APPLICATION_DATABASE_RELOAD_DELAY,
 
 	/* Application search provider settings */
 	PROP_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE,
@@ -127,6 +134,7 @@ enum
 	PROP_PLUGIN_SEARCH_PATHS,
 	PROP_CONFIG_PATH,
 	PROP_DATA_PATH,
+	PROP_CACHE_PATH,
 
 	PROP_LAST
 };
@@ -155,6 +163,9 @@ static guint XfdashboardSettingsSignals[SIGNAL_LAST]={ 0, };
 #define DEFAULT_RESET_SEARCH_ON_RESUME							TRUE
 #define DEFAULT_SWITCH_TO_VIEW_ON_RESUME						NULL
 #define DEFAULT_RESELECT_THEME_FOCUS_ON_RESUME					FALSE
+#define DEFAULT_ICON_ATLAS_MAX_SIZE								128
+#define DEFAULT_IMAGE_CACHE_SIZE								(16*1024*1024)
+#define DEFAULT_APPLICATION_DATABASE_RELOAD_DELAY				500
 #define DEFAULT_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE			XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE_NONE
 #define DEFAULT_APPLICATIONS_VIEW_SHOW_ALL_APPS					FALSE
 #define DEFAULT_SEARCH_VIEW_DELAY_SEARCH_TIMEOUT				0
@@ -399,6 +410,38 @@ static void _xfdashboard_settings_set_data_path(XfdashboardSettings *self, const
 	}
 }
 
+/* Set the base path of cache files for application or NULL to disable application
+ * specific cache files.
+ */
+static void _xfdashboard_settings_set_cache_path(XfdashboardSettings *self, const gchar *inPath)
+{
+	XfdashboardSettingsPrivate		*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_SETTINGS(self));
+	g_return_if_fail(!inPath || *inPath);
+
+	priv=self->priv;
+
+	/* Set value if changed */
+	if(g_strcmp0(priv->cachePath, inPath)!=0)
+	{
+		/* Set value */
+		if(priv->cachePath)
+		{
+			g_free(priv->cachePath);
+			priv->cachePath=NULL;
+		}
+
+		if(inPath)
+		{
+			priv->cachePath=g_strdup(inPath);
+		}
+
+		/* Notify about property change */
+		g_object_notify_by_pspec(G_OBJECT(self), XfdashboardSettingsProperties[PROP_CACHE_PATH]);
+	}
+}
+
 
 /* IMPLEMENTATION: GObject */
 
@@ -461,6 +504,12 @@ static void _xfdashboard_settings_dispose(GObject *inObject)
 		priv->switchToViewOnResume=NULL;
 	}
 
+	if(priv->cachePath)
+	{
+		g_free(priv->cachePath);
+		priv->cachePath=NULL;
+	}
+
 	if(priv->plugins)
 	{
 		g_list_free_full(priv->plugins, (GDestroyNotify)_xfdashboard_settings_plugin_entry_free);
@@ -530,6 +579,18 @@ static void _xfdashboard_settings_set_property(GObject *inObject,
 			xfdashboard_settings_set_reselect_theme_focus_on_resume(self, g_value_get_boolean(inValue));
 			break;
 
+		case PROP_ICON_ATLAS_MAX_SIZE:
+			xfdashboard_settings_set_icon_atlas_max_size(self, g_value_get_uint(inValue));
+			break;
+
+		case PROP_IMAGE_CACHE_SIZE:
+			xfdashboard_settings_set_image_cache_size(self, g_value_get_uint(inValue));
+			break;
+
+		case PROP_APPLICATION_DATABASE_RELOAD_DELAY:
+			xfdashboard_settings_set_application_database_reload_delay(self, g_value_get_uint(inValue));
+			break;
+
 		/* Applications search provider settings */
 		case PROP_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE:
 			xfdashboard_settings_set_applications_search_sort_mode(self, g_value_get_flags(inValue));
@@ -571,6 +632,10 @@ static void _xfdashboard_settings_set_property(GObject *inObject,
 			_xfdashboard_settings_set_data_path(self, g_value_get_string(inValue));
 			break;
 
+		case PROP_CACHE_PATH:
+			_xfdashboard_settings_set_cache_path(self, g_value_get_string(inValue));
+			break;
+
 		/* Unknown settings ;) */
 		default:
 			G_OBJECT_WARN_INVALID_PROPERTY_ID(inObject, inPropID, inSpec);
@@ -636,6 +701,18 @@ static void _xfdashboard_settings_get_property(GObject *inObject,
 			g_value_set_boolean(outValue, self->priv->reselectThemeFocusOnResume);
 			break;
 
+		case PROP_ICON_ATLAS_MAX_SIZE:
+			g_value_set_uint(outValue, self->priv->iconAtlasMaxSize);
+			break;
+
+		case PROP_IMAGE_CACHE_SIZE:
+			g_value_set_uint(outValue, self->priv->imageCacheSize);
+			break;
+
+		case PROP_APPLICATION_DATABASE_RELOAD_DELAY:
+			g_value_set_uint(outValue, self->priv->applicationDatabaseReloadDelay);
+			break;
+
 		/* Application search provider settings */
 		case PROP_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE:
 			g_value_set_flags(outValue, self->priv->applicationsSearchProviderSortMode);
@@ -677,6 +754,10 @@ static void _xfdashboard_settings_get_property(GObject *inObject,
 			g_value_set_string(outValue, self->priv->dataPath);
 			break;
 
+		case PROP_CACHE_PATH:
+			g_value_set_string(outValue, self->priv->cachePath);
+			break;
+
 		/* Unknown settings ;) */
 		default:
 			G_OBJECT_WARN_INVALID_PROPERTY_ID(inObject, inPropID, inSpec);
@@ -869,6 +950,57 @@ static void xfdashboard_settings_class_init(XfdashboardSettingsClass *klass)
 								DEFAULT_RESELECT_THEME_FOCUS_ON_RESUME,
 								G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
 
+	/**
+	 * XfdashboardSettings:icon-atlas-max-size:
+	 *
+	 * The maximum width and height in pixels of icons which are placed into
+	 * a shared texture atlas instead of their own texture. Larger icons get
+	 * their own texture. If set to zero no icon will be placed into an atlas.
+	 */
+	XfdashboardSettingsProperties[PROP_ICON_ATLAS_MAX_SIZE]=
+		g_param_spec_uint("icon-atlas-max-size",
+							"Icon atlas maximum size",
+							"The maximum size of icons to place into shared texture atlas",
+							0,
+							512,
+							DEFAULT_ICON_ATLAS_MAX_SIZE,
+							G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+
+	/**
+	 * XfdashboardSettings:image-cache-size:
+	 *
+	 * The number of bytes of decoded images which are kept in cache after
+	 * they are not used anymore, so they can be reused without loading them
+	 * again. The least recently used images are released first if this size
+	 * is exceeded. If set to zero images are released as soon as they are not
+	 * used anymore.
+	 */
+	XfdashboardSettingsProperties[PROP_IMAGE_CACHE_SIZE]=
+		g_param_spec_uint("image-cache-size",
+							"Image cache size",
+							"The number of bytes of unused images to keep in cache",
+							0,
+							G_MAXUINT,
+							DEFAULT_IMAGE_CACHE_SIZE,
+							G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+
+	/**
+	 * XfdashboardSettings:application-database-reload-delay:
+	 *
+	 * The number of milliseconds the application database waits for further
+	 * changes at desktop files or application menus before all collected
+	 * changes are applied at once. If set to zero each change is applied
+	 * immediately.
+	 */
+	XfdashboardSettingsProperties[PROP_APPLICATION_DATABASE_RELOAD_DELAY]=
+		g_param_spec_uint("application-database-reload-delay",
+							"Application database reload delay",
+							"The number of milliseconds to collect changes at applications before applying them",
+							0,
+							G_MAXUINT,
+							DEFAULT_APPLICATION_DATABASE_RELOAD_DELAY,
+							G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS);
+
 	/**
 	 * XfdashboardSettings:applications-search-sort-mode:
 	 *
@@ -997,6 +1129,19 @@ static void xfdashboard_settings_class_init(XfdashboardSettingsClass *klass)
 								NULL,
 								G_PARAM_READWRITE | G_PARAM_CONSTRUCT_ONLY | G_PARAM_STATIC_STRINGS);
 
+	/**
+	 * XfdashboardSettings:cache-path:
+	 *
+	 * The base path of cache files of application or NULL to disable application specific cache
+	 * files, e.g. the precompiled theme cache.
+	 */
+	XfdashboardSettingsProperties[PROP_CACHE_PATH]=
+		g_param_spec_string("cache-path",
+								"Cache path",
+								"Base path to cache files of application",
+								NULL,
+								G_PARAM_READWRITE | G_PARAM_CONSTRUCT_ONLY | G_PARAM_STATIC_STRINGS);
+
 	g_object_class_install_properties(gobjectClass, PROP_LAST, XfdashboardSettingsProperties);
 
 	/* Define signals */
@@ -1046,11 +1191,15 @@ static void xfdashboard_settings_init(XfdashboardSettings *self)
 	priv->resetSearchOnResume=DEFAULT_RESET_SEARCH_ON_RESUME;
 	priv->switchToViewOnResume=g_strdup(DEFAULT_SWITCH_TO_VIEW_ON_RESUME);
 	priv->reselectThemeFocusOnResume=DEFAULT_RESELECT_THEME_FOCUS_ON_RESUME;
+	priv->iconAtlasMaxSize=DEFAULT_ICON_ATLAS_MAX_SIZE;
+	priv->imageCacheSize=DEFAULT_IMAGE_CACHE_SIZE;
+	priv->applicationDatabaseReloadDelay=DEFAULT_APPLICATION_DATABASE_RELOAD_DELAY;
 	priv->bindingFiles=NULL;
 	priv->themeSearchPaths=NULL;
 	priv->pluginSearchPaths=NULL;
 	priv->configPath=NULL;
 	priv->dataPath=NULL;
+	priv->cachePath=NULL;
 
 	/* Set default applications search provider settings */
 	priv->applicationsSearchProviderSortMode=DEFAULT_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE;
@@ -1831,6 +1980,139 @@ void xfdashboard_settings_set_reselect_theme_focus_on_resume(XfdashboardSettings
 	}
 }
 
+/**
+ * xfdashboard_settings_get_icon_atlas_max_size:
+ * @self: A #XfdashboardSettings
+ *
+ * Retrieve the maximum size of icons which are placed into a shared texture
+ * atlas from settings at @self.
+ *
+ * Return value: The maximum width and height in pixels or zero if disabled.
+ */
+guint xfdashboard_settings_get_icon_atlas_max_size(XfdashboardSettings *self)
+{
+	g_return_val_if_fail(XFDASHBOARD_IS_SETTINGS(self), 0);
+
+	return(self->priv->iconAtlasMaxSize);
+}
+
+/**
+ * xfdashboard_settings_set_icon_atlas_max_size:
+ * @self: A #XfdashboardSettings
+ * @inIconAtlasMaxSize: The maximum size of icons to place into atlas
+ *
+ * Sets the maximum width and height in pixels of icons which are placed into
+ * a shared texture atlas in settings at @self. Setting zero at
+ * @inIconAtlasMaxSize disables the texture atlas.
+ */
+void xfdashboard_settings_set_icon_atlas_max_size(XfdashboardSettings *self, guint inIconAtlasMaxSize)
+{
+	XfdashboardSettingsPrivate		*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_SETTINGS(self));
+
+	priv=self->priv;
+
+	/* Set value if changed */
+	if(priv->iconAtlasMaxSize!=inIconAtlasMaxSize)
+	{
+		/* Set value */
+		priv->iconAtlasMaxSize=inIconAtlasMaxSize;
+
+		/* Notify about property change */
+		g_object_notify_by_pspec(G_OBJECT(self), XfdashboardSettingsProperties[PROP_ICON_ATLAS_MAX_SIZE]);
+	}
+}
+
+/**
+ * xfdashboard_settings_get_image_cache_size:
+ * @self: A #XfdashboardSettings
+ *
+ * Retrieve the number of bytes of unused images to keep in cache from
+ * settings at @self.
+ *
+ * Return value: The size in bytes.
+ */
+guint xfdashboard_settings_get_image_cache_size(XfdashboardSettings *self)
+{
+	g_return_val_if_fail(XFDASHBOARD_IS_SETTINGS(self), 0);
+
+	return(self->priv->imageCacheSize);
+}
+
+/**
+ * xfdashboard_settings_set_image_cache_size:
+ * @self: A #XfdashboardSettings
+ * @inImageCacheSize: The number of bytes of unused images to keep
+ *
+ * Sets the number of bytes of decoded but unused images which are kept in
+ * cache in settings at @self. Setting zero at @inImageCacheSize releases
+ * images as soon as they are not used anymore.
+ */
+void xfdashboard_settings_set_image_cache_size(XfdashboardSettings *self, guint inImageCacheSize)
+{
+	XfdashboardSettingsPrivate		*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_SETTINGS(self));
+
+	priv=self->priv;
+
+	/* Set value if changed */
+	if(priv->imageCacheSize!=inImageCacheSize)
+	{
+		/* Set value */
+		priv->imageCacheSize=inImageCacheSize;
+
+		/* Notify about property change */
+		g_object_notify_by_pspec(G_OBJECT(self), XfdashboardSettingsProperties[PROP_IMAGE_CACHE_SIZE]);
+	}
+}
+
+/**
+ * xfdashboard_settings_get_application_database_reload_delay:
+ * @self: A #XfdashboardSettings
+ *
+ * Retrieve the number of milliseconds the application database collects
+ * changes before applying them from settings at @self.
+ *
+ * Return value: The delay in milliseconds.
+ */
+guint xfdashboard_settings_get_application_database_reload_delay(XfdashboardSettings *self)
+{
+	g_return_val_if_fail(XFDASHBOARD_IS_SETTINGS(self), 0);
+
+	return(self->priv->applicationDatabaseReloadDelay);
+}
+
+/**
+ * xfdashboard_settings_set_application_database_reload_delay:
+ * @self: A #XfdashboardSettings
+ * @inApplicationDatabaseReloadDelay: The delay in milliseconds
+ *
+ * Sets the number of milliseconds the application database waits for
+ * further changes before applying all collected changes at once in settings
+ * at @self. Setting zero at @inApplicationDatabaseReloadDelay applies each
+ * change immediately.
+ */
+void xfdashboard_settings_set_application_database_reload_delay(XfdashboardSettings *self, guint inApplicationDatabaseReloadDelay)
+{
+	XfdashboardSettingsPrivate		*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_SETTINGS(self));
+
+	priv=self->priv;
+
+	/* Set value if changed */
+	if(priv->applicationDatabaseReloadDelay!=inApplicationDatabaseReloadDelay)
+	{
+		/* Set value */
+		priv->applicationDatabaseReloadDelay=inApplicationDatabaseReloadDelay;
+
+		/* Notify about property change */
+		g_object_notify_by_pspec(G_OBJECT(self), XfdashboardSettingsProperties[PROP_APPLICATION_DATABASE_RELOAD_DELAY]);
+	}
+}
+
 /**
  * xfdashboard_settings_get_applications_search_sort_mode:
  * @self: A #XfdashboardSettings
@@ -2103,3 +2385,20 @@ const gchar* xfdashboard_settings_get_data_path(XfdashboardSettings *self)
 
 	return(self->priv->dataPath);
 }
+
+/**
+ * xfdashboard_settings_get_cache_path:
+ * @self: A #XfdashboardSettings
+ *
+ * Retrieves the base path of cache files of application in settings
+ * at @self.
+ *
+ * Return value: The base path of cache files or %NULL if support for
+ *   cache files is disabled.
+ */
+const gchar* xfdashboard_settings_get_cache_path(XfdashboardSettings *self)
+{
+	g_return_val_if_fail(XFDASHBOARD_IS_SETTINGS(self), NULL);
+
+	return(self->priv->cachePath);
+}
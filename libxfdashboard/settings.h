@@ -126,6 +126,15 @@ void xfdashboard_settings_set_switch_to_view_on_resume(XfdashboardSettings *self
 gboolean xfdashboard_settings_get_reselect_theme_focus_on_resume(XfdashboardSettings *self);
 void xfdashboard_settings_set_reselect_theme_focus_on_resume(XfdashboardSettings *self, gboolean inReselectThemeFocusOnResume);
 
+guint xfdashboard_settings_get_icon_atlas_max_size(XfdashboardSettings *self);
+void xfdashboard_settings_set_icon_atlas_max_size(XfdashboardSettings *self, guint inIconAtlasMaxSize);
+
+guint xfdashboard_settings_get_image_cache_size(XfdashboardSettings *self);
+void xfdashboard_settings_set_image_cache_size(XfdashboardSettings *self, guint inImageCacheSize);
+
+guint xfdashboard_settings_get_application_database_reload_delay(XfdashboardSettings *self);
+void xfdashboard_settings_set_application_database_reload_delay(XfdashboardSettings *self, guint inApplicationDatabaseReloadDelay);
+
 XfdashboardApplicationsSearchProviderSortMode xfdashboard_settings_get_applications_search_sort_mode(XfdashboardSettings *self);
 void xfdashboard_settings_set_applications_search_sort_mode(XfdashboardSettings *self, XfdashboardApplicationsSearchProviderSortMode inApplicationsSearchProviderSortMode);
 
@@ -148,6 +157,8 @@ const gchar* xfdashboard_settings_get_config_path(XfdashboardSettings *self);
 
 const gchar* xfdashboard_settings_get_data_path(XfdashboardSettings *self);
 
+const gchar* xfdashboard_settings_get_cache_path(XfdashboardSettings *self);
+
 G_END_DECLS
 
 #endif	/* __LIBXFDASHBOARD_SETTINGS__ */
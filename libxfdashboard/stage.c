@@ -53,6 +53,7 @@
 #include <libxfdashboard/window-content.h>
 #include <libxfdashboard/stage-interface.h>
 #include <libxfdashboard/settings.h>
+#include <libxfdashboard/profiler.h>
 #include <libxfdashboard/compat.h>
 #include <libxfdashboard/debug.h>
 
@@ -1594,6 +1595,37 @@ static void _xfdashboard_stage_show(ClutterActor *inActor)
 	}
 }
 
+/* Allocate position and size of stage and its children */
+static void _xfdashboard_stage_allocate(ClutterActor *inActor,
+										const ClutterActorBox *inBox,
+										ClutterAllocationFlags inFlags)
+{
+	gint64						profilerBegin;
+
+	g_return_if_fail(XFDASHBOARD_IS_STAGE(inActor));
+
+	/* Call parent's allocate method and measure time needed for layout */
+	profilerBegin=xfdashboard_profiler_begin("layout");
+	CLUTTER_ACTOR_CLASS(xfdashboard_stage_parent_class)->allocate(inActor, inBox, inFlags);
+	xfdashboard_profiler_end("layout", "stage.allocate", profilerBegin);
+}
+
+/* Paint stage and its children */
+static void _xfdashboard_stage_paint(ClutterActor *inActor)
+{
+	gint64						profilerBegin;
+
+	g_return_if_fail(XFDASHBOARD_IS_STAGE(inActor));
+
+	/* Call parent's paint method and measure time needed for painting */
+	profilerBegin=xfdashboard_profiler_begin("paint");
+	CLUTTER_ACTOR_CLASS(xfdashboard_stage_parent_class)->paint(inActor);
+	xfdashboard_profiler_end("paint", "stage.paint", profilerBegin);
+
+	/* Draw graph of frame timings on top of everything if profiler is enabled */
+	if(xfdashboard_profiler_is_enabled()) xfdashboard_profiler_paint_overlay(inActor);
+}
+
 /* IMPLEMENTATION: GObject */
 
 /* Dispose this object */
@@ -1788,6 +1820,8 @@ static void xfdashboard_stage_class_init(XfdashboardStageClass *klass)
 
 	actorClass->show=_xfdashboard_stage_show;
 	actorClass->event=_xfdashboard_stage_event;
+	actorClass->allocate=_xfdashboard_stage_allocate;
+	actorClass->paint=_xfdashboard_stage_paint;
 
 	gobjectClass->dispose=_xfdashboard_stage_dispose;
 	gobjectClass->set_property=_xfdashboard_stage_set_property;
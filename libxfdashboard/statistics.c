@@ -0,0 +1,255 @@
+/*
+ * statistics: Collects timings and counters for performance analysis
+ * 
+ * Copyright 2012-2021 Stephan Haller <nomad@froevel.de>
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ * 
+ * 
+ */
+
+/**
+ * SECTION:statistics
+ * @short_description: Timings and counters for performance analysis
+ * @include: xfdashboard/statistics.h
+ *
+ * The statistics functions collect samples of named timings and counters,
+ * e.g. the time needed to look up the style of an actor or to load a theme,
+ * to detect performance regressions between releases.
+ *
+ * Operations are usually timed with xfdashboard_profiler_begin() and
+ * xfdashboard_profiler_end() which add their timings to the statistics and,
+ * if enabled, to the trace of the profiler. xfdashboard_statistics_begin()
+ * and xfdashboard_statistics_end() are meant for timings which should not
+ * appear in the trace, e.g. the time between two unrelated events.
+ *
+ * Collecting statistics is disabled by default and can be enabled by setting
+ * the environment variable `XFDASHBOARD_STATISTICS` to the path of a file or
+ * to `stdout` or `stderr`. When the core instance is destroyed all collected
+ * statistics are written to this destination as tab-separated values, one
+ * line per name with its number of samples, sum, minimum, maximum and mean
+ * of all sample values. Timings are measured in microseconds.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <libxfdashboard/statistics.h>
+
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+
+
+/* IMPLEMENTATION: Private variables and methods */
+typedef struct _XfdashboardStatisticsEntry		XfdashboardStatisticsEntry;
+struct _XfdashboardStatisticsEntry
+{
+	guint64			count;
+	gint64			sum;
+	gint64			min;
+	gint64			max;
+};
+
+static gchar		*_xfdashboard_statistics_destination=NULL;
+static GHashTable	*_xfdashboard_statistics_entries=NULL;
+G_LOCK_DEFINE_STATIC(_xfdashboard_statistics_lock);
+
+/* Check environment once if statistics should be collected */
+static gboolean _xfdashboard_statistics_check_enabled(void)
+{
+	static gsize		initialized=0;
+
+	if(g_once_init_enter(&initialized))
+	{
+		const gchar		*environment;
+
+		environment=g_getenv("XFDASHBOARD_STATISTICS");
+		if(environment && *environment)
+		{
+			_xfdashboard_statistics_destination=g_strdup(environment);
+			_xfdashboard_statistics_entries=g_hash_table_new_full(g_str_hash,
+																	g_str_equal,
+																	g_free,
+																	g_free);
+		}
+
+		g_once_init_leave(&initialized, 1);
+	}
+
+	return(_xfdashboard_statistics_destination!=NULL);
+}
+
+/* Write all collected statistics to stream */
+static void _xfdashboard_statistics_write(FILE *inStream)
+{
+	GList							*names;
+	GList							*iter;
+	XfdashboardStatisticsEntry		*entry;
+
+	g_return_if_fail(inStream);
+
+	/* Write header */
+	fprintf(inStream, "# xfdashboard %s\n", PACKAGE_VERSION);
+	fprintf(inStream, "# name\tcount\tsum\tmin\tmax\tmean\n");
+
+	/* Write entries sorted by name */
+	names=g_hash_table_get_keys(_xfdashboard_statistics_entries);
+	names=g_list_sort(names, (GCompareFunc)g_strcmp0);
+	for(iter=names; iter; iter=g_list_next(iter))
+	{
+		entry=(XfdashboardStatisticsEntry*)g_hash_table_lookup(_xfdashboard_statistics_entries, iter->data);
+		if(!entry || entry->count==0) continue;
+
+		fprintf(inStream,
+				"%s\t%" G_GUINT64_FORMAT "\t%" G_GINT64_FORMAT "\t%" G_GINT64_FORMAT "\t%" G_GINT64_FORMAT "\t%.2f\n",
+				(const gchar*)iter->data,
+				entry->count,
+				entry->sum,
+				entry->min,
+				entry->max,
+				((gdouble)entry->sum)/((gdouble)entry->count));
+	}
+	g_list_free(names);
+}
+
+
+/* IMPLEMENTATION: Public API */
+
+/**
+ * xfdashboard_statistics_is_enabled:
+ *
+ * Determines if statistics are collected, i.e. if environment variable
+ * `XFDASHBOARD_STATISTICS` is set.
+ *
+ * Return value: %TRUE if statistics are collected, otherwise %FALSE
+ */
+gboolean xfdashboard_statistics_is_enabled(void)
+{
+	return(_xfdashboard_statistics_check_enabled());
+}
+
+/**
+ * xfdashboard_statistics_begin:
+ *
+ * Starts measuring a timing. The returned value must be passed to
+ * xfdashboard_statistics_end() when the measured operation has finished.
+ *
+ * Return value: The current monotonic time or zero if statistics are
+ *   not collected
+ */
+gint64 xfdashboard_statistics_begin(void)
+{
+	if(G_LIKELY(!_xfdashboard_statistics_check_enabled())) return(0);
+
+	return(g_get_monotonic_time());
+}
+
+/**
+ * xfdashboard_statistics_end:
+ * @inName: The name of timing
+ * @inBeginTime: The value returned by xfdashboard_statistics_begin()
+ *
+ * Stops measuring a timing started with xfdashboard_statistics_begin() and
+ * adds the elapsed time in microseconds as sample to statistics named @inName.
+ */
+void xfdashboard_statistics_end(const gchar *inName, gint64 inBeginTime)
+{
+	g_return_if_fail(inName && *inName);
+
+	if(G_LIKELY(inBeginTime==0)) return;
+
+	xfdashboard_statistics_add(inName, g_get_monotonic_time()-inBeginTime);
+}
+
+/**
+ * xfdashboard_statistics_add:
+ * @inName: The name of timing or counter
+ * @inValue: The value of sample to add
+ *
+ * Adds the sample value @inValue to statistics named @inName if statistics
+ * are collected. This function is thread-safe.
+ */
+void xfdashboard_statistics_add(const gchar *inName, gint64 inValue)
+{
+	XfdashboardStatisticsEntry		*entry;
+
+	g_return_if_fail(inName && *inName);
+
+	if(G_LIKELY(!_xfdashboard_statistics_check_enabled())) return;
+
+	G_LOCK(_xfdashboard_statistics_lock);
+
+	entry=(XfdashboardStatisticsEntry*)g_hash_table_lookup(_xfdashboard_statistics_entries, inName);
+	if(!entry)
+	{
+		entry=g_new0(XfdashboardStatisticsEntry, 1);
+		entry->min=inValue;
+		entry->max=inValue;
+		g_hash_table_insert(_xfdashboard_statistics_entries, g_strdup(inName), entry);
+	}
+
+	entry->count++;
+	entry->sum+=inValue;
+	if(inValue<entry->min) entry->min=inValue;
+	if(inValue>entry->max) entry->max=inValue;
+
+	G_UNLOCK(_xfdashboard_statistics_lock);
+}
+
+/**
+ * xfdashboard_statistics_dump:
+ *
+ * Writes all statistics collected so far to the destination set in
+ * environment variable `XFDASHBOARD_STATISTICS`. This function is called
+ * automatically when the core instance is destroyed.
+ */
+void xfdashboard_statistics_dump(void)
+{
+	FILE							*stream;
+
+	if(!_xfdashboard_statistics_check_enabled()) return;
+
+	G_LOCK(_xfdashboard_statistics_lock);
+
+	if(g_strcmp0(_xfdashboard_statistics_destination, "stdout")==0)
+	{
+		_xfdashboard_statistics_write(stdout);
+		fflush(stdout);
+	}
+		else if(g_strcmp0(_xfdashboard_statistics_destination, "stderr")==0)
+		{
+			_xfdashboard_statistics_write(stderr);
+		}
+		else
+		{
+			stream=fopen(_xfdashboard_statistics_destination, "w");
+			if(stream)
+			{
+				_xfdashboard_statistics_write(stream);
+				fclose(stream);
+			}
+				else
+				{
+					g_warning("Could not write statistics to %s: %s",
+								_xfdashboard_statistics_destination,
+								g_strerror(errno));
+				}
+		}
+
+	G_UNLOCK(_xfdashboard_statistics_lock);
+}
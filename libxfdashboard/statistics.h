@@ -0,0 +1,47 @@
+/*
+ * statistics: Collects timings and counters for performance analysis
+ * 
+ * Copyright 2012-2021 Stephan Haller <nomad@froevel.de>
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ * 
+ * 
+ */
+
+#ifndef __LIBXFDASHBOARD_STATISTICS__
+#define __LIBXFDASHBOARD_STATISTICS__
+
+#if !defined(__LIBXFDASHBOARD_H_INSIDE__) && !defined(LIBXFDASHBOARD_COMPILATION)
+#error "Only <libxfdashboard/libxfdashboard.h> can be included directly."
+#endif
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/* Public API */
+gboolean xfdashboard_statistics_is_enabled(void);
+
+gint64 xfdashboard_statistics_begin(void);
+void xfdashboard_statistics_end(const gchar *inName, gint64 inBeginTime);
+
+void xfdashboard_statistics_add(const gchar *inName, gint64 inValue);
+
+void xfdashboard_statistics_dump(void);
+
+G_END_DECLS
+
+#endif	/* __LIBXFDASHBOARD_STATISTICS__ */
@@ -33,6 +33,7 @@
 #include <libxfdashboard/core.h>
 #include <libxfdashboard/marshal.h>
 #include <libxfdashboard/utils.h>
+#include <libxfdashboard/profiler.h>
 #include <libxfdashboard/compat.h>
 
 
@@ -1279,6 +1280,7 @@ void xfdashboard_stylable_remove_pseudo_class(XfdashboardStylable *self, const g
 void xfdashboard_stylable_invalidate(XfdashboardStylable *self)
 {
 	XfdashboardStylableInterface		*iface;
+	gint64								profilerBegin;
 
 	g_return_if_fail(XFDASHBOARD_IS_STYLABLE(self));
 
@@ -1287,7 +1289,9 @@ void xfdashboard_stylable_invalidate(XfdashboardStylable *self)
 	/* Call virtual function */
 	if(iface->invalidate)
 	{
+		profilerBegin=xfdashboard_profiler_begin("style");
 		iface->invalidate(self);
+		xfdashboard_profiler_end("style", "style.invalidate", profilerBegin);
 		return;
 	}
 
@@ -190,13 +190,19 @@
 
 #include <glib/gi18n-lib.h>
 #include <glib.h>
+#include <glib/gstdio.h>
 #include <gio/gio.h>
 #include <gio/gfiledescriptorbased.h>
 #include <clutter/clutter.h>
 #include <gtk/gtk.h>
+#include <errno.h>
 
 #include <libxfdashboard/stylable.h>
 #include <libxfdashboard/css-selector.h>
+#include <libxfdashboard/statistics.h>
+#include <libxfdashboard/profiler.h>
+#include <libxfdashboard/utils.h>
+#include <libxfdashboard/core.h>
 #include <libxfdashboard/compat.h>
 #include <libxfdashboard/debug.h>
 
@@ -214,6 +220,8 @@ struct _XfdashboardThemeCSSPrivate
 	GHashTable	*registeredFunctions;
 
 	gint		offsetLine;
+
+	GHashTable	*preloadedFiles;
 };
 
 G_DEFINE_TYPE_WITH_PRIVATE(XfdashboardThemeCSS,
@@ -262,6 +270,32 @@ struct _XfdashboardThemeCSSTableCopyData
 	const gchar						*name;
 };
 
+/* A CSS file and all CSS files it imports read by a worker thread before they
+ * are parsed at main thread
+ */
+typedef struct _XfdashboardThemeCSSPreloadFile		XfdashboardThemeCSSPreloadFile;
+struct _XfdashboardThemeCSSPreloadFile
+{
+	const gchar						*themePath;	/* Not owned */
+	XfdashboardThemeCSSPreloadFile	*parent;	/* Not owned, file importing this one */
+	gchar							*path;
+	gchar							*contents;
+	gsize							length;
+	GSList							*imports;	/* Owned, files imported in order */
+};
+
+/* The cache file stores a serialized GVariant containing:
+ * - the version of cache file format,
+ * - the key the cache was created for,
+ * - the list of CSS files parsed (path, modification time, size),
+ * - the line offset after all CSS files were parsed,
+ * - the list of selectors (type, index of style, selector, priority, source,
+ *   line, position),
+ * - the list of styles (property name and value pairs).
+ */
+#define XFDASHBOARD_THEME_CSS_CACHE_VERSION			2
+#define XFDASHBOARD_THEME_CSS_CACHE_TYPE			"(usa(sxx)ia(uusisuu)aa{ss})"
+
 #define XFDASHBOARD_THEME_CSS_FUNCTION_CALLBACK(f)	((XfdashboardThemeCSSFunctionCallback)(f))
 typedef gboolean (*XfdashboardThemeCSSFunctionCallback)(XfdashboardThemeCSS *self,
 														const gchar *inName,
@@ -269,6 +303,27 @@ typedef gboolean (*XfdashboardThemeCSSFunctionCallback)(XfdashboardThemeCSS *sel
 														GValue *outResult,
 														GError **outError);
 
+/* Results of CSS function calls shared by all instances of this class, i.e.
+ * across all themes loaded. The results of functions depending on the icon theme
+ * are kept in a separate cache which is cleared when the icon theme changes.
+ * Each cache holds at most XFDASHBOARD_THEME_CSS_FUNCTION_CACHE_MAX_ENTRIES
+ * results and drops the oldest ones first. Both caches are destroyed when
+ * the core shuts down.
+ */
+#define XFDASHBOARD_THEME_CSS_FUNCTION_CACHE_MAX_ENTRIES	1024
+
+typedef struct _XfdashboardThemeCSSFunctionCache		XfdashboardThemeCSSFunctionCache;
+struct _XfdashboardThemeCSSFunctionCache
+{
+	GHashTable		*results;
+	GQueue			keys;		/* Keys owned by hash-table in order of insertion */
+};
+
+static XfdashboardThemeCSSFunctionCache		*_xfdashboard_theme_css_function_results=NULL;
+static XfdashboardThemeCSSFunctionCache		*_xfdashboard_theme_css_function_icon_results=NULL;
+static guint								_xfdashboard_theme_css_function_cache_shutdownSignalID=0;
+static guint								_xfdashboard_theme_css_function_cache_iconThemeChangedSignalID=0;
+
 /* Forward declarations */
 static void _xfdashboard_theme_css_set_error(XfdashboardThemeCSS *self,
 												GError **outError,
@@ -381,6 +436,67 @@ static gchar* _xfdashboard_theme_css_append_char(gchar *ioString, gchar inChar)
 	return(tmp);
 }
 
+/* Create scanner to tokenize CSS */
+static GScanner* _xfdashboard_theme_css_create_scanner(const gchar *inName, gint inPriority)
+{
+	GScanner						*scanner;
+
+	/* Create scanner object with default settings */
+	scanner=g_scanner_new(NULL);
+	scanner->input_name=inName;
+	scanner->user_data=GINT_TO_POINTER(inPriority);
+
+	/* Set up scanner config
+	 * - Identifiers are allowed to contain '-' (minus sign) as non-first characters
+	 * - Disallow scanning float values as we need '.' for identifiers
+	 * - Set up single comment line not to include '#' as this character is need for identifiers
+	 * - Disable parsing HEX values
+	 * - Identifiers cannot be single quoted
+	 * - Identifiers cannot be double quoted
+	 */
+	scanner->config->cset_identifier_nth=G_CSET_a_2_z "-_0123456789" G_CSET_A_2_Z G_CSET_LATINS G_CSET_LATINC;
+	scanner->config->scan_float=FALSE;
+	scanner->config->cpair_comment_single="\1\n";
+	scanner->config->scan_hex=FALSE;
+	scanner->config->scan_string_sq=FALSE;
+	scanner->config->scan_string_dq=FALSE;
+
+	return(scanner);
+}
+
+/* Resolve path of a CSS file to import. A relative path is resolved relative
+ * to the CSS file importing it if such a file exists, otherwise it is assumed
+ * to be relative to theme path. This function does not access any object and
+ * is safe to be called from worker threads.
+ */
+static gchar* _xfdashboard_theme_css_resolve_import_path(const gchar *inThemePath,
+															const gchar *inImportingPath,
+															const gchar *inFilename)
+{
+	gchar							*filename;
+	gchar							*cssPath;
+
+	g_return_val_if_fail(inFilename && *inFilename, NULL);
+
+	/* Absolute paths need not to be resolved */
+	if(g_path_is_absolute(inFilename)) return(g_strdup(inFilename));
+
+	/* Check if a file, relative to path of CSS file currently parsed, exists */
+	if(inImportingPath)
+	{
+		cssPath=g_path_get_dirname(inImportingPath);
+		filename=g_build_filename(cssPath, inFilename, NULL);
+		g_free(cssPath);
+
+		if(g_file_test(filename, G_FILE_TEST_EXISTS)) return(filename);
+
+		g_free(filename);
+	}
+
+	/* Assume path is relative to theme */
+	return(g_build_filename(inThemePath, inFilename, NULL));
+}
+
 /* Destroy selector */
 static void _xfdashboard_theme_css_selector_free(XfdashboardThemeCSSSelector *inSelector)
 {
@@ -405,6 +521,45 @@ static XfdashboardThemeCSSSelector* _xfdashboard_theme_css_selector_new(const gc
 	return(selector);
 }
 
+/* Add style to builder for cache and remember its index */
+static guint _xfdashboard_theme_css_cache_add_style(GVariantBuilder *ioBuilder,
+													GHashTable *ioStyleIndices,
+													GHashTable *inStyle)
+{
+	GHashTableIter					iter;
+	const gchar						*name;
+	const gchar						*value;
+	GVariantBuilder					styleBuilder;
+	guint							index;
+
+	g_return_val_if_fail(ioBuilder, 0);
+	g_return_val_if_fail(ioStyleIndices, 0);
+	g_return_val_if_fail(inStyle, 0);
+
+	/* Check if style was added already. The index is stored with an
+	 * offset of one in hash-table to distinguish it from NULL.
+	 */
+	index=GPOINTER_TO_UINT(g_hash_table_lookup(ioStyleIndices, inStyle));
+	if(index>0) return(index-1);
+
+	/* Add all properties of style to builder */
+	g_variant_builder_init(&styleBuilder, G_VARIANT_TYPE("a{ss}"));
+
+	g_hash_table_iter_init(&iter, inStyle);
+	while(g_hash_table_iter_next(&iter, (gpointer*)&name, (gpointer*)&value))
+	{
+		g_variant_builder_add(&styleBuilder, "{ss}", name, value ? value : "");
+	}
+
+	g_variant_builder_add_value(ioBuilder, g_variant_builder_end(&styleBuilder));
+
+	/* Remember index of style */
+	index=g_hash_table_size(ioStyleIndices);
+	g_hash_table_insert(ioStyleIndices, inStyle, GUINT_TO_POINTER(index+1));
+
+	return(index);
+}
+
 /* Get function argument and transform it to requested type.
  * Returned value must first be cleared with g_value_unset and
  * then freed with g_free.
@@ -1030,6 +1185,221 @@ static gboolean _xfdashboard_theme_css_function_rgb_rgba(XfdashboardThemeCSS *se
 	return(TRUE);
 }
 
+/* Create a cache for results of CSS functions */
+static XfdashboardThemeCSSFunctionCache* _xfdashboard_theme_css_function_cache_new(void)
+{
+	XfdashboardThemeCSSFunctionCache	*cache;
+
+	cache=g_new0(XfdashboardThemeCSSFunctionCache, 1);
+	cache->results=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+	g_queue_init(&cache->keys);
+
+	return(cache);
+}
+
+/* Remove all results from cache of CSS functions */
+static void _xfdashboard_theme_css_function_cache_clear(XfdashboardThemeCSSFunctionCache *inCache)
+{
+	g_return_if_fail(inCache);
+
+	/* Keys are owned by hash-table so clear queue before hash-table */
+	g_queue_clear(&inCache->keys);
+	g_hash_table_remove_all(inCache->results);
+}
+
+/* Free cache of CSS functions */
+static void _xfdashboard_theme_css_function_cache_free(XfdashboardThemeCSSFunctionCache *inCache)
+{
+	g_return_if_fail(inCache);
+
+	g_queue_clear(&inCache->keys);
+	g_hash_table_destroy(inCache->results);
+	g_free(inCache);
+}
+
+/* Icon theme changed so results of CSS functions depending on it are invalid */
+static void _xfdashboard_theme_css_function_on_icon_theme_changed(GtkIconTheme *inIconTheme,
+																	gpointer inUserData)
+{
+	if(_xfdashboard_theme_css_function_icon_results)
+	{
+		_xfdashboard_theme_css_function_cache_clear(_xfdashboard_theme_css_function_icon_results);
+	}
+}
+
+/* Destroy caches for results of CSS functions */
+static void _xfdashboard_theme_css_function_destroy_caches(void)
+{
+	XfdashboardCore					*core;
+
+	/* Disconnect icon theme "changed" signal handler */
+	if(_xfdashboard_theme_css_function_cache_iconThemeChangedSignalID)
+	{
+		g_signal_handler_disconnect(gtk_icon_theme_get_default(), _xfdashboard_theme_css_function_cache_iconThemeChangedSignalID);
+		_xfdashboard_theme_css_function_cache_iconThemeChangedSignalID=0;
+	}
+
+	/* Disconnect core "shutdown" signal handler */
+	if(_xfdashboard_theme_css_function_cache_shutdownSignalID)
+	{
+		core=xfdashboard_core_get_default();
+		g_signal_handler_disconnect(core, _xfdashboard_theme_css_function_cache_shutdownSignalID);
+		_xfdashboard_theme_css_function_cache_shutdownSignalID=0;
+	}
+
+	/* Destroy caches */
+	if(_xfdashboard_theme_css_function_results)
+	{
+		_xfdashboard_theme_css_function_cache_free(_xfdashboard_theme_css_function_results);
+		_xfdashboard_theme_css_function_results=NULL;
+	}
+
+	if(_xfdashboard_theme_css_function_icon_results)
+	{
+		_xfdashboard_theme_css_function_cache_free(_xfdashboard_theme_css_function_icon_results);
+		_xfdashboard_theme_css_function_icon_results=NULL;
+	}
+}
+
+/* Create caches for results of CSS functions if they do not exist yet */
+static void _xfdashboard_theme_css_function_create_caches(void)
+{
+	XfdashboardCore					*core;
+
+	/* Caches were already set up */
+	if(_xfdashboard_theme_css_function_results) return;
+
+	_xfdashboard_theme_css_function_results=_xfdashboard_theme_css_function_cache_new();
+	_xfdashboard_theme_css_function_icon_results=_xfdashboard_theme_css_function_cache_new();
+
+	/* Connect to "changed" signal of icon theme to invalidate results
+	 * of CSS functions depending on icon theme.
+	 */
+	_xfdashboard_theme_css_function_cache_iconThemeChangedSignalID=
+		g_signal_connect(gtk_icon_theme_get_default(),
+							"changed",
+							G_CALLBACK(_xfdashboard_theme_css_function_on_icon_theme_changed),
+							NULL);
+
+	/* Connect to "shutdown" signal of core to destroy caches */
+	core=xfdashboard_core_get_default();
+	_xfdashboard_theme_css_function_cache_shutdownSignalID=
+		g_signal_connect(core,
+							"shutdown",
+							G_CALLBACK(_xfdashboard_theme_css_function_destroy_caches),
+							NULL);
+}
+
+/* Get cache for results of CSS function and the key of the function call
+ * for looking up and storing its result. The key is built from function name
+ * and its arguments. Functions depending on icon theme include also the theme
+ * path as icons may be looked up relative to it.
+ */
+static XfdashboardThemeCSSFunctionCache* _xfdashboard_theme_css_function_get_cache(XfdashboardThemeCSS *self,
+																						const gchar *inName,
+																						GList *inArguments,
+																						gchar **outKey)
+{
+	XfdashboardThemeCSSPrivate		*priv;
+	XfdashboardThemeCSSFunctionCache	*cache;
+	GString							*key;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_THEME_CSS(self), NULL);
+	g_return_val_if_fail(inName && *inName, NULL);
+	g_return_val_if_fail(outKey, NULL);
+
+	priv=self->priv;
+	key=g_string_new(inName);
+
+	/* Create caches if they do not exist yet */
+	_xfdashboard_theme_css_function_create_caches();
+
+	/* Select cache */
+	if(g_strcmp0(inName, "try_icons")==0)
+	{
+		cache=_xfdashboard_theme_css_function_icon_results;
+
+		g_string_append_c(key, '\x1f');
+		if(priv->themePath) g_string_append(key, priv->themePath);
+	}
+		else cache=_xfdashboard_theme_css_function_results;
+
+	/* Add arguments to key */
+	for(; inArguments; inArguments=g_list_next(inArguments))
+	{
+		g_string_append_c(key, '\x1e');
+		g_string_append(key, (const gchar*)inArguments->data);
+	}
+
+	/* Return cache and key */
+	*outKey=g_string_free(key, FALSE);
+	return(cache);
+}
+
+/* Lookup result of a previous call to CSS function with same arguments.
+ * Returns a copy of result which must be freed with g_free or NULL if not found.
+ */
+static gchar* _xfdashboard_theme_css_function_lookup_result(XfdashboardThemeCSS *self,
+																const gchar *inName,
+																GList *inArguments)
+{
+	XfdashboardThemeCSSFunctionCache	*cache;
+	gchar							*key;
+	const gchar						*result;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_THEME_CSS(self), NULL);
+	g_return_val_if_fail(inName && *inName, NULL);
+
+	cache=_xfdashboard_theme_css_function_get_cache(self, inName, inArguments, &key);
+	result=(const gchar*)g_hash_table_lookup(cache->results, key);
+	g_free(key);
+
+	xfdashboard_statistics_add(result ? "style.function-cache-hit" : "style.function-cache-miss", 1);
+
+	return(g_strdup(result));
+}
+
+/* Remember result of call to CSS function */
+static void _xfdashboard_theme_css_function_store_result(XfdashboardThemeCSS *self,
+															const gchar *inName,
+															GList *inArguments,
+															const gchar *inResult)
+{
+	XfdashboardThemeCSSFunctionCache	*cache;
+	gchar							*key;
+	gchar							*oldestKey;
+
+	g_return_if_fail(XFDASHBOARD_IS_THEME_CSS(self));
+	g_return_if_fail(inName && *inName);
+	g_return_if_fail(inResult);
+
+	cache=_xfdashboard_theme_css_function_get_cache(self, inName, inArguments, &key);
+
+	/* If a result for this function call is cached already just replace it.
+	 * The hash-table keeps its key which is still referenced in queue and
+	 * frees the new one.
+	 */
+	if(g_hash_table_contains(cache->results, key))
+	{
+		g_hash_table_insert(cache->results, key, g_strdup(inResult));
+		return;
+	}
+
+	/* Drop oldest results if cache is full */
+	while(g_hash_table_size(cache->results)>=XFDASHBOARD_THEME_CSS_FUNCTION_CACHE_MAX_ENTRIES)
+	{
+		oldestKey=(gchar*)g_queue_pop_head(&cache->keys);
+		if(!oldestKey) break;
+
+		g_hash_table_remove(cache->results, oldestKey);
+		xfdashboard_statistics_add("style.function-cache-evict", 1);
+	}
+
+	/* Cache takes ownership of key */
+	g_hash_table_insert(cache->results, key, g_strdup(inResult));
+	g_queue_push_tail(&cache->keys, key);
+}
+
 /* Register CSS function */
 static void _xfdashboard_theme_css_register_function(XfdashboardThemeCSS *self,
 														const gchar *inName,
@@ -1352,8 +1722,22 @@ static gchar* _xfdashboard_theme_css_parse_at_identifier(XfdashboardThemeCSS *se
 		ioScanner->config=oldScannerConfig;
 		g_free(scannerConfig);
 
-		/* Do function call if no error occured so far */
+		/* Lookup result of a previous call to function with same arguments */
 		if(!error)
+		{
+			result=_xfdashboard_theme_css_function_lookup_result(self, identifier, arguments);
+			if(result)
+			{
+				XFDASHBOARD_DEBUG(self, THEME,
+									"Using cached result of function %s with %d arguments: %s",
+									identifier,
+									g_list_length(arguments),
+									result);
+			}
+		}
+
+		/* Do function call if no error occured so far and no result is cached */
+		if(!error && !result)
 		{
 			GValue				functionValue=G_VALUE_INIT;
 			GError				*functionError;
@@ -1377,6 +1761,7 @@ static gchar* _xfdashboard_theme_css_parse_at_identifier(XfdashboardThemeCSS *se
 				if(g_value_transform(&functionValue, &stringValue))
 				{
 					result=g_value_dup_string(&stringValue);
+					if(result) _xfdashboard_theme_css_function_store_result(self, identifier, arguments, result);
 				}
 					else
 					{
@@ -2104,55 +2489,19 @@ static GTokenType _xfdashboard_theme_css_command_import(XfdashboardThemeCSS *sel
 	if(!g_path_is_absolute(filename))
 	{
 		gchar					*tempFilename;
-		gchar					*cssPath;
-		gboolean				foundFile;
-
-		foundFile=FALSE;
 
-		/* Path to file is relative so check if a file, relative to
-		 * path of CSS file currently parsed, exists.
-		 */
-		if(inScanner->input_fd>0 &&
-			inScanner->input_name)
-		{
-			cssPath=g_path_get_dirname(inScanner->input_name);
-
-			tempFilename=g_build_filename(cssPath, filename, NULL);
-			if(g_file_test(tempFilename, G_FILE_TEST_EXISTS))
-			{
-				XFDASHBOARD_DEBUG(self, THEME,
-									"Resolved relative path '%s' to import to '%s' which is relative to current css file '%s'.",
-									filename,
-									tempFilename,
-									inScanner->input_name);
-
-				g_free(filename);
-				filename=g_strdup(tempFilename);
-				foundFile=TRUE;
-			}
+		tempFilename=_xfdashboard_theme_css_resolve_import_path(priv->themePath,
+																inScanner->input_name,
+																filename);
 
-			g_free(cssPath);
-			g_free(tempFilename);
-		}
-
-		/* If current CSS being parsed is not a file or the relative path
-		 * to current CSS file to import does not exist, assume it is a
-		 * relative path to theme.
-		 */
-		if(!foundFile)
-		{
-			tempFilename=g_build_filename(priv->themePath, filename, NULL);
-
-			XFDASHBOARD_DEBUG(self, THEME,
-								"Resolved relative path '%s' to import to '%s' which is relative to theme path '%s'.",
-								filename,
-								tempFilename,
-								priv->themePath);
+		XFDASHBOARD_DEBUG(self, THEME,
+							"Resolved relative path '%s' to import from '%s' to '%s'.",
+							filename,
+							inScanner->input_name,
+							tempFilename);
 
-			g_free(filename);
-			filename=g_strdup(tempFilename);
-			g_free(tempFilename);
-		}
+		g_free(filename);
+		filename=tempFilename;
 	}
 
 	oldLineOffset=priv->offsetLine;
@@ -2500,6 +2849,8 @@ static GTokenType _xfdashboard_theme_css_parse_css_block(XfdashboardThemeCSS *se
 
 static gboolean _xfdashboard_theme_css_parse_css(XfdashboardThemeCSS *self,
 													GInputStream *inStream,
+													const gchar *inText,
+													gsize inTextLength,
 													const gchar *inName,
 													gint inPriority,
 													GList **outSelectors,
@@ -2514,7 +2865,7 @@ static gboolean _xfdashboard_theme_css_parse_css(XfdashboardThemeCSS *self,
 	GList							*styles;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_THEME_CSS(self), FALSE);
-	g_return_val_if_fail(G_IS_INPUT_STREAM(inStream), FALSE);
+	g_return_val_if_fail(inText || G_IS_INPUT_STREAM(inStream), FALSE);
 	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
 	g_return_val_if_fail(outSelectors && *outSelectors==NULL, FALSE);
 	g_return_val_if_fail(outStyles && *outStyles==NULL, FALSE);
@@ -2524,32 +2875,19 @@ static gboolean _xfdashboard_theme_css_parse_css(XfdashboardThemeCSS *self,
 	selectors=NULL;
 	styles=NULL;
 
-	/* Create scanner object with default settings */
-	scanner=g_scanner_new(NULL);
-	scanner->input_name=inName;
-	scanner->user_data=GINT_TO_POINTER(inPriority);
-
-	/* Set up scanner config
-	 * - Identifiers are allowed to contain '-' (minus sign) as non-first characters
-	 * - Disallow scanning float values as we need '.' for identifiers
-	 * - Set up single comment line not to include '#' as this character is need for identifiers
-	 * - Disable parsing HEX values
-	 * - Identifiers cannot be single quoted
-	 * - Identifiers cannot be double quoted
-	 */
-	scanner->config->cset_identifier_nth=G_CSET_a_2_z "-_0123456789" G_CSET_A_2_Z G_CSET_LATINS G_CSET_LATINC;
-	scanner->config->scan_float=FALSE;
-	scanner->config->cpair_comment_single="\1\n";
-	scanner->config->scan_hex=FALSE;
-	scanner->config->scan_string_sq=FALSE;
-	scanner->config->scan_string_dq=FALSE;
+	/* Create scanner object */
+	scanner=_xfdashboard_theme_css_create_scanner(inName, inPriority);
 
-	/* Set input stream */
-	if(G_IS_FILE_DESCRIPTOR_BASED(inStream))
+	/* Set input text or stream */
+	if(inText)
 	{
-		g_scanner_input_file(scanner,
-								g_file_descriptor_based_get_fd(G_FILE_DESCRIPTOR_BASED(inStream)));
+		g_scanner_input_text(scanner, inText, (guint)inTextLength);
 	}
+		else if(G_IS_FILE_DESCRIPTOR_BASED(inStream))
+		{
+			g_scanner_input_file(scanner,
+									g_file_descriptor_based_get_fd(G_FILE_DESCRIPTOR_BASED(inStream)));
+		}
 		else
 		{
 			/* Set error */
@@ -2620,71 +2958,265 @@ static gboolean _xfdashboard_theme_css_parse_css(XfdashboardThemeCSS *self,
 	return(success);
 }
 
-/* Callback for sorting selector matches by score */
-static gint _xfdashboard_theme_css_sort_by_score(XfdashboardThemeCSSSelectorMatch *inLeft,
-													XfdashboardThemeCSSSelectorMatch *inRight)
+/* Create and destroy data of CSS file to read by a worker thread */
+static XfdashboardThemeCSSPreloadFile* _xfdashboard_theme_css_preload_file_new(const gchar *inThemePath,
+																				XfdashboardThemeCSSPreloadFile *inParent,
+																				const gchar *inPath)
 {
-	gint							priority;
-	guint							line;
-	guint							position;
-	gint							score;
-	XfdashboardCssSelectorRule		*leftRule;
-	XfdashboardCssSelectorRule		*rightRule;
-
-	g_assert(inLeft);
-	g_assert(inRight);
+	XfdashboardThemeCSSPreloadFile	*file;
 
-	score=inLeft->score-inRight->score;
-	if(score!=0) return(score);
+	g_return_val_if_fail(inPath && *inPath, NULL);
 
-	/* Get CSS selector rule to compare them */
-	g_assert(inLeft->selector && inLeft->selector->selector);
-	g_assert(inRight->selector && inRight->selector->selector);
+	file=g_new0(XfdashboardThemeCSSPreloadFile, 1);
+	file->themePath=inThemePath;
+	file->parent=inParent;
+	file->path=g_strdup(inPath);
 
-	leftRule=xfdashboard_css_selector_get_rule(inLeft->selector->selector);
-	rightRule=xfdashboard_css_selector_get_rule(inRight->selector->selector);
+	return(file);
+}
 
-	/* Compare CSS selector rules */
-	priority=xfdashboard_css_selector_rule_get_priority(leftRule);
-	priority-=xfdashboard_css_selector_rule_get_priority(rightRule);
-	if(priority!=0) return(priority);
+static void _xfdashboard_theme_css_preload_file_free(gpointer inData)
+{
+	XfdashboardThemeCSSPreloadFile	*file;
 
-	line=xfdashboard_css_selector_rule_get_line(leftRule);
-	line-=xfdashboard_css_selector_rule_get_line(rightRule);
-	if(line!=0) return(line);
+	g_return_if_fail(inData);
 
-	position=xfdashboard_css_selector_rule_get_position(leftRule);
-	position-=xfdashboard_css_selector_rule_get_position(rightRule);
-	if(position!=0) return(position);
+	file=(XfdashboardThemeCSSPreloadFile*)inData;
 
-	return(0);
+	/* Release allocated resources */
+	g_slist_free_full(file->imports, _xfdashboard_theme_css_preload_file_free);
+	if(file->contents) g_free(file->contents);
+	if(file->path) g_free(file->path);
+	g_free(file);
 }
 
-/* IMPLEMENTATION: GObject */
-
-/* Dispose this object */
-static void _xfdashboard_theme_css_dispose(GObject *inObject)
+/* Get filename of an '@import' identifier just scanned like
+ * _xfdashboard_theme_css_command_import() does but do not report any error.
+ * Errors are reported when the CSS file is parsed at main thread.
+ */
+static gchar* _xfdashboard_theme_css_preload_get_import_filename(GScanner *inScanner)
 {
-	XfdashboardThemeCSS				*self=XFDASHBOARD_THEME_CSS(inObject);
-	XfdashboardThemeCSSPrivate		*priv=self->priv;
+	GTokenType						token;
+	GScannerConfig					*scannerConfig;
+	GScannerConfig					*oldScannerConfig;
+	gchar							*filename;
 
-	/* Release allocated resources */
-	if(priv->themePath)
-	{
-		g_free(priv->themePath);
-		priv->themePath=NULL;
-	}
+	g_return_val_if_fail(inScanner, NULL);
 
-	if(priv->selectors)
-	{
-		g_list_free_full(priv->selectors, (GDestroyNotify)_xfdashboard_theme_css_selector_free);
-		priv->selectors=NULL;
-	}
+	filename=NULL;
 
-	if(priv->styles)
-	{
-		g_list_free_full(priv->styles, (GDestroyNotify)g_hash_table_unref);
-		priv->styles=NULL;
+	/* Set parser option to parse filename */
+#if GLIB_CHECK_VERSION(2, 67, 4)
+	scannerConfig=(GScannerConfig*)g_memdup2(inScanner->config, sizeof(GScannerConfig));
+#else
+	scannerConfig=(GScannerConfig*)g_memdup(inScanner->config, sizeof(GScannerConfig));
+#endif
+	scannerConfig->scan_identifier_1char=1;
+	scannerConfig->char_2_token=FALSE;
+	scannerConfig->scan_string_sq=TRUE;
+	scannerConfig->scan_string_dq=TRUE;
+
+	oldScannerConfig=inScanner->config;
+	inScanner->config=scannerConfig;
+
+	/* Syntax is: @import(filename) */
+	token=g_scanner_get_next_token(inScanner);
+	if(token==G_TOKEN_CHAR && inScanner->value.v_char=='(')
+	{
+		token=g_scanner_get_next_token(inScanner);
+		while((token==G_TOKEN_CHAR && inScanner->value.v_char!=')') ||
+				token==G_TOKEN_IDENTIFIER ||
+				token==G_TOKEN_STRING)
+		{
+			switch(token)
+			{
+				case G_TOKEN_CHAR:
+					filename=_xfdashboard_theme_css_append_char(filename, inScanner->value.v_char);
+					break;
+
+				case G_TOKEN_STRING:
+					filename=_xfdashboard_theme_css_append_string(filename, inScanner->value.v_string);
+					break;
+
+				default:
+					filename=_xfdashboard_theme_css_append_string(filename, inScanner->value.v_identifier);
+					break;
+			}
+
+			token=g_scanner_get_next_token(inScanner);
+		}
+
+		/* Expect closing ')' */
+		if(filename &&
+			(token!=G_TOKEN_CHAR || inScanner->value.v_char!=')'))
+		{
+			g_free(filename);
+			filename=NULL;
+		}
+	}
+
+	/* Restore old parser options */
+	inScanner->config=oldScannerConfig;
+	g_free(scannerConfig);
+
+	return(filename);
+}
+
+/* Read CSS file and all CSS files it imports. The content of each file is
+ * tokenized with its own scanner to find the '@import' identifiers but is not
+ * parsed further as parsing depends on constants and CSS functions of files
+ * parsed before. This function does not access any object and is safe to be
+ * called from worker threads.
+ */
+static void _xfdashboard_theme_css_preload_file_read(gpointer inData, gpointer inUserData)
+{
+	XfdashboardThemeCSSPreloadFile	*file;
+	XfdashboardThemeCSSPreloadFile	*importFile;
+	XfdashboardThemeCSSPreloadFile	*iter;
+	GScanner						*scanner;
+	GTokenType						token;
+	gchar							*filename;
+	gchar							*importPath;
+
+	g_return_if_fail(inData);
+
+	file=(XfdashboardThemeCSSPreloadFile*)inData;
+
+	/* Read content of file. If it fails the file is read again at main thread
+	 * when it is parsed which will report the error.
+	 */
+	if(!g_file_get_contents(file->path, &file->contents, &file->length, NULL))
+	{
+		file->contents=NULL;
+		file->length=0;
+		return;
+	}
+
+	/* Tokenize content to find files to import */
+	scanner=_xfdashboard_theme_css_create_scanner(file->path, 0);
+	g_scanner_input_text(scanner, file->contents, (guint)file->length);
+
+	token=g_scanner_get_next_token(scanner);
+	while(token!=G_TOKEN_EOF)
+	{
+		/* Check for '@import' identifier */
+		if((guint)token=='@' &&
+			g_scanner_get_next_token(scanner)==G_TOKEN_IDENTIFIER &&
+			g_strcmp0(scanner->value.v_identifier, "import")==0)
+		{
+			filename=_xfdashboard_theme_css_preload_get_import_filename(scanner);
+			if(filename)
+			{
+				importPath=_xfdashboard_theme_css_resolve_import_path(file->themePath, file->path, filename);
+
+				/* Do not follow import cycles */
+				for(iter=file; iter && g_strcmp0(iter->path, importPath)!=0; iter=iter->parent);
+
+				if(!iter)
+				{
+					importFile=_xfdashboard_theme_css_preload_file_new(file->themePath, file, importPath);
+					file->imports=g_slist_append(file->imports, importFile);
+					_xfdashboard_theme_css_preload_file_read(importFile, inUserData);
+				}
+
+				/* Release allocated resources */
+				g_free(importPath);
+				g_free(filename);
+			}
+		}
+
+		/* Get next token */
+		token=g_scanner_get_next_token(scanner);
+	}
+
+	/* Destroy scanner */
+	g_scanner_destroy(scanner);
+}
+
+/* Add CSS file read and all CSS files it imports to lookup table */
+static void _xfdashboard_theme_css_preload_file_collect(GHashTable *ioFiles, XfdashboardThemeCSSPreloadFile *inFile)
+{
+	GSList							*iter;
+
+	g_return_if_fail(ioFiles);
+	g_return_if_fail(inFile);
+
+	if(!g_hash_table_contains(ioFiles, inFile->path))
+	{
+		g_hash_table_insert(ioFiles, inFile->path, inFile);
+	}
+
+	for(iter=inFile->imports; iter; iter=g_slist_next(iter))
+	{
+		_xfdashboard_theme_css_preload_file_collect(ioFiles, (XfdashboardThemeCSSPreloadFile*)iter->data);
+	}
+}
+
+/* Callback for sorting selector matches by score */
+static gint _xfdashboard_theme_css_sort_by_score(XfdashboardThemeCSSSelectorMatch *inLeft,
+													XfdashboardThemeCSSSelectorMatch *inRight)
+{
+	gint							priority;
+	guint							line;
+	guint							position;
+	gint							score;
+	XfdashboardCssSelectorRule		*leftRule;
+	XfdashboardCssSelectorRule		*rightRule;
+
+	g_assert(inLeft);
+	g_assert(inRight);
+
+	score=inLeft->score-inRight->score;
+	if(score!=0) return(score);
+
+	/* Get CSS selector rule to compare them */
+	g_assert(inLeft->selector && inLeft->selector->selector);
+	g_assert(inRight->selector && inRight->selector->selector);
+
+	leftRule=xfdashboard_css_selector_get_rule(inLeft->selector->selector);
+	rightRule=xfdashboard_css_selector_get_rule(inRight->selector->selector);
+
+	/* Compare CSS selector rules */
+	priority=xfdashboard_css_selector_rule_get_priority(leftRule);
+	priority-=xfdashboard_css_selector_rule_get_priority(rightRule);
+	if(priority!=0) return(priority);
+
+	line=xfdashboard_css_selector_rule_get_line(leftRule);
+	line-=xfdashboard_css_selector_rule_get_line(rightRule);
+	if(line!=0) return(line);
+
+	position=xfdashboard_css_selector_rule_get_position(leftRule);
+	position-=xfdashboard_css_selector_rule_get_position(rightRule);
+	if(position!=0) return(position);
+
+	return(0);
+}
+
+/* IMPLEMENTATION: GObject */
+
+/* Dispose this object */
+static void _xfdashboard_theme_css_dispose(GObject *inObject)
+{
+	XfdashboardThemeCSS				*self=XFDASHBOARD_THEME_CSS(inObject);
+	XfdashboardThemeCSSPrivate		*priv=self->priv;
+
+	/* Release allocated resources */
+	if(priv->themePath)
+	{
+		g_free(priv->themePath);
+		priv->themePath=NULL;
+	}
+
+	if(priv->selectors)
+	{
+		g_list_free_full(priv->selectors, (GDestroyNotify)_xfdashboard_theme_css_selector_free);
+		priv->selectors=NULL;
+	}
+
+	if(priv->styles)
+	{
+		g_list_free_full(priv->styles, (GDestroyNotify)g_hash_table_unref);
+		priv->styles=NULL;
 	}
 
 	if(priv->names)
@@ -2769,6 +3301,7 @@ void xfdashboard_theme_css_init(XfdashboardThemeCSS *self)
 	priv->names=NULL;
 	priv->registeredFunctions=NULL;
 	priv->offsetLine=0;
+	priv->preloadedFiles=NULL;
 
 	/* Register CSS functions */
 #define REGISTER_CSS_FUNC(name, callback) \
@@ -2840,6 +3373,7 @@ gboolean xfdashboard_theme_css_add_file(XfdashboardThemeCSS *self,
 											GError **outError)
 {
 	XfdashboardThemeCSSPrivate		*priv;
+	XfdashboardThemeCSSPreloadFile	*preloadFile;
 	GFile							*file;
 	GFileInputStream				*stream;
 	GError							*error;
@@ -2851,47 +3385,73 @@ gboolean xfdashboard_theme_css_add_file(XfdashboardThemeCSS *self,
 	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
 
 	priv=self->priv;
+	file=NULL;
+	stream=NULL;
+	error=NULL;
 	selectors=NULL;
 	styles=NULL;
 
-	/* Load and parse CSS file */
-	file=g_file_new_for_path(inPath);
-	if(!file)
-	{
-		_xfdashboard_theme_css_set_error(self,
-											outError,
-											XFDASHBOARD_THEME_CSS_ERROR_UNSUPPORTED_STREAM,
-											"Could not get file for path '%s'",
-											inPath);
+	/* Parse CSS file from content read already by xfdashboard_theme_css_add_files()
+	 * or load and parse CSS file now.
+	 */
+	preloadFile=NULL;
+	if(priv->preloadedFiles) preloadFile=g_hash_table_lookup(priv->preloadedFiles, inPath);
 
-		return(FALSE);
+	if(preloadFile && preloadFile->contents)
+	{
+		_xfdashboard_theme_css_parse_css(self,
+											NULL,
+											preloadFile->contents,
+											preloadFile->length,
+											inPath,
+											inPriority,
+											&selectors,
+											&styles,
+											&error);
 	}
+		else
+		{
+			file=g_file_new_for_path(inPath);
+			if(!file)
+			{
+				_xfdashboard_theme_css_set_error(self,
+													outError,
+													XFDASHBOARD_THEME_CSS_ERROR_UNSUPPORTED_STREAM,
+													"Could not get file for path '%s'",
+													inPath);
 
-	error=NULL;
-	stream=g_file_read(file, NULL, &error);
-	if(error)
-	{
-		g_propagate_error(outError, error);
+				return(FALSE);
+			}
 
-		/* Release allocated resources */
-		g_object_unref(file);
+			stream=g_file_read(file, NULL, &error);
+			if(error)
+			{
+				g_propagate_error(outError, error);
 
-		return(FALSE);
-	}
+				/* Release allocated resources */
+				g_object_unref(file);
+
+				return(FALSE);
+			}
+
+			_xfdashboard_theme_css_parse_css(self,
+												G_INPUT_STREAM(stream),
+												NULL,
+												0,
+												inPath,
+												inPriority,
+												&selectors,
+												&styles,
+												&error);
+		}
 
-	_xfdashboard_theme_css_parse_css(self,
-										G_INPUT_STREAM(stream),
-										inPath,
-										inPriority,
-										&selectors,
-										&styles,
-										&error);
 	if(error)
 	{
 		g_propagate_error(outError, error);
 
 		/* Release allocated resources */
-		g_object_unref(file);
+		if(stream) g_object_unref(stream);
+		if(file) g_object_unref(file);
 
 		return(FALSE);
 	}
@@ -2923,11 +3483,575 @@ gboolean xfdashboard_theme_css_add_file(XfdashboardThemeCSS *self,
 	}
 
 	/* Release allocated resources */
-	g_object_unref(file);
+	if(stream) g_object_unref(stream);
+	if(file) g_object_unref(file);
+
+	return(TRUE);
+}
+
+/**
+ * xfdashboard_theme_css_add_files:
+ * @self: A #XfdashboardThemeCSS
+ * @inPaths: (element-type utf8): The paths to CSS files to load
+ * @outError: A return location for a #GError or %NULL
+ *
+ * Loads all CSS files at @inPaths into theme CSS object at @self in the order
+ * they are listed. The index of a CSS file at @inPaths is used as priority of
+ * its entries like it is passed to xfdashboard_theme_css_add_file().
+ *
+ * The CSS files and all CSS files they import are read by a pool of worker
+ * threads first. The CSS files are then parsed and their selectors and styles
+ * are created in the calling thread in the order they are listed.
+ *
+ * If loading a CSS file fails, the error message will be placed inside error
+ * at @outError (if not %NULL) and the remaining CSS files are not loaded.
+ *
+ * Return value: %TRUE if all CSS files could be loaded or %FALSE if not and
+ *   error is stored at @outError.
+ */
+gboolean xfdashboard_theme_css_add_files(XfdashboardThemeCSS *self,
+											GPtrArray *inPaths,
+											GError **outError)
+{
+	XfdashboardThemeCSSPrivate		*priv;
+	GPtrArray						*files;
+	GThreadPool						*pool;
+	GError							*error;
+	gboolean						success;
+	guint							i;
+	gint64							profilerBegin;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_THEME_CSS(self), FALSE);
+	g_return_val_if_fail(inPaths, FALSE);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
+
+	priv=self->priv;
+	error=NULL;
+	success=TRUE;
+
+	/* Read all CSS files and the CSS files they import by a pool of worker
+	 * threads. If no thread pool could be created the files are read at this
+	 * thread.
+	 */
+	profilerBegin=xfdashboard_profiler_begin("theme");
+
+	files=g_ptr_array_new_with_free_func(_xfdashboard_theme_css_preload_file_free);
+	for(i=0; i<inPaths->len; i++)
+	{
+		g_ptr_array_add(files,
+						_xfdashboard_theme_css_preload_file_new(priv->themePath,
+																NULL,
+																(const gchar*)g_ptr_array_index(inPaths, i)));
+	}
+
+	pool=g_thread_pool_new(_xfdashboard_theme_css_preload_file_read,
+							NULL,
+							MAX(1, MIN((gint)files->len, (gint)g_get_num_processors())),
+							FALSE,
+							NULL);
+	for(i=0; i<files->len; i++)
+	{
+		if(pool) g_thread_pool_push(pool, g_ptr_array_index(files, i), NULL);
+			else _xfdashboard_theme_css_preload_file_read(g_ptr_array_index(files, i), NULL);
+	}
+	if(pool) g_thread_pool_free(pool, FALSE, TRUE);
+
+	xfdashboard_profiler_end("theme", "theme-css.read-files", profilerBegin);
+
+	/* Parse CSS files in the order given from content read. The first CSS file
+	 * in order importing a file provides its content.
+	 */
+	priv->preloadedFiles=g_hash_table_new(g_str_hash, g_str_equal);
+	for(i=0; i<files->len; i++)
+	{
+		_xfdashboard_theme_css_preload_file_collect(priv->preloadedFiles, g_ptr_array_index(files, i));
+	}
+
+	for(i=0; success && i<inPaths->len; i++)
+	{
+		XFDASHBOARD_DEBUG(self, THEME,
+							"Loading CSS file %s with priority %u",
+							(const gchar*)g_ptr_array_index(inPaths, i),
+							i);
+
+		if(!xfdashboard_theme_css_add_file(self, g_ptr_array_index(inPaths, i), i, &error))
+		{
+			g_propagate_error(outError, error);
+			success=FALSE;
+		}
+	}
+
+	/* Release allocated resources */
+	g_hash_table_destroy(priv->preloadedFiles);
+	priv->preloadedFiles=NULL;
+	g_ptr_array_unref(files);
+
+	return(success);
+}
+
+/**
+ * xfdashboard_theme_css_load_cache:
+ * @self: A #XfdashboardThemeCSS
+ * @inCacheFile: The path to cache file to load
+ * @inKey: The key the cache file must have been created for
+ * @outError: A return location for a #GError or %NULL
+ *
+ * Loads all selectors and styles from the precompiled cache file at
+ * @inCacheFile created by xfdashboard_theme_css_save_cache() into theme CSS
+ * object at @self instead of parsing all CSS files again. The cache file is
+ * only used if it was created for the key at @inKey and if none of the CSS
+ * files it was created from has been modified since.
+ *
+ * This function must be called before any CSS file was added with
+ * xfdashboard_theme_css_add_file().
+ *
+ * If loading cache fails, the error message will be placed inside error
+ * at @outError (if not %NULL) and the theme CSS object at @self is left
+ * unchanged.
+ *
+ * Return value: %TRUE if cache file could be loaded or %FALSE if not and error
+ *   is stored at @outError.
+ */
+gboolean xfdashboard_theme_css_load_cache(XfdashboardThemeCSS *self,
+											const gchar *inCacheFile,
+											const gchar *inKey,
+											GError **outError)
+{
+	XfdashboardThemeCSSPrivate		*priv;
+	GMappedFile						*mappedFile;
+	GBytes							*bytes;
+	GVariant						*cache;
+	GVariant						*sources;
+	GVariant						*selectors;
+	GVariant						*styles;
+	GVariant						*style;
+	GVariantIter					iter;
+	GVariantIter					styleIter;
+	guint32							version;
+	const gchar						*key;
+	gint32							offsetLine;
+	const gchar						*path;
+	gint64							mtime;
+	gint64							size;
+	GStatBuf						fileInfo;
+	guint32							type;
+	guint32							styleIndex;
+	const gchar						*selectorString;
+	gint32							priority;
+	const gchar						*source;
+	guint32							line;
+	guint32							position;
+	gchar							*name;
+	gchar							*value;
+	GPtrArray						*loadedStyles;
+	GList							*loadedSelectors;
+	GSList							*loadedNames;
+	GError							*error;
+	gboolean						success;
+	guint							i;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_THEME_CSS(self), FALSE);
+	g_return_val_if_fail(inCacheFile!=NULL && *inCacheFile!=0, FALSE);
+	g_return_val_if_fail(inKey!=NULL, FALSE);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
+
+	priv=self->priv;
+	error=NULL;
+	success=TRUE;
+
+	/* Cache can only be loaded into an empty theme CSS object */
+	if(priv->selectors || priv->styles || priv->names)
+	{
+		_xfdashboard_theme_css_set_error(self,
+											outError,
+											XFDASHBOARD_THEME_CSS_ERROR_INVALID_ARGUMENT,
+											"Cannot load cache '%s' into non-empty theme CSS",
+											inCacheFile);
+		return(FALSE);
+	}
+
+	/* Map cache file into memory and create a variant from it */
+	mappedFile=g_mapped_file_new(inCacheFile, FALSE, &error);
+	if(!mappedFile)
+	{
+		g_propagate_error(outError, error);
+		return(FALSE);
+	}
+
+	bytes=g_mapped_file_get_bytes(mappedFile);
+	cache=g_variant_ref_sink(g_variant_new_from_bytes(G_VARIANT_TYPE(XFDASHBOARD_THEME_CSS_CACHE_TYPE), bytes, FALSE));
+	g_bytes_unref(bytes);
+	g_mapped_file_unref(mappedFile);
+
+	g_variant_get(cache,
+					"(u&s@a(sxx)i@a(uusisuu)@aa{ss})",
+					&version,
+					&key,
+					&sources,
+					&offsetLine,
+					&selectors,
+					&styles);
+
+	/* Check that cache file was created by this version and for requested key */
+	if(version!=XFDASHBOARD_THEME_CSS_CACHE_VERSION ||
+		g_strcmp0(key, inKey)!=0)
+	{
+		_xfdashboard_theme_css_set_error(self,
+											outError,
+											XFDASHBOARD_THEME_CSS_ERROR_INVALID_CACHE,
+											"Cache '%s' was created for another version or key",
+											inCacheFile);
+
+		/* Release allocated resources */
+		g_variant_unref(sources);
+		g_variant_unref(selectors);
+		g_variant_unref(styles);
+		g_variant_unref(cache);
+
+		return(FALSE);
+	}
+
+	/* Check that no CSS file was modified since cache file was created */
+	loadedNames=NULL;
+
+	g_variant_iter_init(&iter, sources);
+	while(success && g_variant_iter_next(&iter, "(&sxx)", &path, &mtime, &size))
+	{
+		if(g_stat(path, &fileInfo)!=0 ||
+			xfdashboard_get_modification_time(&fileInfo)!=mtime ||
+			(gint64)fileInfo.st_size!=size)
+		{
+			_xfdashboard_theme_css_set_error(self,
+												outError,
+												XFDASHBOARD_THEME_CSS_ERROR_INVALID_CACHE,
+												"Cache '%s' is outdated because '%s' has changed",
+												inCacheFile,
+												path);
+			success=FALSE;
+		}
+			else loadedNames=g_slist_prepend(loadedNames, g_strdup(path));
+	}
+
+	/* Rebuild styles */
+	loadedStyles=g_ptr_array_new_with_free_func((GDestroyNotify)g_hash_table_unref);
+
+	g_variant_iter_init(&iter, styles);
+	while(success && (style=g_variant_iter_next_value(&iter)))
+	{
+		GHashTable					*properties;
+
+		properties=g_hash_table_new_full(g_str_hash,
+											g_str_equal,
+											g_free,
+											(GDestroyNotify)g_free);
+
+		g_variant_iter_init(&styleIter, style);
+		while(g_variant_iter_next(&styleIter, "{ss}", &name, &value))
+		{
+			g_hash_table_insert(properties, name, value);
+		}
+
+		g_ptr_array_add(loadedStyles, properties);
+		g_variant_unref(style);
+	}
+
+	/* Rebuild selectors and assign them their styles */
+	loadedSelectors=NULL;
+
+	g_variant_iter_init(&iter, selectors);
+	while(success &&
+			g_variant_iter_next(&iter,
+								"(uu&si&suu)",
+								&type,
+								&styleIndex,
+								&selectorString,
+								&priority,
+								&source,
+								&line,
+								&position))
+	{
+		XfdashboardThemeCSSSelector	*selector;
+
+		/* Check for valid type and style */
+		if((type!=XFDASHBOARD_THEME_CSS_SELECTOR_TYPE_SELECTOR &&
+				type!=XFDASHBOARD_THEME_CSS_SELECTOR_TYPE_CONSTANT) ||
+			styleIndex>=loadedStyles->len)
+		{
+			_xfdashboard_theme_css_set_error(self,
+												outError,
+												XFDASHBOARD_THEME_CSS_ERROR_INVALID_CACHE,
+												"Cache '%s' contains an invalid selector",
+												inCacheFile);
+			success=FALSE;
+			break;
+		}
+
+		/* Create selector */
+		selector=_xfdashboard_theme_css_selector_new(NULL);
+		selector->type=type;
+		selector->style=g_hash_table_ref(g_ptr_array_index(loadedStyles, styleIndex));
+		loadedSelectors=g_list_prepend(loadedSelectors, selector);
+
+		if(type==XFDASHBOARD_THEME_CSS_SELECTOR_TYPE_SELECTOR)
+		{
+			selector->selector=xfdashboard_css_selector_new_from_string_with_priority(selectorString, priority);
+			if(!selector->selector)
+			{
+				_xfdashboard_theme_css_set_error(self,
+													outError,
+													XFDASHBOARD_THEME_CSS_ERROR_INVALID_CACHE,
+													"Cache '%s' contains invalid selector '%s'",
+													inCacheFile,
+													selectorString);
+				success=FALSE;
+				break;
+			}
+
+			xfdashboard_css_selector_adjust_to_source(selector->selector,
+														(source && *source) ? source : NULL,
+														line,
+														position);
+		}
+	}
+
+	/* If any error occurred, release all loaded data and return error */
+	if(!success)
+	{
+		/* Release allocated resources */
+		g_list_free_full(loadedSelectors, (GDestroyNotify)_xfdashboard_theme_css_selector_free);
+		g_ptr_array_unref(loadedStyles);
+		g_slist_free_full(loadedNames, g_free);
+		g_variant_unref(sources);
+		g_variant_unref(selectors);
+		g_variant_unref(styles);
+		g_variant_unref(cache);
+
+		return(FALSE);
+	}
+
+	/* If we get here cache file was loaded successfully so take over the
+	 * loaded selectors, styles and names of sources.
+	 */
+	priv->selectors=g_list_reverse(loadedSelectors);
+	priv->names=g_slist_reverse(loadedNames);
+	priv->offsetLine=offsetLine;
+
+	for(i=0; i<loadedStyles->len; i++)
+	{
+		priv->styles=g_list_prepend(priv->styles, g_hash_table_ref(g_ptr_array_index(loadedStyles, i)));
+	}
+	priv->styles=g_list_reverse(priv->styles);
+
+	XFDASHBOARD_DEBUG(self, THEME,
+						"Loaded %d selectors and %d styles of %d sources from cache '%s'",
+						g_list_length(priv->selectors),
+						g_list_length(priv->styles),
+						g_slist_length(priv->names),
+						inCacheFile);
+
+	/* Release allocated resources */
+	g_ptr_array_unref(loadedStyles);
+	g_variant_unref(sources);
+	g_variant_unref(selectors);
+	g_variant_unref(styles);
+	g_variant_unref(cache);
 
 	return(TRUE);
 }
 
+/**
+ * xfdashboard_theme_css_save_cache:
+ * @self: A #XfdashboardThemeCSS
+ * @inCacheFile: The path to cache file to write
+ * @inKey: The key to store in cache file
+ * @outError: A return location for a #GError or %NULL
+ *
+ * Stores all selectors and styles parsed from the CSS files added to theme CSS
+ * object at @self in a precompiled cache file at @inCacheFile which can be
+ * loaded later with xfdashboard_theme_css_load_cache() to avoid parsing all
+ * CSS files again. The key at @inKey should identify all other conditions
+ * the parsed CSS depends on, e.g. the icon theme used by \@try_icons.
+ *
+ * If saving cache fails, the error message will be placed inside error
+ * at @outError (if not %NULL).
+ *
+ * Return value: %TRUE if cache file could be saved or %FALSE if not and error
+ *   is stored at @outError.
+ */
+gboolean xfdashboard_theme_css_save_cache(XfdashboardThemeCSS *self,
+											const gchar *inCacheFile,
+											const gchar *inKey,
+											GError **outError)
+{
+	XfdashboardThemeCSSPrivate		*priv;
+	GVariantBuilder					sourcesBuilder;
+	GVariantBuilder					selectorsBuilder;
+	GVariantBuilder					stylesBuilder;
+	GHashTable						*styleIndices;
+	GVariant						*cache;
+	GSList							*names;
+	GList							*iter;
+	GStatBuf						fileInfo;
+	gchar							*fileFolder;
+	GError							*error;
+	gboolean						success;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_THEME_CSS(self), FALSE);
+	g_return_val_if_fail(inCacheFile!=NULL && *inCacheFile!=0, FALSE);
+	g_return_val_if_fail(inKey!=NULL, FALSE);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
+
+	priv=self->priv;
+	error=NULL;
+
+	/* Collect modification time and size of all parsed CSS files */
+	g_variant_builder_init(&sourcesBuilder, G_VARIANT_TYPE("a(sxx)"));
+	for(names=priv->names; names; names=g_slist_next(names))
+	{
+		const gchar					*path;
+
+		path=(const gchar*)names->data;
+		if(g_stat(path, &fileInfo)!=0)
+		{
+			int						errno_save;
+
+			/* Get error code */
+			errno_save=errno;
+
+			/* Set error */
+			g_set_error(outError,
+							G_IO_ERROR,
+							g_io_error_from_errno(errno_save),
+							"Could not get file information of '%s': %s",
+							path,
+							g_strerror(errno_save));
+
+			/* Release allocated resources */
+			g_variant_builder_clear(&sourcesBuilder);
+
+			return(FALSE);
+		}
+
+		g_variant_builder_add(&sourcesBuilder,
+								"(sxx)",
+								path,
+								xfdashboard_get_modification_time(&fileInfo),
+								(gint64)fileInfo.st_size);
+	}
+
+	/* Collect styles in the order they were parsed */
+	styleIndices=g_hash_table_new(g_direct_hash, g_direct_equal);
+
+	g_variant_builder_init(&stylesBuilder, G_VARIANT_TYPE("aa{ss}"));
+	for(iter=priv->styles; iter; iter=g_list_next(iter))
+	{
+		_xfdashboard_theme_css_cache_add_style(&stylesBuilder, styleIndices, (GHashTable*)iter->data);
+	}
+
+	/* Collect selectors and the index of their styles */
+	g_variant_builder_init(&selectorsBuilder, G_VARIANT_TYPE("a(uusisuu)"));
+	for(iter=priv->selectors; iter; iter=g_list_next(iter))
+	{
+		XfdashboardThemeCSSSelector	*selector;
+		XfdashboardCssSelectorRule	*rule;
+		gchar						*selectorString;
+		guint						styleIndex;
+
+		selector=(XfdashboardThemeCSSSelector*)iter->data;
+
+		/* Skip selectors which were not parsed completely */
+		if(!selector->style) continue;
+
+		styleIndex=_xfdashboard_theme_css_cache_add_style(&stylesBuilder, styleIndices, selector->style);
+
+		if(selector->type==XFDASHBOARD_THEME_CSS_SELECTOR_TYPE_SELECTOR)
+		{
+			rule=xfdashboard_css_selector_get_rule(selector->selector);
+			selectorString=xfdashboard_css_selector_to_string(selector->selector);
+
+			g_variant_builder_add(&selectorsBuilder,
+									"(uusisuu)",
+									(guint32)selector->type,
+									(guint32)styleIndex,
+									selectorString ? selectorString : "",
+									xfdashboard_css_selector_rule_get_priority(rule),
+									xfdashboard_css_selector_rule_get_source(rule) ? xfdashboard_css_selector_rule_get_source(rule) : "",
+									xfdashboard_css_selector_rule_get_line(rule),
+									xfdashboard_css_selector_rule_get_position(rule));
+
+			if(selectorString) g_free(selectorString);
+		}
+			else if(selector->type==XFDASHBOARD_THEME_CSS_SELECTOR_TYPE_CONSTANT)
+			{
+				g_variant_builder_add(&selectorsBuilder,
+										"(uusisuu)",
+										(guint32)selector->type,
+										(guint32)styleIndex,
+										"",
+										0,
+										"",
+										0,
+										0);
+			}
+	}
+
+	/* Build cache */
+	cache=g_variant_ref_sink(g_variant_new(XFDASHBOARD_THEME_CSS_CACHE_TYPE,
+											XFDASHBOARD_THEME_CSS_CACHE_VERSION,
+											inKey,
+											&sourcesBuilder,
+											priv->offsetLine,
+											&selectorsBuilder,
+											&stylesBuilder));
+	g_hash_table_destroy(styleIndices);
+
+	/* Create parent folders for cache file if not available */
+	fileFolder=g_path_get_dirname(inCacheFile);
+	if(g_mkdir_with_parents(fileFolder, 0700)<0)
+	{
+		int							errno_save;
+
+		/* Get error code */
+		errno_save=errno;
+
+		/* Set error */
+		g_set_error(outError,
+						G_IO_ERROR,
+						g_io_error_from_errno(errno_save),
+						"Could not create folder for theme cache at %s: %s",
+						fileFolder,
+						g_strerror(errno_save));
+
+		/* Release allocated resources */
+		if(fileFolder) g_free(fileFolder);
+		g_variant_unref(cache);
+
+		return(FALSE);
+	}
+
+	/* Store cache in file */
+	success=g_file_set_contents(inCacheFile,
+								g_variant_get_data(cache),
+								g_variant_get_size(cache),
+								&error);
+	if(!success) g_propagate_error(outError, error);
+		else
+		{
+			XFDASHBOARD_DEBUG(self, THEME,
+								"Saved %d selectors and %d styles of %d sources to cache '%s'",
+								g_list_length(priv->selectors),
+								g_list_length(priv->styles),
+								g_slist_length(priv->names),
+								inCacheFile);
+		}
+
+	/* Release allocated resources */
+	if(fileFolder) g_free(fileFolder);
+	g_variant_unref(cache);
+
+	return(success);
+}
+
 /***
  * xfdashboard_theme_css_get_properties:
  * @self: A #XfdashboardThemeCSS
@@ -2959,6 +4083,7 @@ GHashTable* xfdashboard_theme_css_get_properties(XfdashboardThemeCSS *self,
 	GList								*entry, *matches;
 	XfdashboardThemeCSSSelectorMatch	*match;
 	GHashTable							*result;
+	gint64								profilerBegin;
 #ifdef DEBUG
 	GTimer								*timer=NULL;
 	const gchar							*styleID;
@@ -2974,6 +4099,7 @@ GHashTable* xfdashboard_theme_css_get_properties(XfdashboardThemeCSS *self,
 	priv=self->priv;
 	matches=NULL;
 	match=NULL;
+	profilerBegin=xfdashboard_profiler_begin("style");
 
 #ifdef DEBUG
 	styleID=xfdashboard_stylable_get_name(inStylable);
@@ -3042,6 +4168,8 @@ GHashTable* xfdashboard_theme_css_get_properties(XfdashboardThemeCSS *self,
 
 	g_list_free_full(matches, (GDestroyNotify)_xfdashboard_themes_css_selector_match_free);
 
+	xfdashboard_profiler_end("style", "style.get-properties", profilerBegin);
+
 #ifdef DEBUG
 	XFDASHBOARD_DEBUG(self, STYLE,
 						"Found %u properties for %s in %f seconds" ,
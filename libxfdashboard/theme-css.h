@@ -94,6 +94,7 @@ GQuark xfdashboard_theme_css_error_quark(void);
  * @XFDASHBOARD_THEME_CSS_ERROR_UNSUPPORTED_STREAM: The source CSS is not a file
  * @XFDASHBOARD_THEME_CSS_ERROR_PARSER_ERROR: The CSS file could not be parsed
  * @XFDASHBOARD_THEME_CSS_ERROR_FUNCTION_ERROR: A function used in CSS failed
+ * @XFDASHBOARD_THEME_CSS_ERROR_INVALID_CACHE: The cache file is invalid or outdated
  *
  * Error codes returned by theme CSS.
  */
@@ -102,7 +103,8 @@ typedef enum /*< prefix=XFDASHBOARD_THEME_CSS_ERROR >*/
 	XFDASHBOARD_THEME_CSS_ERROR_INVALID_ARGUMENT,
 	XFDASHBOARD_THEME_CSS_ERROR_UNSUPPORTED_STREAM,
 	XFDASHBOARD_THEME_CSS_ERROR_PARSER_ERROR,
-	XFDASHBOARD_THEME_CSS_ERROR_FUNCTION_ERROR
+	XFDASHBOARD_THEME_CSS_ERROR_FUNCTION_ERROR,
+	XFDASHBOARD_THEME_CSS_ERROR_INVALID_CACHE
 } XfdashboardThemeCSSError;
 
 /* Public declarations */
@@ -128,6 +130,18 @@ gboolean xfdashboard_theme_css_add_file(XfdashboardThemeCSS *self,
 											const gchar *inPath,
 											gint inPriority,
 											GError **outError);
+gboolean xfdashboard_theme_css_add_files(XfdashboardThemeCSS *self,
+											GPtrArray *inPaths,
+											GError **outError);
+
+gboolean xfdashboard_theme_css_load_cache(XfdashboardThemeCSS *self,
+											const gchar *inCacheFile,
+											const gchar *inKey,
+											GError **outError);
+gboolean xfdashboard_theme_css_save_cache(XfdashboardThemeCSS *self,
+											const gchar *inCacheFile,
+											const gchar *inKey,
+											GError **outError);
 
 GHashTable* xfdashboard_theme_css_get_properties(XfdashboardThemeCSS *self,
 													XfdashboardStylable *inStylable);
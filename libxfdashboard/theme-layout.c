@@ -147,6 +147,28 @@
  * `<selected>` attribute at the `<focus>` element which should gain the focus
  * first.
  *
+ * The creation of an `<object>` element which is a child of a `<child>` element
+ * can be deferred by setting its `<deferred>` attribute to a true boolean value.
+ * A deferred object with all its constraints, layout and children is not created
+ * when the interface is built but when its position in the actor tree gets
+ * mapped, e.g. shown, the first time. Objects of a class derived from
+ * #XfdashboardView are deferred by default unless the `<deferred>` attribute is
+ * set to a false boolean value or any object created within it is referenced
+ * from outside. Objects created within a deferred object can only be referenced
+ * from objects of the same deferred object and cannot be focusables.
+ *
+ * Views managed by a #XfdashboardViewpad are not part of the layout but are
+ * created by the viewpad. Views which are hidden, e.g. the applications view,
+ * defer loading their content in the same way until they get mapped the first
+ * time.
+ *
+ * <note>
+ *   <para>
+ *     Actors looked up by their name right after the interface was built, like
+ *     the ones listed below for interface `primary`, must not be deferred.
+ *   </para>
+ * </note>
+ *
  * The format for the XML file can be described with the following simple but
  * not fully accurate DTD:
  *
@@ -156,7 +178,8 @@
  *
  *   <!ELEMENT object     (property*|constraint*|layout|child*)>
  *   <!ATTLIST object     id             ID           #IMPLIED
- *                        class          CDATA        #REQUIRED>
+ *                        class          CDATA        #REQUIRED
+ *                        deferred       (yes | no)   #IMPLIED>
  *
  *   <!ELEMENT property   (#CDATA)>
  *   <!ATTLIST property   name           CDATA        #REQUIRED
@@ -263,6 +286,7 @@
 #include <gio/gio.h>
 
 #include <libxfdashboard/enums.h>
+#include <libxfdashboard/view.h>
 #include <libxfdashboard/utils.h>
 #include <libxfdashboard/compat.h>
 #include <libxfdashboard/debug.h>
@@ -274,6 +298,8 @@ typedef struct _XfdashboardThemeLayoutParsedObject			XfdashboardThemeLayoutParse
 typedef struct _XfdashboardThemeLayoutParserData			XfdashboardThemeLayoutParserData;
 typedef struct _XfdashboardThemeLayoutUnresolvedBuildID		XfdashboardThemeLayoutUnresolvedBuildID;
 typedef struct _XfdashboardThemeLayoutCheckRefID			XfdashboardThemeLayoutCheckRefID;
+typedef struct _XfdashboardThemeLayoutCheckDeferred			XfdashboardThemeLayoutCheckDeferred;
+typedef struct _XfdashboardThemeLayoutDeferredObject		XfdashboardThemeLayoutDeferredObject;
 
 /* Define this class in GObject system */
 struct _XfdashboardThemeLayoutPrivate
@@ -343,6 +369,8 @@ struct _XfdashboardThemeLayoutParsedObject
 	XfdashboardThemeLayoutParsedObject	*layout;		/* 0 or 1 entry of XfdashboardThemeLayoutParsedObject */
 	GSList								*children;		/* 0, 1 or more entries of XfdashboardThemeLayoutParsedObject */
 	GPtrArray							*focusables;	/* 0, 1 or more entries of XfdashboardThemeLayoutTagData (only used at <interface>) */
+	gboolean							deferred;		/* Create object not before it gets mapped (only used at <child>) */
+	gboolean							deferredByPolicy;	/* Deferred by default policy and not by attribute */
 };
 
 struct _XfdashboardThemeLayoutParserData
@@ -373,6 +401,23 @@ struct _XfdashboardThemeLayoutCheckRefID
 	GHashTable							*ids;
 };
 
+struct _XfdashboardThemeLayoutCheckDeferred
+{
+	XfdashboardThemeLayout				*self;
+	GHashTable							*ids;			/* Maps ID to deferred object it is created within */
+	XfdashboardThemeLayoutParsedObject	*currentDeferred;
+	XfdashboardThemeLayoutParsedObject	*invalidDeferred;
+	const gchar							*invalidRefID;
+};
+
+struct _XfdashboardThemeLayoutDeferredObject
+{
+	XfdashboardThemeLayout				*self;
+	XfdashboardThemeLayoutParsedObject	*objectData;
+	GHashTable							*ids;
+	gboolean							isCreated;
+};
+
 /* Forward declarations */
 static void _xfdashboard_theme_layout_parse_set_error(XfdashboardThemeLayoutParserData *inParserData,
 														GMarkupParseContext *inContext,
@@ -383,6 +428,10 @@ static void _xfdashboard_theme_layout_parse_set_error(XfdashboardThemeLayoutPars
 
 static void _xfdashboard_theme_layout_object_data_unref(XfdashboardThemeLayoutParsedObject *inData);
 
+static ClutterActor* _xfdashboard_theme_layout_create_deferred(XfdashboardThemeLayout *self,
+																XfdashboardThemeLayoutParsedObject *inObjectData,
+																GHashTable *ioIDs);
+
 #ifdef DEBUG
 static void _xfdashboard_theme_layout_print_parsed_objects_internal(XfdashboardThemeLayoutParsedObject *inData, gint inDepth, const gchar *inPrefix)
 {
@@ -777,6 +826,50 @@ static void _xfdashboard_theme_layout_object_data_free_foreach_callback(gpointer
 	_xfdashboard_theme_layout_object_data_free(data);
 }
 
+/* Create, destroy and look up entries of hash-table mapping IDs to created
+ * objects. Only weak references are stored as the objects are owned by the
+ * actors built and the hash-table may outlive them if it is kept for objects
+ * which are created deferred.
+ */
+static void _xfdashboard_theme_layout_ids_free_weak_ref(GWeakRef *inWeakRef)
+{
+	g_return_if_fail(inWeakRef);
+
+	g_weak_ref_clear(inWeakRef);
+	g_free(inWeakRef);
+}
+
+static GHashTable* _xfdashboard_theme_layout_ids_new(void)
+{
+	return(g_hash_table_new_full(g_str_hash, g_str_equal, g_free, (GDestroyNotify)_xfdashboard_theme_layout_ids_free_weak_ref));
+}
+
+static void _xfdashboard_theme_layout_ids_insert(GHashTable *ioIDs, const gchar *inID, GObject *inObject)
+{
+	GWeakRef								*weakRef;
+
+	g_return_if_fail(ioIDs);
+	g_return_if_fail(inID && *inID);
+	g_return_if_fail(G_IS_OBJECT(inObject));
+
+	weakRef=g_new0(GWeakRef, 1);
+	g_weak_ref_init(weakRef, inObject);
+	g_hash_table_insert(ioIDs, g_strdup(inID), weakRef);
+}
+
+/* Caller must unreference returned object with g_object_unref if not NULL */
+static GObject* _xfdashboard_theme_layout_ids_lookup(GHashTable *inIDs, const gchar *inID)
+{
+	GWeakRef								*weakRef;
+
+	g_return_val_if_fail(inIDs, NULL);
+
+	weakRef=(GWeakRef*)g_hash_table_lookup(inIDs, inID);
+	if(!weakRef) return(NULL);
+
+	return(g_weak_ref_get(weakRef));
+}
+
 /* Free data about an unresolved property which refers an other object */
 static void _xfdashboard_theme_layout_create_object_free_unresolved(gpointer inData)
 {
@@ -830,7 +923,19 @@ static void _xfdashboard_theme_layout_create_object_resolve_unresolved(Xfdashboa
 		{
 			case TAG_PROPERTY:
 				/* Get referenced object */
-				refObject=g_hash_table_lookup(inIDs, unresolvedID->property->tag.property.refID);
+				refObject=_xfdashboard_theme_layout_ids_lookup(inIDs, unresolvedID->property->tag.property.refID);
+
+				/* The referenced object might have been destroyed already as
+				 * only weak references are stored, so do not set property then.
+				 */
+				if(!refObject)
+				{
+					g_warning("Could not resolve object with reference ID '%s' for property '%s' at target object %s because it does not exist anymore",
+								unresolvedID->property->tag.property.refID,
+								unresolvedID->property->tag.property.name,
+								unresolvedID->targetObject ? G_OBJECT_TYPE_NAME(unresolvedID->targetObject) : "<unknown object>");
+					break;
+				}
 
 				/* Set pointer to referenced object in property of target object */
 				g_object_set(unresolvedID->targetObject,
@@ -843,11 +948,25 @@ static void _xfdashboard_theme_layout_create_object_resolve_unresolved(Xfdashboa
 									unresolvedID->property->tag.property.refID,
 									unresolvedID->targetObject ? G_OBJECT_TYPE_NAME(unresolvedID->targetObject) : "<unknown object>",
 									unresolvedID->property->tag.property.name);
+
+				/* Release reference taken when looking up referenced object */
+				g_object_unref(refObject);
 				break;
 
 			case TAG_FOCUS:
 				/* Get referenced object */
-				refObject=g_hash_table_lookup(inIDs, unresolvedID->property->tag.focus.refID);
+				refObject=_xfdashboard_theme_layout_ids_lookup(inIDs, unresolvedID->property->tag.focus.refID);
+
+				/* The referenced object might have been destroyed already as
+				 * only weak references are stored, so skip it in this case.
+				 */
+				if(!refObject)
+				{
+					g_warning("Could not resolve focusable actor with reference ID '%s' at target object %s because it does not exist anymore",
+								unresolvedID->property->tag.focus.refID,
+								unresolvedID->targetObject ? G_OBJECT_TYPE_NAME(unresolvedID->targetObject) : "<unknown object>");
+					break;
+				}
 
 				/* Store reference object in list of focusable actors */
 				if(!focusTable) focusTable=g_ptr_array_new();
@@ -872,6 +991,11 @@ static void _xfdashboard_theme_layout_create_object_resolve_unresolved(Xfdashboa
 										unresolvedID->property->tag.focus.refID,
 										unresolvedID->targetObject ? G_OBJECT_TYPE_NAME(unresolvedID->targetObject) : "<unknown object>");
 				}
+
+				/* Release reference taken when looking up referenced object.
+				 * The actor is still kept alive by its parent it was added to.
+				 */
+				g_object_unref(refObject);
 				break;
 
 			default:
@@ -929,6 +1053,18 @@ static void _xfdashboard_theme_layout_create_object_resolve_unresolved(Xfdashboa
 	if(focusSelected) g_object_unref(focusSelected);
 }
 
+static void _xfdashboard_theme_layout_create_object_resolve_unresolved_full(XfdashboardThemeLayout *self,
+																			GHashTable *inIDs,
+																			GSList *inUnresolvedIDs,
+																			...)
+{
+	va_list										args;
+
+	va_start(args, inUnresolvedIDs);
+	_xfdashboard_theme_layout_create_object_resolve_unresolved(self, inIDs, inUnresolvedIDs, args);
+	va_end(args);
+}
+
 /* Create object with all its constraints, layout and children recursively.
  * Set up all properties which do not reference any other object at creation of object
  * but remember all "unresolved" properties (which do reference other objects).
@@ -1036,7 +1172,7 @@ static GObject* _xfdashboard_theme_layout_create_object(XfdashboardThemeLayout *
 			if(name) g_free(name);
 		}
 
-		g_hash_table_insert(ioIDs, g_strdup(inObjectData->id), object);
+		_xfdashboard_theme_layout_ids_insert(ioIDs, inObjectData->id, object);
 	}
 
 	/* Create children */
@@ -1047,8 +1183,9 @@ static GObject* _xfdashboard_theme_layout_create_object(XfdashboardThemeLayout *
 
 		childObjectData=(XfdashboardThemeLayoutParsedObject*)iter->data;
 
-		/* Create child actor */
-		child=_xfdashboard_theme_layout_create_object(self, childObjectData, ioIDs, ioUnresolvedIDs);
+		/* Create child actor or a placeholder for it if it should be deferred */
+		if(childObjectData->deferred) child=G_OBJECT(_xfdashboard_theme_layout_create_deferred(self, childObjectData, ioIDs));
+			else child=_xfdashboard_theme_layout_create_object(self, childObjectData, ioIDs, ioUnresolvedIDs);
 		if(!child || !CLUTTER_IS_ACTOR(child))
 		{
 			if(child)
@@ -1074,7 +1211,7 @@ static GObject* _xfdashboard_theme_layout_create_object(XfdashboardThemeLayout *
 		}
 
 		/* Add successfully created child actor to this actor */
-		if(childObjectData->id) g_hash_table_insert(ioIDs, g_strdup(childObjectData->id), child);
+		if(childObjectData->id && !childObjectData->deferred) _xfdashboard_theme_layout_ids_insert(ioIDs, childObjectData->id, child);
 		clutter_actor_add_child(CLUTTER_ACTOR(object), CLUTTER_ACTOR(child));
 		XFDASHBOARD_DEBUG(self, THEME,
 							"Created child %s and added to object %s",
@@ -1117,7 +1254,7 @@ static GObject* _xfdashboard_theme_layout_create_object(XfdashboardThemeLayout *
 		}
 
 		/* Add successfully created child actor to this actor */
-		if(layoutObjectData->id) g_hash_table_insert(ioIDs, g_strdup(layoutObjectData->id), layout);
+		if(layoutObjectData->id) _xfdashboard_theme_layout_ids_insert(ioIDs, layoutObjectData->id, layout);
 		clutter_actor_set_layout_manager(CLUTTER_ACTOR(object), CLUTTER_LAYOUT_MANAGER(layout));
 		XFDASHBOARD_DEBUG(self, THEME,
 							"Created layout manager %s and set at object %s",
@@ -1160,7 +1297,7 @@ static GObject* _xfdashboard_theme_layout_create_object(XfdashboardThemeLayout *
 		}
 
 		/* Add successfully created constraint to this actor */
-		if(constraintObjectData->id) g_hash_table_insert(ioIDs, g_strdup(constraintObjectData->id), constraint);
+		if(constraintObjectData->id) _xfdashboard_theme_layout_ids_insert(ioIDs, constraintObjectData->id, constraint);
 		clutter_actor_add_constraint(CLUTTER_ACTOR(object), CLUTTER_CONSTRAINT(constraint));
 		XFDASHBOARD_DEBUG(self, THEME,
 							"Created constraint %s and added to object %s",
@@ -1219,6 +1356,132 @@ static GObject* _xfdashboard_theme_layout_create_object(XfdashboardThemeLayout *
 	return(object);
 }
 
+/* Free data of an object whose creation is deferred */
+static void _xfdashboard_theme_layout_deferred_object_free(XfdashboardThemeLayoutDeferredObject *inData)
+{
+	g_return_if_fail(inData);
+
+	/* Release allocated resources */
+	if(inData->objectData) _xfdashboard_theme_layout_object_data_unref(inData->objectData);
+	if(inData->ids) g_hash_table_unref(inData->ids);
+	if(inData->self) g_object_unref(inData->self);
+	g_free(inData);
+}
+
+/* Destroy placeholder of a deferred object after it was replaced by the object */
+static gboolean _xfdashboard_theme_layout_deferred_object_destroy_placeholder(gpointer inUserData)
+{
+	clutter_actor_destroy(CLUTTER_ACTOR(inUserData));
+
+	return(G_SOURCE_REMOVE);
+}
+
+/* The placeholder of a deferred object was mapped, so create the object with
+ * all its constraints, layout and children now and replace the placeholder.
+ */
+static void _xfdashboard_theme_layout_on_deferred_object_mapped(ClutterActor *inPlaceholder,
+																GParamSpec *inSpec,
+																gpointer inUserData)
+{
+	XfdashboardThemeLayoutDeferredObject		*deferred;
+	ClutterActor								*parent;
+	GObject										*object;
+	GSList										*unresolved;
+
+	g_return_if_fail(CLUTTER_IS_ACTOR(inPlaceholder));
+	g_return_if_fail(inUserData);
+
+	deferred=(XfdashboardThemeLayoutDeferredObject*)inUserData;
+
+	/* Only create object once and only if placeholder is mapped */
+	if(deferred->isCreated || !clutter_actor_is_mapped(inPlaceholder)) return;
+
+	parent=clutter_actor_get_parent(inPlaceholder);
+	if(!parent) return;
+
+	deferred->isCreated=TRUE;
+
+	/* Create object */
+	unresolved=NULL;
+	object=_xfdashboard_theme_layout_create_object(deferred->self, deferred->objectData, deferred->ids, &unresolved);
+	if(!object || !CLUTTER_IS_ACTOR(object))
+	{
+		g_warning("Failed to create deferred object of type %s",
+					g_type_name(deferred->objectData->classType));
+
+		/* Release allocated resources */
+		if(object) g_object_unref(object);
+		if(unresolved) g_slist_free_full(unresolved, _xfdashboard_theme_layout_create_object_free_unresolved);
+
+		return;
+	}
+
+	/* Resolved unresolved properties of newly created object */
+	_xfdashboard_theme_layout_create_object_resolve_unresolved_full(deferred->self, deferred->ids, unresolved, -1);
+	if(unresolved) g_slist_free_full(unresolved, _xfdashboard_theme_layout_create_object_free_unresolved);
+
+	/* Add object next to placeholder. The placeholder cannot be destroyed
+	 * right now as its parent is iterating its children to map them, so
+	 * destroy it before next frame is drawn.
+	 */
+	clutter_actor_insert_child_above(parent, CLUTTER_ACTOR(object), inPlaceholder);
+	clutter_threads_add_idle_full(G_PRIORITY_HIGH,
+									_xfdashboard_theme_layout_deferred_object_destroy_placeholder,
+									g_object_ref(inPlaceholder),
+									g_object_unref);
+
+	XFDASHBOARD_DEBUG(deferred->self, THEME,
+						"Created deferred object %s%s%s%s as child of %s",
+						G_OBJECT_TYPE_NAME(object),
+						deferred->objectData->id ? " with ID '" : "",
+						deferred->objectData->id ? deferred->objectData->id : "",
+						deferred->objectData->id ? "'" : "",
+						G_OBJECT_TYPE_NAME(parent));
+}
+
+/* Create a placeholder actor for an object whose creation is deferred until
+ * the placeholder gets mapped the first time.
+ */
+static ClutterActor* _xfdashboard_theme_layout_create_deferred(XfdashboardThemeLayout *self,
+																XfdashboardThemeLayoutParsedObject *inObjectData,
+																GHashTable *ioIDs)
+{
+	XfdashboardThemeLayoutDeferredObject		*deferred;
+	ClutterActor								*placeholder;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_THEME_LAYOUT(self), NULL);
+	g_return_val_if_fail(inObjectData, NULL);
+	g_return_val_if_fail(ioIDs, NULL);
+
+	/* Set up data needed to create object later. The hash-table of IDs is
+	 * shared with all other objects of the same interface to resolve
+	 * references to objects outside of the deferred object.
+	 */
+	deferred=g_new0(XfdashboardThemeLayoutDeferredObject, 1);
+	deferred->self=g_object_ref(self);
+	deferred->objectData=_xfdashboard_theme_layout_object_data_ref(inObjectData);
+	deferred->ids=g_hash_table_ref(ioIDs);
+	deferred->isCreated=FALSE;
+
+	/* Create placeholder */
+	placeholder=clutter_actor_new();
+	g_signal_connect_data(placeholder,
+							"notify::mapped",
+							G_CALLBACK(_xfdashboard_theme_layout_on_deferred_object_mapped),
+							deferred,
+							(GClosureNotify)_xfdashboard_theme_layout_deferred_object_free,
+							0);
+
+	XFDASHBOARD_DEBUG(self, THEME,
+						"Deferred creation of object of type %s%s%s%s",
+						g_type_name(inObjectData->classType),
+						inObjectData->id ? " with ID '" : "",
+						inObjectData->id ? inObjectData->id : "",
+						inObjectData->id ? "'" : "");
+
+	return(placeholder);
+}
+
 /* Callbacks used for <property> tag */
 static void _xfdashboard_theme_layout_parse_property_text_node(GMarkupParseContext *inContext,
 																const gchar *inText,
@@ -1406,6 +1669,7 @@ static void _xfdashboard_theme_layout_parse_general_start(GMarkupParseContext *i
 		XfdashboardThemeLayoutTagData		*tagData;
 		XfdashboardThemeLayoutParsedObject	*objectData;
 		GType								expectedClassType=G_TYPE_INVALID;
+		gboolean							deferred=-1;
 
 		/* Create tag and object data */
 		tagData=_xfdashboard_theme_layout_tag_data_new(inContext, nextTag, &error);
@@ -1434,6 +1698,9 @@ static void _xfdashboard_theme_layout_parse_general_start(GMarkupParseContext *i
 											G_MARKUP_COLLECT_STRDUP,
 											"class",
 											&tagData->tag.object.class,
+											G_MARKUP_COLLECT_TRISTATE,
+											"deferred",
+											&deferred,
 											G_MARKUP_COLLECT_INVALID))
 		{
 			g_propagate_error(outError, error);
@@ -1510,6 +1777,33 @@ static void _xfdashboard_theme_layout_parse_general_start(GMarkupParseContext *i
 			return;
 		}
 
+		/* Only objects of <child> can be created deferred. If not set explicitly
+		 * views are created deferred by default.
+		 */
+		if(deferred==TRUE && currentTag!=TAG_CHILD)
+		{
+			_xfdashboard_theme_layout_parse_set_error(data,
+														inContext,
+														outError,
+														XFDASHBOARD_THEME_LAYOUT_ERROR_MALFORMED,
+														"Object of class %s for parent tag <%s> cannot be deferred - only objects for tag <%s> can",
+														tagData->tag.object.class,
+														_xfdashboard_theme_layout_get_tag_by_id(currentTag),
+														_xfdashboard_theme_layout_get_tag_by_id(TAG_CHILD));
+			_xfdashboard_theme_layout_tag_data_unref(tagData);
+			_xfdashboard_theme_layout_object_data_unref(objectData);
+			return;
+		}
+
+		if(deferred==-1 &&
+			currentTag==TAG_CHILD &&
+			g_type_is_a(objectData->classType, XFDASHBOARD_TYPE_VIEW))
+		{
+			objectData->deferred=TRUE;
+			objectData->deferredByPolicy=TRUE;
+		}
+			else objectData->deferred=(deferred==TRUE);
+
 		/* Push tag onto stack */
 		g_queue_push_tail(data->stackTags, tagData);
 
@@ -2112,6 +2406,161 @@ static gboolean _xfdashboard_theme_layout_check_ids_and_refids(XfdashboardThemeL
 	return(success);
 }
 
+/* Check that objects created within deferred objects are only referenced
+ * from the same deferred object as they do not exist before it gets mapped.
+ */
+static void _xfdashboard_theme_layout_check_deferred_ids(gpointer inData, gpointer inUserData)
+{
+	XfdashboardThemeLayoutParsedObject	*object;
+	XfdashboardThemeLayoutCheckDeferred	*checkDeferred;
+	XfdashboardThemeLayoutParsedObject	*lastDeferred;
+
+	g_return_if_fail(inData);
+	g_return_if_fail(inUserData);
+
+	object=(XfdashboardThemeLayoutParsedObject*)inData;
+	checkDeferred=(XfdashboardThemeLayoutCheckDeferred*)inUserData;
+
+	/* Remember deferred object the objects' IDs belong to */
+	lastDeferred=checkDeferred->currentDeferred;
+	if(object->deferred) checkDeferred->currentDeferred=object;
+
+	if(object->id && checkDeferred->currentDeferred)
+	{
+		g_hash_table_insert(checkDeferred->ids, object->id, checkDeferred->currentDeferred);
+	}
+
+	/* Call ourselve for each constraint object, layout object and child object */
+	g_slist_foreach(object->constraints, _xfdashboard_theme_layout_check_deferred_ids, inUserData);
+	if(object->layout) _xfdashboard_theme_layout_check_deferred_ids(object->layout, inUserData);
+	g_slist_foreach(object->children, _xfdashboard_theme_layout_check_deferred_ids, inUserData);
+
+	checkDeferred->currentDeferred=lastDeferred;
+}
+
+static void _xfdashboard_theme_layout_check_deferred_refids(gpointer inData, gpointer inUserData)
+{
+	XfdashboardThemeLayoutParsedObject	*object;
+	XfdashboardThemeLayoutCheckDeferred	*checkDeferred;
+	XfdashboardThemeLayoutParsedObject	*lastDeferred;
+	XfdashboardThemeLayoutParsedObject	*refDeferred;
+	XfdashboardThemeLayoutTagData		*property;
+	GSList								*entry;
+	guint								i;
+
+	g_return_if_fail(inData);
+	g_return_if_fail(inUserData);
+
+	object=(XfdashboardThemeLayoutParsedObject*)inData;
+	checkDeferred=(XfdashboardThemeLayoutCheckDeferred*)inUserData;
+
+	/* Stop if an invalid reference was found already */
+	if(checkDeferred->invalidDeferred) return;
+
+	lastDeferred=checkDeferred->currentDeferred;
+	if(object->deferred) checkDeferred->currentDeferred=object;
+
+	/* Check that referenced IDs are not created within another deferred object */
+	for(entry=object->properties; entry && !checkDeferred->invalidDeferred; entry=g_slist_next(entry))
+	{
+		property=(XfdashboardThemeLayoutTagData*)entry->data;
+		if(!property->tag.property.refID) continue;
+
+		refDeferred=g_hash_table_lookup(checkDeferred->ids, property->tag.property.refID);
+		if(refDeferred && refDeferred!=checkDeferred->currentDeferred)
+		{
+			checkDeferred->invalidDeferred=refDeferred;
+			checkDeferred->invalidRefID=property->tag.property.refID;
+		}
+	}
+
+	/* Focusable actors are resolved when interface is built, so they must not
+	 * be created within any deferred object.
+	 */
+	if(object->focusables)
+	{
+		for(i=0; i<object->focusables->len && !checkDeferred->invalidDeferred; i++)
+		{
+			property=(XfdashboardThemeLayoutTagData*)g_ptr_array_index(object->focusables, i);
+
+			refDeferred=g_hash_table_lookup(checkDeferred->ids, property->tag.focus.refID);
+			if(refDeferred)
+			{
+				checkDeferred->invalidDeferred=refDeferred;
+				checkDeferred->invalidRefID=property->tag.focus.refID;
+			}
+		}
+	}
+
+	/* Call ourselve for each constraint object, layout object and child object */
+	g_slist_foreach(object->constraints, _xfdashboard_theme_layout_check_deferred_refids, inUserData);
+	if(object->layout) _xfdashboard_theme_layout_check_deferred_refids(object->layout, inUserData);
+	g_slist_foreach(object->children, _xfdashboard_theme_layout_check_deferred_refids, inUserData);
+
+	checkDeferred->currentDeferred=lastDeferred;
+}
+
+static gboolean _xfdashboard_theme_layout_check_deferred(XfdashboardThemeLayout *self,
+															XfdashboardThemeLayoutParsedObject *inInterfaceObject,
+															GError **outError)
+{
+	XfdashboardThemeLayoutCheckDeferred	checkDeferred;
+	gboolean							success;
+	gboolean							doCheck;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_THEME_LAYOUT(self), FALSE);
+	g_return_val_if_fail(inInterfaceObject, FALSE);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
+
+	success=TRUE;
+	doCheck=TRUE;
+
+	/* Check all references to objects created within deferred objects. If
+	 * an invalid reference is found to an object which was deferred by
+	 * default policy, do not defer it and check again. Otherwise it is an
+	 * error.
+	 */
+	while(doCheck)
+	{
+		checkDeferred.self=self;
+		checkDeferred.ids=g_hash_table_new(g_str_hash, g_str_equal);
+		checkDeferred.currentDeferred=NULL;
+		checkDeferred.invalidDeferred=NULL;
+		checkDeferred.invalidRefID=NULL;
+
+		_xfdashboard_theme_layout_check_deferred_ids(inInterfaceObject, &checkDeferred);
+		_xfdashboard_theme_layout_check_deferred_refids(inInterfaceObject, &checkDeferred);
+
+		if(!checkDeferred.invalidDeferred) doCheck=FALSE;
+			else if(checkDeferred.invalidDeferred->deferredByPolicy)
+			{
+				XFDASHBOARD_DEBUG(self, THEME,
+									"Will not defer object of type %s because ID '%s' is referenced from outside",
+									g_type_name(checkDeferred.invalidDeferred->classType),
+									checkDeferred.invalidRefID);
+
+				checkDeferred.invalidDeferred->deferred=FALSE;
+				checkDeferred.invalidDeferred->deferredByPolicy=FALSE;
+			}
+			else
+			{
+				g_set_error(outError,
+							XFDASHBOARD_THEME_LAYOUT_ERROR,
+							XFDASHBOARD_THEME_LAYOUT_ERROR_MALFORMED,
+							"Referenced ID '%s' is created deferred within object of type %s and cannot be referenced from outside",
+							checkDeferred.invalidRefID,
+							g_type_name(checkDeferred.invalidDeferred->classType));
+				success=FALSE;
+				doCheck=FALSE;
+			}
+
+		g_hash_table_destroy(checkDeferred.ids);
+	}
+
+	/* Return result of checks */
+	return(success);
+}
+
 /* Parse XML from string */
 static gboolean _xfdashboard_theme_layout_parse_xml(XfdashboardThemeLayout *self,
 													const gchar *inPath,
@@ -2223,6 +2672,12 @@ static gboolean _xfdashboard_theme_layout_parse_xml(XfdashboardThemeLayout *self
 		success=FALSE;
 	}
 
+	if(success && !_xfdashboard_theme_layout_check_deferred(self, data->interface, &error))
+	{
+		g_propagate_error(outError, error);
+		success=FALSE;
+	}
+
 	/* Handle collected data if parsing was successful */
 	if(success)
 	{
@@ -2477,7 +2932,7 @@ ClutterActor* xfdashboard_theme_layout_build_interface(XfdashboardThemeLayout *s
 	/* Create hash-table to resolve IDs of objects created and
 	 * initialize empty list of IDs to resolve.
 	 */
-	ids=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+	ids=_xfdashboard_theme_layout_ids_new();
 	unresolved=NULL;
 
 	/* Create actor */
@@ -2519,8 +2974,10 @@ ClutterActor* xfdashboard_theme_layout_build_interface(XfdashboardThemeLayout *s
 								inID);
 		}
 
-	/* Release allocated resources */
-	if(ids) g_hash_table_destroy(ids);
+	/* Release allocated resources. The hash-table of IDs may still be used
+	 * by objects which are created deferred so only unreference it.
+	 */
+	if(ids) g_hash_table_unref(ids);
 	if(unresolved) g_slist_free_full(unresolved, _xfdashboard_theme_layout_create_object_free_unresolved);
 
 	/* Release extra reference taken at interface object data */
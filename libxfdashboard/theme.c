@@ -107,9 +107,11 @@
 #include <glib/gi18n-lib.h>
 #include <glib.h>
 #include <gio/gio.h>
+#include <gtk/gtk.h>
 
 #include <libxfdashboard/core.h>
 #include <libxfdashboard/settings.h>
+#include <libxfdashboard/profiler.h>
 #include <libxfdashboard/compat.h>
 #include <libxfdashboard/debug.h>
 
@@ -170,6 +172,136 @@ static GParamSpec* XfdashboardThemeProperties[PROP_LAST]={ 0, };
 #define XFDASHBOARD_THEME_GROUP_KEY_ANIMATIONS			"Animations"
 
 
+/* Load CSS files for styling in the order given, i.e. the index of a file is
+ * used as its priority. If a cache path is configured the precompiled cache of
+ * these CSS files is used if it is still valid. Otherwise all CSS files are
+ * parsed and the cache is rebuilt.
+ */
+static gboolean _xfdashboard_theme_load_styles(XfdashboardTheme *self,
+												GPtrArray *inFiles,
+												GError **outError)
+{
+	XfdashboardThemePrivate		*priv;
+	XfdashboardSettings			*settings;
+	const gchar					*cachePath;
+	gchar						*cacheFile;
+	gchar						*cacheKey;
+	GError						*error;
+	guint						i;
+	gint64						profilerBegin;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_THEME(self), FALSE);
+	g_return_val_if_fail(inFiles, FALSE);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
+
+	priv=self->priv;
+	cacheFile=NULL;
+	cacheKey=NULL;
+	error=NULL;
+	profilerBegin=xfdashboard_profiler_begin("theme");
+
+	/* Try to load styles from cache */
+	settings=xfdashboard_core_get_settings(NULL);
+	cachePath=xfdashboard_settings_get_cache_path(settings);
+	if(cachePath)
+	{
+		GString					*key;
+		gchar					*iconThemeName;
+		gchar					*checksum;
+		gchar					*filename;
+
+		/* Build key of cache from all conditions the parsed CSS depends on,
+		 * i.e. the version of this library, the theme, the CSS files in their
+		 * order and the icon theme which is used by CSS function @try_icons.
+		 */
+		iconThemeName=NULL;
+		g_object_get(gtk_settings_get_default(), "gtk-icon-theme-name", &iconThemeName, NULL);
+
+		key=g_string_new(NULL);
+		g_string_append_printf(key, "%s\n%s\n", PACKAGE_VERSION, priv->themePath);
+		for(i=0; i<inFiles->len; i++)
+		{
+			g_string_append_printf(key, "%s\n", (const gchar*)g_ptr_array_index(inFiles, i));
+		}
+		g_string_append(key, iconThemeName ? iconThemeName : "");
+		cacheKey=g_string_free(key, FALSE);
+
+		if(iconThemeName) g_free(iconThemeName);
+
+		/* Build path to cache file for theme */
+		checksum=g_compute_checksum_for_string(G_CHECKSUM_SHA1, priv->themePath, -1);
+		filename=g_strdup_printf("%s.css.cache", checksum);
+		cacheFile=g_build_filename(cachePath, "themes", filename, NULL);
+		g_free(filename);
+		g_free(checksum);
+
+		/* Load cache */
+		if(xfdashboard_theme_css_load_cache(priv->styling, cacheFile, cacheKey, &error))
+		{
+			XFDASHBOARD_DEBUG(self, THEME,
+								"Loaded CSS files for theme %s from cache %s",
+								priv->themeName,
+								cacheFile);
+
+			/* Release allocated resources */
+			g_free(cacheFile);
+			g_free(cacheKey);
+
+			xfdashboard_profiler_end("theme", "theme.load-styles", profilerBegin);
+
+			return(TRUE);
+		}
+
+		XFDASHBOARD_DEBUG(self, THEME,
+							"Could not load CSS files for theme %s from cache %s: %s",
+							priv->themeName,
+							cacheFile,
+							error ? error->message : "Unknown error");
+		g_clear_error(&error);
+	}
+
+	/* Parse all CSS files */
+	XFDASHBOARD_DEBUG(self, THEME,
+						"Loading %u CSS files for theme %s",
+						inFiles->len,
+						priv->themeName);
+
+	if(!xfdashboard_theme_css_add_files(priv->styling, inFiles, &error))
+	{
+		/* Set error */
+		g_propagate_error(outError, error);
+
+		/* Release allocated resources */
+		if(cacheFile) g_free(cacheFile);
+		if(cacheKey) g_free(cacheKey);
+
+		xfdashboard_profiler_end("theme", "theme.load-styles", profilerBegin);
+
+		/* Return FALSE to indicate error */
+		return(FALSE);
+	}
+
+	/* Rebuild cache but failing to do so is not an error */
+	if(cacheFile &&
+		!xfdashboard_theme_css_save_cache(priv->styling, cacheFile, cacheKey, &error))
+	{
+		XFDASHBOARD_DEBUG(self, THEME,
+							"Could not save CSS files for theme %s to cache %s: %s",
+							priv->themeName,
+							cacheFile,
+							error ? error->message : "Unknown error");
+		g_clear_error(&error);
+	}
+
+	/* Release allocated resources */
+	if(cacheFile) g_free(cacheFile);
+	if(cacheKey) g_free(cacheKey);
+
+	xfdashboard_profiler_end("theme", "theme.load-styles", profilerBegin);
+
+	return(TRUE);
+}
+
 /* Load theme file and all listed resources in this file */
 static gboolean _xfdashboard_theme_load_resources(XfdashboardTheme *self,
 													GError **outError)
@@ -181,6 +313,7 @@ static gboolean _xfdashboard_theme_load_resources(XfdashboardTheme *self,
 	gchar						**resources, **resource;
 	gchar						*resourceFile;
 	gint						counter;
+	GPtrArray					*styleFiles;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_THEME(self), FALSE);
 	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
@@ -285,92 +418,30 @@ static gboolean _xfdashboard_theme_load_resources(XfdashboardTheme *self,
 		return(FALSE);
 	}
 
-	counter=0;
-	resource=resources;
-	while(*resource)
+	styleFiles=g_ptr_array_new_with_free_func(g_free);
+	for(resource=resources; *resource; resource++)
 	{
-		/* Get path and file for style resource */
-		resourceFile=g_build_filename(priv->themePath, *resource, NULL);
-
-		/* Try to load style resource */
-		XFDASHBOARD_DEBUG(self, THEME,
-							"Loading CSS file %s for theme %s with priority %d",
-							resourceFile,
-							priv->themeName,
-							counter);
-
-		if(!xfdashboard_theme_css_add_file(priv->styling, resourceFile, counter, &error))
-		{
-			/* Set error */
-			g_propagate_error(outError, error);
-
-			/* Release allocated resources */
-			if(resources) g_strfreev(resources);
-			if(resourceFile) g_free(resourceFile);
-			if(themeKeyFile) g_key_file_free(themeKeyFile);
-
-			/* Return FALSE to indicate error */
-			return(FALSE);
-		}
-
-		/* Release allocated resources */
-		if(resourceFile) g_free(resourceFile);
-
-		/* Continue with next entry */
-		resource++;
-		counter++;
+		g_ptr_array_add(styleFiles, g_build_filename(priv->themePath, *resource, NULL));
 	}
 	g_strfreev(resources);
 
-	if(priv->userGlobalStyleFile)
-	{
-		XFDASHBOARD_DEBUG(self, THEME,
-							"Loading user's global CSS file %s for theme %s with priority %d",
-							priv->userGlobalStyleFile,
-							priv->themeName,
-							counter);
-
-		/* Load user's theme unrelated (global) stylesheet as it exists */
-		if(!xfdashboard_theme_css_add_file(priv->styling, priv->userGlobalStyleFile, counter, &error))
-		{
-			/* Set error */
-			g_propagate_error(outError, error);
+	if(priv->userGlobalStyleFile) g_ptr_array_add(styleFiles, g_strdup(priv->userGlobalStyleFile));
+	if(priv->userThemeStyleFile) g_ptr_array_add(styleFiles, g_strdup(priv->userThemeStyleFile));
 
-			/* Release allocated resources */
-			if(themeKeyFile) g_key_file_free(themeKeyFile);
-
-			/* Return FALSE to indicate error */
-			return(FALSE);
-		}
-
-		/* Increase counter used for CSS priority for next user CSS file */
-		counter++;
-	}
-
-	if(priv->userThemeStyleFile)
+	/* Load style resources either from cache or by parsing them */
+	if(!_xfdashboard_theme_load_styles(self, styleFiles, &error))
 	{
-		XFDASHBOARD_DEBUG(self, THEME,
-							"Loading user's theme CSS file %s for theme %s with priority %d",
-							priv->userThemeStyleFile,
-							priv->themeName,
-							counter);
-
-		/* Load user's theme related stylesheet as it exists */
-		if(!xfdashboard_theme_css_add_file(priv->styling, priv->userThemeStyleFile, counter, &error))
-		{
-			/* Set error */
-			g_propagate_error(outError, error);
-
-			/* Release allocated resources */
-			if(themeKeyFile) g_key_file_free(themeKeyFile);
+		/* Set error */
+		g_propagate_error(outError, error);
 
-			/* Return FALSE to indicate error */
-			return(FALSE);
-		}
+		/* Release allocated resources */
+		if(styleFiles) g_ptr_array_unref(styleFiles);
+		if(themeKeyFile) g_key_file_free(themeKeyFile);
 
-		/* Increase counter used for CSS priority for next user CSS file */
-		counter++;
+		/* Return FALSE to indicate error */
+		return(FALSE);
 	}
+	g_ptr_array_unref(styleFiles);
 
 	/* Create XML parser and load layout resources */
 	resources=g_key_file_get_string_list(themeKeyFile,
@@ -390,6 +461,7 @@ static gboolean _xfdashboard_theme_load_resources(XfdashboardTheme *self,
 		return(FALSE);
 	}
 
+	counter=0;
 	resource=resources;
 	while(*resource)
 	{
@@ -1017,6 +1089,7 @@ gboolean xfdashboard_theme_load(XfdashboardTheme *self,
 {
 	XfdashboardThemePrivate		*priv;
 	GError						*error;
+	gint64						profilerBegin;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_THEME(self), FALSE);
 	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
@@ -1043,15 +1116,20 @@ gboolean xfdashboard_theme_load(XfdashboardTheme *self,
 	priv->loaded=TRUE;
 
 	/* Load theme key file */
+	profilerBegin=xfdashboard_profiler_begin("theme");
 	if(!_xfdashboard_theme_load_resources(self, &error))
 	{
 		/* Set returned error */
 		g_propagate_error(outError, error);
 
+		xfdashboard_profiler_end("theme", "theme.load", profilerBegin);
+
 		/* Return FALSE to indicate error */
 		return(FALSE);
 	}
 
+	xfdashboard_profiler_end("theme", "theme.load", profilerBegin);
+
 	/* If we found named themed and could load all resources successfully */
 	return(TRUE);
 }
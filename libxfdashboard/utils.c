@@ -713,3 +713,102 @@ gboolean xfdashboard_strv_equal(const gchar **inLeft, const gchar **inRight)
 	/* Now compare them */
 	return(g_strv_equal(inLeft, inRight));
 }
+
+/**
+ * xfdashboard_get_nine_slice_rectangles:
+ * @inWidth: The width of area to paint
+ * @inHeight: The height of area to paint
+ * @inSliceSize: The size of corner slices in pixels
+ * @outCoordinates: (out caller-allocates) (array fixed-size=72): The array to store
+ *   the coordinates of rectangles to paint at
+ *
+ * Calculates the rectangles to paint a nine-slice texture of @inWidth and @inHeight
+ * pixels at. A nine-slice texture is a square texture of (2 * @inSliceSize + 1)
+ * pixels. Its corners of @inSliceSize pixels are painted unscaled and the single
+ * row and column of pixels in the middle of the texture is stretched to fill the
+ * edges and the centre. The area to paint must be at least as large as the texture.
+ *
+ * The @outCoordinates array must have space for #XFDASHBOARD_NINE_SLICE_RECTANGLES
+ * rectangles of eight floats each. Each rectangle is stored as x1, y1, x2, y2
+ * followed by its texture coordinates s1, t1, s2, t2 which is the layout expected
+ * by cogl_framebuffer_draw_textured_rectangles().
+ */
+void xfdashboard_get_nine_slice_rectangles(gfloat inWidth,
+											gfloat inHeight,
+											gint inSliceSize,
+											gfloat *outCoordinates)
+{
+	gfloat				textureSize;
+	gfloat				positionsX[4];
+	gfloat				positionsY[4];
+	gfloat				texCoords[6];
+	gint				row, column;
+
+	g_return_if_fail(inSliceSize>0);
+	g_return_if_fail(inWidth>=(2*inSliceSize+1));
+	g_return_if_fail(inHeight>=(2*inSliceSize+1));
+	g_return_if_fail(outCoordinates);
+
+	textureSize=(2*inSliceSize)+1;
+
+	/* Determine borders of slices in area to paint */
+	positionsX[0]=0.0f;
+	positionsX[1]=inSliceSize;
+	positionsX[2]=inWidth-inSliceSize;
+	positionsX[3]=inWidth;
+
+	positionsY[0]=0.0f;
+	positionsY[1]=inSliceSize;
+	positionsY[2]=inHeight-inSliceSize;
+	positionsY[3]=inHeight;
+
+	/* Determine texture coordinates of slices. The stretched slices sample
+	 * the centre of the middle pixel only to prevent bleeding of corners
+	 * into edges.
+	 */
+	texCoords[0]=0.0f;
+	texCoords[1]=inSliceSize/textureSize;
+	texCoords[2]=(inSliceSize+0.5f)/textureSize;
+	texCoords[3]=(inSliceSize+0.5f)/textureSize;
+	texCoords[4]=(inSliceSize+1.0f)/textureSize;
+	texCoords[5]=1.0f;
+
+	/* Store rectangles row by row */
+	for(row=0; row<3; row++)
+	{
+		for(column=0; column<3; column++)
+		{
+			*outCoordinates++=positionsX[column];
+			*outCoordinates++=positionsY[row];
+			*outCoordinates++=positionsX[column+1];
+			*outCoordinates++=positionsY[row+1];
+			*outCoordinates++=texCoords[column*2];
+			*outCoordinates++=texCoords[row*2];
+			*outCoordinates++=texCoords[(column*2)+1];
+			*outCoordinates++=texCoords[(row*2)+1];
+		}
+	}
+}
+
+/**
+ * xfdashboard_get_modification_time:
+ * @inFileInfo: The file information as returned by g_stat()
+ *
+ * Gets the modification time of file from @inFileInfo in nanoseconds since
+ * epoch. It should be used when checking if a file has changed since it was
+ * seen last time as the modification time in seconds would miss changes
+ * done within the same second. If the system does not provide modification
+ * times with nanoseconds precision, the time in seconds is converted.
+ *
+ * Returns: The modification time in nanoseconds
+ */
+gint64 xfdashboard_get_modification_time(const GStatBuf *inFileInfo)
+{
+	g_return_val_if_fail(inFileInfo, 0);
+
+#ifdef HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC
+	return(((gint64)inFileInfo->st_mtim.tv_sec*G_GINT64_CONSTANT(1000000000))+(gint64)inFileInfo->st_mtim.tv_nsec);
+#else
+	return((gint64)inFileInfo->st_mtime*G_GINT64_CONSTANT(1000000000));
+#endif
+}
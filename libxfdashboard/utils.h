@@ -30,6 +30,7 @@
 
 #include <clutter/clutter.h>
 #include <gio/gio.h>
+#include <glib/gstdio.h>
 
 #include <libxfdashboard/window-tracker-workspace.h>
 #include <libxfdashboard/stage-interface.h>
@@ -135,6 +136,20 @@ void xfdashboard_dump_actor(ClutterActor *inActor);
 
 gboolean xfdashboard_strv_equal(const gchar **inLeft, const gchar **inRight);
 
+/**
+ * XFDASHBOARD_NINE_SLICE_RECTANGLES:
+ *
+ * The number of rectangles returned by xfdashboard_get_nine_slice_rectangles().
+ */
+#define XFDASHBOARD_NINE_SLICE_RECTANGLES	9
+
+void xfdashboard_get_nine_slice_rectangles(gfloat inWidth,
+											gfloat inHeight,
+											gint inSliceSize,
+											gfloat *outCoordinates);
+
+gint64 xfdashboard_get_modification_time(const GStatBuf *inFileInfo);
+
 G_END_DECLS
 
 #endif	/* __LIBXFDASHBOARD_UTILS__ */
@@ -52,6 +52,7 @@
 #include <libxfdashboard/stylable.h>
 #include <libxfdashboard/window-tracker.h>
 #include <libxfdashboard/settings.h>
+#include <libxfdashboard/profiler.h>
 #include <libxfdashboard/enums.h>
 #include <libxfdashboard/compat.h>
 #include <libxfdashboard/debug.h>
@@ -748,6 +749,7 @@ static void _xfdashboard_window_content_x11_handle_x_event(XfdashboardWindowCont
 		priv->workaroundMode==XFDASHBOARD_WINDOW_CONTENT_X11_WORKAROUND_MODE_NONE)
 	{
 		/* Update texture for live window content */
+		xfdashboard_profiler_mark("window-content", "window-content.damage");
 		clutter_content_invalidate(CLUTTER_CONTENT(self));
 	}
 #endif
@@ -1163,6 +1165,7 @@ static void _xfdashboard_window_content_x11_resume(XfdashboardWindowContentX11 *
 	GError									*error;
 	gint									trapError;
 	CoglTexture								*windowTexture;
+	gint64									profilerBegin;
 
 	g_return_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(self));
 	g_return_if_fail(self->priv->window);
@@ -1193,6 +1196,7 @@ static void _xfdashboard_window_content_x11_resume(XfdashboardWindowContentX11 *
 	}
 
 	/* Set up resources */
+	profilerBegin=xfdashboard_profiler_begin("window-content");
 	clutter_x11_trap_x_errors();
 	while(1)
 	{
@@ -1295,6 +1299,7 @@ static void _xfdashboard_window_content_x11_resume(XfdashboardWindowContentX11 *
 
 	/* Check if everything went well */
 	trapError=clutter_x11_untrap_x_errors();
+	xfdashboard_profiler_end("window-content", "window-content.resume", profilerBegin);
 	if(trapError!=0)
 	{
 		XFDASHBOARD_DEBUG(self, WINDOWS,
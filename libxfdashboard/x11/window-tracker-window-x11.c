@@ -56,8 +56,10 @@
 #include <libxfdashboard/x11/window-tracker-x11.h>
 #include <libxfdashboard/window-tracker.h>
 #include <libxfdashboard/core.h>
+#include <libxfdashboard/application-database.h>
 #include <libxfdashboard/desktop-app-info.h>
 #include <libxfdashboard/marshal.h>
+#include <libxfdashboard/statistics.h>
 #include <libxfdashboard/compat.h>
 #include <libxfdashboard/debug.h>
 
@@ -81,6 +83,14 @@ struct _XfdashboardWindowTrackerWindowX11Private
 	gint									lastGeometryHeight;
 
 	ClutterContent							*content;
+
+	GAppInfo								*appInfo;
+	gboolean								appInfoResolved;
+	gulong									appInfoChangedID;
+	gulong									xWindowID;
+	XfdashboardApplicationDatabase			*appDatabase;
+	gulong									appDatabaseAddedID;
+	gulong									appDatabaseRemovedID;
 };
 
 G_DEFINE_TYPE_WITH_CODE(XfdashboardWindowTrackerWindowX11,
@@ -107,6 +117,10 @@ static GParamSpec* XfdashboardWindowTrackerWindowX11Properties[PROP_LAST]={ 0, }
 
 
 /* IMPLEMENTATION: Private variables and methods */
+static Display*		_xfdashboard_window_tracker_window_x11_atoms_display=NULL;
+static Atom			_xfdashboard_window_tracker_window_x11_atoms[2]={ None, None };
+static GHashTable*	_xfdashboard_window_tracker_window_x11_by_xid=NULL;
+
 #define XFDASHBOARD_WINDOW_TRACKER_WINDOW_X11_WARN_NO_WINDOW(self)             \
 	g_critical("No wnck window wrapped at %s in called function %s",           \
 				G_OBJECT_TYPE_NAME(self),                                      \
@@ -126,7 +140,6 @@ static GAppInfo*  _xfdashboard_window_tracker_window_x11_window_tracker_window_r
 	gchar										*iterName;
 	gchar										*iterNameLowerCase;
 	XfdashboardApplicationDatabase				*appDatabase;
-	GList										*apps;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_WINDOW_X11(self), NULL);
 	g_return_val_if_fail(inName && *inName, NULL);
@@ -135,9 +148,8 @@ static GAppInfo*  _xfdashboard_window_tracker_window_x11_window_tracker_window_r
 	priv=self->priv;
 	appInfo=NULL;
 
-	/* Get list of applications */
+	/* Get application database */
 	appDatabase=xfdashboard_core_get_application_database(NULL);
-	apps=xfdashboard_application_database_get_all_applications(appDatabase);
 
 	/* Build desktop ID from name */
 	if(!g_str_has_suffix(inName, ".desktop")) iterName=g_strconcat(inName, ".desktop", NULL);
@@ -148,82 +160,53 @@ static GAppInfo*  _xfdashboard_window_tracker_window_x11_window_tracker_window_r
 	/* Lookup application from unmodified name */
 	appInfo=xfdashboard_application_database_lookup_desktop_id(appDatabase, iterName);
 
-	/* Lookup application from to-lower-case converted name if previous
+	/* Lookup application from name but compare case-insensitive if previous
 	 * lookup with unmodified name failed.
 	 */
 	if(!appInfo)
 	{
-		/* Lookup application from lower-case name */
-		appInfo=xfdashboard_application_database_lookup_desktop_id(appDatabase, iterNameLowerCase);
+		appInfo=xfdashboard_application_database_lookup_desktop_id_nocase(appDatabase, iterName);
 	}
 
 	/* If no application was found for the name it may be an application
 	 * located in a subdirectory. Then the desktop ID is prefixed with
-	 * the subdirectory's name followed by a dash. So iterate through all
-	 * applications and lookup with glob pattern '*-' followed by name
-	 * and suffix '.desktop'.
+	 * the subdirectory's name followed by a dash. So lookup all applications
+	 * whose desktop ID ends with a dash followed by the name and suffix
+	 * '.desktop'.
 	 */
 	if(!appInfo)
 	{
-		GList									*iterApps;
 		GList									*foundSubdirApps;
-		gchar									*globName;
-		GPatternSpec							*globPattern;
-		GAppInfo								*globAppInfo;
 
-		/* Build glob pattern */
-		globAppInfo=NULL;
-		globName=g_strconcat("*-", iterNameLowerCase, NULL);
-		globPattern=g_pattern_spec_new(globName);
-
-		/* Iterate through application and collect applications matching
-		 * glob pattern.
-		 */
-		foundSubdirApps=NULL;
-		for(iterApps=apps; iterApps; iterApps=g_list_next(iterApps))
-		{
-			if(!G_IS_APP_INFO(iterApps->data)) continue;
-			globAppInfo=G_APP_INFO(iterApps->data);
-
-#if GLIB_CHECK_VERSION(2,70,0)
-			if(g_pattern_spec_match_string(globPattern, g_app_info_get_id(globAppInfo)))
-#else
-			if(g_pattern_match_string(globPattern, g_app_info_get_id(globAppInfo)))
-#endif
-			{
-				foundSubdirApps=g_list_prepend(foundSubdirApps, globAppInfo);
-				XFDASHBOARD_DEBUG(self, APPLICATIONS,
-									"Found possible application '%s' for window '%s' using pattern '%s'",
-									g_app_info_get_id(globAppInfo),
-									wnck_window_get_name(priv->window),
-									globName);
-			}
-		}
+		foundSubdirApps=xfdashboard_application_database_lookup_desktop_id_suffix(appDatabase, iterNameLowerCase);
 
-		/* If exactly one application was collected because it matched
-		 * the glob pattern then we found the application.
-		 */
+		/* If exactly one application was found then we found the application */
 		if(g_list_length(foundSubdirApps)==1)
 		{
 			appInfo=G_APP_INFO(g_object_ref(G_OBJECT(foundSubdirApps->data)));
 
 			XFDASHBOARD_DEBUG(self, APPLICATIONS,
-								"Found exactly one application named '%s' for window '%s' using pattern '%s'",
+								"Found exactly one application named '%s' for window '%s' using suffix '-%s'",
 								g_app_info_get_id(appInfo),
 								wnck_window_get_name(priv->window),
-								globName);
+								iterNameLowerCase);
 		}
+			else if(foundSubdirApps)
+			{
+				XFDASHBOARD_DEBUG(self, APPLICATIONS,
+									"Found %u possible applications for window '%s' using suffix '-%s'",
+									g_list_length(foundSubdirApps),
+									wnck_window_get_name(priv->window),
+									iterNameLowerCase);
+			}
 
 		/* Release allocated resources */
-		if(foundSubdirApps) g_list_free(foundSubdirApps);
-		if(globPattern) g_pattern_spec_free(globPattern);
-		if(globName) g_free(globName);
+		if(foundSubdirApps) g_list_free_full(foundSubdirApps, g_object_unref);
 	}
 
 	/* Release allocated resources */
 	if(iterName) g_free(iterName);
 	if(iterNameLowerCase) g_free(iterNameLowerCase);
-	if(apps) g_list_free_full(apps, g_object_unref);
 	if(appDatabase) g_object_unref(appDatabase);
 
 	/* Return found AppInfo */
@@ -236,8 +219,7 @@ static GAppInfo* _xfdashboard_window_tracker_window_x11_window_tracker_window_re
 	XfdashboardWindowTrackerWindowX11Private	*priv;
 	GAppInfo									*appInfo;
 	XfdashboardApplicationDatabase				*appDatabase;
-	GList										*apps;
-	GList										*iter;
+	const gchar									*value;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_WINDOW_X11(self), NULL);
 	g_return_val_if_fail(self->priv->window, NULL);
@@ -245,50 +227,25 @@ static GAppInfo* _xfdashboard_window_tracker_window_x11_window_tracker_window_re
 	priv=self->priv;
 	appInfo=NULL;
 
-	/* Get list of applications */
+	/* Get application database */
 	appDatabase=xfdashboard_core_get_application_database(NULL);
-	apps=xfdashboard_application_database_get_all_applications(appDatabase);
 
-	/* Iterate through application and lookup start-up WM class */
-	for(iter=apps; iter && !appInfo; iter=g_list_next(iter))
+	/* Lookup start-up WM class from class group name and then
+	 * from class instance name of window.
+	 */
+	value=wnck_window_get_class_group_name(priv->window);
+	if(!appInfo && value && *value)
 	{
-		XfdashboardDesktopAppInfo				*iterAppInfo;
-		gchar									*appInfoStartupWM;
-		const gchar								*value;
-
-		/* Skip AppInfo which are not of type XfdashboardDesktopAppInfo */
-		if(!XFDASHBOARD_IS_DESKTOP_APP_INFO(iter->data)) continue;
-
-		iterAppInfo=XFDASHBOARD_DESKTOP_APP_INFO(iter->data);
-
-		/* If AppInfo has no entry for start-up WM class then skip it */
-		if(!xfdashboard_desktop_app_info_has_key(iterAppInfo, G_KEY_FILE_DESKTOP_KEY_STARTUP_WM_CLASS)) continue;
-
-		/* Check if start-up WM class of AppInfo matches */
-		appInfoStartupWM=xfdashboard_desktop_app_info_get_string(iterAppInfo, G_KEY_FILE_DESKTOP_KEY_STARTUP_WM_CLASS);
-
-		value=wnck_window_get_class_group_name(priv->window);
-		if(!appInfo &&
-			value &&
-			g_strcmp0(appInfoStartupWM, value)==0)
-		{
-			appInfo=G_APP_INFO(g_object_ref(iterAppInfo));
-		}
-
-		value=wnck_window_get_class_instance_name(priv->window);
-		if(!appInfo &&
-			value &&
-			g_strcmp0(appInfoStartupWM, value)==0)
-		{
-			appInfo=G_APP_INFO(g_object_ref(iterAppInfo));
-		}
+		appInfo=xfdashboard_application_database_lookup_startup_wm_class(appDatabase, value);
+	}
 
-		/* Release allocated resources */
-		if(appInfoStartupWM) g_free(appInfoStartupWM);
+	value=wnck_window_get_class_instance_name(priv->window);
+	if(!appInfo && value && *value)
+	{
+		appInfo=xfdashboard_application_database_lookup_startup_wm_class(appDatabase, value);
 	}
 
 	/* Release allocated resources */
-	if(apps) g_list_free_full(apps, g_object_unref);
 	if(appDatabase) g_object_unref(appDatabase);
 
 	/* Return found AppInfo */
@@ -301,8 +258,6 @@ static GAppInfo* _xfdashboard_window_tracker_window_x11_window_tracker_window_re
 	XfdashboardWindowTrackerWindowX11Private	*priv;
 	GAppInfo									*appInfo;
 	XfdashboardApplicationDatabase				*appDatabase;
-	GList										*apps;
-	GList										*iter;
 	gchar										*windowExecutable;
 #if defined(__linux__)
 	int											windowPID;
@@ -366,68 +321,11 @@ static GAppInfo* _xfdashboard_window_tracker_window_x11_window_tracker_window_re
 	 */
 	if(!windowExecutable) return(NULL);
 
-	/* Get list of applications */
+	/* Lookup application by executable */
 	appDatabase=xfdashboard_core_get_application_database(NULL);
-	apps=xfdashboard_application_database_get_all_applications(appDatabase);
-
-	/* Iterate through application and lookup start-up WM class */
-	for(iter=apps; iter && !appInfo; iter=g_list_next(iter))
-	{
-		XfdashboardDesktopAppInfo				*iterAppInfo;
-		const gchar								*iterExecutable;
-		gboolean								executableMatches;
-
-		/* Skip AppInfo which are not of type XfdashboardDesktopAppInfo */
-		if(!XFDASHBOARD_IS_DESKTOP_APP_INFO(iter->data)) continue;
-
-		iterAppInfo=XFDASHBOARD_DESKTOP_APP_INFO(iter->data);
-
-		/* If AppInfo has no entry for binary executable then skip it.
-		 * But this should never happen.
-		 */
-		iterExecutable=g_app_info_get_executable(G_APP_INFO(iterAppInfo));
-		if(G_UNLIKELY(!iterExecutable)) continue;
-
-		/* Check if executable of AppInfo matches the executable of process
-		 * running this window. If either AppInfo's executable or window's
-		 * executable is a relative path then check only their basenames as
-		 * we cannot determine if the process, which spawned the window's
-		 * executable, had the correct PATH enviroment set up to spawn the
-		 * process. So we have to assume it. If both executables are available
-		 * as absolute path then compre them entirely.
-		 */
-		if(!g_path_is_absolute(iterExecutable) ||
-			!g_path_is_absolute(windowExecutable))
-		{
-			gchar								*iterExecutableBasename;
-			gchar								*windowExecutableBasename;
-
-			/* Get basename of both executables */
-			iterExecutableBasename=g_path_get_basename(iterExecutable);
-			windowExecutableBasename=g_path_get_basename(windowExecutable);
-
-			/* Compare basename of both executables */
-			executableMatches=(g_strcmp0(iterExecutableBasename, windowExecutableBasename)==0 ? TRUE : FALSE);
-
-			/* Release allocated resources */
-			g_free(iterExecutableBasename);
-			g_free(windowExecutableBasename);
-		}
-			else
-			{
-				/* Both executable have absolute path so compare them entirely */
-				executableMatches=(g_strcmp0(iterExecutable, windowExecutable)==0 ? TRUE : FALSE);
-			}
-
-		/* If both executables matched then we found the AppInfo */
-		if(executableMatches)
-		{
-			appInfo=G_APP_INFO(g_object_ref(iterAppInfo));
-		}
-	}
+	appInfo=xfdashboard_application_database_lookup_executable(appDatabase, windowExecutable);
 
 	/* Release allocated resources */
-	if(apps) g_list_free_full(apps, g_object_unref);
 	if(appDatabase) g_object_unref(appDatabase);
 	if(windowExecutable) g_free(windowExecutable);
 
@@ -768,6 +666,138 @@ static void _xfdashboard_window_tracker_window_x11_on_wnck_geometry_changed(Xfda
 	g_signal_emit_by_name(self, "geometry-changed");
 }
 
+/* Forget resolved AppInfo for window, so it will be resolved again on next request */
+static void _xfdashboard_window_tracker_window_x11_reset_appinfo(XfdashboardWindowTrackerWindowX11 *self)
+{
+	XfdashboardWindowTrackerWindowX11Private	*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_WINDOW_X11(self));
+
+	priv=self->priv;
+
+	if(priv->appInfo)
+	{
+		if(priv->appInfoChangedID)
+		{
+			g_signal_handler_disconnect(priv->appInfo, priv->appInfoChangedID);
+			priv->appInfoChangedID=0;
+		}
+
+		g_object_unref(priv->appInfo);
+		priv->appInfo=NULL;
+	}
+
+	priv->appInfoResolved=FALSE;
+}
+
+/* Resolved AppInfo or application database changed, so forget resolved AppInfo */
+static void _xfdashboard_window_tracker_window_x11_on_appinfo_changed(XfdashboardWindowTrackerWindowX11 *self,
+																		gpointer inUserData)
+{
+	g_return_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_WINDOW_X11(self));
+
+	XFDASHBOARD_DEBUG(self, WINDOWS,
+						"Forget resolved application for window '%s' because applications changed",
+						self->priv->window ? wnck_window_get_name(self->priv->window) : "<nil>");
+
+	_xfdashboard_window_tracker_window_x11_reset_appinfo(self);
+}
+
+/* Class of mapped wnck window changed, so forget resolved AppInfo */
+static void _xfdashboard_window_tracker_window_x11_on_wnck_class_changed(XfdashboardWindowTrackerWindowX11 *self,
+																			gpointer inUserData)
+{
+	XfdashboardWindowTrackerWindowX11Private	*priv;
+	WnckWindow									*window;
+
+	g_return_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_WINDOW_X11(self));
+	g_return_if_fail(WNCK_IS_WINDOW(inUserData));
+
+	priv=self->priv;
+	window=WNCK_WINDOW(inUserData);
+
+	/* Check that window emitting this signal is the mapped window of this object */
+	if(priv->window!=window)
+	{
+		XFDASHBOARD_WINDOW_TRACKER_WINDOW_X11_WARN_WRONG_WINDOW(self);
+		return;
+	}
+
+	/* Forget resolved AppInfo */
+	_xfdashboard_window_tracker_window_x11_reset_appinfo(self);
+}
+
+/* Property "_GTK_APPLICATION_ID" of a X11 window changed, so forget resolved
+ * AppInfo of window object wrapping it. The property change events are
+ * received as libwnck selects them for all client windows already.
+ */
+static GdkFilterReturn _xfdashboard_window_tracker_window_x11_on_gdkx_event(GdkXEvent *inXEvent,
+																			GdkEvent *inEvent,
+																			gpointer inUserData)
+{
+	XEvent										*xEvent;
+	XfdashboardWindowTrackerWindowX11			*self;
+
+	xEvent=(XEvent*)inXEvent;
+
+	/* Only handle changes of property "_GTK_APPLICATION_ID". If its atom was
+	 * not interned yet, no AppInfo was resolved from it so far.
+	 */
+	if(xEvent->type!=PropertyNotify ||
+		xEvent->xproperty.display!=_xfdashboard_window_tracker_window_x11_atoms_display ||
+		xEvent->xproperty.atom!=_xfdashboard_window_tracker_window_x11_atoms[0])
+	{
+		return(GDK_FILTER_CONTINUE);
+	}
+
+	/* Forget resolved AppInfo of window object wrapping X11 window */
+	self=g_hash_table_lookup(_xfdashboard_window_tracker_window_x11_by_xid, GUINT_TO_POINTER(xEvent->xproperty.window));
+	if(self && self->priv->appInfoResolved)
+	{
+		XFDASHBOARD_DEBUG(self, WINDOWS,
+							"Forget resolved application for window '%s' because its application ID changed",
+							self->priv->window ? wnck_window_get_name(self->priv->window) : "<nil>");
+
+		_xfdashboard_window_tracker_window_x11_reset_appinfo(self);
+	}
+
+	return(GDK_FILTER_CONTINUE);
+}
+
+/* Set X11 window ID of wnck window mapped in this window object to receive
+ * property changes of X11 window.
+ */
+static void _xfdashboard_window_tracker_window_x11_set_xid(XfdashboardWindowTrackerWindowX11 *self,
+															gulong inXWindowID)
+{
+	XfdashboardWindowTrackerWindowX11Private	*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_WINDOW_X11(self));
+
+	priv=self->priv;
+
+	/* Remove previous X11 window ID */
+	if(priv->xWindowID && _xfdashboard_window_tracker_window_x11_by_xid)
+	{
+		if(g_hash_table_lookup(_xfdashboard_window_tracker_window_x11_by_xid, GUINT_TO_POINTER(priv->xWindowID))==self)
+		{
+			g_hash_table_remove(_xfdashboard_window_tracker_window_x11_by_xid, GUINT_TO_POINTER(priv->xWindowID));
+		}
+	}
+	priv->xWindowID=inXWindowID;
+
+	if(!priv->xWindowID) return;
+
+	/* Set up lookup table and event filter once which are shared by all instances */
+	if(G_UNLIKELY(!_xfdashboard_window_tracker_window_x11_by_xid))
+	{
+		_xfdashboard_window_tracker_window_x11_by_xid=g_hash_table_new(g_direct_hash, g_direct_equal);
+		gdk_window_add_filter(NULL, _xfdashboard_window_tracker_window_x11_on_gdkx_event, NULL);
+	}
+
+	g_hash_table_insert(_xfdashboard_window_tracker_window_x11_by_xid, GUINT_TO_POINTER(priv->xWindowID), self);
+}
+
 /* Set wnck window to map in this window object */
 static void _xfdashboard_window_tracker_window_x11_set_window(XfdashboardWindowTrackerWindowX11 *self,
 																WnckWindow *inWindow)
@@ -811,9 +841,11 @@ static void _xfdashboard_window_tracker_window_x11_set_window(XfdashboardWindowT
 		priv->state=0;
 		priv->actions=0;
 		priv->workspace=NULL;
+		_xfdashboard_window_tracker_window_x11_reset_appinfo(self);
 
 		/* Set new value */
 		priv->window=inWindow;
+		_xfdashboard_window_tracker_window_x11_set_xid(self, priv->window ? wnck_window_get_xid(priv->window) : 0);
 
 		/* Initialize states and connect signals if window is set */
 		if(priv->window)
@@ -856,6 +888,10 @@ static void _xfdashboard_window_tracker_window_x11_set_window(XfdashboardWindowT
 										"geometry-changed",
 										G_CALLBACK(_xfdashboard_window_tracker_window_x11_on_wnck_geometry_changed),
 										self);
+			g_signal_connect_swapped(priv->window,
+										"class-changed",
+										G_CALLBACK(_xfdashboard_window_tracker_window_x11_on_wnck_class_changed),
+										self);
 		}
 
 		/* Notify about property change */
@@ -1484,27 +1520,21 @@ static gint _xfdashboard_window_tracker_window_x11_window_tracker_window_get_pid
 	return(wnck_window_get_pid(priv->window));
 }
 
-/* Try to determine AppInfo for window */
-static GAppInfo* _xfdashboard_window_tracker_window_x11_window_tracker_window_get_appinfo(XfdashboardWindowTrackerWindow *inWindow)
+/* Try to determine AppInfo for window.
+ * Callee is responsible to free result with g_object_unref().
+ */
+static GAppInfo* _xfdashboard_window_tracker_window_x11_resolve_appinfo(XfdashboardWindowTrackerWindowX11 *self)
 {
-	XfdashboardWindowTrackerWindowX11			*self;
 	XfdashboardWindowTrackerWindowX11Private	*priv;
 	GAppInfo									*appInfo;
 	const gchar									*value;
 
-	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_WINDOW_X11(inWindow), NULL);
+	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_WINDOW_X11(self), NULL);
+	g_return_val_if_fail(self->priv->window, NULL);
 
-	self=XFDASHBOARD_WINDOW_TRACKER_WINDOW_X11(inWindow);
 	priv=self->priv;
 	appInfo=NULL;
 
-	/* A wnck window must be wrapped by this object */
-	if(!priv->window)
-	{
-		XFDASHBOARD_WINDOW_TRACKER_WINDOW_X11_WARN_NO_WINDOW(self);
-		return(NULL);
-	}
-
 	/* If window property "_GTK_APPLICATION_ID" is available at X11 window,
 	 * then read in the value of this property and try to lookup AppInfo
 	 * from this value.
@@ -1527,9 +1557,18 @@ static GAppInfo* _xfdashboard_window_tracker_window_x11_window_tracker_window_ge
 		screen=gdk_screen_get_default();
 		display=GDK_DISPLAY_XDISPLAY(gdk_screen_get_display(screen));
 
-		/* Get X11 atoms needed for query */
-		atomGtkAppID=XInternAtom(display, "_GTK_APPLICATION_ID", False);
-		atomUTF8String=XInternAtom(display, "UTF8_STRING", False);
+		/* Get X11 atoms needed for query but intern them only once
+		 * in one request.
+		 */
+		if(G_UNLIKELY(_xfdashboard_window_tracker_window_x11_atoms_display!=display))
+		{
+			static char							*atomNames[]={ "_GTK_APPLICATION_ID", "UTF8_STRING" };
+
+			XInternAtoms(display, atomNames, G_N_ELEMENTS(atomNames), False, _xfdashboard_window_tracker_window_x11_atoms);
+			_xfdashboard_window_tracker_window_x11_atoms_display=display;
+		}
+		atomGtkAppID=_xfdashboard_window_tracker_window_x11_atoms[0];
+		atomUTF8String=_xfdashboard_window_tracker_window_x11_atoms[1];
 
 		/* Query window property "_GTK_APPLICATION_ID" from X11 window */
 		XGetWindowProperty(display,
@@ -1590,6 +1629,68 @@ static GAppInfo* _xfdashboard_window_tracker_window_x11_window_tracker_window_ge
 	return(appInfo);
 }
 
+/* Get AppInfo for window. The AppInfo is resolved once and remembered until
+ * the class of window or the application database changes.
+ */
+static GAppInfo* _xfdashboard_window_tracker_window_x11_window_tracker_window_get_appinfo(XfdashboardWindowTrackerWindow *inWindow)
+{
+	XfdashboardWindowTrackerWindowX11			*self;
+	XfdashboardWindowTrackerWindowX11Private	*priv;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_WINDOW_X11(inWindow), NULL);
+
+	self=XFDASHBOARD_WINDOW_TRACKER_WINDOW_X11(inWindow);
+	priv=self->priv;
+
+	/* A wnck window must be wrapped by this object */
+	if(!priv->window)
+	{
+		XFDASHBOARD_WINDOW_TRACKER_WINDOW_X11_WARN_NO_WINDOW(self);
+		return(NULL);
+	}
+
+	/* Resolve AppInfo if not done yet */
+	if(!priv->appInfoResolved)
+	{
+		/* Get notified when applications are added or removed at
+		 * application database which may change the resolved AppInfo.
+		 */
+		if(!priv->appDatabase)
+		{
+			priv->appDatabase=xfdashboard_core_get_application_database(NULL);
+			priv->appDatabaseAddedID=g_signal_connect_swapped(priv->appDatabase,
+																"application-added",
+																G_CALLBACK(_xfdashboard_window_tracker_window_x11_on_appinfo_changed),
+																self);
+			priv->appDatabaseRemovedID=g_signal_connect_swapped(priv->appDatabase,
+																"application-removed",
+																G_CALLBACK(_xfdashboard_window_tracker_window_x11_on_appinfo_changed),
+																self);
+		}
+
+		/* Resolve AppInfo and get notified if it changes, e.g. its desktop
+		 * file was modified.
+		 */
+		priv->appInfo=_xfdashboard_window_tracker_window_x11_resolve_appinfo(self);
+		priv->appInfoResolved=TRUE;
+		xfdashboard_statistics_add("window.appinfo-cache-miss", 1);
+
+		if(priv->appInfo &&
+			XFDASHBOARD_IS_DESKTOP_APP_INFO(priv->appInfo))
+		{
+			priv->appInfoChangedID=g_signal_connect_swapped(priv->appInfo,
+															"changed",
+															G_CALLBACK(_xfdashboard_window_tracker_window_x11_on_appinfo_changed),
+															self);
+		}
+	}
+		else xfdashboard_statistics_add("window.appinfo-cache-hit", 1);
+
+	/* Return resolved AppInfo with an extra reference taken */
+	if(priv->appInfo) return(G_APP_INFO(g_object_ref(priv->appInfo)));
+	return(NULL);
+}
+
 /* Get content for this window for use in actors.
  * Caller is responsible to remove reference with g_object_unref().
  */
@@ -1707,6 +1808,27 @@ static void _xfdashboard_window_tracker_window_x11_dispose(GObject *inObject)
 		priv->window=NULL;
 	}
 
+	_xfdashboard_window_tracker_window_x11_set_xid(self, 0);
+	_xfdashboard_window_tracker_window_x11_reset_appinfo(self);
+
+	if(priv->appDatabase)
+	{
+		if(priv->appDatabaseAddedID)
+		{
+			g_signal_handler_disconnect(priv->appDatabase, priv->appDatabaseAddedID);
+			priv->appDatabaseAddedID=0;
+		}
+
+		if(priv->appDatabaseRemovedID)
+		{
+			g_signal_handler_disconnect(priv->appDatabase, priv->appDatabaseRemovedID);
+			priv->appDatabaseRemovedID=0;
+		}
+
+		g_object_unref(priv->appDatabase);
+		priv->appDatabase=NULL;
+	}
+
 	/* Call parent's class dispose method */
 	G_OBJECT_CLASS(xfdashboard_window_tracker_window_x11_parent_class)->dispose(inObject);
 }
@@ -1802,6 +1924,13 @@ void xfdashboard_window_tracker_window_x11_init(XfdashboardWindowTrackerWindowX1
 	/* Set default values */
 	priv->window=NULL;
 	priv->content=NULL;
+	priv->appInfo=NULL;
+	priv->appInfoResolved=FALSE;
+	priv->appInfoChangedID=0;
+	priv->xWindowID=0;
+	priv->appDatabase=NULL;
+	priv->appDatabaseAddedID=0;
+	priv->appDatabaseRemovedID=0;
 }
 
 
@@ -33,6 +33,7 @@
 
 #include <common/xfconf-settings.h>
 #include <libxfdashboard/core.h>
+#include <libxfdashboard/profiler.h>
 #include <libxfdashboard/compat.h>
 #include <libxfdashboard/debug.h>
 
@@ -234,6 +235,7 @@ static XfdashboardSettings* _xfdashboard_application_create_settings(Xfdashboard
 	const gchar					*homeDirectory;
 	gchar						*configPath;
 	gchar						*dataPath;
+	gchar						*cachePath;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION(self), NULL);
 
@@ -339,6 +341,9 @@ static XfdashboardSettings* _xfdashboard_application_create_settings(Xfdashboard
 	/* Set up base path to data files */
 	dataPath=g_build_filename(g_get_user_data_dir(), "xfdashboard", NULL);
 
+	/* Set up base path to cache files */
+	cachePath=g_build_filename(g_get_user_cache_dir(), "xfdashboard", NULL);
+
 	/* Create settings instance for Xfconf settings storage */
 	settings=g_object_new(XFDASHBOARD_TYPE_XFCONF_SETTINGS,
 							"binding-files", bindingFilePaths,
@@ -346,9 +351,11 @@ static XfdashboardSettings* _xfdashboard_application_create_settings(Xfdashboard
 							"plugin-search-paths", pluginsSearchPaths,
 							"config-path", configPath,
 							"data-path", dataPath,
+							"cache-path", cachePath,
 							NULL);
 
 	/* Release allocated resources */
+	if(cachePath) g_free(cachePath);
 	if(dataPath) g_free(dataPath);
 	if(configPath) g_free(configPath);
 	if(themesSearchPaths) g_strfreev(themesSearchPaths);
@@ -472,6 +479,7 @@ static gint _xfdashboard_application_handle_command_line_arguments(XfdashboardAp
 	gboolean						optionRestart;
 	gboolean						optionToggle;
 	gchar							*optionSwitchToView;
+	gchar							*optionProfile;
 	gboolean						optionVersion;
 	GOptionEntry					entries[]=
 									{
@@ -480,6 +488,7 @@ static gint _xfdashboard_application_handle_command_line_arguments(XfdashboardAp
 										{ "restart", 'r', 0, G_OPTION_ARG_NONE, &optionRestart, N_("Restart running instance"), NULL },
 										{ "toggle", 't', 0, G_OPTION_ARG_NONE, &optionToggle, N_("Toggles visibility if running instance was started in daemon mode otherwise it quits running non-daemon instance"), NULL },
 										{ "view", 0, 0, G_OPTION_ARG_STRING, &optionSwitchToView, N_("The ID of view to switch to on startup or resume"), "ID" },
+										{ "profile", 0, 0, G_OPTION_ARG_FILENAME, &optionProfile, N_("Show frame timings and write trace to file on exit"), "FILE" },
 										{ "version", 'v', 0, G_OPTION_ARG_NONE, &optionVersion, N_("Show version"), NULL },
 										{ NULL }
 									};
@@ -495,6 +504,7 @@ static gint _xfdashboard_application_handle_command_line_arguments(XfdashboardAp
 	optionRestart=FALSE;
 	optionToggle=FALSE;
 	optionSwitchToView=NULL;
+	optionProfile=NULL;
 	optionVersion=FALSE;
 
 	/* Setup command-line options */
@@ -526,6 +536,7 @@ static gint _xfdashboard_application_handle_command_line_arguments(XfdashboardAp
 
 		/* Release allocated resources */
 		if(optionSwitchToView) g_free(optionSwitchToView);
+		if(optionProfile) g_free(optionProfile);
 		if(context) g_option_context_free(context);
 
 		return(XFDASHBOARD_APPLICATION_ERROR_FAILED);
@@ -550,6 +561,7 @@ static gint _xfdashboard_application_handle_command_line_arguments(XfdashboardAp
 
 		/* Release allocated resources */
 		if(optionSwitchToView) g_free(optionSwitchToView);
+		if(optionProfile) g_free(optionProfile);
 		if(context) g_option_context_free(context);
 
 		/* No errors so far and no errors will happen as we do not handle
@@ -583,6 +595,7 @@ static gint _xfdashboard_application_handle_command_line_arguments(XfdashboardAp
 
 		/* Release allocated resources */
 		if(optionSwitchToView) g_free(optionSwitchToView);
+		if(optionProfile) g_free(optionProfile);
 		if(context) g_option_context_free(context);
 
 		/* Return state to restart this applicationa */
@@ -603,6 +616,7 @@ static gint _xfdashboard_application_handle_command_line_arguments(XfdashboardAp
 
 		/* Release allocated resources */
 		if(optionSwitchToView) g_free(optionSwitchToView);
+		if(optionProfile) g_free(optionProfile);
 		if(context) g_option_context_free(context);
 
 		return(XFDASHBOARD_APPLICATION_ERROR_QUIT);
@@ -645,6 +659,7 @@ static gint _xfdashboard_application_handle_command_line_arguments(XfdashboardAp
 
 		/* Release allocated resources */
 		if(optionSwitchToView) g_free(optionSwitchToView);
+		if(optionProfile) g_free(optionProfile);
 		if(context) g_option_context_free(context);
 
 		/* Stop here because option was handled and application does not get initialized */
@@ -685,6 +700,15 @@ static gint _xfdashboard_application_handle_command_line_arguments(XfdashboardAp
 			g_object_notify_by_pspec(G_OBJECT(self), XfdashboardApplicationProperties[PROP_DAEMONIZED]);
 		}
 
+		/* Handle options: profile
+		 *
+		 * Enable profiler before the core is initialized to record timings
+		 * of start-up also. Clutter was already initialized in main() before
+		 * this application instance was run, as the profiler requires it.
+		 * The profiler can only be enabled on start-up.
+		 */
+		if(optionProfile) xfdashboard_profiler_enable(optionProfile);
+
 		/* Perform full initialization of this application instance */
 		result=_xfdashboard_application_initialize_full(self);
 		if(result==FALSE) return(XFDASHBOARD_APPLICATION_ERROR_FAILED);
@@ -753,6 +777,7 @@ static gint _xfdashboard_application_handle_command_line_arguments(XfdashboardAp
 
 	/* Release allocated resources */
 	if(optionSwitchToView) g_free(optionSwitchToView);
+	if(optionProfile) g_free(optionProfile);
 	if(context) g_option_context_free(context);
 
 	/* All done successfully so return status code 0 for success */